@@ -0,0 +1,1992 @@
+
+################################################################
+# This is a generated script based on design: design_1
+#
+# Though there are limitations about the generated script,
+# the main purpose of this utility is to make learning
+# IP Integrator Tcl commands easier.
+################################################################
+
+namespace eval _tcl {
+proc get_script_folder {} {
+   set script_path [file normalize [info script]]
+   set script_folder [file dirname $script_path]
+   return $script_folder
+}
+}
+variable script_folder
+set script_folder [_tcl::get_script_folder]
+
+################################################################
+# Check if script is running in correct Vivado version.
+################################################################
+set scripts_vivado_version 2024.1
+set current_vivado_version [version -short]
+
+if { [string first $scripts_vivado_version $current_vivado_version] == -1 } {
+   puts ""
+   if { [string compare $scripts_vivado_version $current_vivado_version] > 0 } {
+      catch {common::send_gid_msg -ssname BD::TCL -id 2042 -severity "ERROR" " This script was generated using Vivado <$scripts_vivado_version> and is being run in <$current_vivado_version> of Vivado. Sourcing the script failed since it was created with a future version of Vivado."}
+
+   } else {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2041 -severity "ERROR" "This script was generated using Vivado <$scripts_vivado_version> and is being run in <$current_vivado_version> of Vivado. Please run the script in Vivado <$scripts_vivado_version> then open the design in Vivado <$current_vivado_version>. Upgrade the design by running \"Tools => Report => Report IP Status...\", then run write_bd_tcl to create an updated script."}
+
+   }
+
+   return 1
+}
+
+################################################################
+# START
+################################################################
+
+# To test this script, run the following commands from Vivado Tcl console:
+# source design_1_script.tcl
+
+
+# The design that will be created by this Tcl script contains the following 
+# module references:
+# tx_header_inserter, tx_streamer, tx_local_dma, eth_pkt_gen, rdma_axilite_ctrl, tx_link_stripe, eth_tx_arb, rx_streamer, rx_header_parser, axis_rx_to_bram, rdma_axilite_rx_ctrl, rx_link_merge
+
+# Please add the sources of those modules before sourcing this Tcl script.
+
+# If there is no project opened, this script will create a
+# project, but make sure you do not have an existing project
+# <./myproj/project_1.xpr> in the current working folder.
+
+set list_projs [get_projects -quiet]
+if { $list_projs eq "" } {
+   create_project project_1 myproj -part xck26-sfvc784-2LV-c
+   set_property BOARD_PART xilinx.com:kr260_som_som240_2_connector_kr260_carrier_som240_2_connector_som240_1_connector_kr260_carrier_som240_1_connector:part0:1.1 [current_project]
+}
+
+
+# CHANGE DESIGN NAME HERE
+variable design_name
+set design_name design_1
+
+# If you do not already have an existing IP Integrator design open,
+# you can create a design using the following command:
+#    create_bd_design $design_name
+
+# Creating design if needed
+set errMsg ""
+set nRet 0
+
+set cur_design [current_bd_design -quiet]
+set list_cells [get_bd_cells -quiet]
+
+if { ${design_name} eq "" } {
+   # USE CASES:
+   #    1) Design_name not set
+
+   set errMsg "Please set the variable <design_name> to a non-empty value."
+   set nRet 1
+
+} elseif { ${cur_design} ne "" && ${list_cells} eq "" } {
+   # USE CASES:
+   #    2): Current design opened AND is empty AND names same.
+   #    3): Current design opened AND is empty AND names diff; design_name NOT in project.
+   #    4): Current design opened AND is empty AND names diff; design_name exists in project.
+
+   if { $cur_design ne $design_name } {
+      common::send_gid_msg -ssname BD::TCL -id 2001 -severity "INFO" "Changing value of <design_name> from <$design_name> to <$cur_design> since current design is empty."
+      set design_name [get_property NAME $cur_design]
+   }
+   common::send_gid_msg -ssname BD::TCL -id 2002 -severity "INFO" "Constructing design in IPI design <$cur_design>..."
+
+} elseif { ${cur_design} ne "" && $list_cells ne "" && $cur_design eq $design_name } {
+   # USE CASES:
+   #    5) Current design opened AND has components AND same names.
+
+   set errMsg "Design <$design_name> already exists in your project, please set the variable <design_name> to another value."
+   set nRet 1
+} elseif { [get_files -quiet ${design_name}.bd] ne "" } {
+   # USE CASES: 
+   #    6) Current opened design, has components, but diff names, design_name exists in project.
+   #    7) No opened design, design_name exists in project.
+
+   set errMsg "Design <$design_name> already exists in your project, please set the variable <design_name> to another value."
+   set nRet 2
+
+} else {
+   # USE CASES:
+   #    8) No opened design, design_name not in project.
+   #    9) Current opened design, has components, but diff names, design_name not in project.
+
+   common::send_gid_msg -ssname BD::TCL -id 2003 -severity "INFO" "Currently there is no design <$design_name> in project, so creating one..."
+
+   create_bd_design $design_name
+
+   common::send_gid_msg -ssname BD::TCL -id 2004 -severity "INFO" "Making design <$design_name> as current_bd_design."
+   current_bd_design $design_name
+
+}
+
+common::send_gid_msg -ssname BD::TCL -id 2005 -severity "INFO" "Currently the variable <design_name> is equal to \"$design_name\"."
+
+if { $nRet != 0 } {
+   catch {common::send_gid_msg -ssname BD::TCL -id 2006 -severity "ERROR" $errMsg}
+   return $nRet
+}
+
+set bCheckIPsPassed 1
+##################################################################
+# CHECK IPs
+##################################################################
+set bCheckIPs 1
+if { $bCheckIPs == 1 } {
+   set list_check_ips "\ 
+xilinx.com:ip:zynq_ultra_ps_e:3.5\
+xilinx.com:ip:proc_sys_reset:5.0\
+xilinx.com:ip:blk_mem_gen:8.4\
+xilinx.com:ip:axi_bram_ctrl:4.1\
+xilinx.com:ip:smartconnect:1.0\
+xilinx.com:user:data_mover_controller:1.0\
+xilinx.com:ip:axi_datamover:5.1\
+xilinx.com:ip:xlconstant:1.1\
+xilinx.com:ip:clk_wiz:6.0\
+xilinx.com:ip:axi_ethernet:7.2\
+xilinx.com:ip:xlconcat:2.1\
+xilinx.com:ip:axis_data_fifo:2.0\
+"
+
+   set list_ips_missing ""
+   common::send_gid_msg -ssname BD::TCL -id 2011 -severity "INFO" "Checking if the following IPs exist in the project's IP catalog: $list_check_ips ."
+
+   foreach ip_vlnv $list_check_ips {
+      set ip_obj [get_ipdefs -all $ip_vlnv]
+      if { $ip_obj eq "" } {
+         lappend list_ips_missing $ip_vlnv
+      }
+   }
+
+   if { $list_ips_missing ne "" } {
+      catch {common::send_gid_msg -ssname BD::TCL -id 2012 -severity "ERROR" "The following IPs are not found in the IP Catalog:\n  $list_ips_missing\n\nResolution: Please add the repository containing the IP(s) to the project." }
+      set bCheckIPsPassed 0
+   }
+
+}
+
+##################################################################
+# CHECK Modules
+##################################################################
+set bCheckModules 1
+if { $bCheckModules == 1 } {
+   set list_check_mods "\ 
+tx_header_inserter\
+tx_streamer\
+tx_local_dma\
+eth_pkt_gen\
+rdma_axilite_ctrl\
+tx_link_stripe\
+eth_tx_arb\
+rx_streamer\
+rx_header_parser\
+axis_rx_to_bram\
+rdma_axilite_rx_ctrl\
+rx_link_merge\
+"
+
+   set list_mods_missing ""
+   common::send_gid_msg -ssname BD::TCL -id 2020 -severity "INFO" "Checking if the following modules exist in the project's sources: $list_check_mods ."
+
+   foreach mod_vlnv $list_check_mods {
+      if { [can_resolve_reference $mod_vlnv] == 0 } {
+         lappend list_mods_missing $mod_vlnv
+      }
+   }
+
+   if { $list_mods_missing ne "" } {
+      catch {common::send_gid_msg -ssname BD::TCL -id 2021 -severity "ERROR" "The following module(s) are not found in the project: $list_mods_missing" }
+      common::send_gid_msg -ssname BD::TCL -id 2022 -severity "INFO" "Please add source files for the missing module(s) above."
+      set bCheckIPsPassed 0
+   }
+}
+
+if { $bCheckIPsPassed != 1 } {
+  common::send_gid_msg -ssname BD::TCL -id 2023 -severity "WARNING" "Will not continue with creation of design due to the error(s) above."
+  return 3
+}
+
+##################################################################
+# DESIGN PROCs
+##################################################################
+
+
+
+# Procedure to create entire design; Provide argument to make
+# procedure reusable. If parentCell is "", will use root.
+proc create_root_design { parentCell } {
+
+  variable script_folder
+  variable design_name
+
+  if { $parentCell eq "" } {
+     set parentCell [get_bd_cells /]
+  }
+
+  # Get object for parentCell
+  set parentObj [get_bd_cells $parentCell]
+  if { $parentObj == "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2090 -severity "ERROR" "Unable to find parent cell <$parentCell>!"}
+     return
+  }
+
+  # Make sure parentObj is hier blk
+  set parentType [get_property TYPE $parentObj]
+  if { $parentType ne "hier" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2091 -severity "ERROR" "Parent <$parentObj> has TYPE = <$parentType>. Expected to be <hier>."}
+     return
+  }
+
+  # Save current instance; Restore later
+  set oldCurInst [current_bd_instance .]
+
+  # Set parent object as current
+  current_bd_instance $parentObj
+
+
+  # Create interface ports
+  set som240_2_connector_pl_gem3_rgmii [ create_bd_intf_port -mode Master -vlnv xilinx.com:interface:rgmii_rtl:1.0 som240_2_connector_pl_gem3_rgmii ]
+
+  set som240_2_connector_pl_gem3_rgmii_mdio_mdc [ create_bd_intf_port -mode Master -vlnv xilinx.com:interface:mdio_rtl:1.0 som240_2_connector_pl_gem3_rgmii_mdio_mdc ]
+
+  set som240_1_connector_pl_gem2_rgmii [ create_bd_intf_port -mode Master -vlnv xilinx.com:interface:rgmii_rtl:1.0 som240_1_connector_pl_gem2_rgmii ]
+
+  set som240_1_connector_pl_gem2_rgmii_mdio_mdc [ create_bd_intf_port -mode Master -vlnv xilinx.com:interface:mdio_rtl:1.0 som240_1_connector_pl_gem2_rgmii_mdio_mdc ]
+
+
+  # Create ports
+  set som240_1_connector_hpa_clk0p_clk [ create_bd_port -dir I -type clk -freq_hz 25000000 som240_1_connector_hpa_clk0p_clk ]
+  set_property -dict [ list \
+   CONFIG.PHASE {0.0} \
+ ] $som240_1_connector_hpa_clk0p_clk
+  set som240_2_connector_pl_gem3_reset [ create_bd_port -dir O -from 0 -to 0 -type rst som240_2_connector_pl_gem3_reset ]
+  set som240_1_connector_pl_gem2_reset [ create_bd_port -dir O -from 0 -to 0 -type rst som240_1_connector_pl_gem2_reset ]
+
+  # Create instance: zynq_ultra_ps_e_0, and set properties
+  set zynq_ultra_ps_e_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:zynq_ultra_ps_e:3.5 zynq_ultra_ps_e_0 ]
+  set_property -dict [list \
+    CONFIG.CAN0_BOARD_INTERFACE {custom} \
+    CONFIG.CAN1_BOARD_INTERFACE {custom} \
+    CONFIG.CSU_BOARD_INTERFACE {custom} \
+    CONFIG.DP_BOARD_INTERFACE {custom} \
+    CONFIG.GEM0_BOARD_INTERFACE {custom} \
+    CONFIG.GEM1_BOARD_INTERFACE {custom} \
+    CONFIG.GEM2_BOARD_INTERFACE {custom} \
+    CONFIG.GEM3_BOARD_INTERFACE {custom} \
+    CONFIG.GPIO_BOARD_INTERFACE {custom} \
+    CONFIG.IIC0_BOARD_INTERFACE {custom} \
+    CONFIG.IIC1_BOARD_INTERFACE {custom} \
+    CONFIG.NAND_BOARD_INTERFACE {custom} \
+    CONFIG.PCIE_BOARD_INTERFACE {custom} \
+    CONFIG.PJTAG_BOARD_INTERFACE {custom} \
+    CONFIG.PMU_BOARD_INTERFACE {custom} \
+    CONFIG.PSU_BANK_0_IO_STANDARD {LVCMOS18} \
+    CONFIG.PSU_BANK_1_IO_STANDARD {LVCMOS18} \
+    CONFIG.PSU_BANK_2_IO_STANDARD {LVCMOS18} \
+    CONFIG.PSU_BANK_3_IO_STANDARD {LVCMOS18} \
+    CONFIG.PSU_DDR_RAM_HIGHADDR {0xFFFFFFFF} \
+    CONFIG.PSU_DDR_RAM_HIGHADDR_OFFSET {0x800000000} \
+    CONFIG.PSU_DDR_RAM_LOWADDR_OFFSET {0x80000000} \
+    CONFIG.PSU_IMPORT_BOARD_PRESET {} \
+    CONFIG.PSU_MIO_0_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_0_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_0_SLEW {slow} \
+    CONFIG.PSU_MIO_10_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_10_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_10_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_10_SLEW {slow} \
+    CONFIG.PSU_MIO_11_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_11_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_11_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_11_SLEW {slow} \
+    CONFIG.PSU_MIO_12_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_12_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_12_POLARITY {Default} \
+    CONFIG.PSU_MIO_12_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_12_SLEW {slow} \
+    CONFIG.PSU_MIO_13_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_13_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_13_POLARITY {Default} \
+    CONFIG.PSU_MIO_13_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_13_SLEW {slow} \
+    CONFIG.PSU_MIO_14_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_14_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_14_POLARITY {Default} \
+    CONFIG.PSU_MIO_14_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_14_SLEW {slow} \
+    CONFIG.PSU_MIO_15_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_15_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_15_POLARITY {Default} \
+    CONFIG.PSU_MIO_15_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_15_SLEW {slow} \
+    CONFIG.PSU_MIO_16_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_16_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_16_POLARITY {Default} \
+    CONFIG.PSU_MIO_16_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_16_SLEW {slow} \
+    CONFIG.PSU_MIO_17_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_17_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_17_POLARITY {Default} \
+    CONFIG.PSU_MIO_17_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_17_SLEW {slow} \
+    CONFIG.PSU_MIO_18_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_18_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_18_POLARITY {Default} \
+    CONFIG.PSU_MIO_18_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_18_SLEW {slow} \
+    CONFIG.PSU_MIO_19_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_19_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_19_POLARITY {Default} \
+    CONFIG.PSU_MIO_19_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_19_SLEW {slow} \
+    CONFIG.PSU_MIO_1_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_1_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_1_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_1_SLEW {slow} \
+    CONFIG.PSU_MIO_20_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_20_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_20_POLARITY {Default} \
+    CONFIG.PSU_MIO_20_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_20_SLEW {slow} \
+    CONFIG.PSU_MIO_21_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_21_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_21_POLARITY {Default} \
+    CONFIG.PSU_MIO_21_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_21_SLEW {slow} \
+    CONFIG.PSU_MIO_22_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_22_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_22_POLARITY {Default} \
+    CONFIG.PSU_MIO_22_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_22_SLEW {slow} \
+    CONFIG.PSU_MIO_23_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_23_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_23_POLARITY {Default} \
+    CONFIG.PSU_MIO_23_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_23_SLEW {slow} \
+    CONFIG.PSU_MIO_24_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_24_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_24_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_24_SLEW {slow} \
+    CONFIG.PSU_MIO_25_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_25_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_25_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_25_SLEW {slow} \
+    CONFIG.PSU_MIO_26_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_26_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_27_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_27_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_27_SLEW {slow} \
+    CONFIG.PSU_MIO_28_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_28_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_29_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_29_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_29_SLEW {slow} \
+    CONFIG.PSU_MIO_2_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_2_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_2_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_2_SLEW {slow} \
+    CONFIG.PSU_MIO_30_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_30_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_31_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_31_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_32_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_32_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_32_POLARITY {Default} \
+    CONFIG.PSU_MIO_32_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_32_SLEW {slow} \
+    CONFIG.PSU_MIO_33_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_33_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_33_POLARITY {Default} \
+    CONFIG.PSU_MIO_33_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_33_SLEW {slow} \
+    CONFIG.PSU_MIO_34_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_34_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_34_POLARITY {Default} \
+    CONFIG.PSU_MIO_34_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_34_SLEW {slow} \
+    CONFIG.PSU_MIO_35_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_35_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_35_SLEW {slow} \
+    CONFIG.PSU_MIO_36_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_36_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_36_SLEW {slow} \
+    CONFIG.PSU_MIO_37_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_37_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_38_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_38_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_38_SLEW {slow} \
+    CONFIG.PSU_MIO_39_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_39_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_39_SLEW {slow} \
+    CONFIG.PSU_MIO_3_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_3_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_3_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_3_SLEW {slow} \
+    CONFIG.PSU_MIO_40_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_40_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_40_SLEW {slow} \
+    CONFIG.PSU_MIO_41_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_41_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_41_SLEW {slow} \
+    CONFIG.PSU_MIO_42_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_42_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_42_SLEW {slow} \
+    CONFIG.PSU_MIO_43_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_43_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_43_SLEW {slow} \
+    CONFIG.PSU_MIO_44_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_44_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_45_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_45_PULLUPDOWN {disable} \
+    CONFIG.PSU_MIO_46_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_46_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_47_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_47_PULLUPDOWN {disable} \
+    CONFIG.PSU_MIO_48_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_48_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_49_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_49_PULLUPDOWN {disable} \
+    CONFIG.PSU_MIO_4_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_4_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_4_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_4_SLEW {slow} \
+    CONFIG.PSU_MIO_50_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_50_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_50_SLEW {slow} \
+    CONFIG.PSU_MIO_51_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_51_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_51_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_51_SLEW {slow} \
+    CONFIG.PSU_MIO_52_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_52_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_53_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_53_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_54_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_54_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_54_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_54_SLEW {slow} \
+    CONFIG.PSU_MIO_55_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_55_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_56_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_56_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_56_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_56_SLEW {slow} \
+    CONFIG.PSU_MIO_57_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_57_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_57_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_57_SLEW {slow} \
+    CONFIG.PSU_MIO_58_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_58_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_58_SLEW {slow} \
+    CONFIG.PSU_MIO_59_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_59_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_59_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_59_SLEW {slow} \
+    CONFIG.PSU_MIO_5_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_5_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_5_SLEW {slow} \
+    CONFIG.PSU_MIO_60_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_60_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_60_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_60_SLEW {slow} \
+    CONFIG.PSU_MIO_61_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_61_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_61_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_61_SLEW {slow} \
+    CONFIG.PSU_MIO_62_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_62_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_62_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_62_SLEW {slow} \
+    CONFIG.PSU_MIO_63_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_63_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_63_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_63_SLEW {slow} \
+    CONFIG.PSU_MIO_64_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_64_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_65_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_65_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_66_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_66_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_66_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_66_SLEW {slow} \
+    CONFIG.PSU_MIO_67_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_67_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_68_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_68_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_68_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_68_SLEW {slow} \
+    CONFIG.PSU_MIO_69_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_69_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_69_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_69_SLEW {slow} \
+    CONFIG.PSU_MIO_6_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_6_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_6_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_6_SLEW {slow} \
+    CONFIG.PSU_MIO_70_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_70_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_70_SLEW {slow} \
+    CONFIG.PSU_MIO_71_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_71_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_71_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_71_SLEW {slow} \
+    CONFIG.PSU_MIO_72_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_72_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_72_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_72_SLEW {slow} \
+    CONFIG.PSU_MIO_73_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_73_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_73_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_73_SLEW {slow} \
+    CONFIG.PSU_MIO_74_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_74_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_74_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_74_SLEW {slow} \
+    CONFIG.PSU_MIO_75_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_75_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_75_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_75_SLEW {slow} \
+    CONFIG.PSU_MIO_76_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_76_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_76_SLEW {slow} \
+    CONFIG.PSU_MIO_77_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_77_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_77_SLEW {slow} \
+    CONFIG.PSU_MIO_7_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_7_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_7_POLARITY {Default} \
+    CONFIG.PSU_MIO_7_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_7_SLEW {slow} \
+    CONFIG.PSU_MIO_8_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_8_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_8_POLARITY {Default} \
+    CONFIG.PSU_MIO_8_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_8_SLEW {slow} \
+    CONFIG.PSU_MIO_9_DRIVE_STRENGTH {4} \
+    CONFIG.PSU_MIO_9_INPUT_TYPE {cmos} \
+    CONFIG.PSU_MIO_9_PULLUPDOWN {pullup} \
+    CONFIG.PSU_MIO_9_SLEW {slow} \
+    CONFIG.PSU_MIO_TREE_PERIPHERALS {Quad SPI Flash#Quad SPI Flash#Quad SPI Flash#Quad SPI Flash#Quad SPI Flash#Quad SPI Flash#SPI 1#GPIO0 MIO#GPIO0 MIO#SPI 1#SPI 1#SPI 1#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0\
+MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#GPIO0 MIO#I2C 1#I2C 1#PMU GPI 0#DPAUX#DPAUX#DPAUX#DPAUX#PMU GPI 5#GPIO1 MIO#GPIO1 MIO#GPIO1 MIO#PMU GPO 3#UART 1#UART 1#Gem 1#Gem\
+1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#Gem 1#MDIO 1#MDIO 1#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 0#USB 1#USB 1#USB 1#USB 1#USB 1#USB 1#USB 1#USB 1#USB 1#USB\
+1#USB 1#USB 1#USB0 Reset#USB1 Reset} \
+    CONFIG.PSU_MIO_TREE_SIGNALS {sclk_out#miso_mo1#mo2#mo3#mosi_mi0#n_ss_out#sclk_out#gpio0[7]#gpio0[8]#n_ss_out[0]#miso#mosi#gpio0[12]#gpio0[13]#gpio0[14]#gpio0[15]#gpio0[16]#gpio0[17]#gpio0[18]#gpio0[19]#gpio0[20]#gpio0[21]#gpio0[22]#gpio0[23]#scl_out#sda_out#gpi[0]#dp_aux_data_out#dp_hot_plug_detect#dp_aux_data_oe#dp_aux_data_in#gpi[5]#gpio1[32]#gpio1[33]#gpio1[34]#gpo[3]#txd#rxd#rgmii_tx_clk#rgmii_txd[0]#rgmii_txd[1]#rgmii_txd[2]#rgmii_txd[3]#rgmii_tx_ctl#rgmii_rx_clk#rgmii_rxd[0]#rgmii_rxd[1]#rgmii_rxd[2]#rgmii_rxd[3]#rgmii_rx_ctl#gem1_mdc#gem1_mdio_out#ulpi_clk_in#ulpi_dir#ulpi_tx_data[2]#ulpi_nxt#ulpi_tx_data[0]#ulpi_tx_data[1]#ulpi_stp#ulpi_tx_data[3]#ulpi_tx_data[4]#ulpi_tx_data[5]#ulpi_tx_data[6]#ulpi_tx_data[7]#ulpi_clk_in#ulpi_dir#ulpi_tx_data[2]#ulpi_nxt#ulpi_tx_data[0]#ulpi_tx_data[1]#ulpi_stp#ulpi_tx_data[3]#ulpi_tx_data[4]#ulpi_tx_data[5]#ulpi_tx_data[6]#ulpi_tx_data[7]#reset#reset}\
+\
+    CONFIG.PSU_PERIPHERAL_BOARD_PRESET {} \
+    CONFIG.PSU_SD0_INTERNAL_BUS_WIDTH {8} \
+    CONFIG.PSU_SD1_INTERNAL_BUS_WIDTH {8} \
+    CONFIG.PSU_SMC_CYCLE_T0 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T1 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T2 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T3 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T4 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T5 {NA} \
+    CONFIG.PSU_SMC_CYCLE_T6 {NA} \
+    CONFIG.PSU_USB3__DUAL_CLOCK_ENABLE {1} \
+    CONFIG.PSU_VALUE_SILVERSION {3} \
+    CONFIG.PSU__ACPU0__POWER__ON {1} \
+    CONFIG.PSU__ACPU1__POWER__ON {1} \
+    CONFIG.PSU__ACPU2__POWER__ON {1} \
+    CONFIG.PSU__ACPU3__POWER__ON {1} \
+    CONFIG.PSU__ACTUAL__IP {1} \
+    CONFIG.PSU__ACT_DDR_FREQ_MHZ {1066.656006} \
+    CONFIG.PSU__AFI0_COHERENCY {0} \
+    CONFIG.PSU__AFI1_COHERENCY {0} \
+    CONFIG.PSU__AUX_REF_CLK__FREQMHZ {33.333} \
+    CONFIG.PSU__CAN0_LOOP_CAN1__ENABLE {0} \
+    CONFIG.PSU__CAN0__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__CAN1__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__ACPU_CTRL__ACT_FREQMHZ {1333.333008} \
+    CONFIG.PSU__CRF_APB__ACPU_CTRL__FREQMHZ {1333.333} \
+    CONFIG.PSU__CRF_APB__ACPU_CTRL__SRCSEL {APLL} \
+    CONFIG.PSU__CRF_APB__ACPU__FRAC_ENABLED {1} \
+    CONFIG.PSU__CRF_APB__AFI0_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI0_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI0_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI0_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI0_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__AFI1_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI1_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI1_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI1_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI1_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__AFI2_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI2_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI2_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI2_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI2_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__AFI3_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI3_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI3_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI3_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI3_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__AFI4_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI4_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI4_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI4_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI4_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__AFI5_REF_CTRL__ACT_FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI5_REF_CTRL__DIVISOR0 {2} \
+    CONFIG.PSU__CRF_APB__AFI5_REF_CTRL__FREQMHZ {667} \
+    CONFIG.PSU__CRF_APB__AFI5_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__AFI5_REF__ENABLE {0} \
+    CONFIG.PSU__CRF_APB__APLL_CTRL__FRACFREQ {1333.333} \
+    CONFIG.PSU__CRF_APB__APLL_CTRL__SRCSEL {PSS_REF_CLK} \
+    CONFIG.PSU__CRF_APB__APLL_FRAC_CFG__ENABLED {1} \
+    CONFIG.PSU__CRF_APB__APM_CTRL__ACT_FREQMHZ {1} \
+    CONFIG.PSU__CRF_APB__APM_CTRL__DIVISOR0 {1} \
+    CONFIG.PSU__CRF_APB__APM_CTRL__FREQMHZ {1} \
+    CONFIG.PSU__CRF_APB__DBG_FPD_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRF_APB__DBG_FPD_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__DBG_FPD_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRF_APB__DBG_TRACE_CTRL__ACT_FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__DBG_TRACE_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__DBG_TRACE_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRF_APB__DBG_TSTMP_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRF_APB__DBG_TSTMP_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__DBG_TSTMP_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRF_APB__DDR_CTRL__ACT_FREQMHZ {533.328003} \
+    CONFIG.PSU__CRF_APB__DDR_CTRL__FREQMHZ {1200} \
+    CONFIG.PSU__CRF_APB__DDR_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__DPDMA_REF_CTRL__ACT_FREQMHZ {444.444336} \
+    CONFIG.PSU__CRF_APB__DPDMA_REF_CTRL__FREQMHZ {600} \
+    CONFIG.PSU__CRF_APB__DPDMA_REF_CTRL__SRCSEL {APLL} \
+    CONFIG.PSU__CRF_APB__DPLL_CTRL__FRACFREQ {27.138} \
+    CONFIG.PSU__CRF_APB__DPLL_CTRL__SRCSEL {PSS_REF_CLK} \
+    CONFIG.PSU__CRF_APB__DP_AUDIO_REF_CTRL__ACT_FREQMHZ {24.242182} \
+    CONFIG.PSU__CRF_APB__DP_AUDIO_REF_CTRL__FREQMHZ {25} \
+    CONFIG.PSU__CRF_APB__DP_AUDIO_REF_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRF_APB__DP_AUDIO__FRAC_ENABLED {0} \
+    CONFIG.PSU__CRF_APB__DP_STC_REF_CTRL__ACT_FREQMHZ {26.666401} \
+    CONFIG.PSU__CRF_APB__DP_STC_REF_CTRL__FREQMHZ {27} \
+    CONFIG.PSU__CRF_APB__DP_STC_REF_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRF_APB__DP_VIDEO_REF_CTRL__ACT_FREQMHZ {299.997009} \
+    CONFIG.PSU__CRF_APB__DP_VIDEO_REF_CTRL__FREQMHZ {300} \
+    CONFIG.PSU__CRF_APB__DP_VIDEO_REF_CTRL__SRCSEL {VPLL} \
+    CONFIG.PSU__CRF_APB__DP_VIDEO__FRAC_ENABLED {0} \
+    CONFIG.PSU__CRF_APB__GDMA_REF_CTRL__ACT_FREQMHZ {533.328003} \
+    CONFIG.PSU__CRF_APB__GDMA_REF_CTRL__FREQMHZ {600} \
+    CONFIG.PSU__CRF_APB__GDMA_REF_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__GPU_REF_CTRL__ACT_FREQMHZ {499.994995} \
+    CONFIG.PSU__CRF_APB__GPU_REF_CTRL__FREQMHZ {600} \
+    CONFIG.PSU__CRF_APB__GPU_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRF_APB__GTGREF0_REF_CTRL__ACT_FREQMHZ {-1} \
+    CONFIG.PSU__CRF_APB__GTGREF0_REF_CTRL__DIVISOR0 {-1} \
+    CONFIG.PSU__CRF_APB__GTGREF0_REF_CTRL__FREQMHZ {-1} \
+    CONFIG.PSU__CRF_APB__GTGREF0_REF_CTRL__SRCSEL {NA} \
+    CONFIG.PSU__CRF_APB__GTGREF0__ENABLE {NA} \
+    CONFIG.PSU__CRF_APB__PCIE_REF_CTRL__ACT_FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__SATA_REF_CTRL__ACT_FREQMHZ {250} \
+    CONFIG.PSU__CRF_APB__TOPSW_LSBUS_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRF_APB__TOPSW_LSBUS_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRF_APB__TOPSW_LSBUS_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRF_APB__TOPSW_MAIN_CTRL__ACT_FREQMHZ {533.328003} \
+    CONFIG.PSU__CRF_APB__TOPSW_MAIN_CTRL__FREQMHZ {533.33} \
+    CONFIG.PSU__CRF_APB__TOPSW_MAIN_CTRL__SRCSEL {DPLL} \
+    CONFIG.PSU__CRF_APB__VPLL_CTRL__FRACFREQ {27.138} \
+    CONFIG.PSU__CRF_APB__VPLL_CTRL__SRCSEL {PSS_REF_CLK} \
+    CONFIG.PSU__CRL_APB__ADMA_REF_CTRL__ACT_FREQMHZ {499.994995} \
+    CONFIG.PSU__CRL_APB__ADMA_REF_CTRL__FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__ADMA_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__AFI6_REF_CTRL__ACT_FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__AFI6_REF_CTRL__FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__AFI6_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__AFI6__ENABLE {0} \
+    CONFIG.PSU__CRL_APB__AMS_REF_CTRL__ACT_FREQMHZ {49.999500} \
+    CONFIG.PSU__CRL_APB__AMS_REF_CTRL__FREQMHZ {50} \
+    CONFIG.PSU__CRL_APB__AMS_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__CAN0_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__CAN0_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__CAN0_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__CAN1_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__CAN1_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__CAN1_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__CPU_R5_CTRL__ACT_FREQMHZ {533.328003} \
+    CONFIG.PSU__CRL_APB__CPU_R5_CTRL__FREQMHZ {533.333} \
+    CONFIG.PSU__CRL_APB__CPU_R5_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRL_APB__CSU_PLL_CTRL__ACT_FREQMHZ {180} \
+    CONFIG.PSU__CRL_APB__CSU_PLL_CTRL__DIVISOR0 {3} \
+    CONFIG.PSU__CRL_APB__CSU_PLL_CTRL__SRCSEL {SysOsc} \
+    CONFIG.PSU__CRL_APB__DBG_LPD_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRL_APB__DBG_LPD_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRL_APB__DBG_LPD_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__DEBUG_R5_ATCLK_CTRL__ACT_FREQMHZ {1000} \
+    CONFIG.PSU__CRL_APB__DEBUG_R5_ATCLK_CTRL__DIVISOR0 {6} \
+    CONFIG.PSU__CRL_APB__DEBUG_R5_ATCLK_CTRL__FREQMHZ {1000} \
+    CONFIG.PSU__CRL_APB__DEBUG_R5_ATCLK_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRL_APB__DLL_REF_CTRL__ACT_FREQMHZ {999.989990} \
+    CONFIG.PSU__CRL_APB__DLL_REF_CTRL__FREQMHZ {1500} \
+    CONFIG.PSU__CRL_APB__DLL_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__GEM0_REF_CTRL__ACT_FREQMHZ {124.998749} \
+    CONFIG.PSU__CRL_APB__GEM0_REF_CTRL__FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM0_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__GEM1_REF_CTRL__ACT_FREQMHZ {124.998749} \
+    CONFIG.PSU__CRL_APB__GEM1_REF_CTRL__FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM1_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__GEM2_REF_CTRL__ACT_FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM2_REF_CTRL__FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM2_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__GEM3_REF_CTRL__ACT_FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM3_REF_CTRL__FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__GEM3_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__GEM_TSU_REF_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRL_APB__GEM_TSU_REF_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRL_APB__GEM_TSU_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__I2C0_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__I2C0_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__I2C0_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__I2C1_REF_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__I2C1_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__I2C1_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__IOPLL_CTRL__FRACFREQ {27.138} \
+    CONFIG.PSU__CRL_APB__IOPLL_CTRL__SRCSEL {PSS_REF_CLK} \
+    CONFIG.PSU__CRL_APB__IOU_SWITCH_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRL_APB__IOU_SWITCH_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRL_APB__IOU_SWITCH_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__LPD_LSBUS_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__LPD_LSBUS_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__LPD_LSBUS_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__LPD_SWITCH_CTRL__ACT_FREQMHZ {499.994995} \
+    CONFIG.PSU__CRL_APB__LPD_SWITCH_CTRL__FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__LPD_SWITCH_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__NAND_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__NAND_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__NAND_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__OCM_MAIN_CTRL__ACT_FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__OCM_MAIN_CTRL__DIVISOR0 {3} \
+    CONFIG.PSU__CRL_APB__OCM_MAIN_CTRL__FREQMHZ {500} \
+    CONFIG.PSU__CRL_APB__OCM_MAIN_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__PCAP_CTRL__ACT_FREQMHZ {199.998001} \
+    CONFIG.PSU__CRL_APB__PCAP_CTRL__FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__PCAP_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__PL0_REF_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__PL0_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__PL0_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__PL1_REF_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__PL2_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__PL3_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__QSPI_REF_CTRL__ACT_FREQMHZ {124.998749} \
+    CONFIG.PSU__CRL_APB__QSPI_REF_CTRL__FREQMHZ {125} \
+    CONFIG.PSU__CRL_APB__QSPI_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__RPLL_CTRL__FRACFREQ {27.138} \
+    CONFIG.PSU__CRL_APB__RPLL_CTRL__SRCSEL {PSS_REF_CLK} \
+    CONFIG.PSU__CRL_APB__SDIO0_REF_CTRL__ACT_FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SDIO0_REF_CTRL__FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SDIO0_REF_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRL_APB__SDIO1_REF_CTRL__ACT_FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SDIO1_REF_CTRL__FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SDIO1_REF_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRL_APB__SPI0_REF_CTRL__ACT_FREQMHZ {214} \
+    CONFIG.PSU__CRL_APB__SPI0_REF_CTRL__FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SPI0_REF_CTRL__SRCSEL {RPLL} \
+    CONFIG.PSU__CRL_APB__SPI1_REF_CTRL__ACT_FREQMHZ {199.998001} \
+    CONFIG.PSU__CRL_APB__SPI1_REF_CTRL__FREQMHZ {200} \
+    CONFIG.PSU__CRL_APB__SPI1_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__TIMESTAMP_REF_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__TIMESTAMP_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__TIMESTAMP_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__UART0_REF_CTRL__ACT_FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__UART0_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__UART0_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__UART1_REF_CTRL__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__CRL_APB__UART1_REF_CTRL__FREQMHZ {100} \
+    CONFIG.PSU__CRL_APB__UART1_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__USB0_BUS_REF_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRL_APB__USB0_BUS_REF_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRL_APB__USB0_BUS_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__USB1_BUS_REF_CTRL__ACT_FREQMHZ {249.997498} \
+    CONFIG.PSU__CRL_APB__USB1_BUS_REF_CTRL__FREQMHZ {250} \
+    CONFIG.PSU__CRL_APB__USB1_BUS_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__USB3_DUAL_REF_CTRL__ACT_FREQMHZ {19.999800} \
+    CONFIG.PSU__CRL_APB__USB3_DUAL_REF_CTRL__FREQMHZ {20} \
+    CONFIG.PSU__CRL_APB__USB3_DUAL_REF_CTRL__SRCSEL {IOPLL} \
+    CONFIG.PSU__CRL_APB__USB3__ENABLE {1} \
+    CONFIG.PSU__CSUPMU__PERIPHERAL__VALID {1} \
+    CONFIG.PSU__CSU__CSU_TAMPER_0__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_10__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_11__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_12__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_1__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_2__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_3__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_4__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_5__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_6__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_7__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_8__ENABLE {0} \
+    CONFIG.PSU__CSU__CSU_TAMPER_9__ENABLE {0} \
+    CONFIG.PSU__CSU__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__DDRC__AL {0} \
+    CONFIG.PSU__DDRC__BG_ADDR_COUNT {1} \
+    CONFIG.PSU__DDRC__BRC_MAPPING {ROW_BANK_COL} \
+    CONFIG.PSU__DDRC__BUS_WIDTH {64 Bit} \
+    CONFIG.PSU__DDRC__CL {16} \
+    CONFIG.PSU__DDRC__CLOCK_STOP_EN {0} \
+    CONFIG.PSU__DDRC__COMPONENTS {Components} \
+    CONFIG.PSU__DDRC__CWL {14} \
+    CONFIG.PSU__DDRC__DDR4_ADDR_MAPPING {0} \
+    CONFIG.PSU__DDRC__DDR4_CAL_MODE_ENABLE {0} \
+    CONFIG.PSU__DDRC__DDR4_CRC_CONTROL {0} \
+    CONFIG.PSU__DDRC__DDR4_MAXPWR_SAVING_EN {0} \
+    CONFIG.PSU__DDRC__DDR4_T_REF_MODE {0} \
+    CONFIG.PSU__DDRC__DDR4_T_REF_RANGE {Normal (0-85)} \
+    CONFIG.PSU__DDRC__DEVICE_CAPACITY {8192 MBits} \
+    CONFIG.PSU__DDRC__DM_DBI {DM_NO_DBI} \
+    CONFIG.PSU__DDRC__DRAM_WIDTH {16 Bits} \
+    CONFIG.PSU__DDRC__ECC {Disabled} \
+    CONFIG.PSU__DDRC__ECC_SCRUB {0} \
+    CONFIG.PSU__DDRC__ENABLE {1} \
+    CONFIG.PSU__DDRC__ENABLE_2T_TIMING {0} \
+    CONFIG.PSU__DDRC__ENABLE_DP_SWITCH {0} \
+    CONFIG.PSU__DDRC__EN_2ND_CLK {0} \
+    CONFIG.PSU__DDRC__FGRM {1X} \
+    CONFIG.PSU__DDRC__FREQ_MHZ {1} \
+    CONFIG.PSU__DDRC__LPDDR3_DUALRANK_SDP {0} \
+    CONFIG.PSU__DDRC__LP_ASR {manual normal} \
+    CONFIG.PSU__DDRC__MEMORY_TYPE {DDR 4} \
+    CONFIG.PSU__DDRC__PARITY_ENABLE {0} \
+    CONFIG.PSU__DDRC__PER_BANK_REFRESH {0} \
+    CONFIG.PSU__DDRC__PHY_DBI_MODE {0} \
+    CONFIG.PSU__DDRC__PLL_BYPASS {0} \
+    CONFIG.PSU__DDRC__PWR_DOWN_EN {0} \
+    CONFIG.PSU__DDRC__RANK_ADDR_COUNT {0} \
+    CONFIG.PSU__DDRC__RD_DQS_CENTER {0} \
+    CONFIG.PSU__DDRC__ROW_ADDR_COUNT {16} \
+    CONFIG.PSU__DDRC__SELF_REF_ABORT {0} \
+    CONFIG.PSU__DDRC__SPEED_BIN {DDR4_2400R} \
+    CONFIG.PSU__DDRC__STATIC_RD_MODE {0} \
+    CONFIG.PSU__DDRC__TRAIN_DATA_EYE {1} \
+    CONFIG.PSU__DDRC__TRAIN_READ_GATE {1} \
+    CONFIG.PSU__DDRC__TRAIN_WRITE_LEVEL {1} \
+    CONFIG.PSU__DDRC__T_FAW {30.0} \
+    CONFIG.PSU__DDRC__T_RAS_MIN {33} \
+    CONFIG.PSU__DDRC__T_RC {47.06} \
+    CONFIG.PSU__DDRC__T_RCD {16} \
+    CONFIG.PSU__DDRC__T_RP {16} \
+    CONFIG.PSU__DDRC__VIDEO_BUFFER_SIZE {0} \
+    CONFIG.PSU__DDRC__VREF {1} \
+    CONFIG.PSU__DDR_HIGH_ADDRESS_GUI_ENABLE {1} \
+    CONFIG.PSU__DDR_QOS_ENABLE {0} \
+    CONFIG.PSU__DDR_QOS_HP0_RDQOS {} \
+    CONFIG.PSU__DDR_QOS_HP0_WRQOS {} \
+    CONFIG.PSU__DDR_QOS_HP1_RDQOS {} \
+    CONFIG.PSU__DDR_QOS_HP1_WRQOS {} \
+    CONFIG.PSU__DDR_QOS_HP2_RDQOS {} \
+    CONFIG.PSU__DDR_QOS_HP2_WRQOS {} \
+    CONFIG.PSU__DDR_QOS_HP3_RDQOS {} \
+    CONFIG.PSU__DDR_QOS_HP3_WRQOS {} \
+    CONFIG.PSU__DDR_SW_REFRESH_ENABLED {1} \
+    CONFIG.PSU__DDR__INTERFACE__FREQMHZ {600.000} \
+    CONFIG.PSU__DEVICE_TYPE {EV} \
+    CONFIG.PSU__DISPLAYPORT__LANE0__ENABLE {1} \
+    CONFIG.PSU__DISPLAYPORT__LANE0__IO {GT Lane1} \
+    CONFIG.PSU__DISPLAYPORT__LANE1__ENABLE {0} \
+    CONFIG.PSU__DISPLAYPORT__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__DLL__ISUSED {0} \
+    CONFIG.PSU__DPAUX__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__DPAUX__PERIPHERAL__IO {MIO 27 .. 30} \
+    CONFIG.PSU__DP__LANE_SEL {Single Lower} \
+    CONFIG.PSU__DP__REF_CLK_FREQ {27} \
+    CONFIG.PSU__DP__REF_CLK_SEL {Ref Clk1} \
+    CONFIG.PSU__ENABLE__DDR__REFRESH__SIGNALS {0} \
+    CONFIG.PSU__ENET0__FIFO__ENABLE {0} \
+    CONFIG.PSU__ENET0__GRP_MDIO__ENABLE {0} \
+    CONFIG.PSU__ENET0__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__ENET0__PERIPHERAL__IO {GT Lane0} \
+    CONFIG.PSU__ENET0__PTP__ENABLE {0} \
+    CONFIG.PSU__ENET0__TSU__ENABLE {0} \
+    CONFIG.PSU__ENET1__FIFO__ENABLE {0} \
+    CONFIG.PSU__ENET1__GRP_MDIO__ENABLE {1} \
+    CONFIG.PSU__ENET1__GRP_MDIO__IO {MIO 50 .. 51} \
+    CONFIG.PSU__ENET1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__ENET1__PERIPHERAL__IO {MIO 38 .. 49} \
+    CONFIG.PSU__ENET1__PTP__ENABLE {0} \
+    CONFIG.PSU__ENET1__TSU__ENABLE {0} \
+    CONFIG.PSU__ENET2__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__ENET3__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__EN_AXI_STATUS_PORTS {0} \
+    CONFIG.PSU__EN_EMIO_TRACE {0} \
+    CONFIG.PSU__EP__IP {0} \
+    CONFIG.PSU__EXPAND__CORESIGHT {0} \
+    CONFIG.PSU__EXPAND__FPD_SLAVES {0} \
+    CONFIG.PSU__EXPAND__GIC {0} \
+    CONFIG.PSU__EXPAND__LOWER_LPS_SLAVES {0} \
+    CONFIG.PSU__EXPAND__UPPER_LPS_SLAVES {0} \
+    CONFIG.PSU__FPD_SLCR__WDT1__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__FPGA_PL0_ENABLE {1} \
+    CONFIG.PSU__FPGA_PL1_ENABLE {0} \
+    CONFIG.PSU__FPGA_PL2_ENABLE {0} \
+    CONFIG.PSU__FPGA_PL3_ENABLE {0} \
+    CONFIG.PSU__FP__POWER__ON {1} \
+    CONFIG.PSU__FTM__CTI_IN_0 {0} \
+    CONFIG.PSU__FTM__CTI_IN_1 {0} \
+    CONFIG.PSU__FTM__CTI_IN_2 {0} \
+    CONFIG.PSU__FTM__CTI_IN_3 {0} \
+    CONFIG.PSU__FTM__CTI_OUT_0 {0} \
+    CONFIG.PSU__FTM__CTI_OUT_1 {0} \
+    CONFIG.PSU__FTM__CTI_OUT_2 {0} \
+    CONFIG.PSU__FTM__CTI_OUT_3 {0} \
+    CONFIG.PSU__FTM__GPI {0} \
+    CONFIG.PSU__FTM__GPO {0} \
+    CONFIG.PSU__GEM0_COHERENCY {0} \
+    CONFIG.PSU__GEM0_ROUTE_THROUGH_FPD {0} \
+    CONFIG.PSU__GEM0__REF_CLK_FREQ {125} \
+    CONFIG.PSU__GEM0__REF_CLK_SEL {Ref Clk0} \
+    CONFIG.PSU__GEM1_COHERENCY {0} \
+    CONFIG.PSU__GEM1_ROUTE_THROUGH_FPD {0} \
+    CONFIG.PSU__GEM__TSU__ENABLE {0} \
+    CONFIG.PSU__GEN_IPI_0__MASTER {APU} \
+    CONFIG.PSU__GEN_IPI_10__MASTER {NONE} \
+    CONFIG.PSU__GEN_IPI_1__MASTER {RPU0} \
+    CONFIG.PSU__GEN_IPI_2__MASTER {RPU1} \
+    CONFIG.PSU__GEN_IPI_3__MASTER {PMU} \
+    CONFIG.PSU__GEN_IPI_4__MASTER {PMU} \
+    CONFIG.PSU__GEN_IPI_5__MASTER {PMU} \
+    CONFIG.PSU__GEN_IPI_6__MASTER {PMU} \
+    CONFIG.PSU__GEN_IPI_7__MASTER {NONE} \
+    CONFIG.PSU__GEN_IPI_8__MASTER {NONE} \
+    CONFIG.PSU__GEN_IPI_9__MASTER {NONE} \
+    CONFIG.PSU__GPIO0_MIO__IO {MIO 0 .. 25} \
+    CONFIG.PSU__GPIO0_MIO__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__GPIO1_MIO__IO {MIO 26 .. 51} \
+    CONFIG.PSU__GPIO1_MIO__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__GPIO2_MIO__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__GPIO_EMIO_WIDTH {1} \
+    CONFIG.PSU__GPIO_EMIO__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__GPIO_EMIO__WIDTH {[94:0]} \
+    CONFIG.PSU__GPU_PP0__POWER__ON {1} \
+    CONFIG.PSU__GPU_PP1__POWER__ON {1} \
+    CONFIG.PSU__GT_REF_CLK__FREQMHZ {33.333} \
+    CONFIG.PSU__GT__LINK_SPEED {HBR} \
+    CONFIG.PSU__GT__PRE_EMPH_LVL_4 {0} \
+    CONFIG.PSU__GT__VLT_SWNG_LVL_4 {0} \
+    CONFIG.PSU__HPM0_FPD__NUM_READ_THREADS {4} \
+    CONFIG.PSU__HPM0_FPD__NUM_WRITE_THREADS {4} \
+    CONFIG.PSU__HPM0_LPD__NUM_READ_THREADS {4} \
+    CONFIG.PSU__HPM0_LPD__NUM_WRITE_THREADS {4} \
+    CONFIG.PSU__HPM1_FPD__NUM_READ_THREADS {4} \
+    CONFIG.PSU__HPM1_FPD__NUM_WRITE_THREADS {4} \
+    CONFIG.PSU__I2C0_LOOP_I2C1__ENABLE {0} \
+    CONFIG.PSU__I2C0__GRP_INT__ENABLE {0} \
+    CONFIG.PSU__I2C0__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__I2C1__GRP_INT__ENABLE {0} \
+    CONFIG.PSU__I2C1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__I2C1__PERIPHERAL__IO {MIO 24 .. 25} \
+    CONFIG.PSU__IOU_SLCR__IOU_TTC_APB_CLK__TTC0_SEL {APB} \
+    CONFIG.PSU__IOU_SLCR__IOU_TTC_APB_CLK__TTC1_SEL {APB} \
+    CONFIG.PSU__IOU_SLCR__IOU_TTC_APB_CLK__TTC2_SEL {APB} \
+    CONFIG.PSU__IOU_SLCR__IOU_TTC_APB_CLK__TTC3_SEL {APB} \
+    CONFIG.PSU__IOU_SLCR__TTC0__ACT_FREQMHZ {100.000000} \
+    CONFIG.PSU__IOU_SLCR__TTC1__ACT_FREQMHZ {100.000000} \
+    CONFIG.PSU__IOU_SLCR__TTC2__ACT_FREQMHZ {100.000000} \
+    CONFIG.PSU__IOU_SLCR__TTC3__ACT_FREQMHZ {100.000000} \
+    CONFIG.PSU__IOU_SLCR__WDT0__ACT_FREQMHZ {99.999001} \
+    CONFIG.PSU__IRQ_P2F_ADMA_CHAN__INT {0} \
+    CONFIG.PSU__IRQ_P2F_AIB_AXI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_AMS__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APM_FPD__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_COMM__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_CPUMNT__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_CTI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_EXTERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_IPI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_L2ERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_PMU__INT {0} \
+    CONFIG.PSU__IRQ_P2F_APU_REGS__INT {0} \
+    CONFIG.PSU__IRQ_P2F_ATB_LPD__INT {0} \
+    CONFIG.PSU__IRQ_P2F_CLKMON__INT {0} \
+    CONFIG.PSU__IRQ_P2F_CSUPMU_WDT__INT {0} \
+    CONFIG.PSU__IRQ_P2F_DDR_SS__INT {0} \
+    CONFIG.PSU__IRQ_P2F_DPDMA__INT {0} \
+    CONFIG.PSU__IRQ_P2F_DPORT__INT {0} \
+    CONFIG.PSU__IRQ_P2F_EFUSE__INT {0} \
+    CONFIG.PSU__IRQ_P2F_ENT0_WAKEUP__INT {0} \
+    CONFIG.PSU__IRQ_P2F_ENT0__INT {0} \
+    CONFIG.PSU__IRQ_P2F_ENT1_WAKEUP__INT {0} \
+    CONFIG.PSU__IRQ_P2F_ENT1__INT {0} \
+    CONFIG.PSU__IRQ_P2F_FPD_APB__INT {0} \
+    CONFIG.PSU__IRQ_P2F_FPD_ATB_ERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_FP_WDT__INT {0} \
+    CONFIG.PSU__IRQ_P2F_GDMA_CHAN__INT {0} \
+    CONFIG.PSU__IRQ_P2F_GPIO__INT {0} \
+    CONFIG.PSU__IRQ_P2F_GPU__INT {0} \
+    CONFIG.PSU__IRQ_P2F_I2C1__INT {0} \
+    CONFIG.PSU__IRQ_P2F_LPD_APB__INT {0} \
+    CONFIG.PSU__IRQ_P2F_LPD_APM__INT {0} \
+    CONFIG.PSU__IRQ_P2F_LP_WDT__INT {0} \
+    CONFIG.PSU__IRQ_P2F_OCM_ERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_PCIE_DMA__INT {0} \
+    CONFIG.PSU__IRQ_P2F_PCIE_LEGACY__INT {0} \
+    CONFIG.PSU__IRQ_P2F_PCIE_MSC__INT {0} \
+    CONFIG.PSU__IRQ_P2F_PCIE_MSI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_PL_IPI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_QSPI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_R5_CORE0_ECC_ERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_R5_CORE1_ECC_ERR__INT {0} \
+    CONFIG.PSU__IRQ_P2F_RPU_IPI__INT {0} \
+    CONFIG.PSU__IRQ_P2F_RPU_PERMON__INT {0} \
+    CONFIG.PSU__IRQ_P2F_RTC_ALARM__INT {0} \
+    CONFIG.PSU__IRQ_P2F_RTC_SECONDS__INT {0} \
+    CONFIG.PSU__IRQ_P2F_SATA__INT {0} \
+    CONFIG.PSU__IRQ_P2F_SPI1__INT {0} \
+    CONFIG.PSU__IRQ_P2F_TTC0__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC0__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC0__INT2 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC1__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC1__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC1__INT2 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC2__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC2__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC2__INT2 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC3__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC3__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_TTC3__INT2 {0} \
+    CONFIG.PSU__IRQ_P2F_UART1__INT {0} \
+    CONFIG.PSU__IRQ_P2F_USB3_ENDPOINT__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_USB3_ENDPOINT__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_USB3_OTG__INT0 {0} \
+    CONFIG.PSU__IRQ_P2F_USB3_OTG__INT1 {0} \
+    CONFIG.PSU__IRQ_P2F_USB3_PMU_WAKEUP__INT {0} \
+    CONFIG.PSU__IRQ_P2F_XMPU_FPD__INT {0} \
+    CONFIG.PSU__IRQ_P2F_XMPU_LPD__INT {0} \
+    CONFIG.PSU__IRQ_P2F__INTF_FPD_SMMU__INT {0} \
+    CONFIG.PSU__IRQ_P2F__INTF_PPD_CCI__INT {0} \
+    CONFIG.PSU__L2_BANK0__POWER__ON {1} \
+    CONFIG.PSU__LPDMA0_COHERENCY {0} \
+    CONFIG.PSU__LPDMA1_COHERENCY {0} \
+    CONFIG.PSU__LPDMA2_COHERENCY {0} \
+    CONFIG.PSU__LPDMA3_COHERENCY {0} \
+    CONFIG.PSU__LPDMA4_COHERENCY {0} \
+    CONFIG.PSU__LPDMA5_COHERENCY {0} \
+    CONFIG.PSU__LPDMA6_COHERENCY {0} \
+    CONFIG.PSU__LPDMA7_COHERENCY {0} \
+    CONFIG.PSU__LPD_SLCR__CSUPMU_WDT_CLK_SEL__SELECT {APB} \
+    CONFIG.PSU__LPD_SLCR__CSUPMU__ACT_FREQMHZ {100.000000} \
+    CONFIG.PSU__MAXIGP0__DATA_WIDTH {128} \
+    CONFIG.PSU__MAXIGP2__DATA_WIDTH {32} \
+    CONFIG.PSU__M_AXI_GP0_SUPPORTS_NARROW_BURST {1} \
+    CONFIG.PSU__M_AXI_GP1_SUPPORTS_NARROW_BURST {1} \
+    CONFIG.PSU__M_AXI_GP2_SUPPORTS_NARROW_BURST {1} \
+    CONFIG.PSU__NAND__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__NAND__READY_BUSY__ENABLE {0} \
+    CONFIG.PSU__NUM_FABRIC_RESETS {1} \
+    CONFIG.PSU__OCM_BANK0__POWER__ON {1} \
+    CONFIG.PSU__OCM_BANK1__POWER__ON {1} \
+    CONFIG.PSU__OCM_BANK2__POWER__ON {1} \
+    CONFIG.PSU__OCM_BANK3__POWER__ON {1} \
+    CONFIG.PSU__OVERRIDE_HPX_QOS {0} \
+    CONFIG.PSU__OVERRIDE__BASIC_CLOCK {0} \
+    CONFIG.PSU__PCIE__ACS_VIOLAION {0} \
+    CONFIG.PSU__PCIE__AER_CAPABILITY {0} \
+    CONFIG.PSU__PCIE__CLASS_CODE_BASE {} \
+    CONFIG.PSU__PCIE__CLASS_CODE_INTERFACE {} \
+    CONFIG.PSU__PCIE__CLASS_CODE_SUB {} \
+    CONFIG.PSU__PCIE__DEVICE_ID {} \
+    CONFIG.PSU__PCIE__INTX_GENERATION {0} \
+    CONFIG.PSU__PCIE__MSIX_CAPABILITY {0} \
+    CONFIG.PSU__PCIE__MSI_CAPABILITY {0} \
+    CONFIG.PSU__PCIE__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__PCIE__PERIPHERAL__ENDPOINT_ENABLE {1} \
+    CONFIG.PSU__PCIE__PERIPHERAL__ROOTPORT_ENABLE {0} \
+    CONFIG.PSU__PCIE__RESET__POLARITY {Active Low} \
+    CONFIG.PSU__PCIE__REVISION_ID {} \
+    CONFIG.PSU__PCIE__SUBSYSTEM_ID {} \
+    CONFIG.PSU__PCIE__SUBSYSTEM_VENDOR_ID {} \
+    CONFIG.PSU__PCIE__VENDOR_ID {} \
+    CONFIG.PSU__PJTAG__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__PL_CLK0_BUF {TRUE} \
+    CONFIG.PSU__PL__POWER__ON {1} \
+    CONFIG.PSU__PMU_COHERENCY {0} \
+    CONFIG.PSU__PMU__AIBACK__ENABLE {0} \
+    CONFIG.PSU__PMU__EMIO_GPI__ENABLE {0} \
+    CONFIG.PSU__PMU__EMIO_GPO__ENABLE {0} \
+    CONFIG.PSU__PMU__GPI0__ENABLE {1} \
+    CONFIG.PSU__PMU__GPI0__IO {MIO 26} \
+    CONFIG.PSU__PMU__GPI1__ENABLE {0} \
+    CONFIG.PSU__PMU__GPI2__ENABLE {0} \
+    CONFIG.PSU__PMU__GPI3__ENABLE {0} \
+    CONFIG.PSU__PMU__GPI4__ENABLE {0} \
+    CONFIG.PSU__PMU__GPI5__ENABLE {1} \
+    CONFIG.PSU__PMU__GPI5__IO {MIO 31} \
+    CONFIG.PSU__PMU__GPO0__ENABLE {0} \
+    CONFIG.PSU__PMU__GPO1__ENABLE {0} \
+    CONFIG.PSU__PMU__GPO2__ENABLE {0} \
+    CONFIG.PSU__PMU__GPO3__ENABLE {1} \
+    CONFIG.PSU__PMU__GPO3__IO {MIO 35} \
+    CONFIG.PSU__PMU__GPO3__POLARITY {low} \
+    CONFIG.PSU__PMU__GPO4__ENABLE {0} \
+    CONFIG.PSU__PMU__GPO5__ENABLE {0} \
+    CONFIG.PSU__PMU__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__PMU__PLERROR__ENABLE {0} \
+    CONFIG.PSU__PRESET_APPLIED {1} \
+    CONFIG.PSU__PROTECTION__DDR_SEGMENTS {NONE} \
+    CONFIG.PSU__PROTECTION__ENABLE {0} \
+    CONFIG.PSU__PROTECTION__FPD_SEGMENTS {SA:0xFD1A0000; SIZE:1280; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFD000000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write;\
+subsystemId:PMU Firmware| SA:0xFD010000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFD020000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU\
+Firmware| SA:0xFD030000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFD040000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware|\
+SA:0xFD050000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFD610000; SIZE:512; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFD5D0000;\
+SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware|SA:0xFD1A0000 ; SIZE:1280; UNIT:KB; RegionTZ:Secure ; WrAllowed:Read/Write; subsystemId:Secure Subsystem} \
+    CONFIG.PSU__PROTECTION__LPD_SEGMENTS {SA:0xFF980000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFF5E0000; SIZE:2560; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write;\
+subsystemId:PMU Firmware| SA:0xFFCC0000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFF180000; SIZE:768; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU\
+Firmware| SA:0xFF410000; SIZE:640; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware| SA:0xFFA70000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware|\
+SA:0xFF9A0000; SIZE:64; UNIT:KB; RegionTZ:Secure; WrAllowed:Read/Write; subsystemId:PMU Firmware|SA:0xFF5E0000 ; SIZE:2560; UNIT:KB; RegionTZ:Secure ; WrAllowed:Read/Write; subsystemId:Secure Subsystem|SA:0xFFCC0000\
+; SIZE:64; UNIT:KB; RegionTZ:Secure ; WrAllowed:Read/Write; subsystemId:Secure Subsystem|SA:0xFF180000 ; SIZE:768; UNIT:KB; RegionTZ:Secure ; WrAllowed:Read/Write; subsystemId:Secure Subsystem|SA:0xFF9A0000\
+; SIZE:64; UNIT:KB; RegionTZ:Secure ; WrAllowed:Read/Write; subsystemId:Secure Subsystem} \
+    CONFIG.PSU__PROTECTION__MASTERS {USB1:NonSecure;1|USB0:NonSecure;1|S_AXI_LPD:NA;0|S_AXI_HPC1_FPD:NA;1|S_AXI_HPC0_FPD:NA;1|S_AXI_HP3_FPD:NA;0|S_AXI_HP2_FPD:NA;0|S_AXI_HP1_FPD:NA;0|S_AXI_HP0_FPD:NA;0|S_AXI_ACP:NA;0|S_AXI_ACE:NA;0|SD1:NonSecure;0|SD0:NonSecure;0|SATA1:NonSecure;0|SATA0:NonSecure;0|RPU1:Secure;1|RPU0:Secure;1|QSPI:NonSecure;1|PMU:NA;1|PCIe:NonSecure;0|NAND:NonSecure;0|LDMA:NonSecure;1|GPU:NonSecure;1|GEM3:NonSecure;0|GEM2:NonSecure;0|GEM1:NonSecure;1|GEM0:NonSecure;1|FDMA:NonSecure;1|DP:NonSecure;1|DAP:NA;1|Coresight:NA;1|CSU:NA;1|APU:NA;1}\
+\
+    CONFIG.PSU__PROTECTION__MASTERS_TZ {GEM0:NonSecure|SD1:NonSecure|GEM2:NonSecure|GEM1:NonSecure|GEM3:NonSecure|PCIe:NonSecure|DP:NonSecure|NAND:NonSecure|GPU:NonSecure|USB1:NonSecure|USB0:NonSecure|LDMA:NonSecure|FDMA:NonSecure|QSPI:NonSecure|SD0:NonSecure}\
+\
+    CONFIG.PSU__PROTECTION__OCM_SEGMENTS {NONE} \
+    CONFIG.PSU__PROTECTION__PRESUBSYSTEMS {NONE} \
+    CONFIG.PSU__PROTECTION__SLAVES {LPD;USB3_1_XHCI;FE300000;FE3FFFFF;1|LPD;USB3_1;FF9E0000;FF9EFFFF;1|LPD;USB3_0_XHCI;FE200000;FE2FFFFF;1|LPD;USB3_0;FF9D0000;FF9DFFFF;1|LPD;UART1;FF010000;FF01FFFF;1|LPD;UART0;FF000000;FF00FFFF;0|LPD;TTC3;FF140000;FF14FFFF;1|LPD;TTC2;FF130000;FF13FFFF;1|LPD;TTC1;FF120000;FF12FFFF;1|LPD;TTC0;FF110000;FF11FFFF;1|FPD;SWDT1;FD4D0000;FD4DFFFF;1|LPD;SWDT0;FF150000;FF15FFFF;1|LPD;SPI1;FF050000;FF05FFFF;1|LPD;SPI0;FF040000;FF04FFFF;0|FPD;SMMU_REG;FD5F0000;FD5FFFFF;1|FPD;SMMU;FD800000;FDFFFFFF;1|FPD;SIOU;FD3D0000;FD3DFFFF;1|FPD;SERDES;FD400000;FD47FFFF;1|LPD;SD1;FF170000;FF17FFFF;0|LPD;SD0;FF160000;FF16FFFF;0|FPD;SATA;FD0C0000;FD0CFFFF;0|LPD;RTC;FFA60000;FFA6FFFF;1|LPD;RSA_CORE;FFCE0000;FFCEFFFF;1|LPD;RPU;FF9A0000;FF9AFFFF;1|LPD;R5_TCM_RAM_GLOBAL;FFE00000;FFE3FFFF;1|LPD;R5_1_Instruction_Cache;FFEC0000;FFECFFFF;1|LPD;R5_1_Data_Cache;FFED0000;FFEDFFFF;1|LPD;R5_1_BTCM_GLOBAL;FFEB0000;FFEBFFFF;1|LPD;R5_1_ATCM_GLOBAL;FFE90000;FFE9FFFF;1|LPD;R5_0_Instruction_Cache;FFE40000;FFE4FFFF;1|LPD;R5_0_Data_Cache;FFE50000;FFE5FFFF;1|LPD;R5_0_BTCM_GLOBAL;FFE20000;FFE2FFFF;1|LPD;R5_0_ATCM_GLOBAL;FFE00000;FFE0FFFF;1|LPD;QSPI_Linear_Address;C0000000;DFFFFFFF;1|LPD;QSPI;FF0F0000;FF0FFFFF;1|LPD;PMU_RAM;FFDC0000;FFDDFFFF;1|LPD;PMU_GLOBAL;FFD80000;FFDBFFFF;1|FPD;PCIE_MAIN;FD0E0000;FD0EFFFF;0|FPD;PCIE_LOW;E0000000;EFFFFFFF;0|FPD;PCIE_HIGH2;8000000000;BFFFFFFFFF;0|FPD;PCIE_HIGH1;600000000;7FFFFFFFF;0|FPD;PCIE_DMA;FD0F0000;FD0FFFFF;0|FPD;PCIE_ATTRIB;FD480000;FD48FFFF;0|LPD;OCM_XMPU_CFG;FFA70000;FFA7FFFF;1|LPD;OCM_SLCR;FF960000;FF96FFFF;1|OCM;OCM;FFFC0000;FFFFFFFF;1|LPD;NAND;FF100000;FF10FFFF;0|LPD;MBISTJTAG;FFCF0000;FFCFFFFF;1|LPD;LPD_XPPU_SINK;FF9C0000;FF9CFFFF;1|LPD;LPD_XPPU;FF980000;FF98FFFF;1|LPD;LPD_SLCR_SECURE;FF4B0000;FF4DFFFF;1|LPD;LPD_SLCR;FF410000;FF4AFFFF;1|LPD;LPD_GPV;FE100000;FE1FFFFF;1|LPD;LPD_DMA_7;FFAF0000;FFAFFFFF;1|LPD;LPD_DMA_6;FFAE0000;FFAEFFFF;1|LPD;LPD_DMA_5;FFAD0000;FFADFFFF;1|LPD;LPD_DMA_4;FFAC0000;FFACFFFF;1|LPD;LPD_DMA_3;FFAB0000;FFABFFFF;1|LPD;LPD_DMA_2;FFAA0000;FFAAFFFF;1|LPD;LPD_DMA_1;FFA90000;FFA9FFFF;1|LPD;LPD_DMA_0;FFA80000;FFA8FFFF;1|LPD;IPI_CTRL;FF380000;FF3FFFFF;1|LPD;IOU_SLCR;FF180000;FF23FFFF;1|LPD;IOU_SECURE_SLCR;FF240000;FF24FFFF;1|LPD;IOU_SCNTRS;FF260000;FF26FFFF;1|LPD;IOU_SCNTR;FF250000;FF25FFFF;1|LPD;IOU_GPV;FE000000;FE0FFFFF;1|LPD;I2C1;FF030000;FF03FFFF;1|LPD;I2C0;FF020000;FF02FFFF;0|FPD;GPU;FD4B0000;FD4BFFFF;1|LPD;GPIO;FF0A0000;FF0AFFFF;1|LPD;GEM3;FF0E0000;FF0EFFFF;0|LPD;GEM2;FF0D0000;FF0DFFFF;0|LPD;GEM1;FF0C0000;FF0CFFFF;1|LPD;GEM0;FF0B0000;FF0BFFFF;1|FPD;FPD_XMPU_SINK;FD4F0000;FD4FFFFF;1|FPD;FPD_XMPU_CFG;FD5D0000;FD5DFFFF;1|FPD;FPD_SLCR_SECURE;FD690000;FD6CFFFF;1|FPD;FPD_SLCR;FD610000;FD68FFFF;1|FPD;FPD_DMA_CH7;FD570000;FD57FFFF;1|FPD;FPD_DMA_CH6;FD560000;FD56FFFF;1|FPD;FPD_DMA_CH5;FD550000;FD55FFFF;1|FPD;FPD_DMA_CH4;FD540000;FD54FFFF;1|FPD;FPD_DMA_CH3;FD530000;FD53FFFF;1|FPD;FPD_DMA_CH2;FD520000;FD52FFFF;1|FPD;FPD_DMA_CH1;FD510000;FD51FFFF;1|FPD;FPD_DMA_CH0;FD500000;FD50FFFF;1|LPD;EFUSE;FFCC0000;FFCCFFFF;1|FPD;Display\
+Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD050000;FD05FFFF;1|FPD;DDR_XMPU4_CFG;FD040000;FD04FFFF;1|FPD;DDR_XMPU3_CFG;FD030000;FD03FFFF;1|FPD;DDR_XMPU2_CFG;FD020000;FD02FFFF;1|FPD;DDR_XMPU1_CFG;FD010000;FD01FFFF;1|FPD;DDR_XMPU0_CFG;FD000000;FD00FFFF;1|FPD;DDR_QOS_CTRL;FD090000;FD09FFFF;1|FPD;DDR_PHY;FD080000;FD08FFFF;1|DDR;DDR_LOW;0;7FFFFFFF;1|DDR;DDR_HIGH;800000000;87FFFFFFF;1|FPD;DDDR_CTRL;FD070000;FD070FFF;1|LPD;Coresight;FE800000;FEFFFFFF;1|LPD;CSU_DMA;FFC80000;FFC9FFFF;1|LPD;CSU;FFCA0000;FFCAFFFF;1|LPD;CRL_APB;FF5E0000;FF85FFFF;1|FPD;CRF_APB;FD1A0000;FD2DFFFF;1|FPD;CCI_REG;FD5E0000;FD5EFFFF;1|LPD;CAN1;FF070000;FF07FFFF;0|LPD;CAN0;FF060000;FF06FFFF;0|FPD;APU;FD5C0000;FD5CFFFF;1|LPD;APM_INTC_IOU;FFA20000;FFA2FFFF;1|LPD;APM_FPD_LPD;FFA30000;FFA3FFFF;1|FPD;APM_5;FD490000;FD49FFFF;1|FPD;APM_0;FD0B0000;FD0BFFFF;1|LPD;APM2;FFA10000;FFA1FFFF;1|LPD;APM1;FFA00000;FFA0FFFF;1|LPD;AMS;FFA50000;FFA5FFFF;1|FPD;AFI_5;FD3B0000;FD3BFFFF;1|FPD;AFI_4;FD3A0000;FD3AFFFF;1|FPD;AFI_3;FD390000;FD39FFFF;1|FPD;AFI_2;FD380000;FD38FFFF;1|FPD;AFI_1;FD370000;FD37FFFF;1|FPD;AFI_0;FD360000;FD36FFFF;1|LPD;AFIFM6;FF9B0000;FF9BFFFF;1|FPD;ACPU_GIC;F9010000;F907FFFF;1}\
+\
+    CONFIG.PSU__PROTECTION__SUBSYSTEMS {PMU Firmware:PMU|Secure Subsystem:} \
+    CONFIG.PSU__PSS_ALT_REF_CLK__ENABLE {0} \
+    CONFIG.PSU__PSS_ALT_REF_CLK__FREQMHZ {33.333} \
+    CONFIG.PSU__PSS_REF_CLK__FREQMHZ {33.333} \
+    CONFIG.PSU__QSPI_COHERENCY {0} \
+    CONFIG.PSU__QSPI_ROUTE_THROUGH_FPD {0} \
+    CONFIG.PSU__QSPI__GRP_FBCLK__ENABLE {0} \
+    CONFIG.PSU__QSPI__PERIPHERAL__DATA_MODE {x4} \
+    CONFIG.PSU__QSPI__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__QSPI__PERIPHERAL__IO {MIO 0 .. 5} \
+    CONFIG.PSU__QSPI__PERIPHERAL__MODE {Single} \
+    CONFIG.PSU__REPORT__DBGLOG {0} \
+    CONFIG.PSU__RPU_COHERENCY {0} \
+    CONFIG.PSU__RPU__POWER__ON {1} \
+    CONFIG.PSU__SATA__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__SAXIGP0__DATA_WIDTH {128} \
+    CONFIG.PSU__SAXIGP1__DATA_WIDTH {128} \
+    CONFIG.PSU__SD0__CLK_100_SDR_OTAP_DLY {0x3} \
+    CONFIG.PSU__SD0__CLK_200_SDR_OTAP_DLY {0x3} \
+    CONFIG.PSU__SD0__CLK_50_DDR_ITAP_DLY {0x3D} \
+    CONFIG.PSU__SD0__CLK_50_DDR_OTAP_DLY {0x4} \
+    CONFIG.PSU__SD0__CLK_50_SDR_ITAP_DLY {0x15} \
+    CONFIG.PSU__SD0__CLK_50_SDR_OTAP_DLY {0x5} \
+    CONFIG.PSU__SD0__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__SD0__RESET__ENABLE {0} \
+    CONFIG.PSU__SD1__CLK_100_SDR_OTAP_DLY {0x3} \
+    CONFIG.PSU__SD1__CLK_200_SDR_OTAP_DLY {0x3} \
+    CONFIG.PSU__SD1__CLK_50_DDR_ITAP_DLY {0x3D} \
+    CONFIG.PSU__SD1__CLK_50_DDR_OTAP_DLY {0x4} \
+    CONFIG.PSU__SD1__CLK_50_SDR_ITAP_DLY {0x15} \
+    CONFIG.PSU__SD1__CLK_50_SDR_OTAP_DLY {0x5} \
+    CONFIG.PSU__SD1__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__SD1__RESET__ENABLE {0} \
+    CONFIG.PSU__SPI0_LOOP_SPI1__ENABLE {0} \
+    CONFIG.PSU__SPI0__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__SPI1__GRP_SS0__IO {MIO 9} \
+    CONFIG.PSU__SPI1__GRP_SS1__ENABLE {0} \
+    CONFIG.PSU__SPI1__GRP_SS2__ENABLE {0} \
+    CONFIG.PSU__SPI1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__SPI1__PERIPHERAL__IO {MIO 6 .. 11} \
+    CONFIG.PSU__SWDT0__CLOCK__ENABLE {0} \
+    CONFIG.PSU__SWDT0__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__SWDT0__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__SWDT0__RESET__ENABLE {0} \
+    CONFIG.PSU__SWDT1__CLOCK__ENABLE {0} \
+    CONFIG.PSU__SWDT1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__SWDT1__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__SWDT1__RESET__ENABLE {0} \
+    CONFIG.PSU__TCM0A__POWER__ON {1} \
+    CONFIG.PSU__TCM0B__POWER__ON {1} \
+    CONFIG.PSU__TCM1A__POWER__ON {1} \
+    CONFIG.PSU__TCM1B__POWER__ON {1} \
+    CONFIG.PSU__TESTSCAN__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__TRACE__INTERNAL_WIDTH {32} \
+    CONFIG.PSU__TRACE__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__TRISTATE__INVERTED {1} \
+    CONFIG.PSU__TSU__BUFG_PORT_PAIR {0} \
+    CONFIG.PSU__TTC0__CLOCK__ENABLE {0} \
+    CONFIG.PSU__TTC0__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__TTC0__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__TTC0__WAVEOUT__ENABLE {0} \
+    CONFIG.PSU__TTC1__CLOCK__ENABLE {0} \
+    CONFIG.PSU__TTC1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__TTC1__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__TTC1__WAVEOUT__ENABLE {0} \
+    CONFIG.PSU__TTC2__CLOCK__ENABLE {0} \
+    CONFIG.PSU__TTC2__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__TTC2__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__TTC2__WAVEOUT__ENABLE {0} \
+    CONFIG.PSU__TTC3__CLOCK__ENABLE {0} \
+    CONFIG.PSU__TTC3__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__TTC3__PERIPHERAL__IO {NA} \
+    CONFIG.PSU__TTC3__WAVEOUT__ENABLE {0} \
+    CONFIG.PSU__UART0_LOOP_UART1__ENABLE {0} \
+    CONFIG.PSU__UART0__PERIPHERAL__ENABLE {0} \
+    CONFIG.PSU__UART1__BAUD_RATE {115200} \
+    CONFIG.PSU__UART1__MODEM__ENABLE {0} \
+    CONFIG.PSU__UART1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__UART1__PERIPHERAL__IO {MIO 36 .. 37} \
+    CONFIG.PSU__USB0_COHERENCY {0} \
+    CONFIG.PSU__USB0__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__USB0__PERIPHERAL__IO {MIO 52 .. 63} \
+    CONFIG.PSU__USB0__REF_CLK_FREQ {26} \
+    CONFIG.PSU__USB0__REF_CLK_SEL {Ref Clk2} \
+    CONFIG.PSU__USB0__RESET__ENABLE {1} \
+    CONFIG.PSU__USB0__RESET__IO {MIO 76} \
+    CONFIG.PSU__USB1_COHERENCY {0} \
+    CONFIG.PSU__USB1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__USB1__PERIPHERAL__IO {MIO 64 .. 75} \
+    CONFIG.PSU__USB1__REF_CLK_FREQ {26} \
+    CONFIG.PSU__USB1__REF_CLK_SEL {Ref Clk3} \
+    CONFIG.PSU__USB1__RESET__ENABLE {1} \
+    CONFIG.PSU__USB1__RESET__IO {MIO 77} \
+    CONFIG.PSU__USB2_0__EMIO__ENABLE {0} \
+    CONFIG.PSU__USB2_1__EMIO__ENABLE {0} \
+    CONFIG.PSU__USB3_0__EMIO__ENABLE {0} \
+    CONFIG.PSU__USB3_0__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__USB3_0__PERIPHERAL__IO {GT Lane2} \
+    CONFIG.PSU__USB3_1__EMIO__ENABLE {0} \
+    CONFIG.PSU__USB3_1__PERIPHERAL__ENABLE {1} \
+    CONFIG.PSU__USB3_1__PERIPHERAL__IO {GT Lane3} \
+    CONFIG.PSU__USB__RESET__MODE {Separate MIO Pin} \
+    CONFIG.PSU__USB__RESET__POLARITY {Active Low} \
+    CONFIG.PSU__USE_DIFF_RW_CLK_GP0 {0} \
+    CONFIG.PSU__USE_DIFF_RW_CLK_GP1 {0} \
+    CONFIG.PSU__USE__ADMA {0} \
+    CONFIG.PSU__USE__APU_LEGACY_INTERRUPT {0} \
+    CONFIG.PSU__USE__AUDIO {0} \
+    CONFIG.PSU__USE__CLK {0} \
+    CONFIG.PSU__USE__CLK0 {0} \
+    CONFIG.PSU__USE__CLK1 {0} \
+    CONFIG.PSU__USE__CLK2 {0} \
+    CONFIG.PSU__USE__CLK3 {0} \
+    CONFIG.PSU__USE__CROSS_TRIGGER {0} \
+    CONFIG.PSU__USE__DDR_INTF_REQUESTED {0} \
+    CONFIG.PSU__USE__DEBUG__TEST {0} \
+    CONFIG.PSU__USE__EVENT_RPU {0} \
+    CONFIG.PSU__USE__FABRIC__RST {1} \
+    CONFIG.PSU__USE__FTM {0} \
+    CONFIG.PSU__USE__GDMA {0} \
+    CONFIG.PSU__USE__IRQ {0} \
+    CONFIG.PSU__USE__IRQ0 {1} \
+    CONFIG.PSU__USE__IRQ1 {0} \
+    CONFIG.PSU__USE__M_AXI_GP0 {1} \
+    CONFIG.PSU__USE__M_AXI_GP1 {0} \
+    CONFIG.PSU__USE__M_AXI_GP2 {1} \
+    CONFIG.PSU__USE__PROC_EVENT_BUS {0} \
+    CONFIG.PSU__USE__RPU_LEGACY_INTERRUPT {0} \
+    CONFIG.PSU__USE__RST0 {0} \
+    CONFIG.PSU__USE__RST1 {0} \
+    CONFIG.PSU__USE__RST2 {0} \
+    CONFIG.PSU__USE__RST3 {0} \
+    CONFIG.PSU__USE__RTC {0} \
+    CONFIG.PSU__USE__STM {0} \
+    CONFIG.PSU__USE__S_AXI_ACE {0} \
+    CONFIG.PSU__USE__S_AXI_ACP {0} \
+    CONFIG.PSU__USE__S_AXI_GP0 {1} \
+    CONFIG.PSU__USE__S_AXI_GP1 {1} \
+    CONFIG.PSU__USE__S_AXI_GP2 {0} \
+    CONFIG.PSU__USE__S_AXI_GP3 {0} \
+    CONFIG.PSU__USE__S_AXI_GP4 {0} \
+    CONFIG.PSU__USE__S_AXI_GP5 {0} \
+    CONFIG.PSU__USE__S_AXI_GP6 {0} \
+    CONFIG.PSU__USE__USB3_0_HUB {0} \
+    CONFIG.PSU__USE__USB3_1_HUB {0} \
+    CONFIG.PSU__USE__VIDEO {0} \
+    CONFIG.PSU__VIDEO_REF_CLK__ENABLE {0} \
+    CONFIG.PSU__VIDEO_REF_CLK__FREQMHZ {33.333} \
+    CONFIG.QSPI_BOARD_INTERFACE {custom} \
+    CONFIG.SATA_BOARD_INTERFACE {custom} \
+    CONFIG.SD0_BOARD_INTERFACE {custom} \
+    CONFIG.SD1_BOARD_INTERFACE {custom} \
+    CONFIG.SPI0_BOARD_INTERFACE {custom} \
+    CONFIG.SPI1_BOARD_INTERFACE {custom} \
+    CONFIG.SUBPRESET1 {Custom} \
+    CONFIG.SUBPRESET2 {Custom} \
+    CONFIG.SWDT0_BOARD_INTERFACE {custom} \
+    CONFIG.SWDT1_BOARD_INTERFACE {custom} \
+    CONFIG.TRACE_BOARD_INTERFACE {custom} \
+    CONFIG.TTC0_BOARD_INTERFACE {custom} \
+    CONFIG.TTC1_BOARD_INTERFACE {custom} \
+    CONFIG.TTC2_BOARD_INTERFACE {custom} \
+    CONFIG.TTC3_BOARD_INTERFACE {custom} \
+    CONFIG.UART0_BOARD_INTERFACE {custom} \
+    CONFIG.UART1_BOARD_INTERFACE {custom} \
+    CONFIG.USB0_BOARD_INTERFACE {custom} \
+    CONFIG.USB1_BOARD_INTERFACE {custom} \
+    CONFIG.preset {None} \
+  ] $zynq_ultra_ps_e_0
+
+
+  # Create instance: rst_ps8_0_99M, and set properties
+  set rst_ps8_0_99M [ create_bd_cell -type ip -vlnv xilinx.com:ip:proc_sys_reset:5.0 rst_ps8_0_99M ]
+
+  # Create instance: blk_mem_gen_0, and set properties
+  set blk_mem_gen_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:blk_mem_gen:8.4 blk_mem_gen_0 ]
+  set_property CONFIG.Memory_Type {True_Dual_Port_RAM} $blk_mem_gen_0
+
+
+  # Create instance: axi_bram_ctrl_0, and set properties
+  set axi_bram_ctrl_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_bram_ctrl:4.1 axi_bram_ctrl_0 ]
+  set_property CONFIG.SINGLE_PORT_BRAM {1} $axi_bram_ctrl_0
+
+
+  # Create instance: smartconnect_0, and set properties
+  set smartconnect_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:smartconnect:1.0 smartconnect_0 ]
+  set_property -dict [list \
+    CONFIG.NUM_MI {3} \
+    CONFIG.NUM_SI {3} \
+  ] $smartconnect_0
+
+
+  # Create instance: data_mover_controller_0, and set properties
+  set data_mover_controller_0 [ create_bd_cell -type ip -vlnv xilinx.com:user:data_mover_controller:1.0 data_mover_controller_0 ]
+
+  # Create instance: axi_datamover_0, and set properties
+  set axi_datamover_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_0 ]
+  set_property -dict [list \
+    CONFIG.c_addr_width {64} \
+    CONFIG.c_dummy {1} \
+    CONFIG.c_enable_mm2s_adv_sig {1} \
+    CONFIG.c_enable_s2mm_adv_sig {1} \
+  ] $axi_datamover_0
+
+
+  # Create instance: xlconstant_0, and set properties
+  set xlconstant_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_0 ]
+
+  # Create instance: xlconstant_1, and set properties
+  set xlconstant_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_1 ]
+  set_property -dict [list \
+    CONFIG.CONST_VAL {0xf} \
+    CONFIG.CONST_WIDTH {4} \
+  ] $xlconstant_1
+
+
+  # Create instance: tx_header_inserter_0, and set properties
+  set block_name tx_header_inserter
+  set block_cell_name tx_header_inserter_0
+  if { [catch {set tx_header_inserter_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_header_inserter_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: tx_streamer_0, and set properties
+  set block_name tx_streamer
+  set block_cell_name tx_streamer_0
+  if { [catch {set tx_streamer_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_streamer_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: tx_local_dma_0, and set properties
+  set block_name tx_local_dma
+  set block_cell_name tx_local_dma_0
+  if { [catch {set tx_local_dma_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_local_dma_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: tx_link_stripe_0, and set properties
+  set block_name tx_link_stripe
+  set block_cell_name tx_link_stripe_0
+  if { [catch {set tx_link_stripe_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_link_stripe_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: axi_datamover_1, and set properties
+  set axi_datamover_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_1 ]
+  set_property -dict [list \
+    CONFIG.c_addr_width {64} \
+    CONFIG.c_dummy {1} \
+    CONFIG.c_enable_mm2s_adv_sig {1} \
+    CONFIG.c_enable_s2mm_adv_sig {1} \
+    CONFIG.c_mm2s_btt_used {23} \
+    CONFIG.c_s2mm_btt_used {23} \
+  ] $axi_datamover_1
+
+
+  # Create instance: smartconnect_1, and set properties
+  set smartconnect_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:smartconnect:1.0 smartconnect_1 ]
+  set_property CONFIG.NUM_SI {6} $smartconnect_1
+
+  # Create instance: xlconstant_3, and set properties
+  set xlconstant_3 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_3 ]
+
+  # Create instance: xlconstant_4, and set properties
+  set xlconstant_4 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_4 ]
+
+  # Create instance: axi_ethernet_0_refclk, and set properties
+  set axi_ethernet_0_refclk [ create_bd_cell -type ip -vlnv xilinx.com:ip:clk_wiz:6.0 axi_ethernet_0_refclk ]
+  set_property -dict [list \
+    CONFIG.CLKOUT1_REQUESTED_OUT_FREQ {300} \
+    CONFIG.CLKOUT2_REQUESTED_OUT_FREQ {125} \
+    CONFIG.CLKOUT2_USED {true} \
+    CONFIG.CLK_IN1_BOARD_INTERFACE {som240_1_connector_hpa_clk0p_clk} \
+    CONFIG.PRIM_SOURCE {Single_ended_clock_capable_pin} \
+    CONFIG.USE_BOARD_FLOW {true} \
+    CONFIG.USE_RESET {false} \
+  ] $axi_ethernet_0_refclk
+
+
+  # Create instance: eth_pkt_gen_0, and set properties
+  set block_name eth_pkt_gen
+  set block_cell_name eth_pkt_gen_0
+  if { [catch {set eth_pkt_gen_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $eth_pkt_gen_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: eth_pkt_gen_1, and set properties
+  set block_name eth_pkt_gen
+  set block_cell_name eth_pkt_gen_1
+  if { [catch {set eth_pkt_gen_1 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $eth_pkt_gen_1 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: eth_tx_arb_0, and set properties
+  set block_name eth_tx_arb
+  set block_cell_name eth_tx_arb_0
+  if { [catch {set eth_tx_arb_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $eth_tx_arb_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: axi_ethernet_0, and set properties
+  set axi_ethernet_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_ethernet:7.2 axi_ethernet_0 ]
+  set_property -dict [list \
+    CONFIG.ETHERNET_BOARD_INTERFACE {som240_1_connector_pl_gem2_rgmii} \
+    CONFIG.MDIO_BOARD_INTERFACE {som240_1_connector_pl_gem2_rgmii_mdio_mdc} \
+    CONFIG.PHYRST_BOARD_INTERFACE {som240_1_connector_pl_gem2_reset} \
+  ] $axi_ethernet_0
+
+
+  # Create instance: axi_ethernet_1, and set properties
+  set axi_ethernet_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_ethernet:7.2 axi_ethernet_1 ]
+  set_property -dict [list \
+    CONFIG.ETHERNET_BOARD_INTERFACE {som240_2_connector_pl_gem3_rgmii} \
+    CONFIG.MDIO_BOARD_INTERFACE {som240_2_connector_pl_gem3_rgmii_mdio_mdc} \
+    CONFIG.PHYRST_BOARD_INTERFACE {som240_2_connector_pl_gem3_reset} \
+  ] $axi_ethernet_1
+
+
+  # Create instance: axi_interconnect_0, and set properties
+  set axi_interconnect_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 axi_interconnect_0 ]
+  set_property CONFIG.NUM_MI {3} $axi_interconnect_0
+
+
+  # Create instance: xlconstant_2, and set properties
+  set xlconstant_2 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_2 ]
+  set_property CONFIG.CONST_VAL {0} $xlconstant_2
+
+
+  # Create instance: rdma_axilite_ctrl_0, and set properties
+  set block_name rdma_axilite_ctrl
+  set block_cell_name rdma_axilite_ctrl_0
+  if { [catch {set rdma_axilite_ctrl_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rdma_axilite_ctrl_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: xlconstant_5, and set properties
+  set xlconstant_5 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_5 ]
+
+  # Create instance: axis_data_fifo_1, and set properties
+  set axis_data_fifo_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axis_data_fifo:2.0 axis_data_fifo_1 ]
+  set_property -dict [list \
+    CONFIG.FIFO_DEPTH {16384} \
+    CONFIG.FIFO_MEMORY_TYPE {ultra} \
+    CONFIG.HAS_TKEEP {1} \
+    CONFIG.HAS_TLAST {1} \
+    CONFIG.TDATA_NUM_BYTES {4} \
+  ] $axis_data_fifo_1
+
+
+  # Create instance: axi_datamover_2, and set properties
+  set axi_datamover_2 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_2 ]
+  set_property -dict [list \
+    CONFIG.c_addr_width {64} \
+    CONFIG.c_dummy {1} \
+    CONFIG.c_enable_mm2s {0} \
+    CONFIG.c_enable_s2mm_adv_sig {1} \
+    CONFIG.c_s2mm_btt_used {23} \
+  ] $axi_datamover_2
+
+
+  # Create instance: rx_streamer_0, and set properties
+  set block_name rx_streamer
+  set block_cell_name rx_streamer_0
+  if { [catch {set rx_streamer_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rx_streamer_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: rx_header_parser_0, and set properties
+  set block_name rx_header_parser
+  set block_cell_name rx_header_parser_0
+  if { [catch {set rx_header_parser_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rx_header_parser_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: axis_rx_to_rdma_0, and set properties
+  set block_name axis_rx_to_bram
+  set block_cell_name axis_rx_to_rdma_0
+  if { [catch {set axis_rx_to_rdma_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $axis_rx_to_rdma_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  set_property -dict [ list \
+   CONFIG.FREQ_HZ {99999001} \
+   CONFIG.CLK_DOMAIN {design_1_zynq_ultra_ps_e_0_0_pl_clk0} \
+ ] [get_bd_intf_pins /axis_rx_to_rdma_0/m_axis_eth]
+
+  # Create instance: axis_rx_to_rdma_1, and set properties
+  set block_name axis_rx_to_bram
+  set block_cell_name axis_rx_to_rdma_1
+  if { [catch {set axis_rx_to_rdma_1 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $axis_rx_to_rdma_1 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  set_property -dict [ list \
+   CONFIG.FREQ_HZ {99999001} \
+   CONFIG.CLK_DOMAIN {design_1_zynq_ultra_ps_e_0_0_pl_clk0} \
+ ] [get_bd_intf_pins /axis_rx_to_rdma_1/m_axis_eth]
+
+  # Create instance: rx_link_merge_0, and set properties
+  set block_name rx_link_merge
+  set block_cell_name rx_link_merge_0
+  if { [catch {set rx_link_merge_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rx_link_merge_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  set_property -dict [ list \
+   CONFIG.FREQ_HZ {99999001} \
+   CONFIG.CLK_DOMAIN {design_1_zynq_ultra_ps_e_0_0_pl_clk0} \
+ ] [get_bd_intf_pins /rx_link_merge_0/m_axis]
+
+  # Create instance: xlconcat_0, and set properties
+  set xlconcat_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconcat:2.1 xlconcat_0 ]
+  set_property CONFIG.NUM_PORTS {4} $xlconcat_0
+
+
+  # Create instance: rdma_axilite_rx_ctrl_0, and set properties
+  set block_name rdma_axilite_rx_ctrl
+  set block_cell_name rdma_axilite_rx_ctrl_0
+  if { [catch {set rdma_axilite_rx_ctrl_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rdma_axilite_rx_ctrl_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: axis_data_fifo_0, and set properties
+  set axis_data_fifo_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axis_data_fifo:2.0 axis_data_fifo_0 ]
+  set_property -dict [list \
+    CONFIG.FIFO_DEPTH {2048} \
+    CONFIG.HAS_TKEEP {1} \
+    CONFIG.HAS_WR_DATA_COUNT {1} \
+    CONFIG.HAS_TLAST {1} \
+    CONFIG.TDATA_NUM_BYTES {4} \
+  ] $axis_data_fifo_0
+
+
+  # Create interface connections
+  connect_bd_intf_net -intf_net S00_AXI_1 [get_bd_intf_pins axi_interconnect_0/S00_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/M_AXI_HPM0_LPD]
+  connect_bd_intf_net -intf_net axi_bram_ctrl_0_BRAM_PORTA [get_bd_intf_pins blk_mem_gen_0/BRAM_PORTA] [get_bd_intf_pins axi_bram_ctrl_0/BRAM_PORTA]
+  connect_bd_intf_net -intf_net axi_datamover_0_M_AXIS_MM2S [get_bd_intf_pins axi_datamover_0/M_AXIS_MM2S] [get_bd_intf_pins data_mover_controller_0/S00_AXIS]
+  connect_bd_intf_net -intf_net axi_datamover_0_M_AXI_MM2S [get_bd_intf_pins axi_datamover_0/M_AXI_MM2S] [get_bd_intf_pins smartconnect_0/S01_AXI]
+  connect_bd_intf_net -intf_net axi_datamover_0_M_AXI_S2MM [get_bd_intf_pins axi_datamover_0/M_AXI_S2MM] [get_bd_intf_pins smartconnect_0/S02_AXI]
+  connect_bd_intf_net -intf_net axi_datamover_1_M_AXIS_MM2S [get_bd_intf_pins axi_datamover_1/M_AXIS_MM2S] [get_bd_intf_pins tx_local_dma_0/s_axis]
+  connect_bd_intf_net -intf_net tx_local_dma_0_m_axis_hdr [get_bd_intf_pins tx_local_dma_0/m_axis_hdr] [get_bd_intf_pins tx_header_inserter_0/s_axis]
+  connect_bd_intf_net -intf_net tx_local_dma_0_m_axis_s2mm [get_bd_intf_pins tx_local_dma_0/m_axis_s2mm] [get_bd_intf_pins axi_datamover_1/S_AXIS_S2MM]
+  connect_bd_intf_net -intf_net axi_datamover_1_M_AXI_MM2S [get_bd_intf_pins smartconnect_1/S00_AXI] [get_bd_intf_pins axi_datamover_1/M_AXI_MM2S]
+  connect_bd_intf_net -intf_net axi_datamover_1_M_AXI_S2MM [get_bd_intf_pins smartconnect_1/S01_AXI] [get_bd_intf_pins axi_datamover_1/M_AXI_S2MM]
+  connect_bd_intf_net -intf_net axi_ethernet_1_mdio [get_bd_intf_ports som240_2_connector_pl_gem3_rgmii_mdio_mdc] [get_bd_intf_pins axi_ethernet_1/mdio]
+  connect_bd_intf_net -intf_net axi_ethernet_1_rgmii [get_bd_intf_ports som240_2_connector_pl_gem3_rgmii] [get_bd_intf_pins axi_ethernet_1/rgmii]
+  connect_bd_intf_net -intf_net axis_data_fifo_1_M_AXIS [get_bd_intf_pins axis_data_fifo_1/M_AXIS] [get_bd_intf_pins tx_link_stripe_0/s_axis]
+  connect_bd_intf_net -intf_net rdma_axilite_ctrl_0_m_axis_packet [get_bd_intf_pins rdma_axilite_ctrl_0/m_axis_packet] [get_bd_intf_pins axis_data_fifo_1/S_AXIS]
+  connect_bd_intf_net -intf_net smartconnect_0_M00_AXI [get_bd_intf_pins smartconnect_0/M00_AXI] [get_bd_intf_pins axi_bram_ctrl_0/S_AXI]
+  connect_bd_intf_net -intf_net smartconnect_0_M01_AXI [get_bd_intf_pins smartconnect_0/M01_AXI] [get_bd_intf_pins data_mover_controller_0/S00_AXI]
+  connect_bd_intf_net -intf_net smartconnect_0_M02_AXI [get_bd_intf_pins smartconnect_0/M02_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/S_AXI_HPC0_FPD]
+  connect_bd_intf_net -intf_net smartconnect_1_M00_AXI [get_bd_intf_pins smartconnect_1/M00_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/S_AXI_HPC1_FPD]
+  connect_bd_intf_net -intf_net tx_header_inserter_0_m_axis [get_bd_intf_pins tx_header_inserter_0/m_axis] [get_bd_intf_pins rdma_axilite_ctrl_0/s_axis_payload]
+  connect_bd_intf_net -intf_net tx_link_stripe_0_m0_axis [get_bd_intf_pins tx_link_stripe_0/m0_axis] [get_bd_intf_pins eth_pkt_gen_0/s_axis]
+  connect_bd_intf_net -intf_net zynq_ultra_ps_e_0_M_AXI_HPM0_FPD [get_bd_intf_pins zynq_ultra_ps_e_0/M_AXI_HPM0_FPD] [get_bd_intf_pins smartconnect_0/S00_AXI]
+  connect_bd_intf_net -intf_net axi_interconnect_0_M00_AXI [get_bd_intf_pins axi_interconnect_0/M00_AXI] [get_bd_intf_pins axi_ethernet_0/s_axi]
+  connect_bd_intf_net -intf_net axi_interconnect_0_M01_AXI [get_bd_intf_pins axi_interconnect_0/M01_AXI] [get_bd_intf_pins rdma_axilite_rx_ctrl_0/s_axi]
+  connect_bd_intf_net -intf_net axi_interconnect_0_M02_AXI [get_bd_intf_pins axi_interconnect_0/M02_AXI] [get_bd_intf_pins axi_ethernet_1/s_axi]
+  connect_bd_intf_net -intf_net axi_ethernet_0_mdio [get_bd_intf_ports som240_1_connector_pl_gem2_rgmii_mdio_mdc] [get_bd_intf_pins axi_ethernet_0/mdio]
+  connect_bd_intf_net -intf_net axi_ethernet_0_rgmii [get_bd_intf_ports som240_1_connector_pl_gem2_rgmii] [get_bd_intf_pins axi_ethernet_0/rgmii]
+  connect_bd_intf_net -intf_net eth_pkt_gen_0_m_axis [get_bd_intf_pins eth_pkt_gen_0/m_axis] [get_bd_intf_pins eth_tx_arb_0/s0_axis_txd]
+  connect_bd_intf_net -intf_net eth_pkt_gen_1_m_axis [get_bd_intf_pins eth_pkt_gen_1/m_axis] [get_bd_intf_pins axi_ethernet_1/s_axis_txd]
+  connect_bd_intf_net -intf_net eth_tx_arb_0_m_axis_txc [get_bd_intf_pins eth_tx_arb_0/m_axis_txc] [get_bd_intf_pins axi_ethernet_0/s_axis_txc]
+  connect_bd_intf_net -intf_net eth_tx_arb_0_m_axis_txd [get_bd_intf_pins eth_tx_arb_0/m_axis_txd] [get_bd_intf_pins axi_ethernet_0/s_axis_txd]
+  connect_bd_intf_net -intf_net tx_link_stripe_0_m1_axis [get_bd_intf_pins tx_link_stripe_0/m1_axis] [get_bd_intf_pins eth_pkt_gen_1/s_axis]
+  connect_bd_intf_net -intf_net axi_datamover_2_M_AXI_S2MM [get_bd_intf_pins smartconnect_1/S02_AXI] [get_bd_intf_pins axi_datamover_2/M_AXI_S2MM]
+  connect_bd_intf_net -intf_net rx_streamer_0_m_axi_atomic [get_bd_intf_pins rx_streamer_0/m_axi_atomic] [get_bd_intf_pins smartconnect_1/S03_AXI]
+  connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axi_exc [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_intf_pins smartconnect_1/S04_AXI]
+  connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axi_cqr [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_intf_pins smartconnect_1/S05_AXI]
+  connect_bd_intf_net -intf_net axis_data_fifo_0_M_AXIS [get_bd_intf_pins axis_data_fifo_0/M_AXIS] [get_bd_intf_pins rx_header_parser_0/s_axis]
+  connect_bd_intf_net -intf_net axis_rx_to_rdma_0_m_axis_eth [get_bd_intf_pins axis_rx_to_rdma_0/m_axis_eth] [get_bd_intf_pins rx_link_merge_0/s0_axis]
+  connect_bd_intf_net -intf_net axis_rx_to_rdma_1_m_axis_eth [get_bd_intf_pins axis_rx_to_rdma_1/m_axis_eth] [get_bd_intf_pins rx_link_merge_0/s1_axis]
+  connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axis_payload [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axis_payload] [get_bd_intf_pins axis_data_fifo_0/S_AXIS]
+  connect_bd_intf_net -intf_net rx_link_merge_0_m_axis [get_bd_intf_pins rx_link_merge_0/m_axis] [get_bd_intf_pins rdma_axilite_rx_ctrl_0/s_axis_eth]
+  connect_bd_intf_net -intf_net rx_header_parser_0_m_axis [get_bd_intf_pins rx_header_parser_0/m_axis] [get_bd_intf_pins axi_datamover_2/S_AXIS_S2MM]
+  connect_bd_intf_net -intf_net rx_streamer_0_m_axis_s2mm_cmd [get_bd_intf_pins axi_datamover_2/S_AXIS_S2MM_CMD] [get_bd_intf_pins rx_streamer_0/m_axis_s2mm_cmd]
+
+  # Create port connections
+  connect_bd_net -net axi_datamover_0_mm2s_rd_xfer_cmplt [get_bd_pins axi_datamover_0/mm2s_rd_xfer_cmplt] [get_bd_pins data_mover_controller_0/mm2s_rd_xfer_cmplt]
+  connect_bd_net -net axi_datamover_0_s2mm_wr_xfer_cmplt [get_bd_pins axi_datamover_0/s2mm_wr_xfer_cmplt] [get_bd_pins data_mover_controller_0/s2mm_wr_xfer_cmplt]
+  connect_bd_net -net axi_datamover_0_s_axis_s2mm_tready [get_bd_pins axi_datamover_0/s_axis_s2mm_tready] [get_bd_pins data_mover_controller_0/m00_axis_tready]
+  connect_bd_net -net axi_datamover_1_mm2s_rd_xfer_cmplt [get_bd_pins axi_datamover_1/mm2s_rd_xfer_cmplt] [get_bd_pins tx_streamer_0/mm2s_rd_xfer_cmplt]
+  connect_bd_net -net axi_datamover_1_s_axis_mm2s_cmd_tready [get_bd_pins axi_datamover_1/s_axis_mm2s_cmd_tready] [get_bd_pins tx_streamer_0/m_axis_mm2s_cmd_tready]
+  connect_bd_net -net axi_ethernet_1_phy_rst_n [get_bd_pins axi_ethernet_1/phy_rst_n] [get_bd_ports som240_2_connector_pl_gem3_reset]
+  connect_bd_net -net data_mover_controller_0_m00_axis_tdata [get_bd_pins data_mover_controller_0/m00_axis_tdata] [get_bd_pins axi_datamover_0/s_axis_s2mm_tdata]
+  connect_bd_net -net data_mover_controller_0_m00_axis_tlast [get_bd_pins data_mover_controller_0/m00_axis_tlast] [get_bd_pins axi_datamover_0/s_axis_s2mm_tlast]
+  connect_bd_net -net data_mover_controller_0_m00_axis_tvalid [get_bd_pins data_mover_controller_0/m00_axis_tvalid] [get_bd_pins axi_datamover_0/s_axis_s2mm_tvalid]
+  connect_bd_net -net data_mover_controller_0_m_axis_mm2s_cmd_tdata [get_bd_pins data_mover_controller_0/m_axis_mm2s_cmd_tdata] [get_bd_pins axi_datamover_0/s_axis_mm2s_cmd_tdata]
+  connect_bd_net -net data_mover_controller_0_m_axis_mm2s_cmd_tvalid [get_bd_pins data_mover_controller_0/m_axis_mm2s_cmd_tvalid] [get_bd_pins axi_datamover_0/s_axis_mm2s_cmd_tvalid]
+  connect_bd_net -net data_mover_controller_0_m_axis_s2mm_cmd_tdata [get_bd_pins data_mover_controller_0/m_axis_s2mm_cmd_tdata] [get_bd_pins axi_datamover_0/s_axis_s2mm_cmd_tdata]
+  connect_bd_net -net data_mover_controller_0_m_axis_s2mm_cmd_tvalid [get_bd_pins data_mover_controller_0/m_axis_s2mm_cmd_tvalid] [get_bd_pins axi_datamover_0/s_axis_s2mm_cmd_tvalid]
+  connect_bd_net -net data_mover_controller_0_tc_map [get_bd_pins data_mover_controller_0/tc_map] [get_bd_pins tx_streamer_0/tc_map]
+  connect_bd_net -net data_mover_controller_0_tc_weight [get_bd_pins data_mover_controller_0/tc_weight] [get_bd_pins tx_streamer_0/tc_weight]
+  connect_bd_net -net data_mover_controller_0_link_mode [get_bd_pins data_mover_controller_0/link_mode] [get_bd_pins tx_link_stripe_0/link_mode]
+  connect_bd_net -net data_mover_controller_0_tc_wrr [get_bd_pins data_mover_controller_0/tc_wrr] [get_bd_pins tx_streamer_0/tc_wrr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_ddr_addr [get_bd_pins data_mover_controller_0/tx_cmd_ddr_addr] [get_bd_pins tx_streamer_0/tx_cmd_ddr_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_dest_qp [get_bd_pins data_mover_controller_0/tx_cmd_dest_qp] [get_bd_pins tx_streamer_0/tx_cmd_dest_qp]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_qp_handle [get_bd_pins data_mover_controller_0/tx_cmd_qp_handle] [get_bd_pins tx_streamer_0/tx_cmd_qp_handle]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_length [get_bd_pins data_mover_controller_0/tx_cmd_length] [get_bd_pins tx_streamer_0/tx_cmd_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg1_addr [get_bd_pins data_mover_controller_0/tx_cmd_sg1_addr] [get_bd_pins tx_streamer_0/tx_cmd_sg1_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg1_length [get_bd_pins data_mover_controller_0/tx_cmd_sg1_length] [get_bd_pins tx_streamer_0/tx_cmd_sg1_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg2_addr [get_bd_pins data_mover_controller_0/tx_cmd_sg2_addr] [get_bd_pins tx_streamer_0/tx_cmd_sg2_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg2_length [get_bd_pins data_mover_controller_0/tx_cmd_sg2_length] [get_bd_pins tx_streamer_0/tx_cmd_sg2_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_row_count [get_bd_pins data_mover_controller_0/tx_cmd_row_count] [get_bd_pins tx_streamer_0/tx_cmd_row_count]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_src_stride [get_bd_pins data_mover_controller_0/tx_cmd_src_stride] [get_bd_pins tx_streamer_0/tx_cmd_src_stride]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_dst_stride [get_bd_pins data_mover_controller_0/tx_cmd_dst_stride] [get_bd_pins tx_streamer_0/tx_cmd_dst_stride]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_local_rkey [get_bd_pins data_mover_controller_0/tx_cmd_local_rkey] [get_bd_pins tx_streamer_0/tx_cmd_local_rkey]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_imm [get_bd_pins data_mover_controller_0/tx_cmd_imm] [get_bd_pins tx_streamer_0/tx_cmd_imm]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_atomic_swap_add [get_bd_pins data_mover_controller_0/tx_cmd_atomic_swap_add] [get_bd_pins tx_streamer_0/tx_cmd_atomic_swap_add]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_atomic_compare [get_bd_pins data_mover_controller_0/tx_cmd_atomic_compare] [get_bd_pins tx_streamer_0/tx_cmd_atomic_compare]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_dst_ip [get_bd_pins data_mover_controller_0/tx_cmd_dst_ip] [get_bd_pins tx_streamer_0/tx_cmd_dst_ip]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_udp_ports [get_bd_pins data_mover_controller_0/tx_cmd_udp_ports] [get_bd_pins tx_streamer_0/tx_cmd_udp_ports]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_count [get_bd_pins data_mover_controller_0/tx_cmd_mc_count] [get_bd_pins tx_streamer_0/tx_cmd_mc_count]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_dest_qp [get_bd_pins data_mover_controller_0/tx_cmd_mc_dest_qp] [get_bd_pins tx_streamer_0/tx_cmd_mc_dest_qp]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_qp_handle [get_bd_pins data_mover_controller_0/tx_cmd_mc_qp_handle] [get_bd_pins tx_streamer_0/tx_cmd_mc_qp_handle]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_dst_ip [get_bd_pins data_mover_controller_0/tx_cmd_mc_dst_ip] [get_bd_pins tx_streamer_0/tx_cmd_mc_dst_ip]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_udp_ports [get_bd_pins data_mover_controller_0/tx_cmd_mc_udp_ports] [get_bd_pins tx_streamer_0/tx_cmd_mc_udp_ports]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_opcode [get_bd_pins data_mover_controller_0/tx_cmd_opcode] [get_bd_pins tx_streamer_0/tx_cmd_opcode]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_partition_key [get_bd_pins data_mover_controller_0/tx_cmd_partition_key] [get_bd_pins tx_streamer_0/tx_cmd_partition_key]
+  connect_bd_net -net data_mover_controller_0_cc_enable [get_bd_pins data_mover_controller_0/cc_enable] [get_bd_pins tx_streamer_0/cc_enable]
+  connect_bd_net -net data_mover_controller_0_rate_cfg [get_bd_pins data_mover_controller_0/rate_cfg] [get_bd_pins tx_streamer_0/rate_cfg]
+  connect_bd_net -net data_mover_controller_0_rate_cfg_wr [get_bd_pins data_mover_controller_0/rate_cfg_wr] [get_bd_pins tx_streamer_0/rate_cfg_wr]
+  connect_bd_net -net data_mover_controller_0_retry_limit [get_bd_pins data_mover_controller_0/retry_limit] [get_bd_pins tx_streamer_0/retry_limit]
+  connect_bd_net -net data_mover_controller_0_retry_timeout [get_bd_pins data_mover_controller_0/retry_timeout] [get_bd_pins tx_streamer_0/retry_timeout]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_remote_addr [get_bd_pins data_mover_controller_0/tx_cmd_remote_addr] [get_bd_pins tx_streamer_0/tx_cmd_remote_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_rkey [get_bd_pins data_mover_controller_0/tx_cmd_rkey] [get_bd_pins tx_streamer_0/tx_cmd_rkey]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_service_level [get_bd_pins data_mover_controller_0/tx_cmd_service_level] [get_bd_pins tx_streamer_0/tx_cmd_service_level]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sq_index [get_bd_pins data_mover_controller_0/tx_cmd_sq_index] [get_bd_pins tx_streamer_0/tx_cmd_sq_index]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_valid [get_bd_pins data_mover_controller_0/tx_cmd_valid] [get_bd_pins tx_streamer_0/tx_cmd_valid]
+  connect_bd_net -net data_mover_controller_0_tx_cpl_ready [get_bd_pins data_mover_controller_0/tx_cpl_ready] [get_bd_pins tx_streamer_0/tx_cpl_ready]
+  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn [get_bd_pins rst_ps8_0_99M/interconnect_aresetn] [get_bd_pins axi_bram_ctrl_0/s_axi_aresetn] [get_bd_pins smartconnect_0/aresetn]
+  connect_bd_net -net som240_1_connector_hpa_clk0p_clk_1 [get_bd_ports som240_1_connector_hpa_clk0p_clk] [get_bd_pins axi_ethernet_0_refclk/clk_in1]
+  connect_bd_net -net tx_header_inserter_0_rdma_sodir_length [get_bd_pins tx_header_inserter_0/rdma_sodir_length] [get_bd_pins rdma_axilite_ctrl_0/rdma_length]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_addr [get_bd_pins rdma_axilite_ctrl_0/bram_addr] [get_bd_pins blk_mem_gen_0/addrb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_din [get_bd_pins rdma_axilite_ctrl_0/bram_din] [get_bd_pins blk_mem_gen_0/dinb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_en [get_bd_pins rdma_axilite_ctrl_0/bram_en] [get_bd_pins blk_mem_gen_0/enb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_we [get_bd_pins rdma_axilite_ctrl_0/bram_we] [get_bd_pins blk_mem_gen_0/web]
+  connect_bd_net -net blk_mem_gen_0_doutb [get_bd_pins blk_mem_gen_0/doutb] [get_bd_pins rdma_axilite_ctrl_0/bram_dout]
+  connect_bd_net -net tx_header_inserter_0_start [get_bd_pins tx_header_inserter_0/start] [get_bd_pins rdma_axilite_ctrl_0/start]
+  connect_bd_net -net tx_header_inserter_0_tx_busy [get_bd_pins tx_header_inserter_0/tx_busy] [get_bd_pins tx_streamer_0/hdr_tx_busy]
+  connect_bd_net -net tx_header_inserter_0_tx_done [get_bd_pins tx_header_inserter_0/tx_done] [get_bd_pins tx_streamer_0/hdr_tx_done]
+  connect_bd_net -net tx_streamer_0_hdr_fragment_id [get_bd_pins tx_streamer_0/hdr_fragment_id] [get_bd_pins tx_header_inserter_0/fragment_id]
+  connect_bd_net -net tx_streamer_0_hdr_fragment_offset [get_bd_pins tx_streamer_0/hdr_fragment_offset] [get_bd_pins tx_header_inserter_0/fragment_offset]
+  connect_bd_net -net tx_streamer_0_hdr_more_fragments [get_bd_pins tx_streamer_0/hdr_more_fragments] [get_bd_pins tx_header_inserter_0/more_fragments]
+  connect_bd_net -net tx_streamer_0_hdr_header_only [get_bd_pins tx_streamer_0/hdr_header_only] [get_bd_pins tx_header_inserter_0/header_only]
+  connect_bd_net -net tx_streamer_0_hdr_read_sink_addr [get_bd_pins tx_streamer_0/hdr_read_sink_addr] [get_bd_pins tx_header_inserter_0/read_sink_addr]
+  connect_bd_net -net tx_streamer_0_hdr_read_sink_rkey [get_bd_pins tx_streamer_0/hdr_read_sink_rkey] [get_bd_pins tx_header_inserter_0/read_sink_rkey]
+  connect_bd_net -net tx_streamer_0_hdr_imm [get_bd_pins tx_streamer_0/hdr_imm] [get_bd_pins tx_header_inserter_0/rdma_imm]
+  connect_bd_net -net tx_streamer_0_hdr_atomic_data [get_bd_pins tx_streamer_0/hdr_atomic_data] [get_bd_pins tx_header_inserter_0/atomic_data]
+  connect_bd_net -net tx_streamer_0_hdr_atomic_compare [get_bd_pins tx_streamer_0/hdr_atomic_compare] [get_bd_pins tx_header_inserter_0/atomic_compare]
+  connect_bd_net -net tx_streamer_0_hdr_dst_ip [get_bd_pins tx_streamer_0/hdr_dst_ip] [get_bd_pins rdma_axilite_ctrl_0/dst_ip]
+  connect_bd_net -net tx_streamer_0_hdr_udp_ports [get_bd_pins tx_streamer_0/hdr_udp_ports] [get_bd_pins rdma_axilite_ctrl_0/udp_ports]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_dest_qp [get_bd_pins tx_streamer_0/hdr_rdma_dest_qp] [get_bd_pins tx_header_inserter_0/rdma_dest_qp]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_length [get_bd_pins tx_streamer_0/hdr_rdma_length] [get_bd_pins tx_header_inserter_0/rdma_length]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_opcode [get_bd_pins tx_streamer_0/hdr_rdma_opcode] [get_bd_pins tx_header_inserter_0/rdma_opcode]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_partition_key [get_bd_pins tx_streamer_0/hdr_rdma_partition_key] [get_bd_pins tx_header_inserter_0/rdma_partition_key]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_psn [get_bd_pins tx_streamer_0/hdr_rdma_psn] [get_bd_pins tx_header_inserter_0/rdma_psn]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_remote_addr [get_bd_pins tx_streamer_0/hdr_rdma_remote_addr] [get_bd_pins tx_header_inserter_0/rdma_remote_addr]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_rkey [get_bd_pins tx_streamer_0/hdr_rdma_rkey] [get_bd_pins tx_header_inserter_0/rdma_rkey]
+  connect_bd_net -net tx_streamer_0_hdr_rdma_service_level [get_bd_pins tx_streamer_0/hdr_rdma_service_level] [get_bd_pins tx_header_inserter_0/rdma_service_level]
+  connect_bd_net -net tx_streamer_0_hdr_start_tx [get_bd_pins tx_streamer_0/hdr_start_tx] [get_bd_pins tx_header_inserter_0/start_tx]
+  connect_bd_net -net tx_streamer_0_m_axis_mm2s_cmd_tdata [get_bd_pins tx_streamer_0/m_axis_mm2s_cmd_tdata] [get_bd_pins axi_datamover_1/s_axis_mm2s_cmd_tdata]
+  connect_bd_net -net tx_streamer_0_m_axis_mm2s_cmd_tvalid [get_bd_pins tx_streamer_0/m_axis_mm2s_cmd_tvalid] [get_bd_pins axi_datamover_1/s_axis_mm2s_cmd_tvalid]
+  connect_bd_net -net tx_streamer_0_m_axis_s2mm_cmd_tdata [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tdata] [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tdata]
+  connect_bd_net -net tx_streamer_0_m_axis_s2mm_cmd_tvalid [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tvalid] [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tvalid]
+  connect_bd_net -net axi_datamover_1_s_axis_s2mm_cmd_tready [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tready] [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tready]
+  connect_bd_net -net axi_datamover_1_s2mm_wr_xfer_cmplt [get_bd_pins axi_datamover_1/s2mm_wr_xfer_cmplt] [get_bd_pins tx_streamer_0/s2mm_wr_xfer_cmplt]
+  connect_bd_net -net tx_streamer_0_local_copy_en [get_bd_pins tx_streamer_0/local_copy_en] [get_bd_pins tx_local_dma_0/copy_en]
+  connect_bd_net -net tx_streamer_0_local_fill_start [get_bd_pins tx_streamer_0/local_fill_start] [get_bd_pins tx_local_dma_0/fill_start]
+  connect_bd_net -net tx_streamer_0_mc_replay_start [get_bd_pins tx_streamer_0/mc_replay_start] [get_bd_pins tx_local_dma_0/replay_start]
+  connect_bd_net -net tx_streamer_0_local_fill_len [get_bd_pins tx_streamer_0/local_fill_len] [get_bd_pins tx_local_dma_0/fill_len]
+  connect_bd_net -net tx_streamer_0_local_fill_pattern [get_bd_pins tx_streamer_0/local_fill_pattern] [get_bd_pins tx_local_dma_0/fill_pattern]
+  connect_bd_net -net tx_streamer_0_tx_cmd_ready [get_bd_pins tx_streamer_0/tx_cmd_ready] [get_bd_pins data_mover_controller_0/tx_cmd_ready]
+  connect_bd_net -net tx_streamer_0_tx_cpl_bytes_sent [get_bd_pins tx_streamer_0/tx_cpl_bytes_sent] [get_bd_pins data_mover_controller_0/tx_cpl_bytes_sent]
+  connect_bd_net -net tx_streamer_0_tx_cpl_atomic_orig [get_bd_pins tx_streamer_0/tx_cpl_atomic_orig] [get_bd_pins data_mover_controller_0/tx_cpl_atomic_orig]
+  connect_bd_net -net tx_streamer_0_tx_cpl_sq_index [get_bd_pins tx_streamer_0/tx_cpl_sq_index] [get_bd_pins data_mover_controller_0/tx_cpl_sq_index]
+  connect_bd_net -net tx_streamer_0_tx_cpl_status [get_bd_pins tx_streamer_0/tx_cpl_status] [get_bd_pins data_mover_controller_0/tx_cpl_status]
+  connect_bd_net -net tx_streamer_0_tx_cpl_valid [get_bd_pins tx_streamer_0/tx_cpl_valid] [get_bd_pins data_mover_controller_0/tx_cpl_valid]
+  connect_bd_net -net xlconstant_1_dout [get_bd_pins xlconstant_1/dout] [get_bd_pins axi_datamover_0/s_axis_s2mm_tkeep]
+  connect_bd_net -net xlconstant_2_dout [get_bd_pins xlconstant_2/dout] [get_bd_pins blk_mem_gen_0/rstb]
+  connect_bd_net -net xlconstant_4_dout [get_bd_pins xlconstant_4/dout] [get_bd_pins axi_datamover_1/mm2s_allow_addr_req]
+  connect_bd_net -net xlconstant_5_dout [get_bd_pins xlconstant_5/dout] [get_bd_pins rdma_axilite_ctrl_0/enable]
+  connect_bd_net -net eth_pkt_gen_0_m_axis_txc_data [get_bd_pins eth_pkt_gen_0/m_axis_txc_data] [get_bd_pins eth_tx_arb_0/s0_axis_txc_tdata]
+  connect_bd_net -net eth_pkt_gen_0_m_axis_txc_keep [get_bd_pins eth_pkt_gen_0/m_axis_txc_keep] [get_bd_pins eth_tx_arb_0/s0_axis_txc_tkeep]
+  connect_bd_net -net eth_pkt_gen_0_m_axis_txc_last [get_bd_pins eth_pkt_gen_0/m_axis_txc_last] [get_bd_pins eth_tx_arb_0/s0_axis_txc_tlast]
+  connect_bd_net -net eth_pkt_gen_0_m_axis_txc_valid [get_bd_pins eth_pkt_gen_0/m_axis_txc_valid] [get_bd_pins eth_tx_arb_0/s0_axis_txc_tvalid]
+  connect_bd_net -net eth_tx_arb_0_s0_axis_txc_tready [get_bd_pins eth_tx_arb_0/s0_axis_txc_tready] [get_bd_pins eth_pkt_gen_0/m_axis_txc_ready]
+  connect_bd_net -net eth_pkt_gen_1_m_axis_txc_data [get_bd_pins eth_pkt_gen_1/m_axis_txc_data] [get_bd_pins axi_ethernet_1/s_axis_txc_tdata]
+  connect_bd_net -net eth_pkt_gen_1_m_axis_txc_keep [get_bd_pins eth_pkt_gen_1/m_axis_txc_keep] [get_bd_pins axi_ethernet_1/s_axis_txc_tkeep]
+  connect_bd_net -net eth_pkt_gen_1_m_axis_txc_last [get_bd_pins eth_pkt_gen_1/m_axis_txc_last] [get_bd_pins axi_ethernet_1/s_axis_txc_tlast]
+  connect_bd_net -net eth_pkt_gen_1_m_axis_txc_valid [get_bd_pins eth_pkt_gen_1/m_axis_txc_valid] [get_bd_pins axi_ethernet_1/s_axis_txc_tvalid]
+  connect_bd_net -net axi_ethernet_1_s_axis_txc_tready [get_bd_pins axi_ethernet_1/s_axis_txc_tready] [get_bd_pins eth_pkt_gen_1/m_axis_txc_ready]
+  connect_bd_net -net axi_ethernet_0_refclk_clk_out1 [get_bd_pins axi_ethernet_0_refclk/clk_out1] [get_bd_pins axi_ethernet_0/ref_clk] [get_bd_pins axi_ethernet_1/ref_clk]
+  connect_bd_net -net axi_ethernet_0_refclk_clk_out2 [get_bd_pins axi_ethernet_0_refclk/clk_out2] [get_bd_pins axi_ethernet_0/gtx_clk] [get_bd_pins axi_ethernet_1/gtx_clk]
+  connect_bd_net -net axi_ethernet_0_phy_rst_n [get_bd_pins axi_ethernet_0/phy_rst_n] [get_bd_ports som240_1_connector_pl_gem2_reset]
+  connect_bd_net -net axi_ethernet_0_mac_irq [get_bd_pins axi_ethernet_0/mac_irq] [get_bd_pins xlconcat_0/In0]
+  connect_bd_net -net axi_ethernet_0_interrupt [get_bd_pins axi_ethernet_0/interrupt] [get_bd_pins xlconcat_0/In1]
+  connect_bd_net -net axi_ethernet_1_mac_irq [get_bd_pins axi_ethernet_1/mac_irq] [get_bd_pins xlconcat_0/In2]
+  connect_bd_net -net axi_ethernet_1_interrupt [get_bd_pins axi_ethernet_1/interrupt] [get_bd_pins xlconcat_0/In3]
+  connect_bd_net -net xlconcat_0_dout [get_bd_pins xlconcat_0/dout] [get_bd_pins zynq_ultra_ps_e_0/pl_ps_irq0]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxd_tdata [get_bd_pins axi_ethernet_0/m_axis_rxd_tdata] [get_bd_pins axis_rx_to_rdma_0/s_axis_tdata]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxd_tkeep [get_bd_pins axi_ethernet_0/m_axis_rxd_tkeep] [get_bd_pins axis_rx_to_rdma_0/s_axis_tkeep]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxd_tlast [get_bd_pins axi_ethernet_0/m_axis_rxd_tlast] [get_bd_pins axis_rx_to_rdma_0/s_axis_tlast]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxd_tvalid [get_bd_pins axi_ethernet_0/m_axis_rxd_tvalid] [get_bd_pins axis_rx_to_rdma_0/s_axis_tvalid]
+  connect_bd_net -net axis_rx_to_rdma_0_s_axis_tready [get_bd_pins axis_rx_to_rdma_0/s_axis_tready] [get_bd_pins axi_ethernet_0/m_axis_rxd_tready]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxs_tdata [get_bd_pins axi_ethernet_0/m_axis_rxs_tdata] [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tdata]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxs_tkeep [get_bd_pins axi_ethernet_0/m_axis_rxs_tkeep] [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tkeep]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxs_tlast [get_bd_pins axi_ethernet_0/m_axis_rxs_tlast] [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tlast]
+  connect_bd_net -net axi_ethernet_0_m_axis_rxs_tvalid [get_bd_pins axi_ethernet_0/m_axis_rxs_tvalid] [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tvalid]
+  connect_bd_net -net axis_rx_to_rdma_0_s_axis_rxs_tready [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tready] [get_bd_pins axi_ethernet_0/m_axis_rxs_tready]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxd_tdata [get_bd_pins axi_ethernet_1/m_axis_rxd_tdata] [get_bd_pins axis_rx_to_rdma_1/s_axis_tdata]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxd_tkeep [get_bd_pins axi_ethernet_1/m_axis_rxd_tkeep] [get_bd_pins axis_rx_to_rdma_1/s_axis_tkeep]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxd_tlast [get_bd_pins axi_ethernet_1/m_axis_rxd_tlast] [get_bd_pins axis_rx_to_rdma_1/s_axis_tlast]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxd_tvalid [get_bd_pins axi_ethernet_1/m_axis_rxd_tvalid] [get_bd_pins axis_rx_to_rdma_1/s_axis_tvalid]
+  connect_bd_net -net axis_rx_to_rdma_1_s_axis_tready [get_bd_pins axis_rx_to_rdma_1/s_axis_tready] [get_bd_pins axi_ethernet_1/m_axis_rxd_tready]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxs_tdata [get_bd_pins axi_ethernet_1/m_axis_rxs_tdata] [get_bd_pins axis_rx_to_rdma_1/s_axis_rxs_tdata]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxs_tkeep [get_bd_pins axi_ethernet_1/m_axis_rxs_tkeep] [get_bd_pins axis_rx_to_rdma_1/s_axis_rxs_tkeep]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxs_tlast [get_bd_pins axi_ethernet_1/m_axis_rxs_tlast] [get_bd_pins axis_rx_to_rdma_1/s_axis_rxs_tlast]
+  connect_bd_net -net axi_ethernet_1_m_axis_rxs_tvalid [get_bd_pins axi_ethernet_1/m_axis_rxs_tvalid] [get_bd_pins axis_rx_to_rdma_1/s_axis_rxs_tvalid]
+  connect_bd_net -net axis_rx_to_rdma_1_s_axis_rxs_tready [get_bd_pins axis_rx_to_rdma_1/s_axis_rxs_tready] [get_bd_pins axi_ethernet_1/m_axis_rxs_tready]
+  connect_bd_net -net axi_datamover_2_s2mm_wr_xfer_cmplt [get_bd_pins axi_datamover_2/s2mm_wr_xfer_cmplt] [get_bd_pins rx_streamer_0/s2mm_wr_xfer_cmplt]
+  connect_bd_net -net axis_data_fifo_0_axis_wr_data_count [get_bd_pins axis_data_fifo_0/axis_wr_data_count] [get_bd_pins rdma_axilite_rx_ctrl_0/rx_fifo_level]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_enforce [get_bd_pins rdma_axilite_rx_ctrl_0/mr_enforce] [get_bd_pins rx_streamer_0/mr_enforce]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_access [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_access] [get_bd_pins rx_streamer_0/mr_wr_access]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_en [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_en] [get_bd_pins rx_streamer_0/mr_wr_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_idx [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_idx] [get_bd_pins rx_streamer_0/mr_wr_idx]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_len [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_len] [get_bd_pins rx_streamer_0/mr_wr_len]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_pa [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_pa] [get_bd_pins rx_streamer_0/mr_wr_pa]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_rkey [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_rkey] [get_bd_pins rx_streamer_0/mr_wr_rkey]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_va [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_va] [get_bd_pins rx_streamer_0/mr_wr_va]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_valid [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_valid] [get_bd_pins rx_streamer_0/mr_wr_valid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pause_req [get_bd_pins rdma_axilite_rx_ctrl_0/pause_req] [get_bd_pins axi_ethernet_0/pause_req]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pause_val [get_bd_pins rdma_axilite_rx_ctrl_0/pause_val] [get_bd_pins axi_ethernet_0/pause_val]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cnp_en [get_bd_pins rdma_axilite_rx_ctrl_0/cnp_en] [get_bd_pins rx_streamer_0/cnp_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_psn_check_en [get_bd_pins rdma_axilite_rx_ctrl_0/psn_check_en] [get_bd_pins rx_streamer_0/psn_check_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_srq_enable [get_bd_pins rdma_axilite_rx_ctrl_0/srq_enable] [get_bd_pins rx_streamer_0/srq_enable]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_en [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_en] [get_bd_pins rx_streamer_0/rq_post_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_idx [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_idx] [get_bd_pins rx_streamer_0/rq_post_idx]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_wr_id [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_wr_id] [get_bd_pins rx_streamer_0/rq_post_wr_id]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_addr [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_addr] [get_bd_pins rx_streamer_0/rq_post_addr]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_len [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_len] [get_bd_pins rx_streamer_0/rq_post_len]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cq_pop [get_bd_pins rdma_axilite_rx_ctrl_0/cq_pop] [get_bd_pins rx_streamer_0/cq_pop]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cq_ring_en [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_en] [get_bd_pins rx_streamer_0/cq_ring_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pl_deliver_en [get_bd_pins rdma_axilite_rx_ctrl_0/pl_deliver_en] [get_bd_pins rx_streamer_0/pl_deliver_en]
+  connect_bd_net -net rx_header_parser_0_fragment_offset [get_bd_pins rx_header_parser_0/fragment_offset] [get_bd_pins rx_streamer_0/fragment_offset]
+  connect_bd_net -net rx_header_parser_0_header_valid [get_bd_pins rx_header_parser_0/header_valid] [get_bd_pins rx_streamer_0/header_valid]
+  connect_bd_net -net rx_header_parser_0_rdma_length [get_bd_pins rx_header_parser_0/rdma_length] [get_bd_pins rx_streamer_0/rdma_length]
+  connect_bd_net -net rx_header_parser_0_rdma_opcode [get_bd_pins rx_header_parser_0/rdma_opcode] [get_bd_pins rx_streamer_0/rdma_opcode]
+  connect_bd_net -net rx_header_parser_0_rdma_remote_addr [get_bd_pins rx_header_parser_0/rdma_remote_addr] [get_bd_pins rx_streamer_0/rdma_remote_addr]
+  connect_bd_net -net rx_header_parser_0_rdma_rkey [get_bd_pins rx_header_parser_0/rdma_rkey] [get_bd_pins rx_streamer_0/rdma_rkey]
+  connect_bd_net -net rx_header_parser_0_ecn_ce [get_bd_pins rx_header_parser_0/ecn_ce] [get_bd_pins rx_streamer_0/ecn_ce]
+  connect_bd_net -net rx_header_parser_0_rdma_service_level [get_bd_pins rx_header_parser_0/rdma_service_level] [get_bd_pins rx_streamer_0/service_level]
+  connect_bd_net -net rx_header_parser_0_more_fragments [get_bd_pins rx_header_parser_0/more_fragments] [get_bd_pins rx_streamer_0/more_fragments]
+  connect_bd_net -net rx_header_parser_0_rdma_psn [get_bd_pins rx_header_parser_0/rdma_psn] [get_bd_pins rx_streamer_0/rdma_psn]
+  connect_bd_net -net rx_header_parser_0_rdma_dest_qp [get_bd_pins rx_header_parser_0/rdma_dest_qp] [get_bd_pins rx_streamer_0/rdma_dest_qp]
+  connect_bd_net -net rx_header_parser_0_read_sink_addr [get_bd_pins rx_header_parser_0/read_sink_addr] [get_bd_pins rx_streamer_0/read_sink_addr]
+  connect_bd_net -net rx_header_parser_0_read_sink_rkey [get_bd_pins rx_header_parser_0/read_sink_rkey] [get_bd_pins rx_streamer_0/read_sink_rkey]
+  connect_bd_net -net rx_header_parser_0_header_only [get_bd_pins rx_header_parser_0/header_only] [get_bd_pins rx_streamer_0/header_only]
+  connect_bd_net -net rx_header_parser_0_rdma_imm [get_bd_pins rx_header_parser_0/rdma_imm] [get_bd_pins rx_streamer_0/rdma_imm]
+  connect_bd_net -net rx_header_parser_0_atomic_data [get_bd_pins rx_header_parser_0/atomic_data] [get_bd_pins rx_streamer_0/atomic_data]
+  connect_bd_net -net rx_header_parser_0_atomic_compare [get_bd_pins rx_header_parser_0/atomic_compare] [get_bd_pins rx_streamer_0/atomic_compare]
+  connect_bd_net -net rx_streamer_0_drop_payload [get_bd_pins rx_streamer_0/drop_payload] [get_bd_pins rx_header_parser_0/drop_payload]
+  connect_bd_net -net rx_streamer_0_pl_payload [get_bd_pins rx_streamer_0/pl_payload] [get_bd_pins rx_header_parser_0/pl_payload]
+  connect_bd_net -net rx_header_parser_0_pl_payload_done [get_bd_pins rx_header_parser_0/pl_payload_done] [get_bd_pins rx_streamer_0/pl_xfer_cmplt]
+  connect_bd_net -net rx_streamer_0_mr_violation [get_bd_pins rx_streamer_0/mr_violation] [get_bd_pins rdma_axilite_rx_ctrl_0/mr_violation]
+  connect_bd_net -net rx_streamer_0_rq_level [get_bd_pins rx_streamer_0/rq_level] [get_bd_pins rdma_axilite_rx_ctrl_0/rq_level]
+  connect_bd_net -net rx_streamer_0_cq_valid [get_bd_pins rx_streamer_0/cq_valid] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_valid]
+  connect_bd_net -net rx_streamer_0_cq_wr_id [get_bd_pins rx_streamer_0/cq_wr_id] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_wr_id]
+  connect_bd_net -net rx_streamer_0_cq_byte_len [get_bd_pins rx_streamer_0/cq_byte_len] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_byte_len]
+  connect_bd_net -net rx_streamer_0_cq_info [get_bd_pins rx_streamer_0/cq_info] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_info]
+  connect_bd_net -net rx_streamer_0_cq_imm [get_bd_pins rx_streamer_0/cq_imm] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_imm]
+  connect_bd_net -net rx_streamer_0_cq_count [get_bd_pins rx_streamer_0/cq_count] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_count]
+  connect_bd_net -net rx_streamer_0_cq_overflow [get_bd_pins rx_streamer_0/cq_overflow] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_overflow]
+  connect_bd_net -net rx_streamer_0_cq_ring_cqe [get_bd_pins rx_streamer_0/cq_ring_cqe] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_cqe]
+  connect_bd_net -net rx_streamer_0_cq_ring_push [get_bd_pins rx_streamer_0/cq_ring_push] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_push]
+  connect_bd_net -net rx_streamer_0_recv_rnr [get_bd_pins rx_streamer_0/recv_rnr] [get_bd_pins rdma_axilite_rx_ctrl_0/recv_rnr]
+  connect_bd_net -net rx_streamer_0_ecn_marked [get_bd_pins rx_streamer_0/ecn_marked] [get_bd_pins rdma_axilite_rx_ctrl_0/ecn_marked]
+  connect_bd_net -net rx_streamer_0_psn_error [get_bd_pins rx_streamer_0/psn_error] [get_bd_pins rdma_axilite_rx_ctrl_0/psn_error]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tdata [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tdata] [get_bd_pins eth_tx_arb_0/s1_axis_txc_tdata]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tkeep [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tkeep] [get_bd_pins eth_tx_arb_0/s1_axis_txc_tkeep]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tvalid [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tvalid] [get_bd_pins eth_tx_arb_0/s1_axis_txc_tvalid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tlast [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tlast] [get_bd_pins eth_tx_arb_0/s1_axis_txc_tlast]
+  connect_bd_net -net eth_tx_arb_0_s1_axis_txc_tready [get_bd_pins eth_tx_arb_0/s1_axis_txc_tready] [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tready]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tdata [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tdata] [get_bd_pins eth_tx_arb_0/s1_axis_txd_tdata]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tkeep [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tkeep] [get_bd_pins eth_tx_arb_0/s1_axis_txd_tkeep]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tvalid [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tvalid] [get_bd_pins eth_tx_arb_0/s1_axis_txd_tvalid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tlast [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tlast] [get_bd_pins eth_tx_arb_0/s1_axis_txd_tlast]
+  connect_bd_net -net eth_tx_arb_0_s1_axis_txd_tready [get_bd_pins eth_tx_arb_0/s1_axis_txd_tready] [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tready]
+  connect_bd_net -net rx_streamer_0_rd_rsp_valid [get_bd_pins rx_streamer_0/rd_rsp_valid] [get_bd_pins tx_streamer_0/rd_rsp_valid]
+  connect_bd_net -net rx_streamer_0_rd_rsp_src_addr [get_bd_pins rx_streamer_0/rd_rsp_src_addr] [get_bd_pins tx_streamer_0/rd_rsp_src_addr]
+  connect_bd_net -net rx_streamer_0_rd_rsp_length [get_bd_pins rx_streamer_0/rd_rsp_length] [get_bd_pins tx_streamer_0/rd_rsp_length]
+  connect_bd_net -net rx_streamer_0_rd_rsp_remote_addr [get_bd_pins rx_streamer_0/rd_rsp_remote_addr] [get_bd_pins tx_streamer_0/rd_rsp_remote_addr]
+  connect_bd_net -net rx_streamer_0_rd_rsp_rkey [get_bd_pins rx_streamer_0/rd_rsp_rkey] [get_bd_pins tx_streamer_0/rd_rsp_rkey]
+  connect_bd_net -net rx_streamer_0_rd_rsp_dest_qp [get_bd_pins rx_streamer_0/rd_rsp_dest_qp] [get_bd_pins tx_streamer_0/rd_rsp_dest_qp]
+  connect_bd_net -net rx_streamer_0_rd_rsp_psn [get_bd_pins rx_streamer_0/rd_rsp_psn] [get_bd_pins tx_streamer_0/rd_rsp_psn]
+  connect_bd_net -net rx_streamer_0_rd_rsp_atomic [get_bd_pins rx_streamer_0/rd_rsp_atomic] [get_bd_pins tx_streamer_0/rd_rsp_atomic]
+  connect_bd_net -net rx_streamer_0_rd_rsp_orig [get_bd_pins rx_streamer_0/rd_rsp_orig] [get_bd_pins tx_streamer_0/rd_rsp_orig]
+  connect_bd_net -net rx_streamer_0_rd_rsp_sl [get_bd_pins rx_streamer_0/rd_rsp_sl] [get_bd_pins tx_streamer_0/rd_rsp_sl]
+  connect_bd_net -net rx_streamer_0_read_done [get_bd_pins rx_streamer_0/read_done] [get_bd_pins tx_streamer_0/read_done]
+  connect_bd_net -net rx_streamer_0_atomic_done [get_bd_pins rx_streamer_0/atomic_done] [get_bd_pins tx_streamer_0/atomic_done]
+  connect_bd_net -net rx_streamer_0_atomic_orig [get_bd_pins rx_streamer_0/atomic_orig] [get_bd_pins tx_streamer_0/atomic_orig]
+  connect_bd_net -net rx_streamer_0_ack_tx_valid [get_bd_pins rx_streamer_0/ack_tx_valid] [get_bd_pins tx_streamer_0/ack_tx_valid]
+  connect_bd_net -net rx_streamer_0_ack_tx_dest_qp [get_bd_pins rx_streamer_0/ack_tx_dest_qp] [get_bd_pins tx_streamer_0/ack_tx_dest_qp]
+  connect_bd_net -net rx_streamer_0_ack_tx_psn [get_bd_pins rx_streamer_0/ack_tx_psn] [get_bd_pins tx_streamer_0/ack_tx_psn]
+  connect_bd_net -net rx_streamer_0_ack_tx_syndrome [get_bd_pins rx_streamer_0/ack_tx_syndrome] [get_bd_pins tx_streamer_0/ack_tx_syndrome]
+  connect_bd_net -net rx_streamer_0_ack_rcvd [get_bd_pins rx_streamer_0/ack_rcvd] [get_bd_pins tx_streamer_0/ack_rcvd]
+  connect_bd_net -net rx_streamer_0_ack_rcvd_dest_qp [get_bd_pins rx_streamer_0/ack_rcvd_dest_qp] [get_bd_pins tx_streamer_0/ack_rcvd_dest_qp]
+  connect_bd_net -net rx_streamer_0_ack_rcvd_psn [get_bd_pins rx_streamer_0/ack_rcvd_psn] [get_bd_pins tx_streamer_0/ack_rcvd_psn]
+  connect_bd_net -net rx_streamer_0_ack_rcvd_syndrome [get_bd_pins rx_streamer_0/ack_rcvd_syndrome] [get_bd_pins tx_streamer_0/ack_rcvd_syndrome]
+  connect_bd_net -net rx_streamer_0_cnp_tx_valid [get_bd_pins rx_streamer_0/cnp_tx_valid] [get_bd_pins tx_streamer_0/cnp_tx_valid]
+  connect_bd_net -net rx_streamer_0_cnp_tx_dest_qp [get_bd_pins rx_streamer_0/cnp_tx_dest_qp] [get_bd_pins tx_streamer_0/cnp_tx_dest_qp]
+  connect_bd_net -net rx_streamer_0_cnp_rcvd [get_bd_pins rx_streamer_0/cnp_rcvd] [get_bd_pins tx_streamer_0/cnp_rcvd]
+  connect_bd_net -net rx_streamer_0_cnp_rcvd_dest_qp [get_bd_pins rx_streamer_0/cnp_rcvd_dest_qp] [get_bd_pins tx_streamer_0/cnp_rcvd_dest_qp]
+  connect_bd_net -net tx_streamer_0_rd_rsp_ready [get_bd_pins tx_streamer_0/rd_rsp_ready] [get_bd_pins rx_streamer_0/rd_rsp_ready]
+  connect_bd_net -net tx_streamer_0_ack_tx_ready [get_bd_pins tx_streamer_0/ack_tx_ready] [get_bd_pins rx_streamer_0/ack_tx_ready]
+  connect_bd_net -net tx_streamer_0_cnp_tx_ready [get_bd_pins tx_streamer_0/cnp_tx_ready] [get_bd_pins rx_streamer_0/cnp_tx_ready]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_learn_valid [get_bd_pins rdma_axilite_rx_ctrl_0/learn_valid] [get_bd_pins rdma_axilite_ctrl_0/learn_valid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_learn_ip [get_bd_pins rdma_axilite_rx_ctrl_0/learn_ip] [get_bd_pins rdma_axilite_ctrl_0/learn_ip]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_learn_mac [get_bd_pins rdma_axilite_rx_ctrl_0/learn_mac] [get_bd_pins rdma_axilite_ctrl_0/learn_mac]
+  connect_bd_net -net xlconstant_0_dout [get_bd_pins xlconstant_0/dout] [get_bd_pins axi_datamover_0/s2mm_allow_addr_req] [get_bd_pins axis_rx_to_rdma_0/capture_en] [get_bd_pins axis_rx_to_rdma_1/capture_en]
+  connect_bd_net -net xlconstant_3_dout [get_bd_pins xlconstant_3/dout] [get_bd_pins axi_datamover_1/s2mm_allow_addr_req] [get_bd_pins axi_datamover_2/s2mm_allow_addr_req]
+  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn1 [get_bd_pins rst_ps8_0_99M/peripheral_aresetn] [get_bd_pins axi_datamover_0/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_0/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins smartconnect_1/aresetn] [get_bd_pins data_mover_controller_0/s00_axi_aresetn] [get_bd_pins data_mover_controller_0/s00_axis_aresetn] [get_bd_pins data_mover_controller_0/m00_axis_aresetn] [get_bd_pins axi_interconnect_0/ARESETN] [get_bd_pins axi_interconnect_0/M00_ARESETN] [get_bd_pins axi_interconnect_0/S00_ARESETN] [get_bd_pins axi_ethernet_1/s_axi_lite_resetn] [get_bd_pins axi_ethernet_1/axi_txd_arstn] [get_bd_pins axi_ethernet_1/axi_txc_arstn] [get_bd_pins axi_ethernet_1/axi_rxd_arstn] [get_bd_pins axi_ethernet_1/axi_rxs_arstn] [get_bd_pins eth_pkt_gen_0/aresetn] [get_bd_pins tx_header_inserter_0/aresetn] [get_bd_pins rdma_axilite_ctrl_0/rst_n] [get_bd_pins axis_data_fifo_1/s_axis_aresetn] [get_bd_pins tx_streamer_0/aresetn] [get_bd_pins tx_local_dma_0/aresetn] [get_bd_pins tx_link_stripe_0/aresetn] [get_bd_pins axi_datamover_2/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_2/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins axi_interconnect_0/M01_ARESETN] [get_bd_pins axi_interconnect_0/M02_ARESETN] [get_bd_pins axi_ethernet_0/s_axi_lite_resetn] [get_bd_pins axi_ethernet_0/axi_txd_arstn] [get_bd_pins axi_ethernet_0/axi_txc_arstn] [get_bd_pins axi_ethernet_0/axi_rxd_arstn] [get_bd_pins axi_ethernet_0/axi_rxs_arstn] [get_bd_pins eth_pkt_gen_1/aresetn] [get_bd_pins eth_tx_arb_0/aresetn] [get_bd_pins rx_streamer_0/aresetn] [get_bd_pins rdma_axilite_rx_ctrl_0/rst_n] [get_bd_pins rx_header_parser_0/aresetn] [get_bd_pins axis_data_fifo_0/s_axis_aresetn] [get_bd_pins axis_rx_to_rdma_0/axis_aresetn] [get_bd_pins axis_rx_to_rdma_1/axis_aresetn] [get_bd_pins rx_link_merge_0/aresetn]
+  connect_bd_net -net zynq_ultra_ps_e_0_pl_clk0 [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_fpd_aclk] [get_bd_pins rst_ps8_0_99M/slowest_sync_clk] [get_bd_pins axi_bram_ctrl_0/s_axi_aclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc0_fpd_aclk] [get_bd_pins smartconnect_0/aclk] [get_bd_pins axi_datamover_0/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_0/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_awclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc1_fpd_aclk] [get_bd_pins axi_datamover_1/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_1/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_awclk] [get_bd_pins smartconnect_1/aclk] [get_bd_pins data_mover_controller_0/s00_axi_aclk] [get_bd_pins data_mover_controller_0/s00_axis_aclk] [get_bd_pins data_mover_controller_0/m00_axis_aclk] [get_bd_pins blk_mem_gen_0/clkb] [get_bd_pins axi_ethernet_1/s_axi_lite_clk] [get_bd_pins axi_ethernet_1/axis_clk] [get_bd_pins axi_interconnect_0/ACLK] [get_bd_pins axi_interconnect_0/M00_ACLK] [get_bd_pins axi_interconnect_0/S00_ACLK] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_lpd_aclk] [get_bd_pins eth_pkt_gen_0/aclk] [get_bd_pins tx_header_inserter_0/aclk] [get_bd_pins rdma_axilite_ctrl_0/clk] [get_bd_pins axis_data_fifo_1/s_axis_aclk] [get_bd_pins tx_streamer_0/aclk] [get_bd_pins tx_local_dma_0/aclk] [get_bd_pins tx_link_stripe_0/aclk] [get_bd_pins axi_datamover_2/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_2/m_axis_s2mm_cmdsts_awclk] [get_bd_pins axi_interconnect_0/M01_ACLK] [get_bd_pins axi_interconnect_0/M02_ACLK] [get_bd_pins axi_ethernet_0/s_axi_lite_clk] [get_bd_pins axi_ethernet_0/axis_clk] [get_bd_pins eth_pkt_gen_1/aclk] [get_bd_pins eth_tx_arb_0/aclk] [get_bd_pins rx_streamer_0/aclk] [get_bd_pins rdma_axilite_rx_ctrl_0/clk] [get_bd_pins rx_header_parser_0/aclk] [get_bd_pins axis_data_fifo_0/s_axis_aclk] [get_bd_pins axis_rx_to_rdma_0/axis_clk] [get_bd_pins axis_rx_to_rdma_1/axis_clk] [get_bd_pins rx_link_merge_0/aclk]
+  connect_bd_net -net zynq_ultra_ps_e_0_pl_resetn0 [get_bd_pins zynq_ultra_ps_e_0/pl_resetn0] [get_bd_pins rst_ps8_0_99M/ext_reset_in]
+
+  # Create address segments
+  assign_bd_address -offset 0xA0030000 -range 0x00002000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs axi_bram_ctrl_0/S_AXI/Mem0] -force
+  assign_bd_address -offset 0x80000000 -range 0x00040000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs axi_ethernet_0/s_axi/Reg0] -force
+  assign_bd_address -offset 0x80040000 -range 0x00010000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs rdma_axilite_rx_ctrl_0/s_axi/reg0] -force
+  assign_bd_address -offset 0x80080000 -range 0x00040000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs axi_ethernet_1/s_axi/Reg0] -force
+  assign_bd_address -offset 0xA0000000 -range 0x00010000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs data_mover_controller_0/S00_AXI/S00_AXI_reg] -force
+  assign_bd_address -offset 0xA0030000 -range 0x00002000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs axi_bram_ctrl_0/S_AXI/Mem0] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_LOW] -force
+  assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_QSPI] -force
+  assign_bd_address -offset 0xA0030000 -range 0x00002000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs axi_bram_ctrl_0/S_AXI/Mem0] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_LOW] -force
+  assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_QSPI] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_2/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_2/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_2/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rx_streamer_0/m_axi_atomic] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rx_streamer_0/m_axi_atomic] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+
+  # Exclude Address Segments
+  exclude_bd_addr_seg -offset 0xA0000000 -range 0x00010000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs data_mover_controller_0/S00_AXI/S00_AXI_reg]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_LPS_OCM]
+  exclude_bd_addr_seg -offset 0xA0000000 -range 0x00010000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs data_mover_controller_0/S00_AXI/S00_AXI_reg]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_LPS_OCM]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_2/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
+  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000800000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH]
+  exclude_bd_addr_seg -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_LOW]
+  exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_LPS_OCM]
+  exclude_bd_addr_seg -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_QSPI]
+
+
+  # Restore current instance
+  current_bd_instance $oldCurInst
+
+  # Create PFM attributes
+  set_property PFM_NAME {vendor:lib:kria_base:1.0} [get_files [current_bd_design].bd]
+  set_property PFM.AXI_PORT {S_AXI_HP0_FPD { memport "S_AXI_HP" sptag "" memory "" is_range "false" } S_AXI_HP1_FPD { memport "S_AXI_HP" sptag "" memory "" is_range "false" } S_AXI_HP2_FPD { memport "S_AXI_HP" sptag "" memory "" is_range "false" } S_AXI_HP3_FPD { memport "S_AXI_HP" sptag "" memory "" is_range "false" } } [get_bd_cells /zynq_ultra_ps_e_0]
+
+
+  validate_bd_design
+  save_bd_design
+}
+# End of create_root_design()
+
+
+##################################################################
+# MAIN FLOW
+##################################################################
+
+create_root_design ""
+
+
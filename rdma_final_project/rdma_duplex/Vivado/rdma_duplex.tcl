@@ -0,0 +1,293 @@
+#*****************************************************************************************
+# Vivado (TM) v2024.1 (64-bit)
+#
+# rdma_duplex.tcl: Tcl script for re-creating project 'rdma_duplex'
+#
+# This file contains the Vivado Tcl commands for re-creating the project. In order to
+# re-create the project, please source this file in the Vivado Tcl Shell.
+#
+# * Note that the runs in the created project will not be launched automatically. To
+#   generate the bitstream please launch the synthesis/implementation runs as needed.
+#
+#*****************************************************************************************
+# NOTE: The duplex design has no RTL of its own apart from eth_tx_arb.v; the TX and RX
+#       pipelines are imported from the sibling projects:-
+#
+# 1. ../../rdma_tx/Vivado/src and ../../rdma_tx/Vivado/ip_repo (data_mover_controller)
+# 2. ../../rdma_rx/Vivado/src
+# 3. ./src/eth_tx_arb.v
+#
+# The block design is created by sourcing ./bd/design_1.tcl.
+#
+#*****************************************************************************************
+
+# Check file required for this script exists
+proc checkRequiredFiles { origin_dir} {
+  set status true
+  set files [list \
+ "[file normalize "$origin_dir/src/eth_tx_arb.v"]"\
+ "[file normalize "$origin_dir/bd/design_1.tcl"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/tx_header_inserter.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/tx_streamer.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/tx_local_dma.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/tx_link_stripe.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/eth_pkt_gen.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/ip_eth_tx_64_rdma.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/rdma_ip_encap_integrated.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/rdma_meta_validator.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/endpoint_lookup.v"]"\
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/src/rdma_axilite_ctrl.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_streamer.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_header_parser.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/axis_rx_to_rdma.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/ip_eth_rx_64_rdma.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rdma_hdr_validator.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rdma_ip_decap_integrated.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rdma_axilite_rx_ctrl.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_mr_table.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_recv_queue.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_atomic_unit.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_arp_unit.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_exc_queue.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_cq_ring.v"]"\
+ "[file normalize "$origin_dir/../../rdma_rx/Vivado/src/rx_link_merge.v"]"\
+  ]
+  foreach ifile $files {
+    if { ![file isfile $ifile] } {
+      puts " Could not find local file $ifile "
+      set status false
+    }
+  }
+
+  set paths [list \
+ "[file normalize "$origin_dir/../../rdma_tx/Vivado/ip_repo"]"\
+  ]
+  foreach ipath $paths {
+    if { ![file isdirectory $ipath] } {
+      puts " Could not access $ipath "
+      set status false
+    }
+  }
+
+  return $status
+}
+# Set the reference directory for source file relative paths (by default the value is script directory path)
+set origin_dir "."
+
+# Use origin directory path location variable, if specified in the tcl shell
+if { [info exists ::origin_dir_loc] } {
+  set origin_dir $::origin_dir_loc
+}
+
+# Set the project name
+set _xil_proj_name_ "rdma_duplex_final"
+
+# Use project name variable, if specified in the tcl shell
+if { [info exists ::user_project_name] } {
+  set _xil_proj_name_ $::user_project_name
+}
+
+variable script_file
+set script_file "rdma_duplex.tcl"
+
+# Help information for this script
+proc print_help {} {
+  variable script_file
+  puts "\nDescription:"
+  puts "Create the full-duplex RDMA project (TX and RX pipelines in one block design)."
+  puts "Sources are taken from the rdma_tx and rdma_rx projects next to this one.\n"
+  puts "Syntax:"
+  puts "$script_file"
+  puts "$script_file -tclargs \[--origin_dir <path>\]"
+  puts "$script_file -tclargs \[--project_name <name>\]"
+  puts "$script_file -tclargs \[--help\]\n"
+  puts "Usage:"
+  puts "Name                   Description"
+  puts "-------------------------------------------------------------------------"
+  puts "\[--origin_dir <path>\]  Determine source file paths wrt this path. Default"
+  puts "                       origin_dir path value is \".\".\n"
+  puts "\[--project_name <name>\] Create project with the specified name. Default"
+  puts "                       name is \"rdma_duplex_final\".\n"
+  puts "\[--help\]               Print help information for this script"
+  puts "-------------------------------------------------------------------------\n"
+  exit 0
+}
+
+if { $::argc > 0 } {
+  for {set i 0} {$i < $::argc} {incr i} {
+    set option [string trim [lindex $::argv $i]]
+    switch -regexp -- $option {
+      "--origin_dir"   { incr i; set origin_dir [lindex $::argv $i] }
+      "--project_name" { incr i; set _xil_proj_name_ [lindex $::argv $i] }
+      "--help"         { print_help }
+      default {
+        if { [regexp {^-} $option] } {
+          puts "ERROR: Unknown option '$option' specified, please type '$script_file -tclargs --help' for usage info.\n"
+          return 1
+        }
+      }
+    }
+  }
+}
+
+set tx_dir "[file normalize "$origin_dir/../../rdma_tx/Vivado"]"
+set rx_dir "[file normalize "$origin_dir/../../rdma_rx/Vivado"]"
+
+# Check for paths and files needed for project creation
+set validate_required 1
+if { $validate_required } {
+  if { [checkRequiredFiles $origin_dir] } {
+    puts "Tcl file $script_file is valid. All files required for project creation is accesable. "
+  } else {
+    puts "Tcl file $script_file is not valid. Not all files required for project creation is accesable. "
+    return
+  }
+}
+
+# Create project
+create_project ${_xil_proj_name_} ./${_xil_proj_name_} -part xck26-sfvc784-2LV-c
+
+# Set the directory path for the new project
+set proj_dir [get_property directory [current_project]]
+
+# Set project properties
+set obj [current_project]
+set_property -name "board_part" -value "xilinx.com:kr260_som:part0:1.1" -objects $obj
+set_property -name "board_connections" -value "som240_2_connector xilinx.com:kr260_carrier:som240_2_connector:1.1 som240_1_connector xilinx.com:kr260_carrier:som240_1_connector:1.1" -objects $obj
+set_property -name "default_lib" -value "xil_defaultlib" -objects $obj
+set_property -name "enable_vhdl_2008" -value "1" -objects $obj
+set_property -name "ip_cache_permissions" -value "read write" -objects $obj
+set_property -name "ip_output_repo" -value "$proj_dir/${_xil_proj_name_}.cache/ip" -objects $obj
+set_property -name "mem.enable_memory_map_generation" -value "1" -objects $obj
+set_property -name "platform.board_id" -value "lib" -objects $obj
+set_property -name "platform.name" -value "kria_base" -objects $obj
+set_property -name "platform.vendor" -value "vendor" -objects $obj
+set_property -name "platform.version" -value "1.0" -objects $obj
+set_property -name "revised_directory_structure" -value "1" -objects $obj
+set_property -name "sim.central_dir" -value "$proj_dir/${_xil_proj_name_}.ip_user_files" -objects $obj
+set_property -name "sim.ip.auto_export_scripts" -value "1" -objects $obj
+set_property -name "simulator_language" -value "Mixed" -objects $obj
+set_property -name "xpm_libraries" -value "XPM_CDC XPM_FIFO XPM_MEMORY" -objects $obj
+
+# Create 'sources_1' fileset (if not found)
+if {[string equal [get_filesets -quiet sources_1] ""]} {
+  create_fileset -srcset sources_1
+}
+
+# Set IP repository paths (data_mover_controller)
+set obj [get_filesets sources_1]
+if { $obj != {} } {
+   set_property "ip_repo_paths" "[file normalize "$tx_dir/ip_repo"]" $obj
+
+   # Rebuild user ip_repo's index before adding any source files
+   update_ip_catalog -rebuild
+}
+
+# Set 'sources_1' fileset object
+set obj [get_filesets sources_1]
+# Import the TX pipeline, the RX pipeline and the MAC arbiter
+set files [list \
+ [file normalize "${tx_dir}/src/tx_header_inserter.v"]\
+ [file normalize "${tx_dir}/src/tx_streamer.v"]\
+ [file normalize "${tx_dir}/src/tx_local_dma.v"]\
+ [file normalize "${tx_dir}/src/tx_link_stripe.v"]\
+ [file normalize "${tx_dir}/src/eth_pkt_gen.v"]\
+ [file normalize "${tx_dir}/src/ip_eth_tx_64_rdma.v"]\
+ [file normalize "${tx_dir}/src/rdma_ip_encap_integrated.v"]\
+ [file normalize "${tx_dir}/src/rdma_meta_validator.v"]\
+ [file normalize "${tx_dir}/src/endpoint_lookup.v"]\
+ [file normalize "${tx_dir}/src/rdma_axilite_ctrl.v"]\
+ [file normalize "${rx_dir}/src/rx_streamer.v"]\
+ [file normalize "${rx_dir}/src/rx_header_parser.v"]\
+ [file normalize "${rx_dir}/src/axis_rx_to_rdma.v"]\
+ [file normalize "${rx_dir}/src/ip_eth_rx_64_rdma.v"]\
+ [file normalize "${rx_dir}/src/rdma_hdr_validator.v"]\
+ [file normalize "${rx_dir}/src/rdma_ip_decap_integrated.v"]\
+ [file normalize "${rx_dir}/src/rdma_axilite_rx_ctrl.v"]\
+ [file normalize "${rx_dir}/src/rx_mr_table.v"]\
+ [file normalize "${rx_dir}/src/rx_recv_queue.v"]\
+ [file normalize "${rx_dir}/src/rx_atomic_unit.v"]\
+ [file normalize "${rx_dir}/src/rx_arp_unit.v"]\
+ [file normalize "${rx_dir}/src/rx_exc_queue.v"]\
+ [file normalize "${rx_dir}/src/rx_cq_ring.v"]\
+ [file normalize "${rx_dir}/src/rx_link_merge.v"]\
+ [file normalize "${origin_dir}/src/eth_tx_arb.v"]\
+]
+set imported_files ""
+foreach f $files {
+  lappend imported_files [import_files -fileset sources_1 $f]
+}
+
+# Set 'sources_1' fileset properties
+set obj [get_filesets sources_1]
+set_property -name "dataflow_viewer_settings" -value "min_width=16" -objects $obj
+set_property -name "top" -value "design_1_wrapper" -objects $obj
+set_property -name "top_auto_set" -value "0" -objects $obj
+
+# Create 'constrs_1' fileset (if not found)
+if {[string equal [get_filesets -quiet constrs_1] ""]} {
+  create_fileset -constrset constrs_1
+}
+
+# Set 'constrs_1' fileset object
+set obj [get_filesets constrs_1]
+
+# Empty: pins and clocks come from the board interfaces of both MACs
+
+# Create 'sim_1' fileset (if not found)
+if {[string equal [get_filesets -quiet sim_1] ""]} {
+  create_fileset -simset sim_1
+}
+
+# Set 'sim_1' fileset properties
+set obj [get_filesets sim_1]
+set_property -name "top" -value "design_1_wrapper" -objects $obj
+set_property -name "top_lib" -value "xil_defaultlib" -objects $obj
+
+# Create BD design_1 (TX and RX pipelines, both MACs)
+source [file normalize "${origin_dir}/bd/design_1.tcl"]
+set_property GENERATE_SYNTH_CHECKPOINT "0" [get_files design_1.bd ]
+set_property PFM_NAME "vendor:lib:kria_base:1.0" [get_files design_1.bd ]
+set_property REGISTERED_WITH_MANAGER "1" [get_files design_1.bd ]
+
+#call make_wrapper to create wrapper files
+if { [get_property IS_LOCKED [ get_files -norecurse [list design_1.bd]] ] == 1  } {
+  import_files -fileset sources_1 [file normalize "${origin_dir}/hdl/design_1_wrapper.v" ]
+} else {
+  set wrapper_path [make_wrapper -fileset sources_1 -files [ get_files -norecurse [list design_1.bd]] -top]
+  add_files -norecurse -fileset sources_1 $wrapper_path
+}
+
+# Create 'synth_1' run (if not found)
+if {[string equal [get_runs -quiet synth_1] ""]} {
+    create_run -name synth_1 -part xck26-sfvc784-2LV-c -flow {Vivado Synthesis 2024} -strategy "Vivado Synthesis Defaults" -report_strategy {No Reports} -constrset constrs_1
+} else {
+  set_property strategy "Vivado Synthesis Defaults" [get_runs synth_1]
+  set_property flow "Vivado Synthesis 2024" [get_runs synth_1]
+}
+set obj [get_runs synth_1]
+set_property set_report_strategy_name 1 $obj
+set_property report_strategy {Vivado Synthesis Default Reports} $obj
+set_property set_report_strategy_name 0 $obj
+
+# set the current synth run
+current_run -synthesis [get_runs synth_1]
+
+# Create 'impl_1' run (if not found)
+if {[string equal [get_runs -quiet impl_1] ""]} {
+    create_run -name impl_1 -part xck26-sfvc784-2LV-c -flow {Vivado Implementation 2024} -strategy "Vivado Implementation Defaults" -report_strategy {No Reports} -constrset constrs_1 -parent_run synth_1
+} else {
+  set_property strategy "Vivado Implementation Defaults" [get_runs impl_1]
+  set_property flow "Vivado Implementation 2024" [get_runs impl_1]
+}
+set obj [get_runs impl_1]
+set_property set_report_strategy_name 1 $obj
+set_property report_strategy {Vivado Implementation Default Reports} $obj
+set_property set_report_strategy_name 0 $obj
+set_property -name "steps.write_bitstream.args.readback_file" -value "0" -objects $obj
+set_property -name "steps.write_bitstream.args.verbose" -value "0" -objects $obj
+
+# set the current impl run
+current_run -implementation [get_runs impl_1]
+
+puts "INFO: Project created:${_xil_proj_name_}"
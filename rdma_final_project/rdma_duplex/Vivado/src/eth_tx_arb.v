@@ -0,0 +1,115 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/19/2026 12:31:05 AM
+-- Design Name:
+-- Module Name: eth_tx_arb
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Shares the TX side of one AXI Ethernet MAC between two frame
+--              sources, each with its own control (txc) and data (txd)
+--              stream:
+--                source 0: RDMA frames (eth_pkt_gen_0)
+--                source 1: ARP replies (rdma_axilite_rx_ctrl m_axis_arp_*)
+--              A source owns the MAC from its first control word until the
+--              last data beat of the frame; when both have a frame waiting
+--              they take turns.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   Both sources present the control stream first, so txc valid is the
+--   request. The MAC needs the control words of a frame before its data,
+--   which holding the grant over both streams guarantees.
+--   The source that is not selected is held off (tready low).
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module eth_tx_arb (
+    input  wire         aclk,
+    input  wire         aresetn,
+
+    // Source 0 (from eth_pkt_gen_0)
+    input  wire [31:0]  s0_axis_txc_tdata,
+    input  wire [3:0]   s0_axis_txc_tkeep,
+    input  wire         s0_axis_txc_tvalid,
+    output wire         s0_axis_txc_tready,
+    input  wire         s0_axis_txc_tlast,
+    input  wire [31:0]  s0_axis_txd_tdata,
+    input  wire [3:0]   s0_axis_txd_tkeep,
+    input  wire         s0_axis_txd_tvalid,
+    output wire         s0_axis_txd_tready,
+    input  wire         s0_axis_txd_tlast,
+
+    // Source 1 (from rdma_axilite_rx_ctrl_0 m_axis_arp_txc / m_axis_arp_txd)
+    input  wire [31:0]  s1_axis_txc_tdata,
+    input  wire [3:0]   s1_axis_txc_tkeep,
+    input  wire         s1_axis_txc_tvalid,
+    output wire         s1_axis_txc_tready,
+    input  wire         s1_axis_txc_tlast,
+    input  wire [31:0]  s1_axis_txd_tdata,
+    input  wire [3:0]   s1_axis_txd_tkeep,
+    input  wire         s1_axis_txd_tvalid,
+    output wire         s1_axis_txd_tready,
+    input  wire         s1_axis_txd_tlast,
+
+    // To axi_ethernet_0 s_axis_txc / s_axis_txd
+    output wire [31:0]  m_axis_txc_tdata,
+    output wire [3:0]   m_axis_txc_tkeep,
+    output wire         m_axis_txc_tvalid,
+    input  wire         m_axis_txc_tready,
+    output wire         m_axis_txc_tlast,
+    output wire [31:0]  m_axis_txd_tdata,
+    output wire [3:0]   m_axis_txd_tkeep,
+    output wire         m_axis_txd_tvalid,
+    input  wire         m_axis_txd_tready,
+    output wire         m_axis_txd_tlast
+);
+
+    reg in_frame;                         // Locked on sel from the first control word offered until the data TLAST
+    reg sel;                              // Source owning the MAC
+    reg last_sel;                         // Source that sent the previous frame
+
+    // Between frames, prefer the source that did not send the last one
+    wire pick = in_frame ? sel :
+                (s0_axis_txc_tvalid && s1_axis_txc_tvalid) ? !last_sel :
+                s1_axis_txc_tvalid;
+
+    assign m_axis_txc_tdata   = pick ? s1_axis_txc_tdata  : s0_axis_txc_tdata;
+    assign m_axis_txc_tkeep   = pick ? s1_axis_txc_tkeep  : s0_axis_txc_tkeep;
+    assign m_axis_txc_tlast   = pick ? s1_axis_txc_tlast  : s0_axis_txc_tlast;
+    assign m_axis_txc_tvalid  = pick ? s1_axis_txc_tvalid : s0_axis_txc_tvalid;
+    assign s0_axis_txc_tready = m_axis_txc_tready && !pick;
+    assign s1_axis_txc_tready = m_axis_txc_tready && pick;
+
+    // Data is only passed once the frame's source is locked
+    assign m_axis_txd_tdata   = sel ? s1_axis_txd_tdata  : s0_axis_txd_tdata;
+    assign m_axis_txd_tkeep   = sel ? s1_axis_txd_tkeep  : s0_axis_txd_tkeep;
+    assign m_axis_txd_tlast   = sel ? s1_axis_txd_tlast  : s0_axis_txd_tlast;
+    assign m_axis_txd_tvalid  = in_frame && (sel ? s1_axis_txd_tvalid : s0_axis_txd_tvalid);
+    assign s0_axis_txd_tready = in_frame && m_axis_txd_tready && !sel;
+    assign s1_axis_txd_tready = in_frame && m_axis_txd_tready && sel;
+
+    wire frame_end = m_axis_txd_tvalid && m_axis_txd_tready && m_axis_txd_tlast;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            in_frame <= 1'b0;
+            sel      <= 1'b0;
+            last_sel <= 1'b1;
+        end else if (frame_end) begin
+            in_frame <= 1'b0;
+            last_sel <= sel;
+        end else if (!in_frame && m_axis_txc_tvalid) begin
+            // A control word offered, taken or not, locks the source
+            sel      <= pick;
+            in_frame <= 1'b1;
+        end
+    end
+
+endmodule
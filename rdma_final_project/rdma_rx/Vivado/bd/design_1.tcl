@@ -46,7 +46,7 @@ if { [string first $scripts_vivado_version $current_vivado_version] == -1 } {
 
 # The design that will be created by this Tcl script contains the following 
 # module references:
-# rx_streamer, rx_header_parser, axis_rx_to_bram, rdma_axilite_rx_ctrl
+# rx_streamer, rx_header_parser, axis_rx_to_bram, rdma_axilite_rx_ctrl, rx_link_merge
 
 # Please add the sources of those modules before sourcing this Tcl script.
 
@@ -175,6 +175,7 @@ rx_streamer\
 rx_header_parser\
 axis_rx_to_bram\
 rdma_axilite_rx_ctrl\
+rx_link_merge\
 "
 
    set list_mods_missing ""
@@ -1301,6 +1302,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   # Create instance: axi_datamover_1, and set properties
   set axi_datamover_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_1 ]
   set_property -dict [list \
+    CONFIG.c_addr_width {64} \
     CONFIG.c_dummy {1} \
     CONFIG.c_enable_mm2s {0} \
     CONFIG.c_enable_s2mm_adv_sig {1} \
@@ -1310,6 +1312,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
 
   # Create instance: smartconnect_1, and set properties
   set smartconnect_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:smartconnect:1.0 smartconnect_1 ]
+  set_property CONFIG.NUM_SI {4} $smartconnect_1
 
   # Create instance: xlconstant_3, and set properties
   set xlconstant_3 [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconstant:1.1 xlconstant_3 ]
@@ -1374,9 +1377,25 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
    CONFIG.CLK_DOMAIN {design_1_zynq_ultra_ps_e_0_0_pl_clk0} \
  ] [get_bd_intf_pins /axis_rx_to_rdma_0/m_axis_eth]
 
+  # Create instance: rx_link_merge_0, and set properties
+  set block_name rx_link_merge
+  set block_cell_name rx_link_merge_0
+  if { [catch {set rx_link_merge_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $rx_link_merge_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  set_property -dict [ list \
+   CONFIG.FREQ_HZ {99999001} \
+   CONFIG.CLK_DOMAIN {design_1_zynq_ultra_ps_e_0_0_pl_clk0} \
+ ] [get_bd_intf_pins /rx_link_merge_0/m_axis]
+
   # Create instance: ps8_0_axi_periph, and set properties
   set ps8_0_axi_periph [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 ps8_0_axi_periph ]
-  set_property CONFIG.NUM_MI {1} $ps8_0_axi_periph
+  set_property CONFIG.NUM_MI {2} $ps8_0_axi_periph
 
 
   # Create instance: xlconcat_0, and set properties
@@ -1405,6 +1424,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   set_property -dict [list \
     CONFIG.FIFO_DEPTH {2048} \
     CONFIG.HAS_TKEEP {1} \
+    CONFIG.HAS_WR_DATA_COUNT {1} \
     CONFIG.HAS_TLAST {1} \
     CONFIG.TDATA_NUM_BYTES {4} \
   ] $axis_data_fifo_0
@@ -1412,12 +1432,17 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
 
   # Create interface connections
   connect_bd_intf_net -intf_net axi_datamover_1_M_AXI_S2MM [get_bd_intf_pins smartconnect_1/S01_AXI] [get_bd_intf_pins axi_datamover_1/M_AXI_S2MM]
+  connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axi_cqr [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_intf_pins smartconnect_1/S03_AXI]
+  connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axi_exc [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_intf_pins smartconnect_1/S02_AXI]
+  connect_bd_intf_net -intf_net rx_streamer_0_m_axi_atomic [get_bd_intf_pins rx_streamer_0/m_axi_atomic] [get_bd_intf_pins smartconnect_1/S00_AXI]
   connect_bd_intf_net -intf_net axi_ethernet_0_mdio [get_bd_intf_ports som240_1_connector_pl_gem2_rgmii_mdio_mdc] [get_bd_intf_pins axi_ethernet_0/mdio]
   connect_bd_intf_net -intf_net axi_ethernet_0_rgmii [get_bd_intf_ports som240_1_connector_pl_gem2_rgmii] [get_bd_intf_pins axi_ethernet_0/rgmii]
   connect_bd_intf_net -intf_net axis_data_fifo_0_M_AXIS [get_bd_intf_pins axis_data_fifo_0/M_AXIS] [get_bd_intf_pins rx_header_parser_0/s_axis]
-  connect_bd_intf_net -intf_net axis_rx_to_rdma_0_m_axis_eth [get_bd_intf_pins axis_rx_to_rdma_0/m_axis_eth] [get_bd_intf_pins rdma_axilite_rx_ctrl_0/s_axis_eth]
+  connect_bd_intf_net -intf_net axis_rx_to_rdma_0_m_axis_eth [get_bd_intf_pins axis_rx_to_rdma_0/m_axis_eth] [get_bd_intf_pins rx_link_merge_0/s0_axis]
   connect_bd_intf_net -intf_net ps8_0_axi_periph_M00_AXI [get_bd_intf_pins ps8_0_axi_periph/M00_AXI] [get_bd_intf_pins axi_ethernet_0/s_axi]
+  connect_bd_intf_net -intf_net ps8_0_axi_periph_M01_AXI [get_bd_intf_pins ps8_0_axi_periph/M01_AXI] [get_bd_intf_pins rdma_axilite_rx_ctrl_0/s_axi]
   connect_bd_intf_net -intf_net rdma_axilite_rx_ctrl_0_m_axis_payload [get_bd_intf_pins rdma_axilite_rx_ctrl_0/m_axis_payload] [get_bd_intf_pins axis_data_fifo_0/S_AXIS]
+  connect_bd_intf_net -intf_net rx_link_merge_0_m_axis [get_bd_intf_pins rx_link_merge_0/m_axis] [get_bd_intf_pins rdma_axilite_rx_ctrl_0/s_axis_eth]
   connect_bd_intf_net -intf_net rx_header_parser_0_m_axis [get_bd_intf_pins rx_header_parser_0/m_axis] [get_bd_intf_pins axi_datamover_1/S_AXIS_S2MM]
   connect_bd_intf_net -intf_net rx_streamer_0_m_axis_s2mm_cmd [get_bd_intf_pins axi_datamover_1/S_AXIS_S2MM_CMD] [get_bd_intf_pins rx_streamer_0/m_axis_s2mm_cmd]
   connect_bd_intf_net -intf_net smartconnect_1_M00_AXI [get_bd_intf_pins smartconnect_1/M00_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/S_AXI_HPC1_FPD]
@@ -1438,29 +1463,97 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_net -net axi_ethernet_0_phy_rst_n [get_bd_pins axi_ethernet_0/phy_rst_n] [get_bd_ports som240_1_connector_pl_gem2_reset]
   connect_bd_net -net axi_ethernet_0_refclk_clk_out1 [get_bd_pins axi_ethernet_0_refclk/clk_out1] [get_bd_pins axi_ethernet_0/ref_clk]
   connect_bd_net -net axi_ethernet_0_refclk_clk_out2 [get_bd_pins axi_ethernet_0_refclk/clk_out2] [get_bd_pins axi_ethernet_0/gtx_clk]
+  connect_bd_net -net axis_data_fifo_0_axis_wr_data_count [get_bd_pins axis_data_fifo_0/axis_wr_data_count] [get_bd_pins rdma_axilite_rx_ctrl_0/rx_fifo_level]
   connect_bd_net -net eth_axis_patgen_0_rxd_tready [get_bd_pins axis_rx_to_rdma_0/s_axis_tready] [get_bd_pins axi_ethernet_0/m_axis_rxd_tready]
   connect_bd_net -net eth_axis_patgen_0_rxs_tready [get_bd_pins axis_rx_to_rdma_0/s_axis_rxs_tready] [get_bd_pins axi_ethernet_0/m_axis_rxs_tready]
-  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn1 [get_bd_pins rst_ps8_0_99M/peripheral_aresetn] [get_bd_pins axi_datamover_1/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins smartconnect_1/aresetn] [get_bd_pins rx_streamer_0/aresetn] [get_bd_pins axi_ethernet_0/s_axi_lite_resetn] [get_bd_pins axi_ethernet_0/axi_txd_arstn] [get_bd_pins axi_ethernet_0/axi_txc_arstn] [get_bd_pins axi_ethernet_0/axi_rxd_arstn] [get_bd_pins axi_ethernet_0/axi_rxs_arstn] [get_bd_pins ps8_0_axi_periph/ARESETN] [get_bd_pins ps8_0_axi_periph/S00_ARESETN] [get_bd_pins ps8_0_axi_periph/M00_ARESETN] [get_bd_pins rdma_axilite_rx_ctrl_0/rst_n] [get_bd_pins rx_header_parser_0/aresetn] [get_bd_pins axis_data_fifo_0/s_axis_aresetn] [get_bd_pins axis_rx_to_rdma_0/axis_aresetn]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_enforce [get_bd_pins rdma_axilite_rx_ctrl_0/mr_enforce] [get_bd_pins rx_streamer_0/mr_enforce]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_access [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_access] [get_bd_pins rx_streamer_0/mr_wr_access]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_en [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_en] [get_bd_pins rx_streamer_0/mr_wr_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_idx [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_idx] [get_bd_pins rx_streamer_0/mr_wr_idx]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_len [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_len] [get_bd_pins rx_streamer_0/mr_wr_len]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_pa [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_pa] [get_bd_pins rx_streamer_0/mr_wr_pa]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_rkey [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_rkey] [get_bd_pins rx_streamer_0/mr_wr_rkey]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_va [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_va] [get_bd_pins rx_streamer_0/mr_wr_va]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_mr_wr_valid [get_bd_pins rdma_axilite_rx_ctrl_0/mr_wr_valid] [get_bd_pins rx_streamer_0/mr_wr_valid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pause_req [get_bd_pins rdma_axilite_rx_ctrl_0/pause_req] [get_bd_pins axi_ethernet_0/pause_req]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pause_val [get_bd_pins rdma_axilite_rx_ctrl_0/pause_val] [get_bd_pins axi_ethernet_0/pause_val]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tdata [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tdata] [get_bd_pins axi_ethernet_0/s_axis_txc_tdata]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tkeep [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tkeep] [get_bd_pins axi_ethernet_0/s_axis_txc_tkeep]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tvalid [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tvalid] [get_bd_pins axi_ethernet_0/s_axis_txc_tvalid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txc_tlast [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tlast] [get_bd_pins axi_ethernet_0/s_axis_txc_tlast]
+  connect_bd_net -net axi_ethernet_0_s_axis_txc_tready [get_bd_pins axi_ethernet_0/s_axis_txc_tready] [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txc_tready]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tdata [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tdata] [get_bd_pins axi_ethernet_0/s_axis_txd_tdata]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tkeep [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tkeep] [get_bd_pins axi_ethernet_0/s_axis_txd_tkeep]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tvalid [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tvalid] [get_bd_pins axi_ethernet_0/s_axis_txd_tvalid]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_m_axis_arp_txd_tlast [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tlast] [get_bd_pins axi_ethernet_0/s_axis_txd_tlast]
+  connect_bd_net -net axi_ethernet_0_s_axis_txd_tready [get_bd_pins axi_ethernet_0/s_axis_txd_tready] [get_bd_pins rdma_axilite_rx_ctrl_0/m_axis_arp_txd_tready]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cnp_en [get_bd_pins rdma_axilite_rx_ctrl_0/cnp_en] [get_bd_pins rx_streamer_0/cnp_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_psn_check_en [get_bd_pins rdma_axilite_rx_ctrl_0/psn_check_en] [get_bd_pins rx_streamer_0/psn_check_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_srq_enable [get_bd_pins rdma_axilite_rx_ctrl_0/srq_enable] [get_bd_pins rx_streamer_0/srq_enable]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_en [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_en] [get_bd_pins rx_streamer_0/rq_post_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_idx [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_idx] [get_bd_pins rx_streamer_0/rq_post_idx]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_wr_id [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_wr_id] [get_bd_pins rx_streamer_0/rq_post_wr_id]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_addr [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_addr] [get_bd_pins rx_streamer_0/rq_post_addr]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_rq_post_len [get_bd_pins rdma_axilite_rx_ctrl_0/rq_post_len] [get_bd_pins rx_streamer_0/rq_post_len]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cq_pop [get_bd_pins rdma_axilite_rx_ctrl_0/cq_pop] [get_bd_pins rx_streamer_0/cq_pop]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_cq_ring_en [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_en] [get_bd_pins rx_streamer_0/cq_ring_en]
+  connect_bd_net -net rdma_axilite_rx_ctrl_0_pl_deliver_en [get_bd_pins rdma_axilite_rx_ctrl_0/pl_deliver_en] [get_bd_pins rx_streamer_0/pl_deliver_en]
+  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn1 [get_bd_pins rst_ps8_0_99M/peripheral_aresetn] [get_bd_pins axi_datamover_1/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins smartconnect_1/aresetn] [get_bd_pins rx_streamer_0/aresetn] [get_bd_pins axi_ethernet_0/s_axi_lite_resetn] [get_bd_pins axi_ethernet_0/axi_txd_arstn] [get_bd_pins axi_ethernet_0/axi_txc_arstn] [get_bd_pins axi_ethernet_0/axi_rxd_arstn] [get_bd_pins axi_ethernet_0/axi_rxs_arstn] [get_bd_pins ps8_0_axi_periph/ARESETN] [get_bd_pins ps8_0_axi_periph/S00_ARESETN] [get_bd_pins ps8_0_axi_periph/M00_ARESETN] [get_bd_pins ps8_0_axi_periph/M01_ARESETN] [get_bd_pins rdma_axilite_rx_ctrl_0/rst_n] [get_bd_pins rx_header_parser_0/aresetn] [get_bd_pins axis_data_fifo_0/s_axis_aresetn] [get_bd_pins axis_rx_to_rdma_0/axis_aresetn] [get_bd_pins rx_link_merge_0/aresetn]
   connect_bd_net -net rx_header_parser_0_fragment_offset [get_bd_pins rx_header_parser_0/fragment_offset] [get_bd_pins rx_streamer_0/fragment_offset]
   connect_bd_net -net rx_header_parser_0_header_valid [get_bd_pins rx_header_parser_0/header_valid] [get_bd_pins rx_streamer_0/header_valid]
   connect_bd_net -net rx_header_parser_0_rdma_length [get_bd_pins rx_header_parser_0/rdma_length] [get_bd_pins rx_streamer_0/rdma_length]
   connect_bd_net -net rx_header_parser_0_rdma_opcode [get_bd_pins rx_header_parser_0/rdma_opcode] [get_bd_pins rx_streamer_0/rdma_opcode]
   connect_bd_net -net rx_header_parser_0_rdma_remote_addr [get_bd_pins rx_header_parser_0/rdma_remote_addr] [get_bd_pins rx_streamer_0/rdma_remote_addr]
   connect_bd_net -net rx_header_parser_0_rdma_rkey [get_bd_pins rx_header_parser_0/rdma_rkey] [get_bd_pins rx_streamer_0/rdma_rkey]
+  connect_bd_net -net rx_header_parser_0_ecn_ce [get_bd_pins rx_header_parser_0/ecn_ce] [get_bd_pins rx_streamer_0/ecn_ce]
+  connect_bd_net -net rx_header_parser_0_rdma_service_level [get_bd_pins rx_header_parser_0/rdma_service_level] [get_bd_pins rx_streamer_0/service_level]
+  connect_bd_net -net rx_header_parser_0_more_fragments [get_bd_pins rx_header_parser_0/more_fragments] [get_bd_pins rx_streamer_0/more_fragments]
+  connect_bd_net -net rx_header_parser_0_rdma_psn [get_bd_pins rx_header_parser_0/rdma_psn] [get_bd_pins rx_streamer_0/rdma_psn]
+  connect_bd_net -net rx_header_parser_0_rdma_dest_qp [get_bd_pins rx_header_parser_0/rdma_dest_qp] [get_bd_pins rx_streamer_0/rdma_dest_qp]
+  connect_bd_net -net rx_header_parser_0_read_sink_addr [get_bd_pins rx_header_parser_0/read_sink_addr] [get_bd_pins rx_streamer_0/read_sink_addr]
+  connect_bd_net -net rx_header_parser_0_read_sink_rkey [get_bd_pins rx_header_parser_0/read_sink_rkey] [get_bd_pins rx_streamer_0/read_sink_rkey]
+  connect_bd_net -net rx_header_parser_0_header_only [get_bd_pins rx_header_parser_0/header_only] [get_bd_pins rx_streamer_0/header_only]
+  connect_bd_net -net rx_header_parser_0_rdma_imm [get_bd_pins rx_header_parser_0/rdma_imm] [get_bd_pins rx_streamer_0/rdma_imm]
+  connect_bd_net -net rx_header_parser_0_atomic_data [get_bd_pins rx_header_parser_0/atomic_data] [get_bd_pins rx_streamer_0/atomic_data]
+  connect_bd_net -net rx_header_parser_0_atomic_compare [get_bd_pins rx_header_parser_0/atomic_compare] [get_bd_pins rx_streamer_0/atomic_compare]
+  connect_bd_net -net rx_streamer_0_drop_payload [get_bd_pins rx_streamer_0/drop_payload] [get_bd_pins rx_header_parser_0/drop_payload]
+  connect_bd_net -net rx_streamer_0_pl_payload [get_bd_pins rx_streamer_0/pl_payload] [get_bd_pins rx_header_parser_0/pl_payload]
+  connect_bd_net -net rx_header_parser_0_pl_payload_done [get_bd_pins rx_header_parser_0/pl_payload_done] [get_bd_pins rx_streamer_0/pl_xfer_cmplt]
+  connect_bd_net -net rx_streamer_0_mr_violation [get_bd_pins rx_streamer_0/mr_violation] [get_bd_pins rdma_axilite_rx_ctrl_0/mr_violation]
+  connect_bd_net -net rx_streamer_0_rq_level [get_bd_pins rx_streamer_0/rq_level] [get_bd_pins rdma_axilite_rx_ctrl_0/rq_level]
+  connect_bd_net -net rx_streamer_0_cq_valid [get_bd_pins rx_streamer_0/cq_valid] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_valid]
+  connect_bd_net -net rx_streamer_0_cq_wr_id [get_bd_pins rx_streamer_0/cq_wr_id] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_wr_id]
+  connect_bd_net -net rx_streamer_0_cq_byte_len [get_bd_pins rx_streamer_0/cq_byte_len] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_byte_len]
+  connect_bd_net -net rx_streamer_0_cq_info [get_bd_pins rx_streamer_0/cq_info] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_info]
+  connect_bd_net -net rx_streamer_0_cq_imm [get_bd_pins rx_streamer_0/cq_imm] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_imm]
+  connect_bd_net -net rx_streamer_0_cq_count [get_bd_pins rx_streamer_0/cq_count] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_count]
+  connect_bd_net -net rx_streamer_0_cq_overflow [get_bd_pins rx_streamer_0/cq_overflow] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_overflow]
+  connect_bd_net -net rx_streamer_0_cq_ring_cqe [get_bd_pins rx_streamer_0/cq_ring_cqe] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_cqe]
+  connect_bd_net -net rx_streamer_0_cq_ring_push [get_bd_pins rx_streamer_0/cq_ring_push] [get_bd_pins rdma_axilite_rx_ctrl_0/cq_ring_push]
+  connect_bd_net -net rx_streamer_0_recv_rnr [get_bd_pins rx_streamer_0/recv_rnr] [get_bd_pins rdma_axilite_rx_ctrl_0/recv_rnr]
+  connect_bd_net -net rx_streamer_0_ecn_marked [get_bd_pins rx_streamer_0/ecn_marked] [get_bd_pins rdma_axilite_rx_ctrl_0/ecn_marked]
+  connect_bd_net -net rx_streamer_0_psn_error [get_bd_pins rx_streamer_0/psn_error] [get_bd_pins rdma_axilite_rx_ctrl_0/psn_error]
   connect_bd_net -net som240_1_connector_hpa_clk0p_clk_1 [get_bd_ports som240_1_connector_hpa_clk0p_clk] [get_bd_pins axi_ethernet_0_refclk/clk_in1]
   connect_bd_net -net xlconcat_0_dout [get_bd_pins xlconcat_0/dout] [get_bd_pins zynq_ultra_ps_e_0/pl_ps_irq0]
-  connect_bd_net -net xlconstant_0_dout [get_bd_pins xlconstant_0/dout] [get_bd_pins axis_rx_to_rdma_0/capture_en]
+  connect_bd_net -net xlconstant_0_dout [get_bd_pins xlconstant_0/dout] [get_bd_pins axis_rx_to_rdma_0/capture_en] [get_bd_pins rx_streamer_0/rd_rsp_ready] [get_bd_pins rx_streamer_0/ack_tx_ready] [get_bd_pins rx_streamer_0/cnp_tx_ready]
   connect_bd_net -net xlconstant_3_dout [get_bd_pins xlconstant_3/dout] [get_bd_pins axi_datamover_1/s2mm_allow_addr_req]
-  connect_bd_net -net zynq_ultra_ps_e_0_pl_clk0 [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins rst_ps8_0_99M/slowest_sync_clk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc1_fpd_aclk] [get_bd_pins axi_datamover_1/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_awclk] [get_bd_pins smartconnect_1/aclk] [get_bd_pins rx_streamer_0/aclk] [get_bd_pins ps8_0_axi_periph/ACLK] [get_bd_pins ps8_0_axi_periph/S00_ACLK] [get_bd_pins ps8_0_axi_periph/M00_ACLK] [get_bd_pins axi_ethernet_0/s_axi_lite_clk] [get_bd_pins axi_ethernet_0/axis_clk] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_lpd_aclk] [get_bd_pins rdma_axilite_rx_ctrl_0/clk] [get_bd_pins rx_header_parser_0/aclk] [get_bd_pins axis_data_fifo_0/s_axis_aclk] [get_bd_pins axis_rx_to_rdma_0/axis_clk]
+  connect_bd_net -net zynq_ultra_ps_e_0_pl_clk0 [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins rst_ps8_0_99M/slowest_sync_clk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc1_fpd_aclk] [get_bd_pins axi_datamover_1/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_awclk] [get_bd_pins smartconnect_1/aclk] [get_bd_pins rx_streamer_0/aclk] [get_bd_pins ps8_0_axi_periph/ACLK] [get_bd_pins ps8_0_axi_periph/S00_ACLK] [get_bd_pins ps8_0_axi_periph/M00_ACLK] [get_bd_pins ps8_0_axi_periph/M01_ACLK] [get_bd_pins axi_ethernet_0/s_axi_lite_clk] [get_bd_pins axi_ethernet_0/axis_clk] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_lpd_aclk] [get_bd_pins rdma_axilite_rx_ctrl_0/clk] [get_bd_pins rx_header_parser_0/aclk] [get_bd_pins axis_data_fifo_0/s_axis_aclk] [get_bd_pins axis_rx_to_rdma_0/axis_clk] [get_bd_pins rx_link_merge_0/aclk]
   connect_bd_net -net zynq_ultra_ps_e_0_pl_resetn0 [get_bd_pins zynq_ultra_ps_e_0/pl_resetn0] [get_bd_pins rst_ps8_0_99M/ext_reset_in]
 
   # Create address segments
   assign_bd_address -offset 0x80000000 -range 0x00040000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs axi_ethernet_0/s_axi/Reg0] -force
+  assign_bd_address -offset 0x80040000 -range 0x00010000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs rdma_axilite_rx_ctrl_0/s_axi/reg0] -force
   assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
   assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rx_streamer_0/m_axi_atomic] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rx_streamer_0/m_axi_atomic] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_exc] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces rdma_axilite_rx_ctrl_0/m_axi_cqr] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
 
   # Exclude Address Segments
-  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH]
   exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
 
 
@@ -196,6 +196,12 @@ reg [15:0] shift_reg;       // Stores tdata[31:16] (2 payload bytes) from previo
 reg [2:0]  shift_count;     // Valid bytes in shift register for final beat
 reg        last_pending;    // tlast received, need to flush shift register
 
+// ECN: a CE-marked frame sets bit 31 (reserved) of RDMA header beat 3 so that the mark
+// travels with the packet through the RX FIFO to rx_header_parser
+wire       rx_ecn_ce = (rx_ip_dscp_ecn[1:0] == 2'b11);
+reg        ecn_ce_reg;
+reg [2:0]  payload_beat_cnt;  // Output payload beats of the current frame (saturates at 4)
+
 // Output registers
 reg [31:0] m_payload_tdata_reg;
 reg [3:0]  m_payload_tkeep_reg;
@@ -314,6 +320,8 @@ always @(posedge iClk) begin
         shift_reg    <= 16'd0;
         shift_count  <= 3'd0;
         last_pending <= 1'b0;
+        ecn_ce_reg       <= 1'b0;
+        payload_beat_cnt <= 3'd0;
 
     end else begin
         // Default: clear single-cycle pulses
@@ -565,6 +573,8 @@ always @(posedge iClk) begin
                         // Beat 10: [15:0] = UDP checksum, [31:16] = first 2 payload bytes
                         // Store the 2 payload bytes for combining with next beat
                         shift_reg <= s_eth_tdata[31:16];
+                        ecn_ce_reg       <= rx_ecn_ce;
+                        payload_beat_cnt <= 3'd0;
 
                         if (s_eth_tlast) begin
                             // Entire payload fits in beat 10 (<=2 bytes)
@@ -625,8 +635,11 @@ always @(posedge iClk) begin
 
                         end else if (s_eth_tvalid) begin
                             // Normal payload: combine {new[15:0], stored[15:0]}
-                            m_payload_tdata_reg  <= {s_eth_tdata[15:0], shift_reg};
+                            m_payload_tdata_reg  <= {s_eth_tdata[15:0] | {(ecn_ce_reg && payload_beat_cnt == 3'd3), 15'd0},
+                                                     shift_reg};
                             m_payload_tkeep_reg  <= 4'hF;
+                            if (payload_beat_cnt != 3'd4)
+                                payload_beat_cnt <= payload_beat_cnt + 1'b1;
                             m_payload_tvalid_reg <= 1'b1;
                             m_payload_tlast_reg  <= 1'b0;
 
@@ -3,7 +3,15 @@
 // AXI-Lite control/status register bridge for RDMA IP decapsulator
 //
 // Register Map:
-//   0x00: CTRL        [0]=enable, [2]=soft_reset (clears counters)
+//   0x00: CTRL        [0]=enable, [2]=soft_reset (clears counters),
+//                     [3]=mr_enforce (rkey check + VA->PA translation),
+//                     [4]=srq_enable (every QP receives from RQ 0),
+//                     [5]=psn_check_en (in-order WRITE/SEND per QP, ACK/NAK generation),
+//                     [6]=cnp_en (answer CE-marked packets with CNPs),
+//                     [7]=pause_en (send 802.3x PAUSE frames when the RX FIFO fills),
+//                     [8]=arp_reply_en (answer ARP requests for LOCAL_IP),
+//                     [9]=arp_learn_en (report peer IP -> MAC bindings to the TX endpoint table),
+//                     [10]=exc_en (copy non-RDMA frames to the exception ring)
 //   0x04: STATUS      [0]=busy, [1]=error, [7:4]=error_code, [10:8]=fsm_state
 //   0x08: RX_SRC_IP   [31:0]=last received source IPv4 (read-only)
 //   0x0C: RX_DST_IP   [31:0]=last received dest IPv4 (read-only)
@@ -14,10 +22,67 @@
 //   0x20: DROP_CNT    [31:0]=dropped packet count (read-only)
 //   0x24: HDR_VALID   [0]=header valid flag, auto-clears on read
 //   0x28: HEARTBEAT   [31:0]=debug counter (increments every clock)
+//   0x2C: MR_VIOL_CNT [31:0]=requests rejected by the MR table (read-only)
+//   0x30: MR_INDEX    [3:0]=memory region slot to program
+//   0x34: MR_RKEY     [31:0]=rkey (low bits must equal MR_INDEX)
+//   0x38: MR_VA_LO    [31:0]=region virtual base
+//   0x3C: MR_VA_HI
+//   0x40: MR_LEN_LO   [31:0]=region length in bytes
+//   0x44: MR_LEN_HI
+//   0x48: MR_PA_LO    [31:0]=physical DDR base
+//   0x4C: MR_PA_HI
+//   0x50: MR_ACCESS   [0]=remote write, [1]=remote read, [2]=remote atomic
+//   0x54: MR_COMMIT   write [0]=1 registers the staged region, [0]=0 invalidates it
+//   0x58: RQ_WR_ID    [31:0]=wr_id of the receive buffer to post
+//   0x5C: RQ_ADDR_LO  [31:0]=physical buffer address
+//   0x60: RQ_ADDR_HI
+//   0x64: RQ_LEN      [31:0]=buffer length in bytes
+//   0x68: RQ_POST     write [1:0]=receive queue (QPN[1:0]) to append the staged buffer to
+//   0x6C: RQ_LEVEL    [8n+7:8n]=posted buffers left in queue n (read-only)
+//   0x70: CQ_STATUS   [4:0]=completions pending, [8]=overflow (sticky) (read-only)
+//   0x74: CQ_WR_ID    [31:0]=wr_id of the oldest completion (read-only)
+//   0x78: CQ_BYTE_LEN [31:0]=bytes received (read-only)
+//   0x7C: CQ_INFO     [31:28]=type (0=RECV, 1=WRITE_WITH_IMM),
+//                     [27:24]=status (0=ok, 1=length error, 2=MR violation), [23:0]=QPN (read-only)
+//   0x80: CQ_POP      write any value to consume the oldest completion
+//   0x84: RNR_CNT     [31:0]=SENDs dropped because no buffer was posted (read-only)
+//   0x88: CQ_IMM      [31:0]=immediate of a WRITE_WITH_IMM completion (read-only)
+//   0x8C: PSN_ERR_CNT [31:0]=duplicate / out-of-order packets dropped (read-only)
+//   0x90: ECN_CE_CNT  [31:0]=CE-marked data packets received (read-only)
+//   0x94: PAUSE_QUANTA [15:0]=pause time sent in XOFF frames (512 bit times each)
+//   0x98: PAUSE_THRESH [15:0]=XOFF level, [31:16]=XON level (RX FIFO words)
+//   0x9C: PAUSE_STATUS [15:0]=RX FIFO level (words), [16]=XOFF active (read-only)
+//   0xA0: PAUSE_CNT    [31:0]=PAUSE frames requested, XOFF and XON (read-only)
+//   0xA4: LOCAL_IP     [31:0]=IPv4 address answered by the ARP responder
+//   0xA8: ARP_CNT      [15:0]=ARP replies sent, [31:16]=bindings learned (read-only)
+//   0xAC: EXC_BASE_LO  [31:0]=exception ring base (2 KB aligned)
+//   0xB0: EXC_BASE_HI
+//   0xB4: EXC_SIZE     [15:0]=ring slots of 2 KB, 0 = disabled
+//   0xB8: EXC_HEAD     [15:0]=next slot software will read (software-owned)
+//   0xBC: EXC_TAIL     [15:0]=next slot hardware will write (read-only)
+//   0xC0: EXC_CNT      [15:0]=frames queued, [31:16]=frames lost (read-only)
+//   0xC4: CQR_BASE_LO  [31:0]=completion ring base (16-byte aligned)
+//   0xC8: CQR_BASE_HI
+//   0xCC: CQR_SIZE     [15:0]=ring entries of 16 bytes, 0 = completions stay in the register CQ
+//   0xD0: CQR_COMMIT   write [1:0]=ring (QPN[1:0]) to program with the staged base/size;
+//                     clears its head, tail and overflow flag
+//   0xD4: CQR_STATUS   [3:0]=rings enabled, [11:8]=ring overflow (sticky) (read-only)
+//   0xD8: CQR_HEAD0    write [15:0]=next entry software will read;
+//                     read [15:0]=head, [31:16]=tail (next entry hardware will write)
+//   0xDC: CQR_HEAD1
+//   0xE0: CQR_HEAD2
+//   0xE4: CQR_HEAD3
+//   0xE8: PL_DELIVER   [3:0]=QPs (QPN[1:0]) whose WRITE payloads leave on the PL stream
+//                     instead of landing in DDR; reads 0 and ignores writes unless
+//                     PL_CONSUMER = 1 (a kernel drives rx_header_parser m_axis_pl tready)
 // ============================================================================
 module rdma_axilite_rx_ctrl #(
     parameter [47:0] LOCAL_MAC  = 48'h000A35010203,
-    parameter [15:0] LOCAL_PORT = 16'd5005
+    parameter [15:0] LOCAL_PORT = 16'd5005,
+    parameter [31:0] LOCAL_IP   = 32'hAC1F09CA,
+    parameter        MR_IDX_WIDTH = 4,
+    parameter        RQ_IDX_WIDTH = 2,
+    parameter        PL_CONSUMER  = 0       // 1 = m_axis_pl is connected to a PL kernel
 )(
     input  wire        clk,
     input  wire        rst_n,  // Active-low reset
@@ -54,7 +119,133 @@ module rdma_axilite_rx_ctrl #(
     output wire [3:0]  m_axis_payload_tkeep,
     output wire        m_axis_payload_tvalid,
     input  wire        m_axis_payload_tready,
-    output wire        m_axis_payload_tlast
+    output wire        m_axis_payload_tlast,
+
+    // Memory region table programming (to rx_streamer)
+    output wire                    mr_enforce,
+    output reg                     mr_wr_en,
+    output wire [MR_IDX_WIDTH-1:0] mr_wr_idx,
+    output reg                     mr_wr_valid,
+    output wire [31:0]             mr_wr_rkey,
+    output wire [63:0]             mr_wr_va,
+    output wire [63:0]             mr_wr_len,
+    output wire [63:0]             mr_wr_pa,
+    output wire [3:0]              mr_wr_access,
+    input  wire                    mr_violation,
+
+    // Receive queue posting and RX completion queue (to/from rx_streamer)
+    output wire                    srq_enable,
+    output reg                     rq_post_en,
+    output wire [RQ_IDX_WIDTH-1:0] rq_post_idx,
+    output wire [31:0]             rq_post_wr_id,
+    output wire [63:0]             rq_post_addr,
+    output wire [31:0]             rq_post_len,
+    input  wire [(8<<RQ_IDX_WIDTH)-1:0] rq_level,
+    output reg                     cq_pop,
+    input  wire                    cq_valid,
+    input  wire [31:0]             cq_wr_id,
+    input  wire [31:0]             cq_byte_len,
+    input  wire [31:0]             cq_info,
+    input  wire [31:0]             cq_imm,
+    input  wire [4:0]              cq_count,
+    input  wire                    cq_overflow,
+    output wire [(1<<RQ_IDX_WIDTH)-1:0] cq_ring_en,
+    input  wire                    cq_ring_push,
+    input  wire [127:0]            cq_ring_cqe,
+    input  wire                    recv_rnr,
+
+    // Direct-to-PL payload delivery (to rx_streamer)
+    output wire [(1<<RQ_IDX_WIDTH)-1:0] pl_deliver_en,
+
+    // Reliable delivery (to/from rx_streamer)
+    output wire                    psn_check_en,
+    input  wire                    psn_error,
+
+    // Congestion control (to/from rx_streamer)
+    output wire                    cnp_en,
+    input  wire                    ecn_marked,
+
+    // Flow control (RX FIFO level in, PAUSE request to the MAC)
+    input  wire [31:0]             rx_fifo_level,
+    output reg                     pause_req,
+    output reg  [15:0]             pause_val,
+
+    // ARP (reply to the MAC's TX port, learned bindings to the TX endpoint table)
+    output wire [31:0]             m_axis_arp_txc_tdata,
+    output wire [3:0]              m_axis_arp_txc_tkeep,
+    output wire                    m_axis_arp_txc_tvalid,
+    input  wire                    m_axis_arp_txc_tready,
+    output wire                    m_axis_arp_txc_tlast,
+    output wire [31:0]             m_axis_arp_txd_tdata,
+    output wire [3:0]              m_axis_arp_txd_tkeep,
+    output wire                    m_axis_arp_txd_tvalid,
+    input  wire                    m_axis_arp_txd_tready,
+    output wire                    m_axis_arp_txd_tlast,
+    output wire                    learn_valid,
+    output wire [31:0]             learn_ip,
+    output wire [47:0]             learn_mac,
+
+    // Exception ring (AXI4 master to DDR through smartconnect_1)
+    output wire [63:0]             m_axi_exc_araddr,
+    output wire [7:0]              m_axi_exc_arlen,
+    output wire [2:0]              m_axi_exc_arsize,
+    output wire [1:0]              m_axi_exc_arburst,
+    output wire [3:0]              m_axi_exc_arcache,
+    output wire [2:0]              m_axi_exc_arprot,
+    output wire                    m_axi_exc_arvalid,
+    input  wire                    m_axi_exc_arready,
+    input  wire [63:0]             m_axi_exc_rdata,
+    input  wire [1:0]              m_axi_exc_rresp,
+    input  wire                    m_axi_exc_rlast,
+    input  wire                    m_axi_exc_rvalid,
+    output wire                    m_axi_exc_rready,
+    output wire [63:0]             m_axi_exc_awaddr,
+    output wire [7:0]              m_axi_exc_awlen,
+    output wire [2:0]              m_axi_exc_awsize,
+    output wire [1:0]              m_axi_exc_awburst,
+    output wire [3:0]              m_axi_exc_awcache,
+    output wire [2:0]              m_axi_exc_awprot,
+    output wire                    m_axi_exc_awvalid,
+    input  wire                    m_axi_exc_awready,
+    output wire [63:0]             m_axi_exc_wdata,
+    output wire [7:0]              m_axi_exc_wstrb,
+    output wire                    m_axi_exc_wlast,
+    output wire                    m_axi_exc_wvalid,
+    input  wire                    m_axi_exc_wready,
+    input  wire [1:0]              m_axi_exc_bresp,
+    input  wire                    m_axi_exc_bvalid,
+    output wire                    m_axi_exc_bready,
+
+    // Per-QP completion rings (AXI4 master to DDR through smartconnect_1)
+    output wire [63:0]             m_axi_cqr_araddr,
+    output wire [7:0]              m_axi_cqr_arlen,
+    output wire [2:0]              m_axi_cqr_arsize,
+    output wire [1:0]              m_axi_cqr_arburst,
+    output wire [3:0]              m_axi_cqr_arcache,
+    output wire [2:0]              m_axi_cqr_arprot,
+    output wire                    m_axi_cqr_arvalid,
+    input  wire                    m_axi_cqr_arready,
+    input  wire [63:0]             m_axi_cqr_rdata,
+    input  wire [1:0]              m_axi_cqr_rresp,
+    input  wire                    m_axi_cqr_rlast,
+    input  wire                    m_axi_cqr_rvalid,
+    output wire                    m_axi_cqr_rready,
+    output wire [63:0]             m_axi_cqr_awaddr,
+    output wire [7:0]              m_axi_cqr_awlen,
+    output wire [2:0]              m_axi_cqr_awsize,
+    output wire [1:0]              m_axi_cqr_awburst,
+    output wire [3:0]              m_axi_cqr_awcache,
+    output wire [2:0]              m_axi_cqr_awprot,
+    output wire                    m_axi_cqr_awvalid,
+    input  wire                    m_axi_cqr_awready,
+    output wire [63:0]             m_axi_cqr_wdata,
+    output wire [7:0]              m_axi_cqr_wstrb,
+    output wire                    m_axi_cqr_wlast,
+    output wire                    m_axi_cqr_wvalid,
+    input  wire                    m_axi_cqr_wready,
+    input  wire [1:0]              m_axi_cqr_bresp,
+    input  wire                    m_axi_cqr_bvalid,
+    output wire                    m_axi_cqr_bready
 );
 
 // Internal reset
@@ -70,6 +261,56 @@ reg [15:0] reg_rx_len;         // Last received payload length
 reg [31:0] reg_pkt_cnt;        // Received packet counter
 reg [31:0] reg_drop_cnt;       // Dropped packet counter
 reg        reg_hdr_valid;      // Header valid flag (sticky until read)
+reg [31:0] reg_mr_viol_cnt;    // MR violation counter
+reg [31:0] reg_rnr_cnt;        // SENDs without a posted receive buffer
+reg [31:0] reg_psn_err_cnt;    // Packets dropped by the PSN check
+reg [31:0] reg_ecn_ce_cnt;     // CE-marked packets
+reg [15:0] reg_pause_quanta;   // Pause time of an XOFF frame
+reg [15:0] reg_pause_xoff;     // FIFO level that starts a pause
+reg [15:0] reg_pause_xon;      // FIFO level that ends it
+reg [31:0] reg_pause_cnt;      // PAUSE frames requested
+reg        pause_xoff;         // Link partner is paused
+reg [21:0] pause_refresh;      // Cycles until the XOFF frame is repeated
+reg [31:0] reg_local_ip;       // Address answered by the ARP responder
+reg [15:0] reg_arp_reply_cnt;  // ARP replies sent
+reg [15:0] reg_arp_learn_cnt;  // Bindings reported to the endpoint table
+wire       arp_stat_reply;
+wire       arp_stat_learn;
+reg [63:0] reg_exc_base;       // Exception ring
+reg [15:0] reg_exc_size;
+reg [15:0] reg_exc_head;
+wire [15:0] exc_tail;
+reg [15:0] reg_exc_frame_cnt;  // Frames written to the ring
+reg [15:0] reg_exc_drop_cnt;   // Exception frames lost (buffers busy or ring full)
+wire       exc_stat_frame;
+wire       exc_stat_drop;
+wire [15:0] fifo_level = (rx_fifo_level[31:16] != 16'd0) ? 16'hFFFF : rx_fifo_level[15:0];
+
+// Staged memory region (written to the table on MR_COMMIT)
+reg [MR_IDX_WIDTH-1:0] reg_mr_index;
+reg [31:0] reg_mr_rkey;
+reg [63:0] reg_mr_va;
+reg [63:0] reg_mr_len;
+reg [63:0] reg_mr_pa;
+reg [3:0]  reg_mr_access;
+
+// Staged receive buffer (appended to a receive queue on RQ_POST)
+reg [31:0] reg_rq_wr_id;
+reg [63:0] reg_rq_addr;
+reg [31:0] reg_rq_len;
+reg [RQ_IDX_WIDTH-1:0] reg_rq_idx;
+
+// Per-QP completion rings (staged base/size written on CQR_COMMIT)
+reg [63:0] reg_cqr_base;
+reg [15:0] reg_cqr_size;
+reg [RQ_IDX_WIDTH-1:0] reg_cqr_idx;
+reg        cqr_cfg_en;
+reg [(16<<RQ_IDX_WIDTH)-1:0] reg_cqr_head;
+wire [(16<<RQ_IDX_WIDTH)-1:0] cqr_tail;
+wire [(1<<RQ_IDX_WIDTH)-1:0]  cqr_overflow;
+
+// QPs whose WRITE payloads go to the PL stream
+reg [(1<<RQ_IDX_WIDTH)-1:0] reg_pl_deliver;
 
 wire [31:0] reg_status;        // Status register (from hardware)
 
@@ -140,8 +381,40 @@ always @(posedge clk) begin
         aw_addr_reg  <= 6'd0;
         aw_pending   <= 1'b0;
         w_pending    <= 1'b0;
-        reg_ctrl     <= 32'd1;  // Enable by default
+        reg_ctrl     <= 32'h301;  // RX and ARP reply/learning enabled by default
+        reg_local_ip <= LOCAL_IP;
+        reg_exc_base <= 64'd0;
+        reg_exc_size <= 16'd0;
+        reg_exc_head <= 16'd0;
+        reg_pause_quanta <= 16'hFFFF;
+        reg_pause_xoff   <= 16'd1024;  // Half of the 2048-word RX FIFO
+        reg_pause_xon    <= 16'd512;
+        reg_mr_index  <= {MR_IDX_WIDTH{1'b0}};
+        reg_mr_rkey   <= 32'd0;
+        reg_mr_va     <= 64'd0;
+        reg_mr_len    <= 64'd0;
+        reg_mr_pa     <= 64'd0;
+        reg_mr_access <= 4'd0;
+        mr_wr_en      <= 1'b0;
+        mr_wr_valid   <= 1'b0;
+        reg_rq_wr_id  <= 32'd0;
+        reg_rq_addr   <= 64'd0;
+        reg_rq_len    <= 32'd0;
+        reg_rq_idx    <= {RQ_IDX_WIDTH{1'b0}};
+        rq_post_en    <= 1'b0;
+        cq_pop        <= 1'b0;
+        reg_cqr_base  <= 64'd0;
+        reg_cqr_size  <= 16'd0;
+        reg_cqr_idx   <= {RQ_IDX_WIDTH{1'b0}};
+        reg_cqr_head  <= {(16<<RQ_IDX_WIDTH){1'b0}};
+        cqr_cfg_en    <= 1'b0;
+        reg_pl_deliver <= {(1<<RQ_IDX_WIDTH){1'b0}};
     end else begin
+        mr_wr_en   <= 1'b0;
+        rq_post_en <= 1'b0;
+        cq_pop     <= 1'b0;
+        cqr_cfg_en <= 1'b0;
+
         // Write response handshake
         if (b_valid_reg && s_axi_bready) begin
             b_valid_reg <= 1'b0;
@@ -162,9 +435,53 @@ always @(posedge clk) begin
 
         // When both address and data are received, perform write
         if (aw_pending && w_pending) begin
-            // Only CTRL register is writable
             case (aw_addr_reg)
-                6'd0: reg_ctrl <= s_axi_wdata;  // 0x00
+                6'd0:  reg_ctrl            <= s_axi_wdata;                  // 0x00
+                6'd12: reg_mr_index        <= s_axi_wdata[MR_IDX_WIDTH-1:0]; // 0x30
+                6'd13: reg_mr_rkey         <= s_axi_wdata;                  // 0x34
+                6'd14: reg_mr_va[31:0]     <= s_axi_wdata;                  // 0x38
+                6'd15: reg_mr_va[63:32]    <= s_axi_wdata;                  // 0x3C
+                6'd16: reg_mr_len[31:0]    <= s_axi_wdata;                  // 0x40
+                6'd17: reg_mr_len[63:32]   <= s_axi_wdata;                  // 0x44
+                6'd18: reg_mr_pa[31:0]     <= s_axi_wdata;                  // 0x48
+                6'd19: reg_mr_pa[63:32]    <= s_axi_wdata;                  // 0x4C
+                6'd20: reg_mr_access       <= s_axi_wdata[3:0];             // 0x50
+                6'd21: begin                                                // 0x54
+                    mr_wr_en    <= 1'b1;
+                    mr_wr_valid <= s_axi_wdata[0];
+                end
+                6'd22: reg_rq_wr_id        <= s_axi_wdata;                  // 0x58
+                6'd23: reg_rq_addr[31:0]   <= s_axi_wdata;                  // 0x5C
+                6'd24: reg_rq_addr[63:32]  <= s_axi_wdata;                  // 0x60
+                6'd25: reg_rq_len          <= s_axi_wdata;                  // 0x64
+                6'd26: begin                                                // 0x68
+                    reg_rq_idx <= s_axi_wdata[RQ_IDX_WIDTH-1:0];
+                    rq_post_en <= 1'b1;
+                end
+                6'd32: cq_pop              <= 1'b1;                         // 0x80
+                6'd37: reg_pause_quanta    <= s_axi_wdata[15:0];            // 0x94
+                6'd38: begin                                                // 0x98
+                    reg_pause_xoff <= s_axi_wdata[15:0];
+                    reg_pause_xon  <= s_axi_wdata[31:16];
+                end
+                6'd41: reg_local_ip        <= s_axi_wdata;                  // 0xA4
+                6'd43: reg_exc_base[31:0]  <= s_axi_wdata;                  // 0xAC
+                6'd44: reg_exc_base[63:32] <= s_axi_wdata;                  // 0xB0
+                6'd45: reg_exc_size        <= s_axi_wdata[15:0];            // 0xB4
+                6'd46: reg_exc_head        <= s_axi_wdata[15:0];            // 0xB8
+                6'd49: reg_cqr_base[31:0]  <= s_axi_wdata;                  // 0xC4
+                6'd50: reg_cqr_base[63:32] <= s_axi_wdata;                  // 0xC8
+                6'd51: reg_cqr_size        <= s_axi_wdata[15:0];            // 0xCC
+                6'd52: begin                                                // 0xD0
+                    reg_cqr_idx <= s_axi_wdata[RQ_IDX_WIDTH-1:0];
+                    reg_cqr_head[s_axi_wdata[RQ_IDX_WIDTH-1:0]*16 +: 16] <= 16'd0;
+                    cqr_cfg_en  <= 1'b1;
+                end
+                6'd54: reg_cqr_head[15:0]  <= s_axi_wdata[15:0];            // 0xD8
+                6'd55: reg_cqr_head[31:16] <= s_axi_wdata[15:0];            // 0xDC
+                6'd56: reg_cqr_head[47:32] <= s_axi_wdata[15:0];            // 0xE0
+                6'd57: reg_cqr_head[63:48] <= s_axi_wdata[15:0];            // 0xE4
+                6'd58: if (PL_CONSUMER != 0) reg_pl_deliver <= s_axi_wdata[(1<<RQ_IDX_WIDTH)-1:0]; // 0xE8
             endcase
             b_valid_reg  <= 1'b1;  // Assert write response
             aw_pending   <= 1'b0;
@@ -213,6 +530,53 @@ always @(posedge clk) begin
                 6'd8:  r_data_reg <= reg_drop_cnt;                  // 0x20
                 6'd9:  r_data_reg <= {31'd0, reg_hdr_valid};        // 0x24
                 6'd10: r_data_reg <= debug_heartbeat;               // 0x28 - Debug: heartbeat counter
+                6'd11: r_data_reg <= reg_mr_viol_cnt;               // 0x2C
+                6'd12: r_data_reg <= {{(32-MR_IDX_WIDTH){1'b0}}, reg_mr_index}; // 0x30
+                6'd13: r_data_reg <= reg_mr_rkey;                   // 0x34
+                6'd14: r_data_reg <= reg_mr_va[31:0];               // 0x38
+                6'd15: r_data_reg <= reg_mr_va[63:32];              // 0x3C
+                6'd16: r_data_reg <= reg_mr_len[31:0];              // 0x40
+                6'd17: r_data_reg <= reg_mr_len[63:32];             // 0x44
+                6'd18: r_data_reg <= reg_mr_pa[31:0];               // 0x48
+                6'd19: r_data_reg <= reg_mr_pa[63:32];              // 0x4C
+                6'd20: r_data_reg <= {28'd0, reg_mr_access};        // 0x50
+                6'd21: r_data_reg <= 32'd0;                         // 0x54 - write-only
+                6'd22: r_data_reg <= reg_rq_wr_id;                  // 0x58
+                6'd23: r_data_reg <= reg_rq_addr[31:0];             // 0x5C
+                6'd24: r_data_reg <= reg_rq_addr[63:32];            // 0x60
+                6'd25: r_data_reg <= reg_rq_len;                    // 0x64
+                6'd26: r_data_reg <= 32'd0;                         // 0x68 - write-only
+                6'd27: r_data_reg <= rq_level[31:0];                // 0x6C
+                6'd28: r_data_reg <= {23'd0, cq_overflow, 3'd0, cq_count}; // 0x70
+                6'd29: r_data_reg <= cq_valid ? cq_wr_id    : 32'd0; // 0x74
+                6'd30: r_data_reg <= cq_valid ? cq_byte_len : 32'd0; // 0x78
+                6'd31: r_data_reg <= cq_valid ? cq_info     : 32'd0; // 0x7C
+                6'd32: r_data_reg <= 32'd0;                         // 0x80 - write-only
+                6'd33: r_data_reg <= reg_rnr_cnt;                   // 0x84
+                6'd34: r_data_reg <= cq_valid ? cq_imm      : 32'd0; // 0x88
+                6'd35: r_data_reg <= reg_psn_err_cnt;               // 0x8C
+                6'd36: r_data_reg <= reg_ecn_ce_cnt;                // 0x90
+                6'd37: r_data_reg <= {16'd0, reg_pause_quanta};     // 0x94
+                6'd38: r_data_reg <= {reg_pause_xon, reg_pause_xoff}; // 0x98
+                6'd39: r_data_reg <= {15'd0, pause_xoff, fifo_level}; // 0x9C
+                6'd40: r_data_reg <= reg_pause_cnt;                 // 0xA0
+                6'd41: r_data_reg <= reg_local_ip;                  // 0xA4
+                6'd42: r_data_reg <= {reg_arp_learn_cnt, reg_arp_reply_cnt}; // 0xA8
+                6'd43: r_data_reg <= reg_exc_base[31:0];            // 0xAC
+                6'd44: r_data_reg <= reg_exc_base[63:32];           // 0xB0
+                6'd45: r_data_reg <= {16'd0, reg_exc_size};         // 0xB4
+                6'd46: r_data_reg <= {16'd0, reg_exc_head};         // 0xB8
+                6'd47: r_data_reg <= {16'd0, exc_tail};             // 0xBC
+                6'd48: r_data_reg <= {reg_exc_drop_cnt, reg_exc_frame_cnt}; // 0xC0
+                6'd49: r_data_reg <= reg_cqr_base[31:0];            // 0xC4
+                6'd50: r_data_reg <= reg_cqr_base[63:32];           // 0xC8
+                6'd51: r_data_reg <= {16'd0, reg_cqr_size};         // 0xCC
+                6'd53: r_data_reg <= {20'd0, cqr_overflow[3:0], 4'd0, cq_ring_en[3:0]}; // 0xD4
+                6'd54: r_data_reg <= {cqr_tail[15:0],  reg_cqr_head[15:0]};  // 0xD8
+                6'd55: r_data_reg <= {cqr_tail[31:16], reg_cqr_head[31:16]}; // 0xDC
+                6'd56: r_data_reg <= {cqr_tail[47:32], reg_cqr_head[47:32]}; // 0xE0
+                6'd57: r_data_reg <= {cqr_tail[63:48], reg_cqr_head[63:48]}; // 0xE4
+                6'd58: r_data_reg <= {{(32-(1<<RQ_IDX_WIDTH)){1'b0}}, reg_pl_deliver}; // 0xE8
                 default: r_data_reg <= 32'hDEADBEEF;                // Debug: invalid address marker
             endcase
             r_valid_reg <= 1'b1;  // Assert read data valid
@@ -268,16 +632,258 @@ end
 // Packet counters
 always @(posedge clk) begin
     if (rst || reg_ctrl[2]) begin
-        reg_pkt_cnt  <= 32'd0;
-        reg_drop_cnt <= 32'd0;
+        reg_pkt_cnt     <= 32'd0;
+        reg_drop_cnt    <= 32'd0;
+        reg_mr_viol_cnt <= 32'd0;
+        reg_rnr_cnt     <= 32'd0;
+        reg_psn_err_cnt <= 32'd0;
+        reg_ecn_ce_cnt  <= 32'd0;
+        reg_arp_reply_cnt <= 16'd0;
+        reg_arp_learn_cnt <= 16'd0;
+        reg_exc_frame_cnt <= 16'd0;
+        reg_exc_drop_cnt  <= 16'd0;
     end else begin
         if (dut_stat_received)
             reg_pkt_cnt <= reg_pkt_cnt + 32'd1;
         if (dut_stat_dropped)
             reg_drop_cnt <= reg_drop_cnt + 32'd1;
+        if (mr_violation)
+            reg_mr_viol_cnt <= reg_mr_viol_cnt + 32'd1;
+        if (recv_rnr)
+            reg_rnr_cnt <= reg_rnr_cnt + 32'd1;
+        if (psn_error)
+            reg_psn_err_cnt <= reg_psn_err_cnt + 32'd1;
+        if (ecn_marked)
+            reg_ecn_ce_cnt <= reg_ecn_ce_cnt + 32'd1;
+        if (arp_stat_reply)
+            reg_arp_reply_cnt <= reg_arp_reply_cnt + 16'd1;
+        if (arp_stat_learn)
+            reg_arp_learn_cnt <= reg_arp_learn_cnt + 16'd1;
+        if (exc_stat_frame)
+            reg_exc_frame_cnt <= reg_exc_frame_cnt + 16'd1;
+        if (exc_stat_drop)
+            reg_exc_drop_cnt <= reg_exc_drop_cnt + 16'd1;
+    end
+end
+
+// ============================================================================
+// Flow control - 802.3x PAUSE from RX FIFO occupancy
+// ============================================================================
+// The FIFO between the decapsulator and the header parser only drains into
+// the S2MM DataMover, so its level also reflects S2MM back-pressure. Above
+// XOFF the MAC is asked for a PAUSE frame with PAUSE_QUANTA, repeated every
+// half pause time (1 quantum = 512 ns at 1 Gb/s ~ 51 cycles, half = 25) while
+// the level stays above XON. Dropping to XON sends a zero-quanta PAUSE (XON).
+always @(posedge clk) begin
+    if (rst || reg_ctrl[2]) begin
+        pause_req     <= 1'b0;
+        pause_val     <= 16'd0;
+        pause_xoff    <= 1'b0;
+        pause_refresh <= 22'd0;
+        reg_pause_cnt <= 32'd0;
+    end else begin
+        pause_req <= 1'b0;
+
+        if (pause_refresh != 22'd0)
+            pause_refresh <= pause_refresh - 22'd1;
+
+        if (pause_xoff) begin
+            if (!reg_ctrl[7] || reg_pause_quanta == 16'd0 || fifo_level <= reg_pause_xon) begin
+                // XON: resume the link partner immediately
+                pause_req     <= 1'b1;
+                pause_val     <= 16'd0;
+                pause_xoff    <= 1'b0;
+                reg_pause_cnt <= reg_pause_cnt + 32'd1;
+            end else if (pause_refresh == 22'd0) begin
+                pause_req     <= 1'b1;
+                pause_val     <= reg_pause_quanta;
+                pause_refresh <= {reg_pause_quanta, 4'd0} + {reg_pause_quanta, 3'd0} + reg_pause_quanta;
+                reg_pause_cnt <= reg_pause_cnt + 32'd1;
+            end
+        end else if (reg_ctrl[7] && reg_pause_quanta != 16'd0 && fifo_level >= reg_pause_xoff) begin
+            pause_req     <= 1'b1;
+            pause_val     <= reg_pause_quanta;
+            pause_xoff    <= 1'b1;
+            pause_refresh <= {reg_pause_quanta, 4'd0} + {reg_pause_quanta, 3'd0} + reg_pause_quanta;
+            reg_pause_cnt <= reg_pause_cnt + 32'd1;
+        end
     end
 end
 
+// Memory region table programming
+assign mr_enforce   = reg_ctrl[3];
+assign mr_wr_idx    = reg_mr_index;
+assign mr_wr_rkey   = reg_mr_rkey;
+assign mr_wr_va     = reg_mr_va;
+assign mr_wr_len    = reg_mr_len;
+assign mr_wr_pa     = reg_mr_pa;
+assign mr_wr_access = reg_mr_access;
+
+// Receive queue posting
+assign srq_enable    = reg_ctrl[4];
+assign rq_post_idx   = reg_rq_idx;
+assign rq_post_wr_id = reg_rq_wr_id;
+assign rq_post_addr  = reg_rq_addr;
+assign rq_post_len   = reg_rq_len;
+
+// Reliable delivery
+assign psn_check_en  = reg_ctrl[5];
+
+// Congestion control
+assign cnp_en        = reg_ctrl[6];
+
+// Direct-to-PL delivery
+assign pl_deliver_en = reg_pl_deliver;
+
+// ============================================================================
+// ARP - responder and IP -> MAC learning
+// ============================================================================
+// Monitors the frames accepted into the decapsulator. Replies go out on the
+// TX side of the receiving MAC; learned bindings feed the TX endpoint table.
+rx_arp_unit u_arp (
+    .aclk(clk),
+    .aresetn(rst_n && !reg_ctrl[2]),
+
+    .local_mac(LOCAL_MAC),
+    .local_ip(reg_local_ip),
+    .local_port(LOCAL_PORT),
+    .reply_en(reg_ctrl[8]),
+    .learn_en(reg_ctrl[9]),
+
+    .mon_tdata(s_axis_eth_tdata),
+    .mon_tlast(s_axis_eth_tlast),
+    .mon_tuser(s_axis_eth_tuser),
+    .mon_beat(s_axis_eth_tvalid && s_axis_eth_tready),
+
+    .learn_valid(learn_valid),
+    .learn_ip(learn_ip),
+    .learn_mac(learn_mac),
+
+    .m_axis_txc_tdata(m_axis_arp_txc_tdata),
+    .m_axis_txc_tkeep(m_axis_arp_txc_tkeep),
+    .m_axis_txc_tvalid(m_axis_arp_txc_tvalid),
+    .m_axis_txc_tready(m_axis_arp_txc_tready),
+    .m_axis_txc_tlast(m_axis_arp_txc_tlast),
+    .m_axis_txd_tdata(m_axis_arp_txd_tdata),
+    .m_axis_txd_tkeep(m_axis_arp_txd_tkeep),
+    .m_axis_txd_tvalid(m_axis_arp_txd_tvalid),
+    .m_axis_txd_tready(m_axis_arp_txd_tready),
+    .m_axis_txd_tlast(m_axis_arp_txd_tlast),
+
+    .stat_reply(arp_stat_reply),
+    .stat_learn(arp_stat_learn)
+);
+
+// ============================================================================
+// Exception ring - frames the decapsulator drops go to software
+// ============================================================================
+rx_exc_queue #(
+    .C_ADDR_WIDTH(64)
+) u_exc_queue (
+    .aclk(clk),
+    .aresetn(rst_n && !reg_ctrl[2]),
+
+    .enable(reg_ctrl[10]),
+    .ring_base(reg_exc_base),
+    .ring_size(reg_exc_size),
+    .ring_head(reg_exc_head),
+    .ring_tail(exc_tail),
+
+    .mon_tdata(s_axis_eth_tdata),
+    .mon_tkeep(s_axis_eth_tkeep),
+    .mon_tlast(s_axis_eth_tlast),
+    .mon_tuser(s_axis_eth_tuser),
+    .mon_beat(s_axis_eth_tvalid && s_axis_eth_tready),
+    .mon_drop(dut_stat_dropped),
+
+    .stat_frame(exc_stat_frame),
+    .stat_drop(exc_stat_drop),
+
+    .m_axi_exc_araddr(m_axi_exc_araddr),
+    .m_axi_exc_arlen(m_axi_exc_arlen),
+    .m_axi_exc_arsize(m_axi_exc_arsize),
+    .m_axi_exc_arburst(m_axi_exc_arburst),
+    .m_axi_exc_arcache(m_axi_exc_arcache),
+    .m_axi_exc_arprot(m_axi_exc_arprot),
+    .m_axi_exc_arvalid(m_axi_exc_arvalid),
+    .m_axi_exc_arready(m_axi_exc_arready),
+    .m_axi_exc_rdata(m_axi_exc_rdata),
+    .m_axi_exc_rresp(m_axi_exc_rresp),
+    .m_axi_exc_rlast(m_axi_exc_rlast),
+    .m_axi_exc_rvalid(m_axi_exc_rvalid),
+    .m_axi_exc_rready(m_axi_exc_rready),
+    .m_axi_exc_awaddr(m_axi_exc_awaddr),
+    .m_axi_exc_awlen(m_axi_exc_awlen),
+    .m_axi_exc_awsize(m_axi_exc_awsize),
+    .m_axi_exc_awburst(m_axi_exc_awburst),
+    .m_axi_exc_awcache(m_axi_exc_awcache),
+    .m_axi_exc_awprot(m_axi_exc_awprot),
+    .m_axi_exc_awvalid(m_axi_exc_awvalid),
+    .m_axi_exc_awready(m_axi_exc_awready),
+    .m_axi_exc_wdata(m_axi_exc_wdata),
+    .m_axi_exc_wstrb(m_axi_exc_wstrb),
+    .m_axi_exc_wlast(m_axi_exc_wlast),
+    .m_axi_exc_wvalid(m_axi_exc_wvalid),
+    .m_axi_exc_wready(m_axi_exc_wready),
+    .m_axi_exc_bresp(m_axi_exc_bresp),
+    .m_axi_exc_bvalid(m_axi_exc_bvalid),
+    .m_axi_exc_bready(m_axi_exc_bready)
+);
+
+// ============================================================================
+// Per-QP RX completion rings
+// ============================================================================
+rx_cq_ring #(
+    .C_ADDR_WIDTH(64),
+    .RING_IDX_WIDTH(RQ_IDX_WIDTH)
+) u_cq_ring (
+    .aclk(clk),
+    .aresetn(rst_n && !reg_ctrl[2]),
+
+    .cfg_en(cqr_cfg_en),
+    .cfg_idx(reg_cqr_idx),
+    .cfg_base(reg_cqr_base),
+    .cfg_size(reg_cqr_size),
+
+    .ring_head(reg_cqr_head),
+    .ring_tail(cqr_tail),
+    .ring_en(cq_ring_en),
+    .ring_overflow(cqr_overflow),
+
+    .push(cq_ring_push),
+    .push_cqe(cq_ring_cqe),
+
+    .m_axi_cqr_araddr(m_axi_cqr_araddr),
+    .m_axi_cqr_arlen(m_axi_cqr_arlen),
+    .m_axi_cqr_arsize(m_axi_cqr_arsize),
+    .m_axi_cqr_arburst(m_axi_cqr_arburst),
+    .m_axi_cqr_arcache(m_axi_cqr_arcache),
+    .m_axi_cqr_arprot(m_axi_cqr_arprot),
+    .m_axi_cqr_arvalid(m_axi_cqr_arvalid),
+    .m_axi_cqr_arready(m_axi_cqr_arready),
+    .m_axi_cqr_rdata(m_axi_cqr_rdata),
+    .m_axi_cqr_rresp(m_axi_cqr_rresp),
+    .m_axi_cqr_rlast(m_axi_cqr_rlast),
+    .m_axi_cqr_rvalid(m_axi_cqr_rvalid),
+    .m_axi_cqr_rready(m_axi_cqr_rready),
+    .m_axi_cqr_awaddr(m_axi_cqr_awaddr),
+    .m_axi_cqr_awlen(m_axi_cqr_awlen),
+    .m_axi_cqr_awsize(m_axi_cqr_awsize),
+    .m_axi_cqr_awburst(m_axi_cqr_awburst),
+    .m_axi_cqr_awcache(m_axi_cqr_awcache),
+    .m_axi_cqr_awprot(m_axi_cqr_awprot),
+    .m_axi_cqr_awvalid(m_axi_cqr_awvalid),
+    .m_axi_cqr_awready(m_axi_cqr_awready),
+    .m_axi_cqr_wdata(m_axi_cqr_wdata),
+    .m_axi_cqr_wstrb(m_axi_cqr_wstrb),
+    .m_axi_cqr_wlast(m_axi_cqr_wlast),
+    .m_axi_cqr_wvalid(m_axi_cqr_wvalid),
+    .m_axi_cqr_wready(m_axi_cqr_wready),
+    .m_axi_cqr_bresp(m_axi_cqr_bresp),
+    .m_axi_cqr_bvalid(m_axi_cqr_bvalid),
+    .m_axi_cqr_bready(m_axi_cqr_bready)
+);
+
 // Instantiate decapsulator
 rdma_ip_decap_integrated #(
     .LOCAL_MAC(LOCAL_MAC),
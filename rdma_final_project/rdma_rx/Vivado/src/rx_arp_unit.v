@@ -0,0 +1,262 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 09:14:52 PM
+-- Design Name:
+-- Module Name: rx_arp_unit
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: ARP responder and IP -> MAC learning.
+--              Watches the Ethernet frames going into the decapsulator
+--              (never stalls them) and, at the end of each good frame:
+--                - answers an ARP request for local_ip with an ARP reply,
+--                  sent on the MAC's own TX port (txc + txd streams);
+--                - reports the sender of an ARP request/reply addressed to
+--                  us, or of an RDMA frame (UDP to local_port), as an
+--                  IP -> MAC binding for the TX endpoint table.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   One reply in flight; a request arriving meanwhile is not answered.
+--   A binding equal to the last one reported is not repeated, so a stream
+--   of RDMA frames from one peer costs a single table write.
+--   The reply is padded to the 60-byte minimum frame size.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_arp_unit (
+    input  wire         aclk,
+    input  wire         aresetn,
+
+    // Configuration
+    input  wire [47:0]  local_mac,
+    input  wire [31:0]  local_ip,
+    input  wire [15:0]  local_port,
+    input  wire         reply_en,
+    input  wire         learn_en,
+
+    // Frame monitor (one beat per s_axis_eth handshake)
+    input  wire [31:0]  mon_tdata,
+    input  wire         mon_tlast,
+    input  wire         mon_tuser,
+    input  wire         mon_beat,
+
+    // Learned binding (to the TX endpoint table)
+    output reg          learn_valid,      // Pulse
+    output reg  [31:0]  learn_ip,
+    output reg  [47:0]  learn_mac,
+
+    // ARP reply (to axi_ethernet_0 s_axis_txc / s_axis_txd)
+    output wire [31:0]  m_axis_txc_tdata,
+    output wire [3:0]   m_axis_txc_tkeep,
+    output wire         m_axis_txc_tvalid,
+    input  wire         m_axis_txc_tready,
+    output wire         m_axis_txc_tlast,
+    output wire [31:0]  m_axis_txd_tdata,
+    output wire [3:0]   m_axis_txd_tkeep,
+    output wire         m_axis_txd_tvalid,
+    input  wire         m_axis_txd_tready,
+    output wire         m_axis_txd_tlast,
+
+    // Statistics
+    output reg          stat_reply,       // Pulse: ARP reply queued
+    output reg          stat_learn        // Pulse: binding reported
+);
+
+    localparam [15:0] ETHERTYPE_IPV4 = 16'h0800;
+    localparam [15:0] ETHERTYPE_ARP  = 16'h0806;
+    localparam [15:0] ARP_OP_REQUEST = 16'd1;
+    localparam [15:0] ARP_OP_REPLY   = 16'd2;
+
+    localparam integer HDR_BEATS   = 11;  // Bytes 0-43: Ethernet + ARP, or up to the UDP ports
+    localparam integer REPLY_BEATS = 15;  // 60 bytes
+
+    // ------------------------------------------------------------------------
+    // Frame capture (byte i of the frame at hdr[8*i+7:8*i])
+    // ------------------------------------------------------------------------
+    reg [HDR_BEATS*32-1:0] hdr;
+    reg [3:0]              beat_cnt;      // Saturates at HDR_BEATS
+
+    wire [47:0] eth_dst   = {hdr[7:0],     hdr[15:8],    hdr[23:16],   hdr[31:24],   hdr[39:32],   hdr[47:40]};
+    wire [47:0] eth_src   = {hdr[55:48],   hdr[63:56],   hdr[71:64],   hdr[79:72],   hdr[87:80],   hdr[95:88]};
+    wire [15:0] ethertype = {hdr[103:96],  hdr[111:104]};
+
+    // ARP (bytes 14-41)
+    wire [15:0] arp_htype = {hdr[119:112], hdr[127:120]};
+    wire [15:0] arp_ptype = {hdr[135:128], hdr[143:136]};
+    wire [7:0]  arp_hlen  = hdr[151:144];
+    wire [7:0]  arp_plen  = hdr[159:152];
+    wire [15:0] arp_oper  = {hdr[167:160], hdr[175:168]};
+    wire [47:0] arp_sha   = {hdr[183:176], hdr[191:184], hdr[199:192], hdr[207:200], hdr[215:208], hdr[223:216]};
+    wire [31:0] arp_spa   = {hdr[231:224], hdr[239:232], hdr[247:240], hdr[255:248]};
+    wire [31:0] arp_tpa   = {hdr[311:304], hdr[319:312], hdr[327:320], hdr[335:328]};
+
+    // IPv4 + UDP (options not supported, as in the decapsulator)
+    wire [7:0]  ip_ver_ihl   = hdr[119:112];
+    wire [7:0]  ip_proto     = hdr[191:184];
+    wire [31:0] ip_src       = {hdr[215:208], hdr[223:216], hdr[231:224], hdr[239:232]};
+    wire [15:0] udp_dst_port = {hdr[295:288], hdr[303:296]};
+
+    wire to_us     = (eth_dst == local_mac) || (eth_dst == 48'hFFFFFFFFFFFF);
+    wire frame_end = mon_beat && mon_tlast;
+    // The last beat is not in hdr yet, so a full header needs HDR_BEATS beats before it
+    wire frame_ok  = frame_end && !mon_tuser && (beat_cnt == HDR_BEATS[3:0]);
+
+    wire is_arp = (ethertype == ETHERTYPE_ARP) && (arp_htype == 16'd1) &&
+                  (arp_ptype == ETHERTYPE_IPV4) && (arp_hlen == 8'd6) && (arp_plen == 8'd4);
+    wire arp_request = is_arp && (arp_oper == ARP_OP_REQUEST) && (arp_tpa == local_ip);
+    wire arp_reply   = is_arp && (arp_oper == ARP_OP_REPLY);
+    wire is_rdma     = (ethertype == ETHERTYPE_IPV4) && (eth_dst == local_mac) &&
+                       (ip_ver_ihl == 8'h45) && (ip_proto == 8'd17) && (udp_dst_port == local_port);
+
+    // Sender of the frame
+    wire [31:0] peer_ip  = is_arp ? arp_spa : ip_src;
+    wire [47:0] peer_mac = is_arp ? arp_sha : eth_src;
+
+    wire learn_hit = frame_ok && to_us && (arp_request || arp_reply || is_rdma) &&
+                     (peer_ip != 32'd0) && (peer_ip != local_ip) && !peer_mac[40];  // No multicast MACs
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            beat_cnt <= 4'd0;
+        end else if (mon_beat) begin
+            if (mon_tlast)
+                beat_cnt <= 4'd0;
+            else if (beat_cnt != HDR_BEATS[3:0])
+                beat_cnt <= beat_cnt + 4'd1;
+        end
+    end
+
+    always @(posedge aclk) begin
+        if (mon_beat && (beat_cnt != HDR_BEATS[3:0]))
+            hdr[beat_cnt*32 +: 32] <= mon_tdata;
+    end
+
+    // ------------------------------------------------------------------------
+    // Learning
+    // ------------------------------------------------------------------------
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            learn_valid <= 1'b0;
+            learn_ip    <= 32'd0;
+            learn_mac   <= 48'h0;
+            stat_learn  <= 1'b0;
+        end else begin
+            learn_valid <= 1'b0;
+            stat_learn  <= 1'b0;
+            if (learn_en && learn_hit && ((peer_ip != learn_ip) || (peer_mac != learn_mac))) begin
+                learn_valid <= 1'b1;
+                learn_ip    <= peer_ip;
+                learn_mac   <= peer_mac;
+                stat_learn  <= 1'b1;
+            end
+        end
+    end
+
+    // ------------------------------------------------------------------------
+    // ARP reply
+    // ------------------------------------------------------------------------
+    localparam [1:0] STATE_IDLE = 2'd0;
+    localparam [1:0] STATE_TXC  = 2'd1;   // AXI Ethernet control words
+    localparam [1:0] STATE_TXD  = 2'd2;   // Frame
+
+    reg [1:0]  state;
+    reg [3:0]  tx_cnt;
+    reg [47:0] rsp_mac;                   // Requester
+    reg [31:0] rsp_ip;
+
+    function [47:0] bswap48;
+        input [47:0] v;
+        begin
+            bswap48 = {v[7:0], v[15:8], v[23:16], v[31:24], v[39:32], v[47:40]};
+        end
+    endfunction
+
+    function [31:0] bswap32;
+        input [31:0] v;
+        begin
+            bswap32 = {v[7:0], v[15:8], v[23:16], v[31:24]};
+        end
+    endfunction
+
+    // Byte i at [8*i+7:8*i], so fields are listed from the end of the frame
+    wire [REPLY_BEATS*32-1:0] reply_frame = {
+        144'd0,                     // 42-59: padding
+        bswap32(rsp_ip),            // 38-41: target IP
+        bswap48(rsp_mac),           // 32-37: target MAC
+        bswap32(local_ip),          // 28-31: sender IP
+        bswap48(local_mac),         // 22-27: sender MAC
+        8'd2, 8'd0,                 // 20-21: operation = reply
+        8'd4, 8'd6,                 // 18-19: address lengths
+        8'h00, 8'h08,               // 16-17: IPv4
+        8'd1, 8'd0,                 // 14-15: Ethernet
+        8'h06, 8'h08,               // 12-13: ARP
+        bswap48(local_mac),         // 6-11:  source
+        bswap48(rsp_mac)            // 0-5:   destination
+    };
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            state      <= STATE_IDLE;
+            tx_cnt     <= 4'd0;
+            rsp_mac    <= 48'h0;
+            rsp_ip     <= 32'd0;
+            stat_reply <= 1'b0;
+        end else begin
+            stat_reply <= 1'b0;
+            case (state)
+                STATE_IDLE: begin
+                    if (reply_en && frame_ok && to_us && arp_request && !arp_sha[40]) begin
+                        rsp_mac    <= arp_sha;
+                        rsp_ip     <= arp_spa;
+                        tx_cnt     <= 4'd0;
+                        stat_reply <= 1'b1;
+                        state      <= STATE_TXC;
+                    end
+                end
+
+                STATE_TXC: begin
+                    if (m_axis_txc_tready) begin
+                        if (tx_cnt == 4'd5) begin
+                            tx_cnt <= 4'd0;
+                            state  <= STATE_TXD;
+                        end else begin
+                            tx_cnt <= tx_cnt + 4'd1;
+                        end
+                    end
+                end
+
+                STATE_TXD: begin
+                    if (m_axis_txd_tready) begin
+                        if (tx_cnt == REPLY_BEATS - 1) begin
+                            tx_cnt <= 4'd0;
+                            state  <= STATE_IDLE;
+                        end else begin
+                            tx_cnt <= tx_cnt + 4'd1;
+                        end
+                    end
+                end
+
+                default: state <= STATE_IDLE;
+            endcase
+        end
+    end
+
+    // Tag word (normal frame, no checksum offload) followed by five zero words, as in eth_pkt_gen
+    assign m_axis_txc_tdata  = (tx_cnt == 4'd0) ? 32'hA0000000 : 32'h00000000;
+    assign m_axis_txc_tkeep  = 4'hF;
+    assign m_axis_txc_tvalid = (state == STATE_TXC);
+    assign m_axis_txc_tlast  = (state == STATE_TXC) && (tx_cnt == 4'd5);
+
+    assign m_axis_txd_tdata  = reply_frame[tx_cnt*32 +: 32];
+    assign m_axis_txd_tkeep  = 4'hF;
+    assign m_axis_txd_tvalid = (state == STATE_TXD);
+    assign m_axis_txd_tlast  = (state == STATE_TXD) && (tx_cnt == REPLY_BEATS - 1);
+
+endmodule
@@ -0,0 +1,201 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 05:02:37 PM
+-- Design Name:
+-- Module Name: rx_atomic_unit
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Read-modify-write engine for remote atomics.
+--              Reads one 64-bit word from DDR over its own AXI4 master,
+--              computes the new value and writes it back:
+--                FETCH_ADD: mem <= mem + swap_add
+--                CMP_SWAP : mem <= (mem == compare) ? swap_add : mem
+--              The original value is returned for the ATOMIC_ACK.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   One operation at a time, single-beat bursts, addr must be 8-byte aligned.
+--   Atomic with respect to other RDMA traffic of this receiver only (the
+--   rx_streamer FSM is blocked while an operation runs), not to CPU accesses.
+--   A failed CMP_SWAP skips the write.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_atomic_unit #(
+    parameter C_ADDR_WIDTH = 64
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    // Operation (from rx_streamer)
+    input  wire                             start,            // Pulse
+    input  wire                             op_cmp_swap,      // 0 = FETCH_ADD
+    input  wire [C_ADDR_WIDTH-1:0]          addr,
+    input  wire [63:0]                      swap_add,
+    input  wire [63:0]                      compare,
+    output reg                              done,             // Pulse
+    output reg                              error,            // SLVERR/DECERR seen
+    output reg  [63:0]                      orig,
+
+    // AXI4 master (64-bit, to DDR through smartconnect_1)
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_atomic_araddr,
+    output wire [7:0]                       m_axi_atomic_arlen,
+    output wire [2:0]                       m_axi_atomic_arsize,
+    output wire [1:0]                       m_axi_atomic_arburst,
+    output wire [3:0]                       m_axi_atomic_arcache,
+    output wire [2:0]                       m_axi_atomic_arprot,
+    output wire                             m_axi_atomic_arvalid,
+    input  wire                             m_axi_atomic_arready,
+    input  wire [63:0]                      m_axi_atomic_rdata,
+    input  wire [1:0]                       m_axi_atomic_rresp,
+    input  wire                             m_axi_atomic_rlast,
+    input  wire                             m_axi_atomic_rvalid,
+    output wire                             m_axi_atomic_rready,
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_atomic_awaddr,
+    output wire [7:0]                       m_axi_atomic_awlen,
+    output wire [2:0]                       m_axi_atomic_awsize,
+    output wire [1:0]                       m_axi_atomic_awburst,
+    output wire [3:0]                       m_axi_atomic_awcache,
+    output wire [2:0]                       m_axi_atomic_awprot,
+    output wire                             m_axi_atomic_awvalid,
+    input  wire                             m_axi_atomic_awready,
+    output wire [63:0]                      m_axi_atomic_wdata,
+    output wire [7:0]                       m_axi_atomic_wstrb,
+    output wire                             m_axi_atomic_wlast,
+    output wire                             m_axi_atomic_wvalid,
+    input  wire                             m_axi_atomic_wready,
+    input  wire [1:0]                       m_axi_atomic_bresp,
+    input  wire                             m_axi_atomic_bvalid,
+    output wire                             m_axi_atomic_bready
+);
+
+    localparam [2:0] STATE_IDLE  = 3'd0;
+    localparam [2:0] STATE_AR    = 3'd1;
+    localparam [2:0] STATE_R     = 3'd2;
+    localparam [2:0] STATE_WRITE = 3'd3;
+    localparam [2:0] STATE_B     = 3'd4;
+
+    reg [2:0] state_reg;
+
+    reg [C_ADDR_WIDTH-1:0] addr_reg;
+    reg                    cmp_swap_reg;
+    reg [63:0]             swap_add_reg;
+    reg [63:0]             compare_reg;
+    reg [63:0]             new_value_reg;
+    reg                    aw_done_reg;   // AW and W complete independently
+    reg                    w_done_reg;
+
+    // Read channel
+    assign m_axi_atomic_araddr  = addr_reg;
+    assign m_axi_atomic_arlen   = 8'd0;
+    assign m_axi_atomic_arsize  = 3'b011;      // 8 bytes
+    assign m_axi_atomic_arburst = 2'b01;
+    assign m_axi_atomic_arcache = 4'b0011;
+    assign m_axi_atomic_arprot  = 3'b000;
+    assign m_axi_atomic_arvalid = (state_reg == STATE_AR);
+    assign m_axi_atomic_rready  = (state_reg == STATE_R);
+
+    // Write channels
+    assign m_axi_atomic_awaddr  = addr_reg;
+    assign m_axi_atomic_awlen   = 8'd0;
+    assign m_axi_atomic_awsize  = 3'b011;
+    assign m_axi_atomic_awburst = 2'b01;
+    assign m_axi_atomic_awcache = 4'b0011;
+    assign m_axi_atomic_awprot  = 3'b000;
+    assign m_axi_atomic_awvalid = (state_reg == STATE_WRITE) && !aw_done_reg;
+    assign m_axi_atomic_wdata   = new_value_reg;
+    assign m_axi_atomic_wstrb   = 8'hFF;
+    assign m_axi_atomic_wlast   = 1'b1;
+    assign m_axi_atomic_wvalid  = (state_reg == STATE_WRITE) && !w_done_reg;
+    assign m_axi_atomic_bready  = (state_reg == STATE_B);
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            state_reg     <= STATE_IDLE;
+            addr_reg      <= 0;
+            cmp_swap_reg  <= 0;
+            swap_add_reg  <= 0;
+            compare_reg   <= 0;
+            new_value_reg <= 0;
+            aw_done_reg   <= 0;
+            w_done_reg    <= 0;
+            done          <= 0;
+            error         <= 0;
+            orig          <= 0;
+        end else begin
+            done <= 1'b0;
+
+            case (state_reg)
+                STATE_IDLE: begin
+                    if (start) begin
+                        addr_reg     <= addr;
+                        cmp_swap_reg <= op_cmp_swap;
+                        swap_add_reg <= swap_add;
+                        compare_reg  <= compare;
+                        error        <= 1'b0;
+                        state_reg    <= STATE_AR;
+                    end
+                end
+
+                STATE_AR: begin
+                    if (m_axi_atomic_arready) begin
+                        state_reg <= STATE_R;
+                    end
+                end
+
+                STATE_R: begin
+                    if (m_axi_atomic_rvalid) begin
+                        orig          <= m_axi_atomic_rdata;
+                        new_value_reg <= cmp_swap_reg ? swap_add_reg : m_axi_atomic_rdata + swap_add_reg;
+                        aw_done_reg   <= 1'b0;
+                        w_done_reg    <= 1'b0;
+
+                        if (m_axi_atomic_rresp[1]) begin
+                            // Read failed: nothing to write back
+                            error     <= 1'b1;
+                            done      <= 1'b1;
+                            state_reg <= STATE_IDLE;
+                        end else if (cmp_swap_reg && (m_axi_atomic_rdata != compare_reg)) begin
+                            // Compare failed: memory unchanged
+                            done      <= 1'b1;
+                            state_reg <= STATE_IDLE;
+                        end else begin
+                            state_reg <= STATE_WRITE;
+                        end
+                    end
+                end
+
+                STATE_WRITE: begin
+                    if (m_axi_atomic_awvalid && m_axi_atomic_awready)
+                        aw_done_reg <= 1'b1;
+                    if (m_axi_atomic_wvalid && m_axi_atomic_wready)
+                        w_done_reg <= 1'b1;
+
+                    if ((aw_done_reg || m_axi_atomic_awready) && (w_done_reg || m_axi_atomic_wready)) begin
+                        state_reg <= STATE_B;
+                    end
+                end
+
+                STATE_B: begin
+                    if (m_axi_atomic_bvalid) begin
+                        error     <= m_axi_atomic_bresp[1];
+                        done      <= 1'b1;
+                        state_reg <= STATE_IDLE;
+                    end
+                end
+
+                default: begin
+                    state_reg <= STATE_IDLE;
+                end
+            endcase
+        end
+    end
+
+endmodule
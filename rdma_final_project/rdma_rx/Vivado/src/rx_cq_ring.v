@@ -0,0 +1,247 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 11:52:37 PM
+-- Design Name:
+-- Module Name: rx_cq_ring
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Per-QP RX completion rings in DDR.
+--              RX completions of a QP whose ring is enabled are written to
+--              ring QPN[RING_IDX_WIDTH-1:0] instead of the register CQ, so
+--              every receive queue has its own completion stream that one
+--              CPU core can poll without sharing CQ_POP with the others.
+--              Entry layout (16 bytes):
+--                +0x0: wr_id
+--                +0x4: byte_len
+--                +0x8: {type[3:0], status[3:0], qpn[23:0]}   (as CQ_INFO)
+--                +0xC: imm
+--              Hardware owns the tails, software the heads; a ring is full
+--              when tail + 1 == head.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   Completions wait in a small FIFO while an entry is written. A
+--   completion for a full ring, or pushed while the FIFO is full, is lost
+--   and sets the sticky overflow flag of its ring; other rings are not
+--   held up.
+--   A ring is (re)programmed with cfg_en, which also clears its tail and
+--   overflow flag; do this while no traffic is sent to its QP.
+--   Ring bases must be 16-byte aligned.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_cq_ring #(
+    parameter C_ADDR_WIDTH     = 64,
+    parameter RING_IDX_WIDTH   = 2,            // 4 rings, one per receive queue
+    parameter FIFO_DEPTH_WIDTH = 4             // 16 completions waiting for DDR
+) (
+    input  wire                                 aclk,
+    input  wire                                 aresetn,
+
+    // Ring programming (from the register file)
+    input  wire                                 cfg_en,           // Pulse
+    input  wire [RING_IDX_WIDTH-1:0]            cfg_idx,
+    input  wire [63:0]                          cfg_base,
+    input  wire [15:0]                          cfg_size,         // Entries, 0 = ring disabled
+
+    input  wire [(16<<RING_IDX_WIDTH)-1:0]      ring_head,        // Software consumer indexes
+    output wire [(16<<RING_IDX_WIDTH)-1:0]      ring_tail,        // Hardware producer indexes
+    output wire [(1<<RING_IDX_WIDTH)-1:0]       ring_en,
+    output reg  [(1<<RING_IDX_WIDTH)-1:0]       ring_overflow,    // Sticky
+
+    // Completions (from rx_recv_queue)
+    input  wire                                 push,             // Pulse
+    input  wire [127:0]                         push_cqe,         // {wr_id, byte_len, imm, info}
+
+    // DDR write port (AXI4 master, read channel unused)
+    output wire [C_ADDR_WIDTH-1:0]              m_axi_cqr_araddr,
+    output wire [7:0]                           m_axi_cqr_arlen,
+    output wire [2:0]                           m_axi_cqr_arsize,
+    output wire [1:0]                           m_axi_cqr_arburst,
+    output wire [3:0]                           m_axi_cqr_arcache,
+    output wire [2:0]                           m_axi_cqr_arprot,
+    output wire                                 m_axi_cqr_arvalid,
+    input  wire                                 m_axi_cqr_arready,
+    input  wire [63:0]                          m_axi_cqr_rdata,
+    input  wire [1:0]                           m_axi_cqr_rresp,
+    input  wire                                 m_axi_cqr_rlast,
+    input  wire                                 m_axi_cqr_rvalid,
+    output wire                                 m_axi_cqr_rready,
+    output wire [C_ADDR_WIDTH-1:0]              m_axi_cqr_awaddr,
+    output wire [7:0]                           m_axi_cqr_awlen,
+    output wire [2:0]                           m_axi_cqr_awsize,
+    output wire [1:0]                           m_axi_cqr_awburst,
+    output wire [3:0]                           m_axi_cqr_awcache,
+    output wire [2:0]                           m_axi_cqr_awprot,
+    output wire                                 m_axi_cqr_awvalid,
+    input  wire                                 m_axi_cqr_awready,
+    output wire [63:0]                          m_axi_cqr_wdata,
+    output wire [7:0]                           m_axi_cqr_wstrb,
+    output wire                                 m_axi_cqr_wlast,
+    output wire                                 m_axi_cqr_wvalid,
+    input  wire                                 m_axi_cqr_wready,
+    input  wire [1:0]                           m_axi_cqr_bresp,
+    input  wire                                 m_axi_cqr_bvalid,
+    output wire                                 m_axi_cqr_bready
+);
+
+    localparam RING_COUNT = 1 << RING_IDX_WIDTH;
+    localparam FIFO_DEPTH = 1 << FIFO_DEPTH_WIDTH;
+
+    localparam [1:0] STATE_IDLE = 2'd0;
+    localparam [1:0] STATE_DATA = 2'd1;   // AW + two W beats
+    localparam [1:0] STATE_B    = 2'd2;   // Write response
+
+    // Ring configuration
+    reg [63:0] base [0:RING_COUNT-1];
+    reg [15:0] size [0:RING_COUNT-1];
+    reg [15:0] tail [0:RING_COUNT-1];
+
+    genvar g;
+    generate
+        for (g = 0; g < RING_COUNT; g = g + 1) begin : gen_ring
+            assign ring_tail[g*16 +: 16] = tail[g];
+            assign ring_en[g]            = (size[g] != 16'd0);
+        end
+    endgenerate
+
+    // Completion FIFO (distributed RAM, head read combinationally)
+    (* ram_style = "distributed" *)
+    reg [127:0]              fifo_mem [0:FIFO_DEPTH-1];
+    reg [FIFO_DEPTH_WIDTH:0] fifo_wr_ptr;
+    reg [FIFO_DEPTH_WIDTH:0] fifo_rd_ptr;
+
+    wire         fifo_empty = (fifo_wr_ptr == fifo_rd_ptr);
+    wire         fifo_full  = (fifo_wr_ptr - fifo_rd_ptr == FIFO_DEPTH);
+    wire [127:0] head_cqe   = fifo_mem[fifo_rd_ptr[FIFO_DEPTH_WIDTH-1:0]];
+
+    wire [RING_IDX_WIDTH-1:0] push_idx = push_cqe[RING_IDX_WIDTH-1:0];        // QPN low bits
+    wire [RING_IDX_WIDTH-1:0] head_idx = head_cqe[RING_IDX_WIDTH-1:0];
+
+    wire [15:0] head_tail_next = (tail[head_idx] + 16'd1 == size[head_idx]) ? 16'd0 : tail[head_idx] + 16'd1;
+    wire        head_full      = (head_tail_next == ring_head[head_idx*16 +: 16]);
+
+    reg [1:0]                state_reg;
+    reg [C_ADDR_WIDTH-1:0]   addr_reg;
+    reg [RING_IDX_WIDTH-1:0] idx_reg;
+    reg [15:0]               tail_next_reg;
+    reg                      aw_done_reg;
+    reg                      w_cnt;       // W beat being sent
+
+    // Entry at the head of the FIFO cannot be written: drop it
+    wire head_drop = (state_reg == STATE_IDLE) && !fifo_empty && (!ring_en[head_idx] || head_full);
+    wire head_done = (state_reg == STATE_B) && m_axi_cqr_bvalid;
+
+    assign m_axi_cqr_araddr  = {C_ADDR_WIDTH{1'b0}};
+    assign m_axi_cqr_arlen   = 8'd0;
+    assign m_axi_cqr_arsize  = 3'b011;
+    assign m_axi_cqr_arburst = 2'b01;
+    assign m_axi_cqr_arcache = 4'b0011;
+    assign m_axi_cqr_arprot  = 3'b000;
+    assign m_axi_cqr_arvalid = 1'b0;
+    assign m_axi_cqr_rready  = 1'b1;
+
+    assign m_axi_cqr_awaddr  = addr_reg;
+    assign m_axi_cqr_awlen   = 8'd1;      // Two 8-byte beats
+    assign m_axi_cqr_awsize  = 3'b011;
+    assign m_axi_cqr_awburst = 2'b01;
+    assign m_axi_cqr_awcache = 4'b0011;
+    assign m_axi_cqr_awprot  = 3'b000;
+    assign m_axi_cqr_awvalid = ((state_reg == STATE_DATA) || (state_reg == STATE_B)) && !aw_done_reg;
+    assign m_axi_cqr_wdata   = w_cnt ? {head_cqe[63:32], head_cqe[31:0]}       // imm, info
+                                     : {head_cqe[95:64], head_cqe[127:96]};    // byte_len, wr_id
+    assign m_axi_cqr_wstrb   = 8'hFF;
+    assign m_axi_cqr_wlast   = w_cnt;
+    assign m_axi_cqr_wvalid  = (state_reg == STATE_DATA);
+    assign m_axi_cqr_bready  = (state_reg == STATE_B);
+
+    // FIFO
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            fifo_wr_ptr <= 0;
+            fifo_rd_ptr <= 0;
+        end else begin
+            if (push && !fifo_full) begin
+                fifo_mem[fifo_wr_ptr[FIFO_DEPTH_WIDTH-1:0]] <= push_cqe;
+                fifo_wr_ptr <= fifo_wr_ptr + 1'b1;
+            end
+            if (head_drop || head_done)
+                fifo_rd_ptr <= fifo_rd_ptr + 1'b1;
+        end
+    end
+
+    // Writer
+    integer i;
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            state_reg     <= STATE_IDLE;
+            addr_reg      <= {C_ADDR_WIDTH{1'b0}};
+            idx_reg       <= {RING_IDX_WIDTH{1'b0}};
+            tail_next_reg <= 16'd0;
+            aw_done_reg   <= 1'b0;
+            w_cnt         <= 1'b0;
+            ring_overflow <= {RING_COUNT{1'b0}};
+            for (i = 0; i < RING_COUNT; i = i + 1) begin
+                base[i] <= 64'd0;
+                size[i] <= 16'd0;
+                tail[i] <= 16'd0;
+            end
+        end else begin
+            case (state_reg)
+                STATE_IDLE: begin
+                    if (!fifo_empty && !head_drop) begin
+                        addr_reg      <= base[head_idx][C_ADDR_WIDTH-1:0] + {tail[head_idx], 4'd0};
+                        idx_reg       <= head_idx;
+                        tail_next_reg <= head_tail_next;
+                        aw_done_reg   <= 1'b0;
+                        w_cnt         <= 1'b0;
+                        state_reg     <= STATE_DATA;
+                    end
+                end
+
+                STATE_DATA: begin
+                    if (m_axi_cqr_awvalid && m_axi_cqr_awready)
+                        aw_done_reg <= 1'b1;
+                    if (m_axi_cqr_wvalid && m_axi_cqr_wready) begin
+                        w_cnt <= 1'b1;
+                        if (m_axi_cqr_wlast)
+                            state_reg <= STATE_B;
+                    end
+                end
+
+                STATE_B: begin
+                    if (m_axi_cqr_awvalid && m_axi_cqr_awready)
+                        aw_done_reg <= 1'b1;
+                    if (m_axi_cqr_bvalid) begin
+                        tail[idx_reg] <= tail_next_reg;
+                        state_reg     <= STATE_IDLE;
+                    end
+                end
+
+                default: state_reg <= STATE_IDLE;
+            endcase
+
+            // Lost completions
+            if (head_drop && ring_en[head_idx])
+                ring_overflow[head_idx] <= 1'b1;
+            if (push && fifo_full)
+                ring_overflow[push_idx] <= 1'b1;
+
+            // Programming wins over a write finishing in the same cycle
+            if (cfg_en) begin
+                base[cfg_idx]          <= cfg_base;
+                size[cfg_idx]          <= cfg_size;
+                tail[cfg_idx]          <= 16'd0;
+                ring_overflow[cfg_idx] <= 1'b0;
+            end
+        end
+    end
+
+endmodule
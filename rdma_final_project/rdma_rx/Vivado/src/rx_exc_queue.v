@@ -0,0 +1,339 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 10:41:06 PM
+-- Design Name:
+-- Module Name: rx_exc_queue
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Slow-path exception queue.
+--              Copies every frame the decapsulator drops (not RDMA: wrong
+--              MAC, EtherType, IP header or UDP port) into a ring of 2 KB
+--              slots in DDR for a software network stack. Frames with a MAC
+--              error (tuser) are not copied.
+--              Slot layout:
+--                +0x0: [15:0] stored length in bytes, [16] truncated
+--                +0x4: reserved (0)
+--                +0x8: frame, from the destination MAC (up to 2040 bytes)
+--              Hardware owns ring_tail, software ring_head; the ring is full
+--              when ring_tail + 1 == ring_head.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   The frame is watched without stalling it and stored in one of two 2 KB
+--   buffers; the drop decision (stat_pkt_dropped of the decapsulator) is
+--   known by its last beat. A frame is lost when both buffers are waiting
+--   for DDR or the ring is full (stat_drop).
+--   ring_base must be 2 KB aligned, so a slot never crosses 4 KB.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_exc_queue #(
+    parameter C_ADDR_WIDTH = 64
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    // Ring configuration
+    input  wire                             enable,
+    input  wire [63:0]                      ring_base,
+    input  wire [15:0]                      ring_size,        // Slots, 0 = disabled
+    input  wire [15:0]                      ring_head,        // Software consumer index
+    output reg  [15:0]                      ring_tail,        // Hardware producer index
+
+    // Frame monitor (one beat per s_axis_eth handshake)
+    input  wire [31:0]                      mon_tdata,
+    input  wire [3:0]                       mon_tkeep,
+    input  wire                             mon_tlast,
+    input  wire                             mon_tuser,
+    input  wire                             mon_beat,
+    input  wire                             mon_drop,         // Decapsulator stat_pkt_dropped
+
+    // Statistics
+    output reg                              stat_frame,       // Pulse: frame written to the ring
+    output reg                              stat_drop,        // Pulse: exception frame lost
+
+    // AXI4 master (64-bit, to DDR through smartconnect_1), write only
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_exc_araddr,
+    output wire [7:0]                       m_axi_exc_arlen,
+    output wire [2:0]                       m_axi_exc_arsize,
+    output wire [1:0]                       m_axi_exc_arburst,
+    output wire [3:0]                       m_axi_exc_arcache,
+    output wire [2:0]                       m_axi_exc_arprot,
+    output wire                             m_axi_exc_arvalid,
+    input  wire                             m_axi_exc_arready,
+    input  wire [63:0]                      m_axi_exc_rdata,
+    input  wire [1:0]                       m_axi_exc_rresp,
+    input  wire                             m_axi_exc_rlast,
+    input  wire                             m_axi_exc_rvalid,
+    output wire                             m_axi_exc_rready,
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_exc_awaddr,
+    output wire [7:0]                       m_axi_exc_awlen,
+    output wire [2:0]                       m_axi_exc_awsize,
+    output wire [1:0]                       m_axi_exc_awburst,
+    output wire [3:0]                       m_axi_exc_awcache,
+    output wire [2:0]                       m_axi_exc_awprot,
+    output wire                             m_axi_exc_awvalid,
+    input  wire                             m_axi_exc_awready,
+    output wire [63:0]                      m_axi_exc_wdata,
+    output wire [7:0]                       m_axi_exc_wstrb,
+    output wire                             m_axi_exc_wlast,
+    output wire                             m_axi_exc_wvalid,
+    input  wire                             m_axi_exc_wready,
+    input  wire [1:0]                       m_axi_exc_bresp,
+    input  wire                             m_axi_exc_bvalid,
+    output wire                             m_axi_exc_bready
+);
+
+    localparam [9:0] MAX_BEATS = 10'd510;     // 32-bit beats after the 8-byte slot header
+
+    function [2:0] count_ones;
+        input [3:0] keep;
+        begin
+            count_ones = keep[0] + keep[1] + keep[2] + keep[3];
+        end
+    endfunction
+
+    // ------------------------------------------------------------------------
+    // Frame capture
+    // ------------------------------------------------------------------------
+    // The monitor is delayed one cycle so that a drop pulse lines up with the
+    // beat that caused it (frames cut short) or falls inside the frame
+    // (validator verdict, given while the decapsulator holds tready low).
+    reg        d_beat;
+    reg [31:0] d_data;
+    reg [3:0]  d_keep;
+    reg        d_last;
+    reg        d_user;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            d_beat <= 1'b0;
+        end else begin
+            d_beat <= mon_beat;
+        end
+        d_data <= mon_tdata;
+        d_keep <= mon_tkeep;
+        d_last <= mon_tlast;
+        d_user <= mon_tuser;
+    end
+
+    wire ring_on = enable && (ring_size != 16'd0);
+
+    // Two frame buffers, 64-bit word w of buffer b at {b, w}; word 0 is the slot header
+    reg [31:0] buf_lo [0:511];
+    reg [31:0] buf_hi [0:511];
+    reg [1:0]  buf_full;
+    reg [11:0] buf_len   [0:1];
+    reg        buf_trunc [0:1];
+
+    reg        fill_buf;
+    reg        in_frame;
+    reg        f_cap;                     // Buffer available for the current frame
+    reg        f_drop;
+    reg        f_err;
+    reg [9:0]  f_beats;
+    reg [11:0] f_bytes;
+
+    wire       f_start   = d_beat && !in_frame;
+    wire       cap_now   = f_start ? (ring_on && !buf_full[fill_buf]) : f_cap;
+    wire [9:0] beat_idx  = f_start ? 10'd0 : f_beats;
+    wire       beat_keep = d_beat && cap_now && (beat_idx < MAX_BEATS);
+    wire [8:0] wr_addr   = {fill_buf, beat_idx[8:1] + 8'd1};
+    wire       drop_now  = (f_start ? 1'b0 : f_drop) || mon_drop;
+    wire       err_now   = (f_start ? 1'b0 : f_err) || d_user;
+    wire [11:0] bytes_now = (f_start ? 12'd0 : f_bytes) + (beat_keep ? count_ones(d_keep) : 3'd0);
+    wire       f_end     = d_beat && d_last;
+    wire       f_commit  = f_end && drop_now && !err_now && cap_now;
+
+    always @(posedge aclk) begin
+        if (beat_keep && !beat_idx[0])
+            buf_lo[wr_addr] <= d_data;
+        if (beat_keep && beat_idx[0])
+            buf_hi[wr_addr] <= d_data;
+    end
+
+    // Drain side (declared here, used by the buffer flags)
+    reg        drain_buf;
+    wire       drain_release;             // drain_buf written or discarded this cycle
+    wire       drain_discard;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            fill_buf   <= 1'b0;
+            in_frame   <= 1'b0;
+            f_cap      <= 1'b0;
+            f_drop     <= 1'b0;
+            f_err      <= 1'b0;
+            f_beats    <= 10'd0;
+            f_bytes    <= 12'd0;
+            buf_full   <= 2'b00;
+            stat_drop  <= 1'b0;
+            buf_len[0]   <= 12'd0;
+            buf_len[1]   <= 12'd0;
+            buf_trunc[0] <= 1'b0;
+            buf_trunc[1] <= 1'b0;
+        end else begin
+            stat_drop <= 1'b0;
+
+            if (mon_drop)
+                f_drop <= 1'b1;
+
+            if (d_beat) begin
+                in_frame <= !d_last;
+                f_cap    <= cap_now;
+                f_drop   <= drop_now && !d_last;
+                f_err    <= err_now;
+                f_bytes  <= bytes_now;
+                if (beat_idx != 10'h3FF)
+                    f_beats <= beat_idx + 10'd1;
+            end
+
+            if (f_commit) begin
+                buf_full[fill_buf]  <= 1'b1;
+                buf_len[fill_buf]   <= bytes_now;
+                buf_trunc[fill_buf] <= (beat_idx >= MAX_BEATS);
+                fill_buf            <= !fill_buf;
+            end else if (f_end && drop_now && !err_now && ring_on) begin
+                // Both buffers still waiting for DDR
+                stat_drop <= 1'b1;
+            end
+
+            if (drain_release)
+                buf_full[drain_buf] <= 1'b0;
+
+            if (drain_discard)
+                stat_drop <= 1'b1;
+        end
+    end
+
+    // ------------------------------------------------------------------------
+    // Drain: one AXI burst per frame into the slot at ring_tail
+    // ------------------------------------------------------------------------
+    localparam [1:0] STATE_IDLE = 2'd0;
+    localparam [1:0] STATE_DATA = 2'd1;   // AW and W beats
+    localparam [1:0] STATE_B    = 2'd2;
+
+    reg [1:0]  state_reg;
+    reg [C_ADDR_WIDTH-1:0] addr_reg;
+    reg [7:0]  len_reg;                   // Beats - 1
+    reg        aw_done_reg;
+    reg [8:0]  rd_idx;                    // Next buffer word to read
+    reg [7:0]  w_cnt;                     // W beats sent
+    reg        w_full;
+    reg [63:0] w_data;
+
+    wire [15:0] tail_next  = (ring_tail + 16'd1 == ring_size) ? 16'd0 : ring_tail + 16'd1;
+    wire        ring_full  = (tail_next == ring_head);
+    wire [11:0] drain_len  = buf_len[drain_buf];
+    wire [8:0]  drain_words = {1'b0, drain_len[11:3]} + (drain_len[2:0] != 3'd0);    // Frame words
+    assign drain_discard = (state_reg == STATE_IDLE) && buf_full[drain_buf] && ring_full;
+    assign drain_release = drain_discard || ((state_reg == STATE_B) && m_axi_exc_bvalid);
+
+    wire [63:0] slot_hdr = {32'd0, 15'd0, buf_trunc[drain_buf], 4'd0, drain_len};
+
+    assign m_axi_exc_araddr  = {C_ADDR_WIDTH{1'b0}};
+    assign m_axi_exc_arlen   = 8'd0;
+    assign m_axi_exc_arsize  = 3'b011;
+    assign m_axi_exc_arburst = 2'b01;
+    assign m_axi_exc_arcache = 4'b0011;
+    assign m_axi_exc_arprot  = 3'b000;
+    assign m_axi_exc_arvalid = 1'b0;
+    assign m_axi_exc_rready  = 1'b1;
+
+    assign m_axi_exc_awaddr  = addr_reg;
+    assign m_axi_exc_awlen   = len_reg;
+    assign m_axi_exc_awsize  = 3'b011;    // 8 bytes
+    assign m_axi_exc_awburst = 2'b01;
+    assign m_axi_exc_awcache = 4'b0011;
+    assign m_axi_exc_awprot  = 3'b000;
+    assign m_axi_exc_awvalid = ((state_reg == STATE_DATA) || (state_reg == STATE_B)) && !aw_done_reg;
+    assign m_axi_exc_wdata   = w_data;
+    assign m_axi_exc_wstrb   = 8'hFF;
+    assign m_axi_exc_wlast   = (w_cnt == len_reg);
+    assign m_axi_exc_wvalid  = (state_reg == STATE_DATA) && w_full;
+    assign m_axi_exc_bready  = (state_reg == STATE_B);
+
+    wire w_take = (state_reg == STATE_DATA) && (!w_full || m_axi_exc_wready) && (rd_idx <= {1'b0, len_reg});
+
+    always @(posedge aclk) begin
+        if (w_take)
+            w_data <= (rd_idx == 9'd0) ? slot_hdr : {buf_hi[{drain_buf, rd_idx[7:0]}], buf_lo[{drain_buf, rd_idx[7:0]}]};
+    end
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            state_reg   <= STATE_IDLE;
+            addr_reg    <= {C_ADDR_WIDTH{1'b0}};
+            len_reg     <= 8'd0;
+            aw_done_reg <= 1'b0;
+            rd_idx      <= 9'd0;
+            w_cnt       <= 8'd0;
+            w_full      <= 1'b0;
+            drain_buf   <= 1'b0;
+            ring_tail   <= 16'd0;
+            stat_frame  <= 1'b0;
+        end else begin
+            stat_frame <= 1'b0;
+
+            case (state_reg)
+                STATE_IDLE: begin
+                    if (drain_discard) begin
+                        // Ring full: software is behind, give the buffer back
+                        drain_buf <= !drain_buf;
+                    end else if (buf_full[drain_buf]) begin
+                        addr_reg    <= ring_base + {ring_tail, 11'd0};
+                        len_reg     <= drain_words[7:0];     // Header + frame words - 1
+                        aw_done_reg <= 1'b0;
+                        rd_idx      <= 9'd0;
+                        w_cnt       <= 8'd0;
+                        w_full      <= 1'b0;
+                        state_reg   <= STATE_DATA;
+                    end
+                end
+
+                STATE_DATA: begin
+                    if (m_axi_exc_awvalid && m_axi_exc_awready)
+                        aw_done_reg <= 1'b1;
+
+                    if (m_axi_exc_wvalid && m_axi_exc_wready) begin
+                        w_cnt <= w_cnt + 8'd1;
+                        if (m_axi_exc_wlast) begin
+                            w_full    <= 1'b0;
+                            state_reg <= STATE_B;
+                        end
+                    end
+
+                    if (w_take) begin
+                        w_full <= 1'b1;
+                        rd_idx <= rd_idx + 9'd1;
+                    end else if (m_axi_exc_wvalid && m_axi_exc_wready) begin
+                        w_full <= 1'b0;
+                    end
+                end
+
+                STATE_B: begin
+                    // AW may still be outstanding when the last W beat went first
+                    if (m_axi_exc_awvalid && m_axi_exc_awready)
+                        aw_done_reg <= 1'b1;
+                    if (m_axi_exc_bvalid) begin
+                        // Slot complete (an error response still moves on: the slot holds garbage)
+                        ring_tail  <= tail_next;
+                        stat_frame <= 1'b1;
+                        drain_buf  <= !drain_buf;
+                        state_reg  <= STATE_IDLE;
+                    end
+                end
+
+                default: state_reg <= STATE_IDLE;
+            endcase
+        end
+    end
+
+endmodule
@@ -31,7 +31,14 @@ module rx_header_parser #(
     parameter RDMA_QPN_WIDTH     = 24,
     parameter RDMA_ADDR_WIDTH    = 64,
     parameter RDMA_RKEY_WIDTH    = 32,
-    parameter RDMA_LENGTH_WIDTH  = 32
+    parameter RDMA_LENGTH_WIDTH  = 32,
+
+    parameter RDMA_OPCODE_READ_REQUEST = 8'h0C,  // Carries a 3-beat read extension
+    parameter RDMA_OPCODE_WRITE_IMM    = 8'h0B,  // Carries a 1-beat immediate
+    parameter RDMA_OPCODE_CMP_SWAP     = 8'h13,  // Carries swap/add + compare (4 beats)
+    parameter RDMA_OPCODE_FETCH_ADD    = 8'h14,
+    parameter RDMA_OPCODE_ATOMIC_ACK   = 8'h12,  // Carries the original value (2 beats)
+    parameter RDMA_OPCODE_ACK          = 8'h11   // ACK/NAK: carries the AETH (1 beat)
 ) (
     input  wire                             aclk,
     input  wire                             aresetn,
@@ -47,6 +54,17 @@ module rx_header_parser #(
     output reg                              m_axis_tvalid,
     input  wire                             m_axis_tready,
     output reg                              m_axis_tlast,
+
+    // Payload of packets rx_streamer delivers to the PL instead of DDR. TUSER carries the
+    // header of the packet, constant over all beats:
+    //   [63:0] VA of the first byte, [95:64] length, [119:96] dest QP, [127:120] opcode,
+    //   [151:128] PSN, [152] last packet of the message, [191:160] WRITE_WITH_IMM immediate
+    output reg  [C_AXIS_TDATA_WIDTH-1:0]    m_axis_pl_tdata,
+    output reg  [C_AXIS_TKEEP_WIDTH-1:0]    m_axis_pl_tkeep,
+    output reg                              m_axis_pl_tvalid,
+    input  wire                             m_axis_pl_tready,
+    output reg                              m_axis_pl_tlast,
+    output wire [191:0]                     m_axis_pl_tuser,
     
     output reg [RDMA_OPCODE_WIDTH-1:0]      rdma_opcode,
     output reg [RDMA_PSN_WIDTH-1:0]         rdma_psn,
@@ -59,29 +77,85 @@ module rx_header_parser #(
     
     output reg [15:0]                       fragment_id,
     output reg                              more_fragments,
+    output reg                              ecn_ce,           // IP header was CE-marked (set by the decap in beat 3)
     output reg [15:0]                       fragment_offset,
+
+    // READ request extension (beats 9-11): where the responder sends the data back
+    output reg [RDMA_ADDR_WIDTH-1:0]        read_sink_addr,
+    output reg [RDMA_RKEY_WIDTH-1:0]        read_sink_rkey,
+    output reg                              header_only,      // Packet ended with the header (no payload)
+
+    // WRITE_WITH_IMM (beat 9): immediate reported in the RX completion.
+    // ACK/NAK (beat 9): AETH, syndrome in [31:24]
+    output reg [31:0]                       rdma_imm,
+
+    // Atomics: beats 9-10 swap/add operand (request) or original value (ACK),
+    // beats 11-12 compare operand (CMP_SWAP)
+    output reg [63:0]                       atomic_data,
+    output reg [63:0]                       atomic_compare,
     
     output reg                              header_valid,     // Pulse when header is parsed
-    output reg                              parsing_busy      // Parsing in progress
+    output reg                              parsing_busy,     // Parsing in progress
+
+    input  wire                             drop_payload,     // Pulse from rx_streamer: discard current payload
+    input  wire                             pl_payload,       // Pulse from rx_streamer: current payload to m_axis_pl
+    output wire                             pl_payload_done   // Pulse: last beat taken on m_axis_pl
 );
 
     localparam [1:0] STATE_IDLE         = 2'b00;
     localparam [1:0] STATE_PARSE_HEADER = 2'b01;
     localparam [1:0] STATE_FORWARD_DATA = 2'b10;
     
-    localparam HEADER_BEATS = 7;
+    localparam HEADER_BEATS      = 9;
+    localparam READ_HEADER_BEATS = 12;   // Base header + sink address + sink rkey
+    localparam IMM_HEADER_BEATS  = 10;   // Base header + immediate
+    localparam ATOMIC_HEADER_BEATS     = 13;   // Base header + swap/add + compare
+    localparam ATOMIC_ACK_HEADER_BEATS = 11;   // Base header + original value
 
     reg [1:0] state_reg, state_next;
 
-    reg [2:0] header_beat_count; // 0-6 beats
+    reg [3:0] header_beat_count; // 0-12 beats
 
-    reg [C_AXIS_TDATA_WIDTH-1:0] header_buf [0:HEADER_BEATS-1];
+    reg [C_AXIS_TDATA_WIDTH-1:0] header_buf [0:ATOMIC_HEADER_BEATS-1];
+
+    // Header length depends on the opcode in beat 0
+    wire [RDMA_OPCODE_WIDTH-1:0] hdr_opcode = (header_beat_count == 4'd0) ?
+                                              s_axis_tdata[RDMA_OPCODE_WIDTH-1:0] :
+                                              header_buf[0][RDMA_OPCODE_WIDTH-1:0];
+    wire [3:0] hdr_last_beat = (hdr_opcode == RDMA_OPCODE_READ_REQUEST) ? (READ_HEADER_BEATS - 1)       :
+                               (hdr_opcode == RDMA_OPCODE_WRITE_IMM ||
+                                hdr_opcode == RDMA_OPCODE_ACK)          ? (IMM_HEADER_BEATS - 1)        :
+                               (hdr_opcode == RDMA_OPCODE_CMP_SWAP ||
+                                hdr_opcode == RDMA_OPCODE_FETCH_ADD)    ? (ATOMIC_HEADER_BEATS - 1)     :
+                               (hdr_opcode == RDMA_OPCODE_ATOMIC_ACK)   ? (ATOMIC_ACK_HEADER_BEATS - 1) :
+                                                                          (HEADER_BEATS - 1);
+
+    // Set for one cycle after the last header beat was stored
+    reg header_done_reg;
+    reg header_tlast_reg;
     
     reg s_axis_tready_reg;
     assign s_axis_tready = s_axis_tready_reg;
 
     reg header_complete;
 
+    // Payload of a rejected request is consumed here instead of stalling the S2MM stream
+    reg drop_reg;
+
+    // Payload steered to m_axis_pl (no S2MM command is issued for it)
+    reg pl_reg;
+    wire pl_last_hs = (state_reg == STATE_FORWARD_DATA) && pl_reg && !drop_reg &&
+                      s_axis_tvalid && m_axis_pl_tready && s_axis_tlast;
+    assign pl_payload_done = pl_last_hs;
+
+    assign m_axis_pl_tuser = {rdma_imm,
+                              7'd0, !more_fragments,
+                              rdma_psn,
+                              rdma_opcode,
+                              rdma_dest_qp,
+                              rdma_length,
+                              rdma_remote_addr + fragment_offset};
+
     wire s_axis_hs = s_axis_tvalid && s_axis_tready;  // handshake
 
     always @(posedge aclk) begin
@@ -95,25 +169,53 @@ module rx_header_parser #(
     integer i;
     always @(posedge aclk) begin
         if (!aresetn) begin
-            header_beat_count <= 3'd0;
-            for (i = 0; i < HEADER_BEATS; i = i+1) begin
+            header_beat_count <= 4'd0;
+            header_done_reg   <= 1'b0;
+            header_tlast_reg  <= 1'b0;
+            for (i = 0; i < ATOMIC_HEADER_BEATS; i = i+1) begin
                 header_buf[i] <= {C_AXIS_TDATA_WIDTH{1'b0}};
             end
         end else begin
-            if (state_reg == STATE_IDLE && !s_axis_tvalid) begin
-                header_beat_count <= 3'd0;
-            end
+            header_done_reg <= 1'b0;
 
             if ((state_reg == STATE_IDLE || state_reg == STATE_PARSE_HEADER) && s_axis_hs) begin
                 header_buf[header_beat_count] <= s_axis_tdata;
 
-                if (header_beat_count < HEADER_BEATS-1) begin
-                    header_beat_count <= header_beat_count + 1'b1;
+                if (header_beat_count == hdr_last_beat) begin
+                    header_beat_count <= 4'd0;
+                    header_done_reg   <= 1'b1;
+                    header_tlast_reg  <= s_axis_tlast;
                 end else begin
-                    header_beat_count <= header_beat_count; 
+                    header_beat_count <= header_beat_count + 1'b1;
                 end
-            end else begin
-                header_beat_count <= 3'd0;
+            end else if (state_reg == STATE_FORWARD_DATA) begin
+                header_beat_count <= 4'd0;
+            end
+            // A stall inside the header keeps the beat count
+        end
+    end
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            drop_reg <= 1'b0;
+        end else begin
+            if (state_reg == STATE_FORWARD_DATA && drop_reg &&
+                s_axis_tvalid && s_axis_tlast) begin
+                drop_reg <= 1'b0;
+            end else if (drop_payload) begin
+                drop_reg <= 1'b1;
+            end
+        end
+    end
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            pl_reg <= 1'b0;
+        end else begin
+            if (pl_last_hs) begin
+                pl_reg <= 1'b0;
+            end else if (pl_payload) begin
+                pl_reg <= 1'b1;
             end
         end
     end
@@ -130,12 +232,19 @@ module rx_header_parser #(
             rdma_service_level  <= 8'd0;
             fragment_id         <= 16'd0;
             more_fragments      <= 1'b0;
+            ecn_ce              <= 1'b0;
             fragment_offset     <= 16'd0;
+            read_sink_addr      <= {RDMA_ADDR_WIDTH{1'b0}};
+            read_sink_rkey      <= {RDMA_RKEY_WIDTH{1'b0}};
+            header_only         <= 1'b0;
+            rdma_imm            <= 32'd0;
+            atomic_data         <= 64'd0;
+            atomic_compare      <= 64'd0;
             header_valid        <= 1'b0;
         end else begin
             header_valid <= 1'b0; // default (pulse)
 
-            if (header_beat_count == HEADER_BEATS-1) begin
+            if (header_done_reg) begin
                 // Beat 0: {rdma_psn[23:0], rdma_opcode[7:0]}
                 rdma_opcode  <= header_buf[0][7:0];
                 rdma_psn     <= header_buf[0][31:8];
@@ -143,11 +252,13 @@ module rx_header_parser #(
                 // Beat 1: {8'b0, rdma_dest_qp[23:0]}
                 rdma_dest_qp <= header_buf[1][23:0];
                 
-                // Beat 2: rdma_remote_addr[31:0] (lower 32 bits)
-                rdma_remote_addr <= {32'd0, header_buf[2]};
+                // Beat 2: rdma_remote_addr[31:0], Beat 8: rdma_remote_addr[63:32]
+                rdma_remote_addr <= {header_buf[8], header_buf[2]};
                 
-                // Beat 3: {16'b0, fragment_offset[15:0]}
+                // Beat 3: {ecn_ce, 14'b0, more_fragments, fragment_offset[15:0]}
                 fragment_offset <= header_buf[3][15:0];
+                more_fragments  <= header_buf[3][16];
+                ecn_ce          <= header_buf[3][31];
                 
                 // Beat 4: rdma_length[31:0]
                 rdma_length <= header_buf[4];
@@ -157,11 +268,25 @@ module rx_header_parser #(
                 
                 // Beat 6: {24'hababab, rdma_service_level[7:0]}
                 rdma_service_level <= header_buf[6][7:0];
+
+                // Beat 7: rdma_rkey[31:0]
+                rdma_rkey <= header_buf[7];
                 
+                // Beats 9-11 (READ request only): sink address and sink rkey
+                read_sink_addr <= {header_buf[10], header_buf[9]};
+                read_sink_rkey <= header_buf[11];
+
+                // Beat 9 (WRITE_WITH_IMM): immediate data, (ACK): AETH {syndrome, msn}
+                rdma_imm       <= header_buf[9];
+
+                // Beats 9-12 (atomics)
+                atomic_data    <= {header_buf[10], header_buf[9]};
+                atomic_compare <= {header_buf[12], header_buf[11]};
+
                 // Future fragmentation info (not used currently)
                 fragment_id    <= 16'd0;
-                more_fragments <= 1'b0;
-                
+
+                header_only  <= header_tlast_reg;
                 header_valid <= 1'b1;
             end
         end
@@ -176,6 +301,11 @@ module rx_header_parser #(
         m_axis_tkeep  = {C_AXIS_TKEEP_WIDTH{1'b0}};
         m_axis_tvalid = 1'b0;
         m_axis_tlast  = 1'b0;
+
+        m_axis_pl_tdata  = {C_AXIS_TDATA_WIDTH{1'b0}};
+        m_axis_pl_tkeep  = {C_AXIS_TKEEP_WIDTH{1'b0}};
+        m_axis_pl_tvalid = 1'b0;
+        m_axis_pl_tlast  = 1'b0;
         
         parsing_busy = 1'b1;
         
@@ -193,23 +323,47 @@ module rx_header_parser #(
                 s_axis_tready_reg = 1'b1;
 
                 if (s_axis_tvalid && s_axis_tready_reg &&
-                    (header_beat_count == HEADER_BEATS-1)) begin
-                    state_next = STATE_FORWARD_DATA;
+                    (header_beat_count == hdr_last_beat)) begin
+                    // Header-only packets (READ request) end here
+                    state_next = s_axis_tlast ? STATE_IDLE : STATE_FORWARD_DATA;
                 end
             end
             
             STATE_FORWARD_DATA: begin
-                // Pass-through payload data
-                m_axis_tdata  = s_axis_tdata;
-                m_axis_tkeep  = s_axis_tkeep;
-                m_axis_tvalid = s_axis_tvalid;
-                m_axis_tlast  = s_axis_tlast;
-                
-                s_axis_tready_reg = m_axis_tready;
-                
-                if (s_axis_tvalid && m_axis_tready && s_axis_tlast) begin
-                    state_next   = STATE_IDLE;
-                    parsing_busy = 1'b0;
+                if (drop_reg) begin
+                    // Rejected by rx_streamer: sink the payload
+                    s_axis_tready_reg = 1'b1;
+
+                    if (s_axis_tvalid && s_axis_tlast) begin
+                        state_next   = STATE_IDLE;
+                        parsing_busy = 1'b0;
+                    end
+                end else if (pl_reg) begin
+                    // Delivered to the PL consumer
+                    m_axis_pl_tdata  = s_axis_tdata;
+                    m_axis_pl_tkeep  = s_axis_tkeep;
+                    m_axis_pl_tvalid = s_axis_tvalid;
+                    m_axis_pl_tlast  = s_axis_tlast;
+
+                    s_axis_tready_reg = m_axis_pl_tready;
+
+                    if (s_axis_tvalid && m_axis_pl_tready && s_axis_tlast) begin
+                        state_next   = STATE_IDLE;
+                        parsing_busy = 1'b0;
+                    end
+                end else begin
+                    // Pass-through payload data
+                    m_axis_tdata  = s_axis_tdata;
+                    m_axis_tkeep  = s_axis_tkeep;
+                    m_axis_tvalid = s_axis_tvalid;
+                    m_axis_tlast  = s_axis_tlast;
+
+                    s_axis_tready_reg = m_axis_tready;
+
+                    if (s_axis_tvalid && m_axis_tready && s_axis_tlast) begin
+                        state_next   = STATE_IDLE;
+                        parsing_busy = 1'b0;
+                    end
                 end
             end
             
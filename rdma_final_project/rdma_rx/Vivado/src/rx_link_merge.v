@@ -0,0 +1,97 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/19/2026 12:06:40 AM
+-- Design Name:
+-- Module Name: rx_link_merge
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Link aggregation, receive side.
+--              Merges the frame streams of two links (one AXI Ethernet MAC
+--              + axis_rx_to_bram each) into the single decapsulator input.
+--              Whole frames are forwarded; when both links have a frame
+--              waiting they take turns.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   No reordering is done: tx_link_stripe only spreads plain WRITE
+--   packets, which carry their remote address / fragment offset and land
+--   in place whichever link they arrive on. SEND, WRITE_IMM and READ
+--   responses stay on one link per QP. The in-order PSN check needs all of
+--   a QP's packets on one link (tx_link_stripe per-flow mode).
+--   The link that is not selected is held off (tready low); axis_rx_to_bram
+--   buffers nothing, so the MAC RX FIFO absorbs the wait.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_link_merge #(
+    parameter C_AXIS_TDATA_WIDTH = 32,
+    parameter C_AXIS_TKEEP_WIDTH = 4
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    // Link 0 (from axis_rx_to_rdma_0)
+    input  wire [C_AXIS_TDATA_WIDTH-1:0]    s0_axis_tdata,
+    input  wire [C_AXIS_TKEEP_WIDTH-1:0]    s0_axis_tkeep,
+    input  wire                             s0_axis_tvalid,
+    output wire                             s0_axis_tready,
+    input  wire                             s0_axis_tlast,
+
+    // Link 1 (from axis_rx_to_rdma_1)
+    input  wire [C_AXIS_TDATA_WIDTH-1:0]    s1_axis_tdata,
+    input  wire [C_AXIS_TKEEP_WIDTH-1:0]    s1_axis_tkeep,
+    input  wire                             s1_axis_tvalid,
+    output wire                             s1_axis_tready,
+    input  wire                             s1_axis_tlast,
+
+    // To rdma_axilite_rx_ctrl s_axis_eth
+    output wire [C_AXIS_TDATA_WIDTH-1:0]    m_axis_tdata,
+    output wire [C_AXIS_TKEEP_WIDTH-1:0]    m_axis_tkeep,
+    output wire                             m_axis_tvalid,
+    input  wire                             m_axis_tready,
+    output wire                             m_axis_tlast
+);
+
+    reg in_frame;                         // Locked on sel from the first beat offered until TLAST
+    reg sel;                              // Link being forwarded
+    reg last_sel;                         // Link that sent the previous frame
+
+    // Between frames, prefer the link that did not send the last one
+    wire pick = in_frame ? sel :
+                (s0_axis_tvalid && s1_axis_tvalid) ? !last_sel :
+                s1_axis_tvalid;
+
+    assign m_axis_tdata   = pick ? s1_axis_tdata  : s0_axis_tdata;
+    assign m_axis_tkeep   = pick ? s1_axis_tkeep  : s0_axis_tkeep;
+    assign m_axis_tlast   = pick ? s1_axis_tlast  : s0_axis_tlast;
+    assign m_axis_tvalid  = pick ? s1_axis_tvalid : s0_axis_tvalid;
+    assign s0_axis_tready = m_axis_tready && !pick;
+    assign s1_axis_tready = m_axis_tready && pick;
+
+    wire beat = m_axis_tvalid && m_axis_tready;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            in_frame <= 1'b0;
+            sel      <= 1'b0;
+            last_sel <= 1'b1;
+        end else if (beat) begin
+            sel      <= pick;
+            in_frame <= !m_axis_tlast;
+            if (m_axis_tlast)
+                last_sel <= pick;
+        end else if (m_axis_tvalid) begin
+            // A beat offered but not taken must not switch links
+            sel      <= pick;
+            in_frame <= 1'b1;
+        end
+    end
+
+endmodule
@@ -0,0 +1,277 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 10:12:40 AM
+-- Design Name:
+-- Module Name: rx_mr_table
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Memory region table for incoming RDMA requests.
+--              Entries live in a block RAM indexed by rkey[MR_IDX_WIDTH-1:0];
+--              the remaining rkey bits are stored as a key tag and must match.
+--              Each entry holds the registered VA window [va_base, va_end),
+--              the physical base it maps to and the allowed access rights.
+--              A small fully associative translation cache keeps the last
+--              TC_ENTRIES decoded regions so back-to-back fragments of the
+--              same message translate without a BRAM read.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   Lookup latency: 2 cycles on a cache hit, 3 cycles on a miss.
+--   With enforce = 0 the table is bypassed and pa = va (legacy behaviour).
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_mr_table #(
+    parameter MR_IDX_WIDTH      = 4,            // 16 memory regions
+    parameter TC_ENTRIES        = 4,            // Translation cache entries
+    parameter RDMA_ADDR_WIDTH   = 64,
+    parameter RDMA_RKEY_WIDTH   = 32,
+    parameter RDMA_LENGTH_WIDTH = 32
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    input  wire                             enforce,          // 0 = bypass (pa = va)
+
+    // Programming interface (from rdma_axilite_rx_ctrl)
+    input  wire                             mr_wr_en,         // Pulse: write one entry
+    input  wire [MR_IDX_WIDTH-1:0]          mr_wr_idx,
+    input  wire                             mr_wr_valid,      // 0 = invalidate entry
+    input  wire [RDMA_RKEY_WIDTH-1:0]       mr_wr_rkey,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_va,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_len,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_pa,
+    input  wire [3:0]                       mr_wr_access,
+
+    // Lookup interface (from rx_streamer)
+    input  wire                             lkp_req,          // Pulse
+    input  wire [RDMA_RKEY_WIDTH-1:0]       lkp_rkey,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       lkp_va,
+    input  wire [RDMA_LENGTH_WIDTH-1:0]     lkp_len,
+    input  wire [3:0]                       lkp_access,       // Required rights
+    output reg                              lkp_done,         // Pulse
+    output reg                              lkp_ok,
+    output reg  [2:0]                       lkp_status,
+    output reg  [RDMA_ADDR_WIDTH-1:0]       lkp_pa,
+
+    output wire                             tc_hit            // Last lookup hit the cache
+);
+
+    // Access rights (mr_wr_access / lkp_access)
+    localparam [3:0] MR_ACC_REMOTE_WRITE  = 4'b0001;
+    localparam [3:0] MR_ACC_REMOTE_READ   = 4'b0010;
+    localparam [3:0] MR_ACC_REMOTE_ATOMIC = 4'b0100;
+
+    // Lookup status codes
+    localparam [2:0] MR_ST_OK        = 3'd0;
+    localparam [2:0] MR_ST_BAD_KEY   = 3'd1;   // Entry invalid or key tag mismatch
+    localparam [2:0] MR_ST_ACCESS    = 3'd2;   // Access right not granted
+    localparam [2:0] MR_ST_BOUNDS    = 3'd3;   // Request outside the region
+
+    localparam [1:0] STATE_IDLE  = 2'd0;
+    localparam [1:0] STATE_READ  = 2'd1;
+    localparam [1:0] STATE_CHECK = 2'd2;
+
+    localparam MR_ENTRIES = (1 << MR_IDX_WIDTH);
+    localparam ENTRY_W    = 1 + 4 + RDMA_RKEY_WIDTH + 3*RDMA_ADDR_WIDTH;
+
+    reg [1:0] state_reg;
+
+    // Latched lookup request
+    reg [RDMA_RKEY_WIDTH-1:0]   lkp_rkey_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]   lkp_va_reg;
+    reg [RDMA_ADDR_WIDTH:0]     lkp_end_reg;       // va + len, one extra bit for carry
+    reg [3:0]                   lkp_access_reg;
+    reg                         tc_hit_reg;
+
+    // ------------------------------------------------------------------
+    // Region storage (one wide BRAM word per region)
+    // {valid, access, rkey, va_base, va_end, pa_base}
+    // ------------------------------------------------------------------
+    (* ram_style = "block" *)
+    reg [ENTRY_W-1:0] mr_mem [0:MR_ENTRIES-1];
+    reg [ENTRY_W-1:0] mr_rd_data;
+
+    integer k;
+    initial begin
+        for (k = 0; k < MR_ENTRIES; k = k + 1)
+            mr_mem[k] = {ENTRY_W{1'b0}};
+    end
+
+    always @(posedge aclk) begin
+        if (mr_wr_en) begin
+            mr_mem[mr_wr_idx] <= {mr_wr_valid, mr_wr_access, mr_wr_rkey,
+                                  mr_wr_va, mr_wr_va + mr_wr_len, mr_wr_pa};
+        end
+        mr_rd_data <= mr_mem[lkp_rkey_reg[MR_IDX_WIDTH-1:0]];
+    end
+
+    // ------------------------------------------------------------------
+    // Translation cache
+    // ------------------------------------------------------------------
+    reg                         tc_valid   [0:TC_ENTRIES-1];
+    reg [3:0]                   tc_access  [0:TC_ENTRIES-1];
+    reg [RDMA_RKEY_WIDTH-1:0]   tc_rkey    [0:TC_ENTRIES-1];
+    reg [RDMA_ADDR_WIDTH-1:0]   tc_va_base [0:TC_ENTRIES-1];
+    reg [RDMA_ADDR_WIDTH-1:0]   tc_va_end  [0:TC_ENTRIES-1];
+    reg [RDMA_ADDR_WIDTH-1:0]   tc_pa_base [0:TC_ENTRIES-1];
+    reg [$clog2(TC_ENTRIES)-1:0] tc_victim;
+
+    reg                         tc_hit_comb;
+    reg [$clog2(TC_ENTRIES)-1:0] tc_hit_idx;
+
+    integer t;
+    always @(*) begin
+        tc_hit_comb = 1'b0;
+        tc_hit_idx  = 0;
+        for (t = 0; t < TC_ENTRIES; t = t + 1) begin
+            if (tc_valid[t] && (tc_rkey[t] == lkp_rkey)) begin
+                tc_hit_comb = 1'b1;
+                tc_hit_idx  = t;
+            end
+        end
+    end
+
+    reg [$clog2(TC_ENTRIES)-1:0] tc_hit_idx_reg;
+    reg                         wr_during_lkp;     // Table written while a lookup is in flight
+
+    // Entry under check (from cache or BRAM)
+    reg                         ent_valid;
+    reg [3:0]                   ent_access;
+    reg [RDMA_RKEY_WIDTH-1:0]   ent_rkey;
+    reg [RDMA_ADDR_WIDTH-1:0]   ent_va_base;
+    reg [RDMA_ADDR_WIDTH-1:0]   ent_va_end;
+    reg [RDMA_ADDR_WIDTH-1:0]   ent_pa_base;
+
+    always @(*) begin
+        if (tc_hit_reg) begin
+            ent_valid   = 1'b1;
+            ent_access  = tc_access [tc_hit_idx_reg];
+            ent_rkey    = tc_rkey   [tc_hit_idx_reg];
+            ent_va_base = tc_va_base[tc_hit_idx_reg];
+            ent_va_end  = tc_va_end [tc_hit_idx_reg];
+            ent_pa_base = tc_pa_base[tc_hit_idx_reg];
+        end else begin
+            {ent_valid, ent_access, ent_rkey, ent_va_base, ent_va_end, ent_pa_base} = mr_rd_data;
+        end
+    end
+
+    wire key_ok    = ent_valid && (ent_rkey == lkp_rkey_reg);
+    wire access_ok = ((ent_access & lkp_access_reg) == lkp_access_reg);
+    wire bounds_ok = (lkp_va_reg >= ent_va_base) && (lkp_end_reg <= {1'b0, ent_va_end});
+
+    assign tc_hit = tc_hit_reg;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            state_reg      <= STATE_IDLE;
+            lkp_rkey_reg   <= 0;
+            lkp_va_reg     <= 0;
+            lkp_end_reg    <= 0;
+            lkp_access_reg <= 0;
+            tc_hit_reg     <= 1'b0;
+            tc_hit_idx_reg <= 0;
+            tc_victim      <= 0;
+            wr_during_lkp  <= 1'b0;
+            lkp_done       <= 1'b0;
+            lkp_ok         <= 1'b0;
+            lkp_status     <= MR_ST_OK;
+            lkp_pa         <= 0;
+            for (k = 0; k < TC_ENTRIES; k = k + 1) begin
+                tc_valid[k]   <= 1'b0;
+                tc_access[k]  <= 4'd0;
+                tc_rkey[k]    <= 0;
+                tc_va_base[k] <= 0;
+                tc_va_end[k]  <= 0;
+                tc_pa_base[k] <= 0;
+            end
+        end else begin
+            lkp_done <= 1'b0;
+
+            case (state_reg)
+                STATE_IDLE: begin
+                    if (lkp_req) begin
+                        lkp_rkey_reg   <= lkp_rkey;
+                        lkp_va_reg     <= lkp_va;
+                        lkp_end_reg    <= {1'b0, lkp_va} + lkp_len;
+                        lkp_access_reg <= lkp_access;
+
+                        if (!enforce) begin
+                            // Bypass: raw address, always allowed
+                            lkp_done   <= 1'b1;
+                            lkp_ok     <= 1'b1;
+                            lkp_status <= MR_ST_OK;
+                            lkp_pa     <= lkp_va;
+                            tc_hit_reg <= 1'b0;
+                        end else if (tc_hit_comb) begin
+                            tc_hit_reg     <= 1'b1;
+                            tc_hit_idx_reg <= tc_hit_idx;
+                            state_reg      <= STATE_CHECK;
+                        end else begin
+                            tc_hit_reg <= 1'b0;
+                            state_reg  <= STATE_READ;
+                        end
+                    end
+                end
+
+                STATE_READ: begin
+                    // BRAM addressed with lkp_rkey_reg, mr_rd_data valid next cycle
+                    state_reg <= STATE_CHECK;
+                end
+
+                STATE_CHECK: begin
+                    lkp_done <= 1'b1;
+                    lkp_pa   <= ent_pa_base + (lkp_va_reg - ent_va_base);
+
+                    if (!key_ok) begin
+                        lkp_ok     <= 1'b0;
+                        lkp_status <= MR_ST_BAD_KEY;
+                    end else if (!access_ok) begin
+                        lkp_ok     <= 1'b0;
+                        lkp_status <= MR_ST_ACCESS;
+                    end else if (!bounds_ok) begin
+                        lkp_ok     <= 1'b0;
+                        lkp_status <= MR_ST_BOUNDS;
+                    end else begin
+                        lkp_ok     <= 1'b1;
+                        lkp_status <= MR_ST_OK;
+                    end
+
+                    // Fill the cache with a valid region read from BRAM
+                    if (!tc_hit_reg && key_ok && !wr_during_lkp) begin
+                        tc_valid  [tc_victim] <= 1'b1;
+                        tc_access [tc_victim] <= ent_access;
+                        tc_rkey   [tc_victim] <= ent_rkey;
+                        tc_va_base[tc_victim] <= ent_va_base;
+                        tc_va_end [tc_victim] <= ent_va_end;
+                        tc_pa_base[tc_victim] <= ent_pa_base;
+                        tc_victim <= tc_victim + 1'b1;
+                    end
+
+                    state_reg <= STATE_IDLE;
+                end
+
+                default: state_reg <= STATE_IDLE;
+            endcase
+
+            // Any table update flushes the cache (software writes are rare)
+            if (state_reg == STATE_IDLE)
+                wr_during_lkp <= 1'b0;
+            else if (mr_wr_en)
+                wr_during_lkp <= 1'b1;
+
+            if (mr_wr_en) begin
+                for (k = 0; k < TC_ENTRIES; k = k + 1)
+                    tc_valid[k] <= 1'b0;
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,176 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 03:41:15 PM
+-- Design Name:
+-- Module Name: rx_recv_queue
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Receive queues and RX completion queue for SEND messages.
+--              Software posts receive buffers {wr_id, addr, len} to one of
+--              RQ_COUNT receive queues; an incoming SEND takes the head of the
+--              queue selected by dest_qp[RQ_IDX_WIDTH-1:0], or of queue 0 when
+--              srq_enable is set (shared receive queue).
+--              Finished receives and WRITE_WITH_IMM messages are pushed to
+--              the RX CQ as {wr_id, byte_len, imm, status, qpn} and popped
+--              by software, unless the completion ring of the QP
+--              (QPN[RQ_IDX_WIDTH-1:0]) is enabled: then it is handed to
+--              rx_cq_ring on ring_push / ring_cqe.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   Posts to a full queue and completions pushed to a full CQ are dropped;
+--   the latter sets the sticky cq_overflow flag (cleared on reset).
+--   Head entries are read combinationally (distributed RAM).
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module rx_recv_queue #(
+    parameter RQ_IDX_WIDTH    = 2,              // 4 receive queues
+    parameter RQ_DEPTH_WIDTH  = 4,              // 16 posted buffers per queue
+    parameter CQ_DEPTH_WIDTH  = 4,              // 16 completions
+    parameter RDMA_ADDR_WIDTH = 64,
+    parameter RDMA_QPN_WIDTH  = 24
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    input  wire                             srq_enable,       // All QPs share queue 0
+
+    // Posting interface (from rdma_axilite_rx_ctrl)
+    input  wire                             post_en,          // Pulse: append one buffer
+    input  wire [RQ_IDX_WIDTH-1:0]          post_idx,
+    input  wire [31:0]                      post_wr_id,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       post_addr,
+    input  wire [31:0]                      post_len,
+    output wire [(8<<RQ_IDX_WIDTH)-1:0]     rq_level,         // 8-bit fill level per queue
+
+    // Consume interface (from rx_streamer)
+    input  wire [RDMA_QPN_WIDTH-1:0]        rq_qpn,
+    output wire                             rq_head_valid,
+    output wire [31:0]                      rq_head_wr_id,
+    output wire [RDMA_ADDR_WIDTH-1:0]       rq_head_addr,
+    output wire [31:0]                      rq_head_len,
+    input  wire                             rq_pop,           // Pulse: head buffer taken
+
+    // Completion push (from rx_streamer)
+    input  wire                             cqe_push,         // Pulse
+    input  wire [31:0]                      cqe_wr_id,
+    input  wire [31:0]                      cqe_byte_len,
+    input  wire [31:0]                      cqe_imm,
+    input  wire [7:0]                       cqe_status,       // {type[3:0], status[3:0]}
+    input  wire [RDMA_QPN_WIDTH-1:0]        cqe_qpn,
+
+    // Completion pop (from rdma_axilite_rx_ctrl)
+    input  wire                             cq_pop,           // Pulse
+    output wire                             cq_valid,
+    output wire [31:0]                      cq_wr_id,
+    output wire [31:0]                      cq_byte_len,
+    output wire [31:0]                      cq_info,          // {type[3:0], status[3:0], qpn[23:0]}
+    output wire [31:0]                      cq_imm,
+    output wire [CQ_DEPTH_WIDTH:0]          cq_count,
+    output reg                              cq_overflow,
+
+    // Per-QP completion rings (to rx_cq_ring)
+    input  wire [(1<<RQ_IDX_WIDTH)-1:0]     ring_en,
+    output wire                             ring_push,        // Pulse
+    output wire [127:0]                     ring_cqe          // {wr_id, byte_len, imm, info}
+);
+
+    localparam RQ_COUNT = 1 << RQ_IDX_WIDTH;
+    localparam RQ_DEPTH = 1 << RQ_DEPTH_WIDTH;
+    localparam CQ_DEPTH = 1 << CQ_DEPTH_WIDTH;
+
+    // Receive queue entry: {wr_id, addr, len}
+    (* ram_style = "distributed" *)
+    reg [RDMA_ADDR_WIDTH+63:0]  rq_mem [0:RQ_COUNT*RQ_DEPTH-1];
+    reg [RQ_DEPTH_WIDTH:0]      rq_wr_ptr [0:RQ_COUNT-1];
+    reg [RQ_DEPTH_WIDTH:0]      rq_rd_ptr [0:RQ_COUNT-1];
+
+    // Completion queue entry: {wr_id, byte_len, imm, status, qpn}
+    (* ram_style = "distributed" *)
+    reg [127:0]                 cq_mem [0:CQ_DEPTH-1];
+    reg [CQ_DEPTH_WIDTH:0]      cq_wr_ptr;
+    reg [CQ_DEPTH_WIDTH:0]      cq_rd_ptr;
+
+    wire [RQ_IDX_WIDTH-1:0] rq_sel = srq_enable ? {RQ_IDX_WIDTH{1'b0}} : rq_qpn[RQ_IDX_WIDTH-1:0];
+
+    wire [RQ_DEPTH_WIDTH:0] post_level = rq_wr_ptr[post_idx] - rq_rd_ptr[post_idx];
+    wire                    post_ok    = post_en && (post_level != RQ_DEPTH);
+
+    wire [RDMA_ADDR_WIDTH+63:0] rq_head = rq_mem[{rq_sel, rq_rd_ptr[rq_sel][RQ_DEPTH_WIDTH-1:0]}];
+
+    assign rq_head_valid = (rq_wr_ptr[rq_sel] != rq_rd_ptr[rq_sel]);
+    assign rq_head_wr_id = rq_head[RDMA_ADDR_WIDTH+63:RDMA_ADDR_WIDTH+32];
+    assign rq_head_addr  = rq_head[RDMA_ADDR_WIDTH+31:32];
+    assign rq_head_len   = rq_head[31:0];
+
+    genvar g;
+    generate
+        for (g = 0; g < RQ_COUNT; g = g + 1) begin : gen_level
+            wire [RQ_DEPTH_WIDTH:0] level = rq_wr_ptr[g] - rq_rd_ptr[g];
+            assign rq_level[g*8 +: 8] = level;
+        end
+    endgenerate
+
+    wire cq_full  = (cq_count == CQ_DEPTH);
+
+    wire cqe_ring = ring_en[cqe_qpn[RQ_IDX_WIDTH-1:0]];
+
+    assign ring_push = cqe_push && cqe_ring;
+    assign ring_cqe  = {cqe_wr_id, cqe_byte_len, cqe_imm, cqe_status, cqe_qpn[23:0]};
+
+    assign cq_count    = cq_wr_ptr - cq_rd_ptr;
+    assign cq_valid    = (cq_count != 0);
+    assign cq_wr_id    = cq_mem[cq_rd_ptr[CQ_DEPTH_WIDTH-1:0]][127:96];
+    assign cq_byte_len = cq_mem[cq_rd_ptr[CQ_DEPTH_WIDTH-1:0]][95:64];
+    assign cq_imm      = cq_mem[cq_rd_ptr[CQ_DEPTH_WIDTH-1:0]][63:32];
+    assign cq_info     = cq_mem[cq_rd_ptr[CQ_DEPTH_WIDTH-1:0]][31:0];
+
+    // Receive queues
+    integer i;
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (i = 0; i < RQ_COUNT; i = i + 1) begin
+                rq_wr_ptr[i] <= 0;
+                rq_rd_ptr[i] <= 0;
+            end
+        end else begin
+            if (post_ok) begin
+                rq_mem[{post_idx, rq_wr_ptr[post_idx][RQ_DEPTH_WIDTH-1:0]}] <= {post_wr_id, post_addr, post_len};
+                rq_wr_ptr[post_idx] <= rq_wr_ptr[post_idx] + 1'b1;
+            end
+            if (rq_pop && rq_head_valid) begin
+                rq_rd_ptr[rq_sel] <= rq_rd_ptr[rq_sel] + 1'b1;
+            end
+        end
+    end
+
+    // Completion queue
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            cq_wr_ptr   <= 0;
+            cq_rd_ptr   <= 0;
+            cq_overflow <= 1'b0;
+        end else begin
+            if (cqe_push && !cqe_ring) begin
+                if (!cq_full) begin
+                    cq_mem[cq_wr_ptr[CQ_DEPTH_WIDTH-1:0]] <= ring_cqe;
+                    cq_wr_ptr <= cq_wr_ptr + 1'b1;
+                end else begin
+                    cq_overflow <= 1'b1;
+                end
+            end
+            if (cq_pop && cq_valid) begin
+                cq_rd_ptr <= cq_rd_ptr + 1'b1;
+            end
+        end
+    end
+
+endmodule
@@ -21,22 +21,39 @@
 
 module rx_streamer #(
     // Data Mover Parameters
-    parameter C_ADDR_WIDTH       = 32,          // DDR address width
+    parameter C_ADDR_WIDTH       = 64,          // DDR address width (DataMover c_addr_width)
     parameter C_DATA_WIDTH       = 32,          // AXI-Stream data width
     parameter C_BTT_WIDTH        = 23,          // Bytes to transfer width (up to 8MB)
     
     // RDMA Parameters
     parameter RDMA_OPCODE_WIDTH  = 8,
+    parameter RDMA_PSN_WIDTH     = 24,
+    parameter RDMA_QPN_WIDTH     = 24,
     parameter RDMA_ADDR_WIDTH    = 64,
     parameter RDMA_RKEY_WIDTH    = 32,
     parameter RDMA_LENGTH_WIDTH  = 32,
     parameter OFFSET_LENGTH       = 16,          // Fragment offset length in bits  
+    parameter MR_IDX_WIDTH       = 4,           // Memory region table: 16 regions
+    parameter RQ_IDX_WIDTH       = 2,           // Receive queues: 4
+    parameter QP_IDX_WIDTH       = 2,           // CNP hold-off timers: 4 (low QPN bits)
+    parameter EPSN_IDX_WIDTH     = 8,           // Expected-PSN table: 256 QPs (QPN[7:0])
+    parameter ACK_COALESCE       = 8,           // ACK at least every N landed packets
+    parameter CNP_INTERVAL       = 5000,        // Min cycles between CNPs per QP (50 us at 100 MHz)
     // RDMA Opcode definitions (matching your test opcode)
     parameter RDMA_OPCODE_WRITE_FIRST   = 8'h06,
     parameter RDMA_OPCODE_WRITE_MIDDLE  = 8'h07,
     parameter RDMA_OPCODE_WRITE_LAST    = 8'h08,
     parameter RDMA_OPCODE_WRITE_ONLY    = 8'h0A,
-    parameter RDMA_OPCODE_WRITE_TEST    = 8'h01  // Test opcode from main.c
+    parameter RDMA_OPCODE_WRITE_TEST    = 8'h01, // Test opcode from main.c
+    parameter RDMA_OPCODE_READ_REQUEST  = 8'h0C,
+    parameter RDMA_OPCODE_READ_RESPONSE = 8'h10,
+    parameter RDMA_OPCODE_SEND          = 8'h04, // Lands in a posted receive buffer
+    parameter RDMA_OPCODE_WRITE_IMM     = 8'h0B, // WRITE + RX completion carrying the immediate
+    parameter RDMA_OPCODE_CMP_SWAP      = 8'h13,
+    parameter RDMA_OPCODE_FETCH_ADD     = 8'h14,
+    parameter RDMA_OPCODE_ATOMIC_ACK    = 8'h12, // Original value returned to the requester
+    parameter RDMA_OPCODE_ACK           = 8'h11, // ACK / NAK, AETH in the immediate beat
+    parameter RDMA_OPCODE_CNP           = 8'h81  // Congestion notification, header only
 ) (
     // Clock and Reset
     input  wire                             aclk,
@@ -49,61 +66,374 @@ module rx_streamer #(
     input  wire [RDMA_RKEY_WIDTH-1:0]      rdma_rkey,            // Remote key (for validation)
     input  wire [RDMA_LENGTH_WIDTH-1:0]    rdma_length,          // Payload length
     input wire [OFFSET_LENGTH-1:0]          fragment_offset,      // Fragment offset
+    input  wire                             more_fragments,       // 0 on the last packet of a message
+    input  wire                             ecn_ce,               // Packet arrived CE-marked
+    input  wire [7:0]                       service_level,        // SL of the packet (traffic class)
+    input  wire [RDMA_PSN_WIDTH-1:0]       rdma_psn,
+    input  wire [RDMA_QPN_WIDTH-1:0]       rdma_dest_qp,
+    input  wire [RDMA_ADDR_WIDTH-1:0]      read_sink_addr,       // READ request: requester's buffer
+    input  wire [RDMA_RKEY_WIDTH-1:0]      read_sink_rkey,
+    input  wire                             header_only,          // No payload follows the header
+    input  wire [31:0]                      rdma_imm,             // WRITE_WITH_IMM immediate
+    input  wire [63:0]                      atomic_data,          // Swap/add operand, or ACK original value
+    input  wire [63:0]                      atomic_compare,       // CMP_SWAP compare operand
+    output wire                             drop_payload,         // Pulse: header parser discards payload
+    output wire                             pl_payload,           // Pulse: header parser sends payload to m_axis_pl
+
+    // READ response job for the local tx_streamer (responder side)
+    output wire                             rd_rsp_valid,
+    input  wire                             rd_rsp_ready,
+    output wire [C_ADDR_WIDTH-1:0]          rd_rsp_src_addr,      // Translated local source
+    output wire [RDMA_LENGTH_WIDTH-1:0]     rd_rsp_length,
+    output wire [RDMA_ADDR_WIDTH-1:0]       rd_rsp_remote_addr,   // Requester's sink address
+    output wire [RDMA_RKEY_WIDTH-1:0]       rd_rsp_rkey,
+    output wire [RDMA_QPN_WIDTH-1:0]        rd_rsp_dest_qp,
+    output wire [RDMA_PSN_WIDTH-1:0]        rd_rsp_psn,
+    output wire                             rd_rsp_atomic,        // Job is an ATOMIC_ACK, not a READ response
+    output wire [63:0]                      rd_rsp_orig,          // ATOMIC_ACK: original memory value
+    output wire [7:0]                       rd_rsp_sl,            // Response goes out in the request's class
+
+    // Requester side: last READ response packet has landed
+    output wire                             read_done,            // Pulse
+    output wire                             atomic_done,          // Pulse: ATOMIC_ACK received
+    output wire [63:0]                      atomic_orig,
+
+    // Reliable delivery, responder side: ACK / NAK job for the local tx_streamer
+    input  wire                             psn_check_en,         // 0 = accept packets in any PSN order
+    output wire                             ack_tx_valid,
+    input  wire                             ack_tx_ready,
+    output wire [RDMA_QPN_WIDTH-1:0]        ack_tx_dest_qp,
+    output wire [RDMA_PSN_WIDTH-1:0]        ack_tx_psn,
+    output wire [7:0]                       ack_tx_syndrome,
+
+    // Reliable delivery, requester side: ACK / NAK received for the local tx_streamer
+    output wire                             ack_rcvd,             // Pulse
+    output wire [RDMA_QPN_WIDTH-1:0]        ack_rcvd_dest_qp,
+    output wire [RDMA_PSN_WIDTH-1:0]        ack_rcvd_psn,
+    output wire [7:0]                       ack_rcvd_syndrome,
+
+    // Congestion control: CNP owed to the sender of CE-marked packets, and CNPs received
+    input  wire                             cnp_en,
+    output wire                             cnp_tx_valid,
+    input  wire                             cnp_tx_ready,
+    output wire [RDMA_QPN_WIDTH-1:0]        cnp_tx_dest_qp,
+    output wire                             cnp_rcvd,             // Pulse
+    output wire [RDMA_QPN_WIDTH-1:0]        cnp_rcvd_dest_qp,
+
+    // Memory region table programming (from rdma_axilite_rx_ctrl)
+    input  wire                             mr_enforce,           // 0 = raw physical addressing
+    input  wire                             mr_wr_en,
+    input  wire [MR_IDX_WIDTH-1:0]          mr_wr_idx,
+    input  wire                             mr_wr_valid,
+    input  wire [RDMA_RKEY_WIDTH-1:0]       mr_wr_rkey,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_va,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_len,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       mr_wr_pa,
+    input  wire [3:0]                       mr_wr_access,
+
+    // Receive queue posting and RX completion queue (from/to rdma_axilite_rx_ctrl)
+    input  wire                             srq_enable,           // All QPs share receive queue 0
+    input  wire                             rq_post_en,
+    input  wire [RQ_IDX_WIDTH-1:0]          rq_post_idx,
+    input  wire [31:0]                      rq_post_wr_id,
+    input  wire [RDMA_ADDR_WIDTH-1:0]       rq_post_addr,
+    input  wire [31:0]                      rq_post_len,
+    output wire [(8<<RQ_IDX_WIDTH)-1:0]     rq_level,
+    input  wire                             cq_pop,
+    output wire                             cq_valid,
+    output wire [31:0]                      cq_wr_id,
+    output wire [31:0]                      cq_byte_len,
+    output wire [31:0]                      cq_info,
+    output wire [31:0]                      cq_imm,
+    output wire [4:0]                       cq_count,
+    output wire                             cq_overflow,
+    input  wire [(1<<RQ_IDX_WIDTH)-1:0]     cq_ring_en,           // Completions of QPN[RQ_IDX_WIDTH-1:0] go to a DDR ring
+    output wire                             cq_ring_push,
+    output wire [127:0]                     cq_ring_cqe,
+
     // Data Mover S2MM Command Interface (AXI-Stream)
-    output wire [71:0]                      m_axis_s2mm_cmd_tdata,
+    output wire [C_ADDR_WIDTH+39:0]         m_axis_s2mm_cmd_tdata,
     output wire                             m_axis_s2mm_cmd_tvalid,
     input  wire                             m_axis_s2mm_cmd_tready,
     
     // Data Mover S2MM Status Interface
     input  wire                             s2mm_wr_xfer_cmplt,
+
+    // Direct-to-PL delivery: WRITE payloads of these QPs bypass the Data Mover
+    input  wire [(1<<RQ_IDX_WIDTH)-1:0]     pl_deliver_en,        // Per QPN[RQ_IDX_WIDTH-1:0]
+    input  wire                             pl_xfer_cmplt,        // Pulse: last payload beat taken by the PL consumer
+    
+    // Atomic read-modify-write (AXI4, to DDR)
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_atomic_araddr,
+    output wire [7:0]                       m_axi_atomic_arlen,
+    output wire [2:0]                       m_axi_atomic_arsize,
+    output wire [1:0]                       m_axi_atomic_arburst,
+    output wire [3:0]                       m_axi_atomic_arcache,
+    output wire [2:0]                       m_axi_atomic_arprot,
+    output wire                             m_axi_atomic_arvalid,
+    input  wire                             m_axi_atomic_arready,
+    input  wire [63:0]                      m_axi_atomic_rdata,
+    input  wire [1:0]                       m_axi_atomic_rresp,
+    input  wire                             m_axi_atomic_rlast,
+    input  wire                             m_axi_atomic_rvalid,
+    output wire                             m_axi_atomic_rready,
+    output wire [C_ADDR_WIDTH-1:0]          m_axi_atomic_awaddr,
+    output wire [7:0]                       m_axi_atomic_awlen,
+    output wire [2:0]                       m_axi_atomic_awsize,
+    output wire [1:0]                       m_axi_atomic_awburst,
+    output wire [3:0]                       m_axi_atomic_awcache,
+    output wire [2:0]                       m_axi_atomic_awprot,
+    output wire                             m_axi_atomic_awvalid,
+    input  wire                             m_axi_atomic_awready,
+    output wire [63:0]                      m_axi_atomic_wdata,
+    output wire [7:0]                       m_axi_atomic_wstrb,
+    output wire                             m_axi_atomic_wlast,
+    output wire                             m_axi_atomic_wvalid,
+    input  wire                             m_axi_atomic_wready,
+    input  wire [1:0]                       m_axi_atomic_bresp,
+    input  wire                             m_axi_atomic_bvalid,
+    output wire                             m_axi_atomic_bready,
     
     // Status outputs
-    output wire [2:0]                       rx_state,
+    output wire [3:0]                       rx_state,
     output wire                             rx_active,            // Currently processing a write
     output wire                             write_accepted,       // Valid WRITE command accepted (pulse)
-    output wire                             write_complete        // Write operation completed (pulse)
+    output wire                             write_complete,       // Write operation completed (pulse)
+    output wire                             mr_violation,         // Request rejected by MR check (pulse)
+    output wire                             recv_rnr,             // SEND dropped: no receive buffer (pulse)
+    output wire                             psn_error,            // Duplicate / out-of-order packet dropped (pulse)
+    output wire                             ecn_marked,           // CE-marked packet received (pulse)
+    output wire [2:0]                       mr_status             // Status of the last MR lookup
 );
 
-    localparam [2:0] STATE_IDLE          = 3'd0;
-    localparam [2:0] STATE_CHECK_OPCODE  = 3'd1;
-    localparam [2:0] STATE_PREPARE_CMD   = 3'd2;
-    localparam [2:0] STATE_ISSUE_DM_CMD  = 3'd3;
-    localparam [2:0] STATE_WAIT_COMPLETE = 3'd4;
+    localparam [3:0] STATE_IDLE          = 4'd0;
+    localparam [3:0] STATE_CHECK_OPCODE  = 4'd1;
+    localparam [3:0] STATE_PREPARE_CMD   = 4'd2;
+    localparam [3:0] STATE_ISSUE_DM_CMD  = 4'd3;
+    localparam [3:0] STATE_WAIT_COMPLETE = 4'd4;
+    localparam [3:0] STATE_MR_LOOKUP     = 4'd5;
+    localparam [3:0] STATE_DROP          = 4'd6;
+    localparam [3:0] STATE_ISSUE_RD_RSP  = 4'd7;
+    localparam [3:0] STATE_ATOMIC_EXEC   = 4'd8;
+
+    localparam [3:0] MR_ACC_REMOTE_WRITE  = 4'b0001;
+    localparam [3:0] MR_ACC_REMOTE_READ   = 4'b0010;
+    localparam [3:0] MR_ACC_REMOTE_ATOMIC = 4'b0100;
+
+    // RX completion type (CQ_INFO[31:28]) and status (CQ_INFO[27:24])
+    localparam [3:0] CQE_TYPE_RECV       = 4'd0;
+    localparam [3:0] CQE_TYPE_WRITE_IMM  = 4'd1;
+    localparam [3:0] CQE_ST_SUCCESS      = 4'd0;
+    localparam [3:0] CQE_ST_LOC_LEN_ERR  = 4'd1;   // Message longer than the posted buffer
+    localparam [3:0] CQE_ST_REM_ACC_ERR  = 4'd2;   // A packet of the message failed the MR check
+
+    // AETH syndromes (InfiniBand encoding)
+    localparam [7:0] AETH_ACK         = 8'h00;
+    localparam [7:0] AETH_RNR_NAK     = 8'h20;
+    localparam [7:0] AETH_NAK_SEQ     = 8'h60;   // PSN sequence error: resend from ack_tx_psn
+    localparam [7:0] AETH_NAK_INV_REQ = 8'h61;   // Invalid request (misaligned atomic)
+    localparam [7:0] AETH_NAK_REM_ACC = 8'h62;   // Remote access error
+    localparam [7:0] AETH_NAK_REM_OP  = 8'h63;   // Remote operational error (atomic AXI error)
     
-    reg [2:0] state_reg, state_next;
+    reg [3:0] state_reg, state_next;
     
     // Latched header fields - captured immediately when header_valid pulses
     reg [RDMA_OPCODE_WIDTH-1:0]    opcode_reg;
-    reg [C_ADDR_WIDTH-1:0]         dest_addr_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]      dest_addr_reg;
     reg [RDMA_LENGTH_WIDTH-1:0]    length_reg;
     reg [RDMA_RKEY_WIDTH-1:0]      rkey_reg;
     reg [OFFSET_LENGTH-1:0]      fragment_offset_reg;
+    reg                             more_fragments_reg;
+    reg                             ecn_ce_reg;
+    reg [7:0]                       sl_reg;
+    reg [RDMA_PSN_WIDTH-1:0]       psn_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       dest_qp_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]      read_sink_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]      read_sink_rkey_reg;
+    reg                             header_only_reg;
+    reg [31:0]                      imm_reg;
+    reg [63:0]                      atomic_data_reg;
+    reg [63:0]                      atomic_compare_reg;
     // Flag to indicate new header is available
     reg                             header_pending;
     
     // Data Mover command registers
     reg [C_ADDR_WIDTH-1:0]         s2mm_addr_reg;
     reg [C_BTT_WIDTH-1:0]          s2mm_btt_reg;
+    reg                             s2mm_read_last_reg;  // Command lands the last READ response
+    reg                             s2mm_send_last_reg;  // Command lands the last SEND packet
+    reg                             s2mm_imm_last_reg;   // Command lands the last WRITE_WITH_IMM packet
+    reg [31:0]                      s2mm_imm_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       s2mm_qp_reg;
+    reg                             s2mm_seq_reg;        // Command lands a sequence-checked packet
+    reg [RDMA_PSN_WIDTH-1:0]       s2mm_psn_reg;
+    reg                             s2mm_more_reg;
     
     // Status signals
     reg                             write_accepted_reg;
     reg                             write_complete_reg;
+    reg                             drop_payload_reg;
+    reg                             mr_violation_reg;
+    reg                             read_done_reg;
+    reg                             recv_rnr_reg;
+    reg                             atomic_done_reg;
+    reg                             ack_rcvd_reg;
+    reg                             psn_error_reg;
+    reg                             cnp_rcvd_reg;
+
+    // READ response job (held until tx_streamer takes it)
+    reg [C_ADDR_WIDTH-1:0]         rd_rsp_src_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]    rd_rsp_length_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]      rd_rsp_remote_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]      rd_rsp_rkey_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       rd_rsp_dest_qp_reg;
+    reg [RDMA_PSN_WIDTH-1:0]       rd_rsp_psn_reg;
+    reg                             rd_rsp_atomic_reg;
+    reg [7:0]                       rd_rsp_sl_reg;
+
+    // Expected PSN per QP, and the pending ACK / NAK (a newer one replaces an unsent one)
+    reg [RDMA_PSN_WIDTH-1:0]       epsn_table [0:(1<<EPSN_IDX_WIDTH)-1];
+    reg [(1<<EPSN_IDX_WIDTH)-1:0]  nak_sent_reg;        // NAK already sent for the current gap
+    reg [7:0]                       ack_coalesce_reg;    // Packets landed since the last ACK
+    reg                             ack_valid_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       ack_dest_qp_reg;
+    reg [RDMA_PSN_WIDTH-1:0]       ack_psn_reg;
+    reg [7:0]                       ack_syndrome_reg;
+    integer                         i;
+
+    // CNP generation: one pending CNP, and a hold-off timer per QP
+    reg                             cnp_valid_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       cnp_dest_qp_reg;
+    reg [15:0]                      cnp_hold [0:(1<<QP_IDX_WIDTH)-1];
+
+    // Atomic unit
+    wire                            atomic_start;
+    wire                            atomic_unit_done;
+    wire                            atomic_unit_error;
+    wire [63:0]                     atomic_unit_orig;
+
+    // SEND receive context: one message at a time, packets arrive in order
+    reg                             send_open_reg;       // First packet seen, more to come
+    reg                             send_rnr_reg;        // No buffer was posted: drop the rest
+    reg                             send_err_reg;        // Buffer overrun: drop the rest
+    reg [31:0]                      send_wr_id_reg;
+    reg [C_ADDR_WIDTH-1:0]         send_base_reg;
+    reg [31:0]                      send_room_reg;
+    reg [31:0]                      send_bytes_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       send_qp_reg;
+    reg [C_ADDR_WIDTH-1:0]         send_dst_reg;        // S2MM target of the current packet
+
+    // WRITE_WITH_IMM message: bytes landed so far, sticky MR failure
+    reg [31:0]                      imm_bytes_reg;
+    reg                             imm_err_reg;
+
+    // Receive queue head for the QP of the current header
+    wire                            rq_head_valid;
+    wire [31:0]                     rq_head_wr_id;
+    wire [RDMA_ADDR_WIDTH-1:0]      rq_head_addr;
+    wire [31:0]                     rq_head_len;
+    wire                            rq_pop;
+    wire                            cqe_push;
+    wire [31:0]                     cqe_wr_id;
+    wire [31:0]                     cqe_byte_len;
+    wire [31:0]                     cqe_imm;
+    wire [7:0]                      cqe_status;
+    wire [RDMA_QPN_WIDTH-1:0]       cqe_qpn;
+
+    // Memory region lookup
+    wire                            mr_lkp_req;
+    wire                            mr_lkp_done;
+    wire                            mr_lkp_ok;
+    wire [2:0]                      mr_lkp_status;
+    wire [RDMA_ADDR_WIDTH-1:0]      mr_lkp_pa;
     
     // Check if opcode is a WRITE variant
     wire is_write_op = (opcode_reg == RDMA_OPCODE_WRITE_FIRST)  ||
                        (opcode_reg == RDMA_OPCODE_WRITE_MIDDLE) ||
                        (opcode_reg == RDMA_OPCODE_WRITE_LAST)   ||
                        (opcode_reg == RDMA_OPCODE_WRITE_ONLY)   ||
-                       (opcode_reg == RDMA_OPCODE_WRITE_TEST);  // Accept test opcode 0x01
+                       (opcode_reg == RDMA_OPCODE_WRITE_TEST)   ||  // Accept test opcode 0x01
+                       (opcode_reg == RDMA_OPCODE_WRITE_IMM)    ||
+                       (opcode_reg == RDMA_OPCODE_READ_RESPONSE);   // Lands like a WRITE
+    wire is_read_req = (opcode_reg == RDMA_OPCODE_READ_REQUEST);
+    wire is_send     = (opcode_reg == RDMA_OPCODE_SEND);
+    wire is_write_imm = (opcode_reg == RDMA_OPCODE_WRITE_IMM);
+    wire is_atomic_req = (opcode_reg == RDMA_OPCODE_CMP_SWAP) || (opcode_reg == RDMA_OPCODE_FETCH_ADD);
+    wire is_atomic_ack = (opcode_reg == RDMA_OPCODE_ATOMIC_ACK);
+    wire is_ack        = (opcode_reg == RDMA_OPCODE_ACK);
+    wire is_cnp        = (opcode_reg == RDMA_OPCODE_CNP);
+    wire atomic_aligned = (mr_lkp_pa[2:0] == 3'b000);
+
+    // The first packet of a message claims the receive queue head
+    wire [31:0] send_wr_id = send_open_reg ? send_wr_id_reg : rq_head_wr_id;
+    wire [31:0] send_room  = send_open_reg ? send_room_reg  : rq_head_len;
+    wire [31:0] send_bytes = send_open_reg ? send_bytes_reg : 32'd0;
+    wire        send_rnr   = send_open_reg ? send_rnr_reg   : !rq_head_valid;
+    wire        send_fits  = !send_rnr && !(send_open_reg && send_err_reg) &&
+                             ({1'b0, send_bytes} + {1'b0, length_reg} <= {1'b0, send_room});
+
+    // Sequence check: WRITE / WRITE_IMM / SEND packets must arrive in PSN order per QP.
+    // READ / atomic requests and all responses are outside the sequence space.
+    wire [QP_IDX_WIDTH-1:0]   qp_idx   = dest_qp_reg[QP_IDX_WIDTH-1:0];
+    wire [EPSN_IDX_WIDTH-1:0] epsn_idx = dest_qp_reg[EPSN_IDX_WIDTH-1:0];
+    wire [RDMA_PSN_WIDTH-1:0] epsn     = epsn_table[epsn_idx];
+    wire [RDMA_PSN_WIDTH-1:0] psn_diff = psn_reg - epsn;
+    wire is_seq_op  = psn_check_en && (is_send || (is_write_op && (opcode_reg != RDMA_OPCODE_READ_RESPONSE)));
+    wire seq_dup    = is_seq_op && psn_diff[RDMA_PSN_WIDTH-1];                     // Already received
+    wire seq_gap    = is_seq_op && (psn_diff != 0) && !psn_diff[RDMA_PSN_WIDTH-1]; // Earlier packet lost
+    wire seq_drop   = seq_dup || seq_gap;
+    wire seq_rnr    = is_seq_op && !seq_drop && is_send && !send_open_reg && !rq_head_valid;
+    wire seq_accept = is_seq_op && !seq_drop && !seq_rnr;                          // Consumes the PSN
+
+    // Accepted WRITE payload of a QP in PL delivery mode: no S2MM command, the payload
+    // leaves on the header parser's m_axis_pl and its last beat stands in for the S2MM status
+    wire pl_route    = pl_deliver_en[dest_qp_reg[RQ_IDX_WIDTH-1:0]] && is_write_op &&
+                       (opcode_reg != RDMA_OPCODE_READ_RESPONSE) && !header_only_reg;
+    wire xfer_cmplt  = s2mm_wr_xfer_cmplt || pl_xfer_cmplt;
     
     // Output assignments
     assign rx_state = state_reg;
     assign rx_active = (state_reg != STATE_IDLE);
     assign write_accepted = write_accepted_reg;
     assign write_complete = write_complete_reg;
+    assign drop_payload   = drop_payload_reg;
+    assign pl_payload     = (state_reg == STATE_PREPARE_CMD) && pl_route;
+    assign mr_violation   = mr_violation_reg;
+    assign mr_status      = mr_lkp_status;
+    assign read_done      = read_done_reg;
+    assign recv_rnr       = recv_rnr_reg;
+    assign atomic_done    = atomic_done_reg;
+    assign atomic_orig    = atomic_data_reg;   // Original value carried by the ACK
+    assign psn_error      = psn_error_reg;
+    assign ecn_marked     = (state_reg == STATE_CHECK_OPCODE) && ecn_ce_reg && !header_only_reg;
+
+    assign ack_tx_valid      = ack_valid_reg;
+    assign ack_tx_dest_qp    = ack_dest_qp_reg;
+    assign ack_tx_psn        = ack_psn_reg;
+    assign ack_tx_syndrome   = ack_syndrome_reg;
+    assign ack_rcvd          = ack_rcvd_reg;
+    assign ack_rcvd_dest_qp  = dest_qp_reg;
+    assign ack_rcvd_psn      = psn_reg;
+    assign ack_rcvd_syndrome = imm_reg[31:24];   // AETH syndrome
+
+    assign cnp_tx_valid      = cnp_valid_reg;
+    assign cnp_tx_dest_qp    = cnp_dest_qp_reg;
+    assign cnp_rcvd          = cnp_rcvd_reg;
+    assign cnp_rcvd_dest_qp  = dest_qp_reg;
+
+    assign rd_rsp_valid       = (state_reg == STATE_ISSUE_RD_RSP);
+    assign rd_rsp_src_addr    = rd_rsp_src_addr_reg;
+    assign rd_rsp_length      = rd_rsp_length_reg;
+    assign rd_rsp_remote_addr = rd_rsp_remote_addr_reg;
+    assign rd_rsp_rkey        = rd_rsp_rkey_reg;
+    assign rd_rsp_dest_qp     = rd_rsp_dest_qp_reg;
+    assign rd_rsp_psn         = rd_rsp_psn_reg;
+    assign rd_rsp_atomic      = rd_rsp_atomic_reg;
+    assign rd_rsp_orig        = atomic_unit_orig;
+    assign rd_rsp_sl          = rd_rsp_sl_reg;
     
-    // Data Mover S2MM command interface (72-bit AXI-Stream format)
-    // Format: [Reserved(8) | Address(32) | Type(1) | DSA(1) | Reserved(6) | EOF(1) | BTT(23)]
+    // Data Mover S2MM command interface (104-bit AXI-Stream format with 64-bit addressing)
+    // Format: [Reserved(4) | Tag(4) | Address(C_ADDR_WIDTH) | DRR(1) | EOF(1) | DSA(6) | Type(1) | BTT(23)]
     assign m_axis_s2mm_cmd_tdata  = {8'b00000000, s2mm_addr_reg, 1'b0, 1'b1, 6'b000000, 1'b1, s2mm_btt_reg[22:0]};
     assign m_axis_s2mm_cmd_tvalid = (state_reg == STATE_ISSUE_DM_CMD) ? 1'b1 : 1'b0;
     
@@ -125,16 +455,38 @@ module rx_streamer #(
             length_reg          <= 0;
             rkey_reg            <= 0;
             fragment_offset_reg <= 0;
+            more_fragments_reg  <= 0;
+            ecn_ce_reg          <= 0;
+            sl_reg              <= 0;
+            psn_reg             <= 0;
+            dest_qp_reg         <= 0;
+            read_sink_addr_reg  <= 0;
+            read_sink_rkey_reg  <= 0;
+            header_only_reg     <= 0;
+            imm_reg             <= 0;
+            atomic_data_reg     <= 0;
+            atomic_compare_reg  <= 0;
             header_pending      <= 0;
         end else begin
             // Capture header fields whenever header_valid pulses
             if (header_valid) begin
                 opcode_reg    <= rdma_opcode;
-                dest_addr_reg <= rdma_remote_addr[C_ADDR_WIDTH-1:0];  // Use lower bits as local address
+                dest_addr_reg <= rdma_remote_addr;  // Virtual address, translated by rx_mr_table
                 length_reg    <= rdma_length;
                 rkey_reg      <= rdma_rkey;
                 header_pending <= 1;  // Mark that new header is available
                 fragment_offset_reg <= fragment_offset;
+                more_fragments_reg  <= more_fragments;
+                ecn_ce_reg          <= ecn_ce;
+                sl_reg              <= service_level;
+                psn_reg             <= rdma_psn;
+                dest_qp_reg         <= rdma_dest_qp;
+                read_sink_addr_reg  <= read_sink_addr;
+                read_sink_rkey_reg  <= read_sink_rkey;
+                header_only_reg     <= header_only;
+                imm_reg             <= rdma_imm;
+                atomic_data_reg     <= atomic_data;
+                atomic_compare_reg  <= atomic_compare;
             end
             // Clear pending flag when FSM starts processing (enters CHECK_OPCODE)
             else if (state_reg == STATE_CHECK_OPCODE) begin
@@ -148,15 +500,194 @@ module rx_streamer #(
         if (!aresetn) begin
             s2mm_addr_reg  <= 0;
             s2mm_btt_reg   <= 0;
+            s2mm_read_last_reg <= 0;
+            s2mm_send_last_reg <= 0;
+            s2mm_imm_last_reg  <= 0;
+            s2mm_imm_reg       <= 0;
+            s2mm_qp_reg        <= 0;
+            s2mm_seq_reg       <= 0;
+            s2mm_psn_reg       <= 0;
+            s2mm_more_reg      <= 0;
+            rd_rsp_src_addr_reg    <= 0;
+            rd_rsp_length_reg      <= 0;
+            rd_rsp_remote_addr_reg <= 0;
+            rd_rsp_rkey_reg        <= 0;
+            rd_rsp_dest_qp_reg     <= 0;
+            rd_rsp_psn_reg         <= 0;
+            rd_rsp_atomic_reg      <= 0;
+            rd_rsp_sl_reg          <= 0;
         end else begin
             // Prepare command in PREPARE_CMD state
             if (state_reg == STATE_PREPARE_CMD) begin
-                s2mm_addr_reg  <= dest_addr_reg + fragment_offset_reg;  // Add fragment offset to base address
+                s2mm_addr_reg  <= is_send ? send_dst_reg :                // Posted buffer + bytes so far
+                                  mr_lkp_pa[C_ADDR_WIDTH-1:0];            // Translated (VA + fragment offset)
                 s2mm_btt_reg   <= length_reg[C_BTT_WIDTH-1:0];
+                s2mm_read_last_reg <= (opcode_reg == RDMA_OPCODE_READ_RESPONSE) && !more_fragments_reg;
+                s2mm_send_last_reg <= is_send && !more_fragments_reg;
+                s2mm_imm_last_reg  <= is_write_imm && !more_fragments_reg;
+                s2mm_imm_reg       <= imm_reg;
+                s2mm_qp_reg        <= dest_qp_reg;
+                s2mm_seq_reg       <= is_seq_op;
+                s2mm_psn_reg       <= psn_reg;
+                s2mm_more_reg      <= more_fragments_reg;
+            end
+            // READ request: snapshot the response job (the next header may arrive meanwhile)
+            // Atomics: the ACK job is taken at start, the original value follows from the unit
+            if (state_reg == STATE_MR_LOOKUP && mr_lkp_done) begin
+                rd_rsp_src_addr_reg    <= mr_lkp_pa[C_ADDR_WIDTH-1:0];
+                rd_rsp_length_reg      <= is_atomic_req ? 32'd8 : length_reg;
+                rd_rsp_remote_addr_reg <= is_atomic_req ? {RDMA_ADDR_WIDTH{1'b0}} : read_sink_addr_reg;
+                rd_rsp_rkey_reg        <= is_atomic_req ? {RDMA_RKEY_WIDTH{1'b0}} : read_sink_rkey_reg;
+                rd_rsp_dest_qp_reg     <= dest_qp_reg;
+                rd_rsp_psn_reg         <= psn_reg;
+                rd_rsp_atomic_reg      <= is_atomic_req;
+                rd_rsp_sl_reg          <= sl_reg;
             end
         end
     end
     
+    // SEND receive context
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            send_open_reg  <= 0;
+            send_rnr_reg   <= 0;
+            send_err_reg   <= 0;
+            send_wr_id_reg <= 0;
+            send_base_reg  <= 0;
+            send_room_reg  <= 0;
+            send_bytes_reg <= 0;
+            send_qp_reg    <= 0;
+            send_dst_reg   <= 0;
+        end else begin
+            if (state_reg == STATE_CHECK_OPCODE && is_send && !seq_drop && !seq_rnr) begin
+                if (!send_open_reg) begin
+                    send_rnr_reg   <= !rq_head_valid;
+                    send_wr_id_reg <= rq_head_wr_id;
+                    send_base_reg  <= rq_head_addr[C_ADDR_WIDTH-1:0];
+                    send_room_reg  <= rq_head_len;
+                    send_qp_reg    <= dest_qp_reg;
+                end
+                send_open_reg  <= more_fragments_reg;
+                send_err_reg   <= !send_rnr && !send_fits;
+                send_bytes_reg <= send_fits ? send_bytes + length_reg : send_bytes;
+                send_dst_reg   <= (send_open_reg ? send_base_reg : rq_head_addr[C_ADDR_WIDTH-1:0]) + send_bytes;
+            end
+        end
+    end
+
+    // Sequence state and ACK / NAK generation.
+    // Landed packets are acknowledged at the end of a message or every ACK_COALESCE packets.
+    // A gap is NAKed once (until the missing PSN arrives), a duplicate is re-ACKed.
+    wire seq_landed   = (state_reg == STATE_WAIT_COMPLETE) && xfer_cmplt && s2mm_seq_reg;
+    wire seq_len_drop = (state_reg == STATE_CHECK_OPCODE) && seq_accept && is_send && !send_fits;
+    wire seq_done     = seq_landed || seq_len_drop;
+    wire seq_done_last = seq_landed ? !s2mm_more_reg : !more_fragments_reg;
+    wire seq_ack_due  = seq_done && (seq_done_last || (ack_coalesce_reg == ACK_COALESCE - 1));
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (i = 0; i < (1<<EPSN_IDX_WIDTH); i = i + 1) begin
+                epsn_table[i] <= 0;
+            end
+            nak_sent_reg     <= 0;
+            ack_coalesce_reg <= 0;
+            ack_valid_reg    <= 0;
+            ack_dest_qp_reg  <= 0;
+            ack_psn_reg      <= 0;
+            ack_syndrome_reg <= 0;
+        end else begin
+            if (ack_valid_reg && ack_tx_ready) begin
+                ack_valid_reg <= 1'b0;
+            end
+
+            if (state_reg == STATE_CHECK_OPCODE && seq_accept) begin
+                epsn_table[epsn_idx]   <= epsn + 1'b1;
+                nak_sent_reg[epsn_idx] <= 1'b0;
+            end
+
+            if (seq_done) begin
+                ack_coalesce_reg <= seq_ack_due ? 8'd0 : ack_coalesce_reg + 1'b1;
+            end
+
+            if (seq_ack_due) begin
+                ack_valid_reg    <= 1'b1;
+                ack_dest_qp_reg  <= seq_landed ? s2mm_qp_reg  : dest_qp_reg;
+                ack_psn_reg      <= seq_landed ? s2mm_psn_reg : psn_reg;
+                ack_syndrome_reg <= AETH_ACK;
+            end else if (state_reg == STATE_CHECK_OPCODE && seq_dup) begin
+                ack_valid_reg    <= 1'b1;
+                ack_dest_qp_reg  <= dest_qp_reg;
+                ack_psn_reg      <= epsn - 1'b1;
+                ack_syndrome_reg <= AETH_ACK;
+            end else if (state_reg == STATE_CHECK_OPCODE && (seq_gap || seq_rnr) && !nak_sent_reg[epsn_idx]) begin
+                ack_valid_reg          <= 1'b1;
+                ack_dest_qp_reg        <= dest_qp_reg;
+                ack_psn_reg            <= epsn;
+                ack_syndrome_reg       <= seq_rnr ? AETH_RNR_NAK : AETH_NAK_SEQ;
+                nak_sent_reg[epsn_idx] <= 1'b1;
+            end else if (state_reg == STATE_MR_LOOKUP && mr_lkp_done &&
+                         (is_seq_op || is_read_req || is_atomic_req) &&
+                         (!mr_lkp_ok || (is_atomic_req && !atomic_aligned))) begin
+                // Rejected WRITE / SEND, or a READ / atomic the requester would otherwise wait for
+                ack_valid_reg    <= 1'b1;
+                ack_dest_qp_reg  <= dest_qp_reg;
+                ack_psn_reg      <= psn_reg;
+                ack_syndrome_reg <= !mr_lkp_ok ? AETH_NAK_REM_ACC : AETH_NAK_INV_REQ;
+            end else if (state_reg == STATE_ATOMIC_EXEC && atomic_unit_done && atomic_unit_error) begin
+                ack_valid_reg    <= 1'b1;
+                ack_dest_qp_reg  <= dest_qp_reg;
+                ack_psn_reg      <= psn_reg;
+                ack_syndrome_reg <= AETH_NAK_REM_OP;
+            end
+        end
+    end
+
+    // CNP generation. Every CE-marked data packet asks for a CNP to its sender's QP; at most one
+    // is sent per QP every CNP_INTERVAL cycles. A mark that finds the CNP slot busy is skipped.
+    wire cnp_mark = cnp_en && ecn_marked;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (i = 0; i < (1<<QP_IDX_WIDTH); i = i + 1) begin
+                cnp_hold[i] <= 0;
+            end
+            cnp_valid_reg   <= 0;
+            cnp_dest_qp_reg <= 0;
+        end else begin
+            for (i = 0; i < (1<<QP_IDX_WIDTH); i = i + 1) begin
+                if (cnp_hold[i] != 0) begin
+                    cnp_hold[i] <= cnp_hold[i] - 1'b1;
+                end
+            end
+
+            if (cnp_valid_reg && cnp_tx_ready) begin
+                cnp_valid_reg <= 1'b0;
+            end else if (!cnp_valid_reg && cnp_mark && (cnp_hold[qp_idx] == 0)) begin
+                cnp_valid_reg    <= 1'b1;
+                cnp_dest_qp_reg  <= dest_qp_reg;
+                cnp_hold[qp_idx] <= CNP_INTERVAL;
+            end
+        end
+    end
+
+    // WRITE_WITH_IMM byte count, reset once the completion is pushed
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            imm_bytes_reg <= 0;
+            imm_err_reg   <= 0;
+        end else begin
+            if (cqe_push && cqe_status[7:4] == CQE_TYPE_WRITE_IMM) begin
+                imm_bytes_reg <= 0;
+                imm_err_reg   <= 0;
+            end else if (state_reg == STATE_MR_LOOKUP && mr_lkp_done && is_write_imm) begin
+                if (mr_lkp_ok)
+                    imm_bytes_reg <= imm_bytes_reg + length_reg;
+                else
+                    imm_err_reg   <= 1;
+            end
+        end
+    end
+
     // FSM combinational logic
     always @(*) begin
         // Default assignments
@@ -164,6 +695,14 @@ module rx_streamer #(
         
         write_accepted_reg = 0;
         write_complete_reg = 0;
+        drop_payload_reg   = 0;
+        mr_violation_reg   = 0;
+        read_done_reg      = 0;
+        recv_rnr_reg       = 0;
+        atomic_done_reg    = 0;
+        ack_rcvd_reg       = 0;
+        psn_error_reg      = 0;
+        cnp_rcvd_reg       = 0;
         
         case (state_reg)
             STATE_IDLE: begin
@@ -174,19 +713,83 @@ module rx_streamer #(
             end
             
             STATE_CHECK_OPCODE: begin
-                if (is_write_op) begin
-                    // Valid WRITE operation detected
-                    write_accepted_reg = 1;
-                    state_next = STATE_PREPARE_CMD;
+                if (seq_drop) begin
+                    // Duplicate or out-of-order packet: discard, the ACK / NAK resynchronises the requester
+                    psn_error_reg = 1;
+                    state_next = header_only_reg ? STATE_IDLE : STATE_DROP;
+                end else if (is_send) begin
+                    // SEND: land in the posted receive buffer, no MR check
+                    if (send_fits) begin
+                        write_accepted_reg = 1;
+                        state_next = STATE_PREPARE_CMD;
+                    end else begin
+                        recv_rnr_reg = send_rnr && !send_open_reg;
+                        state_next = header_only_reg ? STATE_IDLE : STATE_DROP;
+                    end
+                end else if (is_cnp) begin
+                    // Requester side: congestion reported by the receiver, cut the QP's rate
+                    cnp_rcvd_reg = 1;
+                    state_next = header_only_reg ? STATE_IDLE : STATE_DROP;
+                end else if (is_ack) begin
+                    // Requester side: ACK / NAK for the local tx_streamer
+                    ack_rcvd_reg = 1;
+                    state_next = STATE_IDLE;
+                end else if (is_atomic_ack) begin
+                    // Requester side: hand the original value to the pending atomic WQE
+                    atomic_done_reg = 1;
+                    state_next = STATE_IDLE;
+                end else if (is_write_op || is_read_req || is_atomic_req) begin
+                    // Valid WRITE / READ / atomic operation detected, check rkey / bounds
+                    state_next = STATE_MR_LOOKUP;
                 end else begin
-                    // Not a WRITE operation, ignore and return to idle
+                    // Unsupported operation, discard its payload
+                    state_next = header_only_reg ? STATE_IDLE : STATE_DROP;
+                end
+            end
+
+            STATE_MR_LOOKUP: begin
+                if (mr_lkp_done) begin
+                    if (mr_lkp_ok && is_read_req) begin
+                        state_next = STATE_ISSUE_RD_RSP;
+                    end else if (mr_lkp_ok && is_atomic_req && atomic_aligned) begin
+                        state_next = STATE_ATOMIC_EXEC;
+                    end else if (mr_lkp_ok && !is_atomic_req) begin
+                        write_accepted_reg = 1;
+                        state_next = STATE_PREPARE_CMD;
+                    end else begin
+                        mr_violation_reg = 1;
+                        state_next = header_only_reg ? STATE_IDLE : STATE_DROP;
+                    end
+                end
+            end
+
+            STATE_ATOMIC_EXEC: begin
+                // Read-modify-write in DDR, then return the original value
+                if (atomic_unit_done) begin
+                    if (atomic_unit_error) begin
+                        mr_violation_reg = 1;
+                        state_next = STATE_IDLE;
+                    end else begin
+                        state_next = STATE_ISSUE_RD_RSP;
+                    end
+                end
+            end
+
+            STATE_ISSUE_RD_RSP: begin
+                // Hand the response job to the TX path
+                if (rd_rsp_ready) begin
                     state_next = STATE_IDLE;
                 end
             end
+
+            STATE_DROP: begin
+                drop_payload_reg = 1;
+                state_next = STATE_IDLE;
+            end
             
             STATE_PREPARE_CMD: begin
                 // Prepare S2MM command (addr and btt loaded in this cycle)
-                state_next = STATE_ISSUE_DM_CMD;
+                state_next = pl_route ? STATE_WAIT_COMPLETE : STATE_ISSUE_DM_CMD;
             end
             
             STATE_ISSUE_DM_CMD: begin
@@ -198,9 +801,10 @@ module rx_streamer #(
             end
             
             STATE_WAIT_COMPLETE: begin
-                if (s2mm_wr_xfer_cmplt) begin
+                if (xfer_cmplt) begin
                     // Write completed successfully
                     write_complete_reg = 1;
+                    read_done_reg      = s2mm_read_last_reg;
                     state_next = STATE_IDLE;
                 end
             end
@@ -211,4 +815,157 @@ module rx_streamer #(
         endcase
     end
 
+    // Completions: the last packet of a SEND / WRITE_WITH_IMM landed, or the message
+    // ends with a packet that was rejected
+    wire cqe_send_ok  = (state_reg == STATE_WAIT_COMPLETE) && xfer_cmplt && s2mm_send_last_reg;
+    wire cqe_send_err = (state_reg == STATE_CHECK_OPCODE) && is_send && !seq_drop && !more_fragments_reg &&
+                        !send_rnr && !send_fits;
+    wire cqe_imm_ok   = (state_reg == STATE_WAIT_COMPLETE) && xfer_cmplt && s2mm_imm_last_reg;
+    wire cqe_imm_err  = (state_reg == STATE_MR_LOOKUP) && mr_lkp_done && !mr_lkp_ok &&
+                        is_write_imm && !more_fragments_reg;
+
+    assign rq_pop       = (state_reg == STATE_CHECK_OPCODE) && is_send && !seq_drop && !send_open_reg;
+    assign cqe_push     = cqe_send_ok || cqe_send_err || cqe_imm_ok || cqe_imm_err;
+    assign cqe_wr_id    = cqe_send_err ? send_wr_id :
+                          cqe_send_ok  ? send_wr_id_reg : 32'd0;   // WRITE_WITH_IMM takes no receive buffer
+    assign cqe_byte_len = cqe_send_err ? send_bytes :
+                          cqe_send_ok  ? send_bytes_reg : imm_bytes_reg;
+    assign cqe_imm      = cqe_imm_err  ? imm_reg : s2mm_imm_reg;
+    assign cqe_status   = cqe_send_err ? {CQE_TYPE_RECV, CQE_ST_LOC_LEN_ERR} :
+                          cqe_send_ok  ? {CQE_TYPE_RECV, CQE_ST_SUCCESS} :
+                          (cqe_imm_err || imm_err_reg) ? {CQE_TYPE_WRITE_IMM, CQE_ST_REM_ACC_ERR} :
+                                                         {CQE_TYPE_WRITE_IMM, CQE_ST_SUCCESS};
+    assign cqe_qpn      = cqe_send_err ? (send_open_reg ? send_qp_reg : dest_qp_reg) :
+                          cqe_send_ok  ? send_qp_reg :
+                          cqe_imm_err  ? dest_qp_reg : s2mm_qp_reg;
+
+    rx_recv_queue #(
+        .RQ_IDX_WIDTH    (RQ_IDX_WIDTH),
+        .RQ_DEPTH_WIDTH  (4),
+        .CQ_DEPTH_WIDTH  (4),
+        .RDMA_ADDR_WIDTH (RDMA_ADDR_WIDTH),
+        .RDMA_QPN_WIDTH  (RDMA_QPN_WIDTH)
+    ) u_recv_queue (
+        .aclk          (aclk),
+        .aresetn       (aresetn),
+        .srq_enable    (srq_enable),
+
+        .post_en       (rq_post_en),
+        .post_idx      (rq_post_idx),
+        .post_wr_id    (rq_post_wr_id),
+        .post_addr     (rq_post_addr),
+        .post_len      (rq_post_len),
+        .rq_level      (rq_level),
+
+        .rq_qpn        (dest_qp_reg),
+        .rq_head_valid (rq_head_valid),
+        .rq_head_wr_id (rq_head_wr_id),
+        .rq_head_addr  (rq_head_addr),
+        .rq_head_len   (rq_head_len),
+        .rq_pop        (rq_pop),
+
+        .cqe_push      (cqe_push),
+        .cqe_wr_id     (cqe_wr_id),
+        .cqe_byte_len  (cqe_byte_len),
+        .cqe_imm       (cqe_imm),
+        .cqe_status    (cqe_status),
+        .cqe_qpn       (cqe_qpn),
+
+        .cq_pop        (cq_pop),
+        .cq_valid      (cq_valid),
+        .cq_wr_id      (cq_wr_id),
+        .cq_byte_len   (cq_byte_len),
+        .cq_info       (cq_info),
+        .cq_imm        (cq_imm),
+        .cq_count      (cq_count),
+        .cq_overflow   (cq_overflow),
+
+        .ring_en       (cq_ring_en),
+        .ring_push     (cq_ring_push),
+        .ring_cqe      (cq_ring_cqe)
+    );
+
+    assign atomic_start = (state_reg == STATE_MR_LOOKUP) && mr_lkp_done && mr_lkp_ok &&
+                          is_atomic_req && atomic_aligned;
+
+    rx_atomic_unit #(
+        .C_ADDR_WIDTH (C_ADDR_WIDTH)
+    ) u_atomic_unit (
+        .aclk        (aclk),
+        .aresetn     (aresetn),
+        .start       (atomic_start),
+        .op_cmp_swap (opcode_reg == RDMA_OPCODE_CMP_SWAP),
+        .addr        (mr_lkp_pa[C_ADDR_WIDTH-1:0]),
+        .swap_add    (atomic_data_reg),
+        .compare     (atomic_compare_reg),
+        .done        (atomic_unit_done),
+        .error       (atomic_unit_error),
+        .orig        (atomic_unit_orig),
+
+        .m_axi_atomic_araddr  (m_axi_atomic_araddr),
+        .m_axi_atomic_arlen   (m_axi_atomic_arlen),
+        .m_axi_atomic_arsize  (m_axi_atomic_arsize),
+        .m_axi_atomic_arburst (m_axi_atomic_arburst),
+        .m_axi_atomic_arcache (m_axi_atomic_arcache),
+        .m_axi_atomic_arprot  (m_axi_atomic_arprot),
+        .m_axi_atomic_arvalid (m_axi_atomic_arvalid),
+        .m_axi_atomic_arready (m_axi_atomic_arready),
+        .m_axi_atomic_rdata   (m_axi_atomic_rdata),
+        .m_axi_atomic_rresp   (m_axi_atomic_rresp),
+        .m_axi_atomic_rlast   (m_axi_atomic_rlast),
+        .m_axi_atomic_rvalid  (m_axi_atomic_rvalid),
+        .m_axi_atomic_rready  (m_axi_atomic_rready),
+        .m_axi_atomic_awaddr  (m_axi_atomic_awaddr),
+        .m_axi_atomic_awlen   (m_axi_atomic_awlen),
+        .m_axi_atomic_awsize  (m_axi_atomic_awsize),
+        .m_axi_atomic_awburst (m_axi_atomic_awburst),
+        .m_axi_atomic_awcache (m_axi_atomic_awcache),
+        .m_axi_atomic_awprot  (m_axi_atomic_awprot),
+        .m_axi_atomic_awvalid (m_axi_atomic_awvalid),
+        .m_axi_atomic_awready (m_axi_atomic_awready),
+        .m_axi_atomic_wdata   (m_axi_atomic_wdata),
+        .m_axi_atomic_wstrb   (m_axi_atomic_wstrb),
+        .m_axi_atomic_wlast   (m_axi_atomic_wlast),
+        .m_axi_atomic_wvalid  (m_axi_atomic_wvalid),
+        .m_axi_atomic_wready  (m_axi_atomic_wready),
+        .m_axi_atomic_bresp   (m_axi_atomic_bresp),
+        .m_axi_atomic_bvalid  (m_axi_atomic_bvalid),
+        .m_axi_atomic_bready  (m_axi_atomic_bready)
+    );
+
+    // Memory region table: rkey -> {VA window, PA base, access}
+    assign mr_lkp_req = (state_reg == STATE_CHECK_OPCODE) && (is_write_op || is_read_req || is_atomic_req);
+
+    rx_mr_table #(
+        .MR_IDX_WIDTH      (MR_IDX_WIDTH),
+        .RDMA_ADDR_WIDTH   (RDMA_ADDR_WIDTH),
+        .RDMA_RKEY_WIDTH   (RDMA_RKEY_WIDTH),
+        .RDMA_LENGTH_WIDTH (RDMA_LENGTH_WIDTH)
+    ) u_mr_table (
+        .aclk         (aclk),
+        .aresetn      (aresetn),
+        .enforce      (mr_enforce),
+
+        .mr_wr_en     (mr_wr_en),
+        .mr_wr_idx    (mr_wr_idx),
+        .mr_wr_valid  (mr_wr_valid),
+        .mr_wr_rkey   (mr_wr_rkey),
+        .mr_wr_va     (mr_wr_va),
+        .mr_wr_len    (mr_wr_len),
+        .mr_wr_pa     (mr_wr_pa),
+        .mr_wr_access (mr_wr_access),
+
+        .lkp_req      (mr_lkp_req),
+        .lkp_rkey     (rkey_reg),
+        .lkp_va       (dest_addr_reg + fragment_offset_reg),
+        .lkp_len      (is_atomic_req ? 32'd8 : length_reg),
+        .lkp_access   (is_read_req   ? MR_ACC_REMOTE_READ   :
+                       is_atomic_req ? MR_ACC_REMOTE_ATOMIC : MR_ACC_REMOTE_WRITE),
+        .lkp_done     (mr_lkp_done),
+        .lkp_ok       (mr_lkp_ok),
+        .lkp_status   (mr_lkp_status),
+        .lkp_pa       (mr_lkp_pa),
+        .tc_hit       ()
+    );
+
 endmodule
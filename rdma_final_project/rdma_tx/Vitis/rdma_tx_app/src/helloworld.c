@@ -6,6 +6,7 @@
 #include "xil_cache.h"
 #include "xparameters.h"
 #include "xiltimer.h"   // <-- timing / XTime_GetTime
+#include "xaxiethernet.h"
 
 // Base addresses
 #ifndef DATA_MOVER_BASE
@@ -21,30 +22,53 @@
 #define REMOTE_BUFFER_BASE 0x20000000U  // Simulated "remote" memory for loopback
 
 #define SODIRINSIK XPAR_RDMA_AXILITE_CTRL_0_BASEADDR
+#define ETH_DEV_ID 0     // axi_ethernet_1, the only MAC of the TX design
 
 // Register indices
 #define REG_IDX_CTRL       0
+#define REG_IDX_RATE_CFG   4  // [31:30] QP, [29:16] burst / 64 B, [15:0] bytes per 256 cycles
+#define REG_IDX_RETRY_TIMEOUT 5 // ACK timeout in cycles, 0 = no retransmission
+#define REG_IDX_RETRY_CFG  6  // [2:0] retry limit
+#define REG_IDX_QP_CTX_DATA 7 // QP context word, stored by a QP_CTX_ADDR write
 #define REG_IDX_SQ_BASE_LO 8
 #define REG_IDX_SQ_BASE_HI 9
 #define REG_IDX_SQ_SIZE    10
 #define REG_IDX_SQ_HEAD    11 // HW-owned read-only
 #define REG_IDX_SQ_TAIL    12
 #define REG_IDX_SQ_DOORBELL 13
+#define REG_IDX_TC_MAP     14 // Traffic class per SL, 2 bits per SL (3 = most urgent)
+#define REG_IDX_TC_WEIGHT  15 // WRR fragments per turn, 8 bits per class
 #define REG_IDX_CQ_BASE_LO 16
 #define REG_IDX_CQ_BASE_HI 17
 #define REG_IDX_CQ_SIZE    18
 #define REG_IDX_CQ_HEAD    19
 #define REG_IDX_CQ_TAIL    20 // HW-owned read-only
 #define REG_IDX_CQ_DOORBELL 21
+#define REG_IDX_QP_CTX_ADDR 22 // [9:2] QP handle, [1:0] word (write-only)
+#define REG_IDX_STRM_BASE_LO 32 // Streaming ring: local ring base
+#define REG_IDX_STRM_BASE_HI 33
+#define REG_IDX_STRM_SIZE   34 // Ring size in bytes
+#define REG_IDX_STRM_CHUNK  35 // Max bytes per generated WRITE
+#define REG_IDX_STRM_RADDR_LO 36 // Remote ring base
+#define REG_IDX_STRM_RADDR_HI 37
+#define REG_IDX_STRM_RKEY   38
+#define REG_IDX_STRM_CFG    39 // [0] enable, [11:4] QP handle
+#define REG_IDX_STRM_PROD   40 // Producer byte offset (write = doorbell)
+#define REG_IDX_STRM_CONS   41 // HW-owned read-only: consumer byte offset, [31] error
 
 #define REG_OFFSET(idx) ((idx) * 4U)
 #define REG_ADDR(idx) (DATA_MOVER_BASE + REG_OFFSET(idx))
 
+// Endpoint table in BRAM: 512 x 16-byte entries {MAC[31:0], valid[31] | MAC[47:32], IP, rsvd}.
+// Entry 0 is the local endpoint; a peer lives in entry 2*h or 2*h+1, h = XOR of its IP bytes.
 #define BRAM_BASE_ADDR XPAR_AXI_BRAM_CTRL_0_BASEADDR
-#define OFFSET_SRC_MAC_L 0x00
-#define OFFSET_SRC_MAC_H 0x04
-#define OFFSET_DST_MAC_L 0x08
-#define OFFSET_DST_MAC_H 0x0C
+#define EP_ENTRY_SIZE    0x10
+#define EP_OFF_MAC_L     0x00
+#define EP_OFF_MAC_H     0x04
+#define EP_OFF_IP        0x08
+#define EP_VALID         0x80000000U
+#define EP_HASH(ip)      ((((ip) >> 24) ^ ((ip) >> 16) ^ ((ip) >> 8) ^ (ip)) & 0xFFU)
+#define EP_ENTRY_ADDR(e) (BRAM_BASE_ADDR + (e) * EP_ENTRY_SIZE)
 
 // Helpers for throughput calculation
 #ifndef COUNTS_PER_SECOND
@@ -68,6 +92,102 @@ typedef struct {
     uint32_t reserved[8];     // Words 8-15: Reserved (rdma_btt upper + rdma_reserved) - bytes 32-63
 } sq_entry_t;
 
+// Word 10 (reserved[2]) carries the remote key checked by the receiver's MR table
+#define SQE_RSVD_RKEY 2
+
+// Inline gather list (flags bit 0): up to two extra local segments follow segment 0
+// (local_key / length_lo). Segment 1: addr = {reserved[0], length_hi}, len = reserved[1].
+// Segment 2: addr = {reserved[4], reserved[3]}, len = reserved[5]. A zero length ends the list.
+#define SQE_FLAG_SGE_INLINE 0x0001
+#define SQE_RSVD_SG1_ADDR_HI 0
+#define SQE_RSVD_SG1_LEN     1
+#define SQE_RSVD_SG2_ADDR_LO 3
+#define SQE_RSVD_SG2_ADDR_HI 4
+#define SQE_RSVD_SG2_LEN     5
+
+// 2D / strided transfer (flags bit 1, takes precedence over SGE_INLINE): length_lo is the
+// row length, length_hi the row count, reserved[0]/[1] the source/destination row pitch.
+// Every row goes out as its own packet(s) addressed to remote_key + row * dst_pitch.
+#define SQE_FLAG_STRIDED     0x0002
+#define SQE_RSVD_SRC_STRIDE  0
+#define SQE_RSVD_DST_STRIDE  1
+
+// RDMA READ (opcode 0x0C): local_key is the sink buffer, remote_key the remote source VA,
+// reserved[2] the remote rkey and word 14 (reserved[6]) the rkey of the local sink region.
+// The CQE is written once the last READ response has landed.
+#define RDMA_OPCODE_READ     0x0C
+#define SQE_RSVD_SINK_RKEY   6
+
+// SEND (opcode 0x04): the receiver picks the destination from its posted receive queue
+// (selected by dest QPN[1:0]); remote_key and the rkey are ignored.
+#define RDMA_OPCODE_SEND     0x04
+
+// WRITE_WITH_IMM (opcode 0x0B): a WRITE whose immediate (word 15, reserved[7]) is reported
+// in the receiver's RX completion once the whole message has landed.
+#define RDMA_OPCODE_WRITE_IMM 0x0B
+#define SQE_RSVD_IMM          7
+
+// Remote atomics on one 8-byte aligned word at remote_key (reserved[2] = rkey, needs remote
+// atomic access). Swap value / addend = {reserved[0], length_hi}, compare = {reserved[4],
+// reserved[3]}; length_lo and local_key are ignored. The CQE reports the original value.
+#define RDMA_OPCODE_CMP_SWAP  0x13
+#define RDMA_OPCODE_FETCH_ADD 0x14
+#define SQE_RSVD_ATOMIC_OP_HI  0
+#define SQE_RSVD_ATOMIC_CMP_LO 3
+#define SQE_RSVD_ATOMIC_CMP_HI 4
+
+// Local-only WQEs, nothing goes on the wire. LOCAL_COPY moves length_lo bytes from local_key
+// to remote_key (a local DDR address here). LOCAL_FILL writes the 32-bit pattern in word 15
+// (reserved[7], 0 = zero fill) over remote_key. Both complete into the normal CQ and can
+// replace the CPU staging / clear loops below once the engine is enabled.
+#define RDMA_OPCODE_LOCAL_COPY 0x20
+#define RDMA_OPCODE_LOCAL_FILL 0x21
+#define SQE_RSVD_FILL_PATTERN  7
+
+// Reliable delivery (RETRY_TIMEOUT != 0): WRITE / WRITE_IMM / SEND are ACKed by the receiver
+// (opcode 0x11, needs PSN checking enabled there) and resent Go-Back-N on NAK or timeout.
+#define RDMA_OPCODE_ACK        0x11
+#define CQE_STATUS_RETRY_EXC   1
+#define CQE_STATUS_REM_ACC_ERR 2
+
+// CONTROL[9]: CNPs (opcode 0x81) from a congested receiver cut the RATE_CFG rate of their QP
+#define CTRL_CC_ENABLE         (1U << 9)
+#define RDMA_OPCODE_CNP        0x81
+
+// Traffic classes: SQE flags[15:12] = SL, mapped to a class by TC_MAP. The TX streamer may
+// switch to a job of another class between two fragments; CONTROL[10] selects WRR with
+// TC_WEIGHT fragments per turn instead of strict priority. CQEs can then come out of SQ order;
+// SQ_HEAD still only moves past the oldest WQE once its CQE is written.
+#define SQE_FLAG_SL_SHIFT      12
+#define SQE_FLAG_SL(sl)        (((sl) & 0xFU) << SQE_FLAG_SL_SHIFT)
+#define CTRL_TC_WRR            (1U << 10)
+
+// QP context table: with SQE_FLAG_QP_CTX the WQE's peer IP, UDP ports, remote QPN and SL come
+// from the entry of handle flags[11:4]. An invalid entry falls back to the build-time defaults.
+#define SQE_FLAG_QP_CTX        0x0004
+#define SQE_FLAG_QP(h)         (((h) & 0xFFU) << 4)
+#define QP_CTX_WORD_IP         0
+#define QP_CTX_WORD_PORTS      1  // [31:16] UDP source port, [15:0] UDP destination port
+#define QP_CTX_WORD_QP         2  // [31] valid, [27:24] SL, [23:0] remote QPN
+#define QP_CTX_WORD_NEXT       3  // [31] valid, [7:0] next multicast group member
+#define QP_CTX_VALID           (1U << 31)
+
+// Multicast: with SQE_FLAG_QP_CTX | SQE_FLAG_MCAST the WQE goes to handle flags[11:4] and up to
+// three further members linked through QP_CTX_WORD_NEXT. Each fragment is read from DDR once.
+// WRITE / WRITE_IMM / SEND only, same remote VA / rkey for all members, no ACKs / retransmission.
+#define SQE_FLAG_MCAST         0x0008
+#define MCAST_MAX_MEMBERS      4
+
+// Link aggregation: CONTROL[12:11] picks the Ethernet link of each frame. Mode 2 keeps a QP on
+// one link when its context gives it its own UDP source port (needed with PSN checking).
+// Mode 1 alternates plain WRITE packets between the links; other opcodes follow mode 2.
+#define CTRL_LINK_MODE_SHIFT   11
+#define CTRL_LINK_MODE(m)      (((m) & 0x3U) << CTRL_LINK_MODE_SHIFT)
+#define LINK_MODE_LINK0        0
+#define LINK_MODE_RR           1
+#define LINK_MODE_FLOW         2
+#define LINK_MODE_LINK1        3
+
 // CQ Entry structure (32 bytes)
 typedef struct {
     uint32_t wqe_id;          // Word 0: SQ index that completed
@@ -76,8 +196,8 @@ typedef struct {
     uint32_t bytes_sent_hi;   // Word 3: Bytes transferred (upper 32 bits)
     uint32_t original_id;     // Word 4: Original WQE ID
     uint32_t original_length; // Word 5: Original requested length
-    uint32_t reserved1;       // Word 6: Reserved
-    uint32_t reserved2;       // Word 7: Reserved
+    uint32_t atomic_orig_lo;  // Word 6: Atomic WQE: original value (lower 32 bits)
+    uint32_t atomic_orig_hi;  // Word 7: Atomic WQE: original value (upper 32 bits)
 } cq_entry_t;
 
 void print_sq_entry(uint32_t idx, volatile sq_entry_t *entry) {
@@ -104,6 +224,59 @@ void print_cq_entry(uint32_t idx, volatile cq_entry_t *entry) {
     xil_printf("  Original Length: %u bytes\n", entry->original_length);
 }
 
+static void WriteEndpoint(u32 entry, u32 ip, u32 mac_h, u32 mac_l)
+{
+    // Clear valid first so the hardware never sees a half-written entry
+    Xil_Out32(EP_ENTRY_ADDR(entry) + EP_OFF_MAC_H, 0);
+    Xil_Out32(EP_ENTRY_ADDR(entry) + EP_OFF_MAC_L, mac_l);
+    Xil_Out32(EP_ENTRY_ADDR(entry) + EP_OFF_IP, ip);
+    Xil_Out32(EP_ENTRY_ADDR(entry) + EP_OFF_MAC_H, EP_VALID | (mac_h & 0xFFFFU));
+}
+
+// Returns the entry used, or -1 if both ways of the bucket hold other peers
+static int AddPeer(u32 ip, u32 mac_h, u32 mac_l)
+{
+    u32 bucket = EP_HASH(ip);
+
+    for (u32 way = 0; way < 2; way++) {
+        u32 entry = bucket * 2 + way;
+        if (entry == 0) {
+            continue; // local endpoint
+        }
+        u32 hi = Xil_In32(EP_ENTRY_ADDR(entry) + EP_OFF_MAC_H);
+        if (!(hi & EP_VALID) || Xil_In32(EP_ENTRY_ADDR(entry) + EP_OFF_IP) == ip) {
+            WriteEndpoint(entry, ip, mac_h, mac_l);
+            return (int)entry;
+        }
+    }
+    return -1;
+}
+
+void SetQpContext(u32 handle, u32 peer_ip, u16 src_port, u16 dst_port, u32 remote_qpn, u32 sl)
+{
+    // Valid word last, so the entry is only used once complete
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), 0);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handle << 2) | QP_CTX_WORD_QP);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), peer_ip);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handle << 2) | QP_CTX_WORD_IP);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), ((u32)src_port << 16) | dst_port);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handle << 2) | QP_CTX_WORD_PORTS);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), 0);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handle << 2) | QP_CTX_WORD_NEXT);
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), QP_CTX_VALID | ((sl & 0xFU) << 24) | (remote_qpn & 0xFFFFFFU));
+    Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handle << 2) | QP_CTX_WORD_QP);
+}
+
+// Chains existing QP contexts into a multicast group headed by handles[0]
+void SetMcastGroup(const u32 *handles, u32 count)
+{
+    for (u32 m = 0; m < count; m++) {
+        u32 next = (m + 1 < count) ? (QP_CTX_VALID | (handles[m + 1] & 0xFFU)) : 0;
+        Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_DATA), next);
+        Xil_Out32(REG_ADDR(REG_IDX_QP_CTX_ADDR), (handles[m] << 2) | QP_CTX_WORD_NEXT);
+    }
+}
+
 void SetupMacAddress(){
     u32 src_mac_l = 0x35010203;
     u32 src_mac_h = 0x0000000A;
@@ -111,24 +284,52 @@ void SetupMacAddress(){
     u32 dst_mac_l = 0x2915372C;
     u32 dst_mac_h = 0x0000000C;
 
-    xil_printf("Writing mac addresses to 0x%08x \r\n", BRAM_BASE_ADDR);
+    xil_printf("Writing endpoint table to 0x%08x \r\n", BRAM_BASE_ADDR);
+
+    for (u32 e = 0; e < 512; e++) {
+        Xil_Out32(EP_ENTRY_ADDR(e) + EP_OFF_MAC_H, 0);
+    }
 
-    Xil_Out32(BRAM_BASE_ADDR+OFFSET_SRC_MAC_L , src_mac_l);
-    Xil_Out32(BRAM_BASE_ADDR+OFFSET_SRC_MAC_H , src_mac_h);
-    Xil_Out32(BRAM_BASE_ADDR+OFFSET_DST_MAC_L , dst_mac_l);
-    Xil_Out32(BRAM_BASE_ADDR+OFFSET_DST_MAC_H , dst_mac_h);
+    WriteEndpoint(0, 0xAC1F09CA, src_mac_h, src_mac_l);  // local, 172.31.9.202
+    int entry = AddPeer(0xAC1F09C9, dst_mac_h, dst_mac_l); // peer, 172.31.9.201
 
     xil_printf("mac config complete \r\n");
     
-    u32 check_src = Xil_In32(BRAM_BASE_ADDR + OFFSET_SRC_MAC_L);
+    u32 check_src = Xil_In32(BRAM_BASE_ADDR + EP_OFF_MAC_L);
 
-    if(check_src != src_mac_l){
+    if(check_src != src_mac_l || entry < 0){
         xil_printf("Error, bram write failed. Read: 0x%08x\r\n", check_src);
     } else {
         xil_printf("bram write success \r\n");
     }
 }
 
+static XAxiEthernet EthInst;
+
+// Honour PAUSE frames from the receiver: with flow control enabled the MAC stops
+// taking frames from the TX FIFO for the requested time instead of overrunning
+// the receiver's RX FIFO. Other options keep their hardware defaults.
+int SetupMacFlowControl(void)
+{
+    XAxiEthernet_Config *cfg = XAxiEthernet_LookupConfig(ETH_DEV_ID);
+    if (!cfg) {
+        xil_printf("Error, MAC config lookup failed\r\n");
+        return XST_FAILURE;
+    }
+    if (XAxiEthernet_CfgInitialize(&EthInst, cfg, cfg->BaseAddress) != XST_SUCCESS) {
+        xil_printf("Error, MAC init failed\r\n");
+        return XST_FAILURE;
+    }
+
+    u32 options = XAxiEthernet_GetOptions(&EthInst);
+    options |= XAE_FLOW_CONTROL_OPTION | XAE_TRANSMITTER_ENABLE_OPTION | XAE_RECEIVER_ENABLE_OPTION;
+    XAxiEthernet_SetOptions(&EthInst, options);
+    XAxiEthernet_Start(&EthInst);
+
+    xil_printf("MAC flow control enabled, options = 0x%08x\r\n", (unsigned)options);
+    return XST_SUCCESS;
+}
+
 // static int configure_tx(u16 payload_len)
 // {
 //     /* Enable the encapsulator */
@@ -181,6 +382,8 @@ int main(void) {
     Xil_DCacheFlushRange((UINTPTR)payload_buf, 4096*64*4);
     xil_printf("Payload prepared: pattern 0xDEADxxxx\n");
 
+    SetupMacFlowControl();
+
     // Configure IP registers
     xil_printf("\nConfiguring RDMA controller...\n");
     Xil_Out32(REG_ADDR(REG_IDX_SQ_BASE_LO), (uint32_t)(SQ_BUFFER_BASE & 0xFFFFFFFFU));
@@ -46,7 +46,7 @@ if { [string first $scripts_vivado_version $current_vivado_version] == -1 } {
 
 # The design that will be created by this Tcl script contains the following 
 # module references:
-# tx_header_inserter, tx_streamer, eth_pkt_gen, rdma_axilite_ctrl
+# tx_header_inserter, tx_streamer, tx_local_dma, eth_pkt_gen, rdma_axilite_ctrl, tx_link_stripe
 
 # Please add the sources of those modules before sourcing this Tcl script.
 
@@ -175,8 +175,10 @@ if { $bCheckModules == 1 } {
    set list_check_mods "\ 
 tx_header_inserter\
 tx_streamer\
+tx_local_dma\
 eth_pkt_gen\
 rdma_axilite_ctrl\
+tx_link_stripe\
 "
 
    set list_mods_missing ""
@@ -1328,6 +1330,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   # Create instance: axi_datamover_0, and set properties
   set axi_datamover_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_0 ]
   set_property -dict [list \
+    CONFIG.c_addr_width {64} \
     CONFIG.c_dummy {1} \
     CONFIG.c_enable_mm2s_adv_sig {1} \
     CONFIG.c_enable_s2mm_adv_sig {1} \
@@ -1367,9 +1370,32 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
      return 1
    }
   
+  # Create instance: tx_local_dma_0, and set properties
+  set block_name tx_local_dma
+  set block_cell_name tx_local_dma_0
+  if { [catch {set tx_local_dma_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_local_dma_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: tx_link_stripe_0, and set properties
+  set block_name tx_link_stripe
+  set block_cell_name tx_link_stripe_0
+  if { [catch {set tx_link_stripe_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2095 -severity "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $tx_link_stripe_0 eq "" } {
+     catch {common::send_gid_msg -ssname BD::TCL -id 2096 -severity "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
   # Create instance: axi_datamover_1, and set properties
   set axi_datamover_1 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_datamover:5.1 axi_datamover_1 ]
   set_property -dict [list \
+    CONFIG.c_addr_width {64} \
     CONFIG.c_dummy {1} \
     CONFIG.c_enable_mm2s_adv_sig {1} \
     CONFIG.c_enable_s2mm_adv_sig {1} \
@@ -1461,13 +1487,15 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_intf_net -intf_net axi_datamover_0_M_AXIS_MM2S [get_bd_intf_pins axi_datamover_0/M_AXIS_MM2S] [get_bd_intf_pins data_mover_controller_0/S00_AXIS]
   connect_bd_intf_net -intf_net axi_datamover_0_M_AXI_MM2S [get_bd_intf_pins axi_datamover_0/M_AXI_MM2S] [get_bd_intf_pins smartconnect_0/S01_AXI]
   connect_bd_intf_net -intf_net axi_datamover_0_M_AXI_S2MM [get_bd_intf_pins axi_datamover_0/M_AXI_S2MM] [get_bd_intf_pins smartconnect_0/S02_AXI]
-  connect_bd_intf_net -intf_net axi_datamover_1_M_AXIS_MM2S [get_bd_intf_pins axi_datamover_1/M_AXIS_MM2S] [get_bd_intf_pins tx_header_inserter_0/s_axis]
+  connect_bd_intf_net -intf_net axi_datamover_1_M_AXIS_MM2S [get_bd_intf_pins axi_datamover_1/M_AXIS_MM2S] [get_bd_intf_pins tx_local_dma_0/s_axis]
+  connect_bd_intf_net -intf_net tx_local_dma_0_m_axis_hdr [get_bd_intf_pins tx_local_dma_0/m_axis_hdr] [get_bd_intf_pins tx_header_inserter_0/s_axis]
+  connect_bd_intf_net -intf_net tx_local_dma_0_m_axis_s2mm [get_bd_intf_pins tx_local_dma_0/m_axis_s2mm] [get_bd_intf_pins axi_datamover_1/S_AXIS_S2MM]
   connect_bd_intf_net -intf_net axi_datamover_1_M_AXI_MM2S [get_bd_intf_pins smartconnect_1/S00_AXI] [get_bd_intf_pins axi_datamover_1/M_AXI_MM2S]
   connect_bd_intf_net -intf_net axi_datamover_1_M_AXI_S2MM [get_bd_intf_pins smartconnect_1/S01_AXI] [get_bd_intf_pins axi_datamover_1/M_AXI_S2MM]
   connect_bd_intf_net -intf_net axi_ethernet_1_mdio [get_bd_intf_ports som240_2_connector_pl_gem3_rgmii_mdio_mdc] [get_bd_intf_pins axi_ethernet_1/mdio]
   connect_bd_intf_net -intf_net axi_ethernet_1_rgmii [get_bd_intf_ports som240_2_connector_pl_gem3_rgmii] [get_bd_intf_pins axi_ethernet_1/rgmii]
   connect_bd_intf_net -intf_net axi_interconnect_0_M00_AXI [get_bd_intf_pins axi_interconnect_0/M00_AXI] [get_bd_intf_pins axi_ethernet_1/s_axi]
-  connect_bd_intf_net -intf_net axis_data_fifo_1_M_AXIS [get_bd_intf_pins axis_data_fifo_1/M_AXIS] [get_bd_intf_pins eth_pkt_gen_0/s_axis]
+  connect_bd_intf_net -intf_net axis_data_fifo_1_M_AXIS [get_bd_intf_pins axis_data_fifo_1/M_AXIS] [get_bd_intf_pins tx_link_stripe_0/s_axis]
   connect_bd_intf_net -intf_net eth_pkt_gen_0_m_axis [get_bd_intf_pins eth_pkt_gen_0/m_axis] [get_bd_intf_pins axi_ethernet_1/s_axis_txd]
   connect_bd_intf_net -intf_net rdma_axilite_ctrl_0_m_axis_packet [get_bd_intf_pins rdma_axilite_ctrl_0/m_axis_packet] [get_bd_intf_pins axis_data_fifo_1/S_AXIS]
   connect_bd_intf_net -intf_net smartconnect_0_M00_AXI [get_bd_intf_pins smartconnect_0/M00_AXI] [get_bd_intf_pins axi_bram_ctrl_0/S_AXI]
@@ -1475,6 +1503,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_intf_net -intf_net smartconnect_0_M02_AXI [get_bd_intf_pins smartconnect_0/M02_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/S_AXI_HPC0_FPD]
   connect_bd_intf_net -intf_net smartconnect_1_M00_AXI [get_bd_intf_pins smartconnect_1/M00_AXI] [get_bd_intf_pins zynq_ultra_ps_e_0/S_AXI_HPC1_FPD]
   connect_bd_intf_net -intf_net tx_header_inserter_0_m_axis [get_bd_intf_pins tx_header_inserter_0/m_axis] [get_bd_intf_pins rdma_axilite_ctrl_0/s_axis_payload]
+  connect_bd_intf_net -intf_net tx_link_stripe_0_m0_axis [get_bd_intf_pins tx_link_stripe_0/m0_axis] [get_bd_intf_pins eth_pkt_gen_0/s_axis]
   connect_bd_intf_net -intf_net zynq_ultra_ps_e_0_M_AXI_HPM0_FPD [get_bd_intf_pins zynq_ultra_ps_e_0/M_AXI_HPM0_FPD] [get_bd_intf_pins smartconnect_0/S00_AXI]
 
   # Create port connections
@@ -1494,12 +1523,39 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_net -net data_mover_controller_0_m_axis_mm2s_cmd_tvalid [get_bd_pins data_mover_controller_0/m_axis_mm2s_cmd_tvalid] [get_bd_pins axi_datamover_0/s_axis_mm2s_cmd_tvalid]
   connect_bd_net -net data_mover_controller_0_m_axis_s2mm_cmd_tdata [get_bd_pins data_mover_controller_0/m_axis_s2mm_cmd_tdata] [get_bd_pins axi_datamover_0/s_axis_s2mm_cmd_tdata]
   connect_bd_net -net data_mover_controller_0_m_axis_s2mm_cmd_tvalid [get_bd_pins data_mover_controller_0/m_axis_s2mm_cmd_tvalid] [get_bd_pins axi_datamover_0/s_axis_s2mm_cmd_tvalid]
+  connect_bd_net -net data_mover_controller_0_tc_map [get_bd_pins data_mover_controller_0/tc_map] [get_bd_pins tx_streamer_0/tc_map]
+  connect_bd_net -net data_mover_controller_0_tc_weight [get_bd_pins data_mover_controller_0/tc_weight] [get_bd_pins tx_streamer_0/tc_weight]
+  connect_bd_net -net data_mover_controller_0_link_mode [get_bd_pins data_mover_controller_0/link_mode] [get_bd_pins tx_link_stripe_0/link_mode]
+  connect_bd_net -net data_mover_controller_0_tc_wrr [get_bd_pins data_mover_controller_0/tc_wrr] [get_bd_pins tx_streamer_0/tc_wrr]
   connect_bd_net -net data_mover_controller_0_tx_cmd_ddr_addr [get_bd_pins data_mover_controller_0/tx_cmd_ddr_addr] [get_bd_pins tx_streamer_0/tx_cmd_ddr_addr]
   connect_bd_net -net data_mover_controller_0_tx_cmd_dest_qp [get_bd_pins data_mover_controller_0/tx_cmd_dest_qp] [get_bd_pins tx_streamer_0/tx_cmd_dest_qp]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_qp_handle [get_bd_pins data_mover_controller_0/tx_cmd_qp_handle] [get_bd_pins tx_streamer_0/tx_cmd_qp_handle]
   connect_bd_net -net data_mover_controller_0_tx_cmd_length [get_bd_pins data_mover_controller_0/tx_cmd_length] [get_bd_pins tx_streamer_0/tx_cmd_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg1_addr [get_bd_pins data_mover_controller_0/tx_cmd_sg1_addr] [get_bd_pins tx_streamer_0/tx_cmd_sg1_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg1_length [get_bd_pins data_mover_controller_0/tx_cmd_sg1_length] [get_bd_pins tx_streamer_0/tx_cmd_sg1_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg2_addr [get_bd_pins data_mover_controller_0/tx_cmd_sg2_addr] [get_bd_pins tx_streamer_0/tx_cmd_sg2_addr]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_sg2_length [get_bd_pins data_mover_controller_0/tx_cmd_sg2_length] [get_bd_pins tx_streamer_0/tx_cmd_sg2_length]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_row_count [get_bd_pins data_mover_controller_0/tx_cmd_row_count] [get_bd_pins tx_streamer_0/tx_cmd_row_count]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_src_stride [get_bd_pins data_mover_controller_0/tx_cmd_src_stride] [get_bd_pins tx_streamer_0/tx_cmd_src_stride]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_dst_stride [get_bd_pins data_mover_controller_0/tx_cmd_dst_stride] [get_bd_pins tx_streamer_0/tx_cmd_dst_stride]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_local_rkey [get_bd_pins data_mover_controller_0/tx_cmd_local_rkey] [get_bd_pins tx_streamer_0/tx_cmd_local_rkey]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_imm [get_bd_pins data_mover_controller_0/tx_cmd_imm] [get_bd_pins tx_streamer_0/tx_cmd_imm]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_atomic_swap_add [get_bd_pins data_mover_controller_0/tx_cmd_atomic_swap_add] [get_bd_pins tx_streamer_0/tx_cmd_atomic_swap_add]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_atomic_compare [get_bd_pins data_mover_controller_0/tx_cmd_atomic_compare] [get_bd_pins tx_streamer_0/tx_cmd_atomic_compare]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_dst_ip [get_bd_pins data_mover_controller_0/tx_cmd_dst_ip] [get_bd_pins tx_streamer_0/tx_cmd_dst_ip]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_udp_ports [get_bd_pins data_mover_controller_0/tx_cmd_udp_ports] [get_bd_pins tx_streamer_0/tx_cmd_udp_ports]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_count [get_bd_pins data_mover_controller_0/tx_cmd_mc_count] [get_bd_pins tx_streamer_0/tx_cmd_mc_count]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_dest_qp [get_bd_pins data_mover_controller_0/tx_cmd_mc_dest_qp] [get_bd_pins tx_streamer_0/tx_cmd_mc_dest_qp]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_qp_handle [get_bd_pins data_mover_controller_0/tx_cmd_mc_qp_handle] [get_bd_pins tx_streamer_0/tx_cmd_mc_qp_handle]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_dst_ip [get_bd_pins data_mover_controller_0/tx_cmd_mc_dst_ip] [get_bd_pins tx_streamer_0/tx_cmd_mc_dst_ip]
+  connect_bd_net -net data_mover_controller_0_tx_cmd_mc_udp_ports [get_bd_pins data_mover_controller_0/tx_cmd_mc_udp_ports] [get_bd_pins tx_streamer_0/tx_cmd_mc_udp_ports]
   connect_bd_net -net data_mover_controller_0_tx_cmd_opcode [get_bd_pins data_mover_controller_0/tx_cmd_opcode] [get_bd_pins tx_streamer_0/tx_cmd_opcode]
   connect_bd_net -net data_mover_controller_0_tx_cmd_partition_key [get_bd_pins data_mover_controller_0/tx_cmd_partition_key] [get_bd_pins tx_streamer_0/tx_cmd_partition_key]
-  connect_bd_net -net data_mover_controller_0_tx_cmd_psn [get_bd_pins data_mover_controller_0/tx_cmd_psn] [get_bd_pins tx_streamer_0/tx_cmd_psn]
+  connect_bd_net -net data_mover_controller_0_cc_enable [get_bd_pins data_mover_controller_0/cc_enable] [get_bd_pins tx_streamer_0/cc_enable]
+  connect_bd_net -net data_mover_controller_0_rate_cfg [get_bd_pins data_mover_controller_0/rate_cfg] [get_bd_pins tx_streamer_0/rate_cfg]
+  connect_bd_net -net data_mover_controller_0_rate_cfg_wr [get_bd_pins data_mover_controller_0/rate_cfg_wr] [get_bd_pins tx_streamer_0/rate_cfg_wr]
+  connect_bd_net -net data_mover_controller_0_retry_limit [get_bd_pins data_mover_controller_0/retry_limit] [get_bd_pins tx_streamer_0/retry_limit]
+  connect_bd_net -net data_mover_controller_0_retry_timeout [get_bd_pins data_mover_controller_0/retry_timeout] [get_bd_pins tx_streamer_0/retry_timeout]
   connect_bd_net -net data_mover_controller_0_tx_cmd_remote_addr [get_bd_pins data_mover_controller_0/tx_cmd_remote_addr] [get_bd_pins tx_streamer_0/tx_cmd_remote_addr]
   connect_bd_net -net data_mover_controller_0_tx_cmd_rkey [get_bd_pins data_mover_controller_0/tx_cmd_rkey] [get_bd_pins tx_streamer_0/tx_cmd_rkey]
   connect_bd_net -net data_mover_controller_0_tx_cmd_service_level [get_bd_pins data_mover_controller_0/tx_cmd_service_level] [get_bd_pins tx_streamer_0/tx_cmd_service_level]
@@ -1511,15 +1567,28 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_net -net eth_pkt_gen_0_m_axis_txc_last [get_bd_pins eth_pkt_gen_0/m_axis_txc_last] [get_bd_pins axi_ethernet_1/s_axis_txc_tlast]
   connect_bd_net -net eth_pkt_gen_0_m_axis_txc_valid [get_bd_pins eth_pkt_gen_0/m_axis_txc_valid] [get_bd_pins axi_ethernet_1/s_axis_txc_tvalid]
   connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn [get_bd_pins rst_ps8_0_99M/interconnect_aresetn] [get_bd_pins axi_bram_ctrl_0/s_axi_aresetn] [get_bd_pins smartconnect_0/aresetn]
-  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn1 [get_bd_pins rst_ps8_0_99M/peripheral_aresetn] [get_bd_pins axi_datamover_0/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_0/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins smartconnect_1/aresetn] [get_bd_pins data_mover_controller_0/s00_axi_aresetn] [get_bd_pins data_mover_controller_0/s00_axis_aresetn] [get_bd_pins data_mover_controller_0/m00_axis_aresetn] [get_bd_pins axi_interconnect_0/ARESETN] [get_bd_pins axi_interconnect_0/M00_ARESETN] [get_bd_pins axi_interconnect_0/S00_ARESETN] [get_bd_pins axi_ethernet_1/s_axi_lite_resetn] [get_bd_pins axi_ethernet_1/axi_txd_arstn] [get_bd_pins axi_ethernet_1/axi_txc_arstn] [get_bd_pins axi_ethernet_1/axi_rxd_arstn] [get_bd_pins axi_ethernet_1/axi_rxs_arstn] [get_bd_pins eth_pkt_gen_0/aresetn] [get_bd_pins tx_header_inserter_0/aresetn] [get_bd_pins rdma_axilite_ctrl_0/rst_n] [get_bd_pins axis_data_fifo_1/s_axis_aresetn] [get_bd_pins tx_streamer_0/aresetn]
+  connect_bd_net -net rst_ps8_0_99M_peripheral_aresetn1 [get_bd_pins rst_ps8_0_99M/peripheral_aresetn] [get_bd_pins axi_datamover_0/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_0/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_mm2s_aresetn] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aresetn] [get_bd_pins axi_datamover_1/m_axi_s2mm_aresetn] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_aresetn] [get_bd_pins smartconnect_1/aresetn] [get_bd_pins data_mover_controller_0/s00_axi_aresetn] [get_bd_pins data_mover_controller_0/s00_axis_aresetn] [get_bd_pins data_mover_controller_0/m00_axis_aresetn] [get_bd_pins axi_interconnect_0/ARESETN] [get_bd_pins axi_interconnect_0/M00_ARESETN] [get_bd_pins axi_interconnect_0/S00_ARESETN] [get_bd_pins axi_ethernet_1/s_axi_lite_resetn] [get_bd_pins axi_ethernet_1/axi_txd_arstn] [get_bd_pins axi_ethernet_1/axi_txc_arstn] [get_bd_pins axi_ethernet_1/axi_rxd_arstn] [get_bd_pins axi_ethernet_1/axi_rxs_arstn] [get_bd_pins eth_pkt_gen_0/aresetn] [get_bd_pins tx_header_inserter_0/aresetn] [get_bd_pins rdma_axilite_ctrl_0/rst_n] [get_bd_pins axis_data_fifo_1/s_axis_aresetn] [get_bd_pins tx_streamer_0/aresetn] [get_bd_pins tx_local_dma_0/aresetn] [get_bd_pins tx_link_stripe_0/aresetn]
   connect_bd_net -net som240_1_connector_hpa_clk0p_clk_1 [get_bd_ports som240_1_connector_hpa_clk0p_clk] [get_bd_pins axi_ethernet_0_refclk/clk_in1]
   connect_bd_net -net tx_header_inserter_0_rdma_sodir_length [get_bd_pins tx_header_inserter_0/rdma_sodir_length] [get_bd_pins rdma_axilite_ctrl_0/rdma_length]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_addr [get_bd_pins rdma_axilite_ctrl_0/bram_addr] [get_bd_pins blk_mem_gen_0/addrb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_din [get_bd_pins rdma_axilite_ctrl_0/bram_din] [get_bd_pins blk_mem_gen_0/dinb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_en [get_bd_pins rdma_axilite_ctrl_0/bram_en] [get_bd_pins blk_mem_gen_0/enb]
+  connect_bd_net -net rdma_axilite_ctrl_0_bram_we [get_bd_pins rdma_axilite_ctrl_0/bram_we] [get_bd_pins blk_mem_gen_0/web]
+  connect_bd_net -net blk_mem_gen_0_doutb [get_bd_pins blk_mem_gen_0/doutb] [get_bd_pins rdma_axilite_ctrl_0/bram_dout]
   connect_bd_net -net tx_header_inserter_0_start [get_bd_pins tx_header_inserter_0/start] [get_bd_pins rdma_axilite_ctrl_0/start]
   connect_bd_net -net tx_header_inserter_0_tx_busy [get_bd_pins tx_header_inserter_0/tx_busy] [get_bd_pins tx_streamer_0/hdr_tx_busy]
   connect_bd_net -net tx_header_inserter_0_tx_done [get_bd_pins tx_header_inserter_0/tx_done] [get_bd_pins tx_streamer_0/hdr_tx_done]
   connect_bd_net -net tx_streamer_0_hdr_fragment_id [get_bd_pins tx_streamer_0/hdr_fragment_id] [get_bd_pins tx_header_inserter_0/fragment_id]
   connect_bd_net -net tx_streamer_0_hdr_fragment_offset [get_bd_pins tx_streamer_0/hdr_fragment_offset] [get_bd_pins tx_header_inserter_0/fragment_offset]
   connect_bd_net -net tx_streamer_0_hdr_more_fragments [get_bd_pins tx_streamer_0/hdr_more_fragments] [get_bd_pins tx_header_inserter_0/more_fragments]
+  connect_bd_net -net tx_streamer_0_hdr_header_only [get_bd_pins tx_streamer_0/hdr_header_only] [get_bd_pins tx_header_inserter_0/header_only]
+  connect_bd_net -net tx_streamer_0_hdr_read_sink_addr [get_bd_pins tx_streamer_0/hdr_read_sink_addr] [get_bd_pins tx_header_inserter_0/read_sink_addr]
+  connect_bd_net -net tx_streamer_0_hdr_read_sink_rkey [get_bd_pins tx_streamer_0/hdr_read_sink_rkey] [get_bd_pins tx_header_inserter_0/read_sink_rkey]
+  connect_bd_net -net tx_streamer_0_hdr_imm [get_bd_pins tx_streamer_0/hdr_imm] [get_bd_pins tx_header_inserter_0/rdma_imm]
+  connect_bd_net -net tx_streamer_0_hdr_atomic_data [get_bd_pins tx_streamer_0/hdr_atomic_data] [get_bd_pins tx_header_inserter_0/atomic_data]
+  connect_bd_net -net tx_streamer_0_hdr_atomic_compare [get_bd_pins tx_streamer_0/hdr_atomic_compare] [get_bd_pins tx_header_inserter_0/atomic_compare]
+  connect_bd_net -net tx_streamer_0_hdr_dst_ip [get_bd_pins tx_streamer_0/hdr_dst_ip] [get_bd_pins rdma_axilite_ctrl_0/dst_ip]
+  connect_bd_net -net tx_streamer_0_hdr_udp_ports [get_bd_pins tx_streamer_0/hdr_udp_ports] [get_bd_pins rdma_axilite_ctrl_0/udp_ports]
   connect_bd_net -net tx_streamer_0_hdr_rdma_dest_qp [get_bd_pins tx_streamer_0/hdr_rdma_dest_qp] [get_bd_pins tx_header_inserter_0/rdma_dest_qp]
   connect_bd_net -net tx_streamer_0_hdr_rdma_length [get_bd_pins tx_streamer_0/hdr_rdma_length] [get_bd_pins tx_header_inserter_0/rdma_length]
   connect_bd_net -net tx_streamer_0_hdr_rdma_opcode [get_bd_pins tx_streamer_0/hdr_rdma_opcode] [get_bd_pins tx_header_inserter_0/rdma_opcode]
@@ -1531,8 +1600,18 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_net -net tx_streamer_0_hdr_start_tx [get_bd_pins tx_streamer_0/hdr_start_tx] [get_bd_pins tx_header_inserter_0/start_tx]
   connect_bd_net -net tx_streamer_0_m_axis_mm2s_cmd_tdata [get_bd_pins tx_streamer_0/m_axis_mm2s_cmd_tdata] [get_bd_pins axi_datamover_1/s_axis_mm2s_cmd_tdata]
   connect_bd_net -net tx_streamer_0_m_axis_mm2s_cmd_tvalid [get_bd_pins tx_streamer_0/m_axis_mm2s_cmd_tvalid] [get_bd_pins axi_datamover_1/s_axis_mm2s_cmd_tvalid]
+  connect_bd_net -net tx_streamer_0_m_axis_s2mm_cmd_tdata [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tdata] [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tdata]
+  connect_bd_net -net tx_streamer_0_m_axis_s2mm_cmd_tvalid [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tvalid] [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tvalid]
+  connect_bd_net -net axi_datamover_1_s_axis_s2mm_cmd_tready [get_bd_pins axi_datamover_1/s_axis_s2mm_cmd_tready] [get_bd_pins tx_streamer_0/m_axis_s2mm_cmd_tready]
+  connect_bd_net -net axi_datamover_1_s2mm_wr_xfer_cmplt [get_bd_pins axi_datamover_1/s2mm_wr_xfer_cmplt] [get_bd_pins tx_streamer_0/s2mm_wr_xfer_cmplt]
+  connect_bd_net -net tx_streamer_0_local_copy_en [get_bd_pins tx_streamer_0/local_copy_en] [get_bd_pins tx_local_dma_0/copy_en]
+  connect_bd_net -net tx_streamer_0_local_fill_start [get_bd_pins tx_streamer_0/local_fill_start] [get_bd_pins tx_local_dma_0/fill_start]
+  connect_bd_net -net tx_streamer_0_mc_replay_start [get_bd_pins tx_streamer_0/mc_replay_start] [get_bd_pins tx_local_dma_0/replay_start]
+  connect_bd_net -net tx_streamer_0_local_fill_len [get_bd_pins tx_streamer_0/local_fill_len] [get_bd_pins tx_local_dma_0/fill_len]
+  connect_bd_net -net tx_streamer_0_local_fill_pattern [get_bd_pins tx_streamer_0/local_fill_pattern] [get_bd_pins tx_local_dma_0/fill_pattern]
   connect_bd_net -net tx_streamer_0_tx_cmd_ready [get_bd_pins tx_streamer_0/tx_cmd_ready] [get_bd_pins data_mover_controller_0/tx_cmd_ready]
   connect_bd_net -net tx_streamer_0_tx_cpl_bytes_sent [get_bd_pins tx_streamer_0/tx_cpl_bytes_sent] [get_bd_pins data_mover_controller_0/tx_cpl_bytes_sent]
+  connect_bd_net -net tx_streamer_0_tx_cpl_atomic_orig [get_bd_pins tx_streamer_0/tx_cpl_atomic_orig] [get_bd_pins data_mover_controller_0/tx_cpl_atomic_orig]
   connect_bd_net -net tx_streamer_0_tx_cpl_sq_index [get_bd_pins tx_streamer_0/tx_cpl_sq_index] [get_bd_pins data_mover_controller_0/tx_cpl_sq_index]
   connect_bd_net -net tx_streamer_0_tx_cpl_status [get_bd_pins tx_streamer_0/tx_cpl_status] [get_bd_pins data_mover_controller_0/tx_cpl_status]
   connect_bd_net -net tx_streamer_0_tx_cpl_valid [get_bd_pins tx_streamer_0/tx_cpl_valid] [get_bd_pins data_mover_controller_0/tx_cpl_valid]
@@ -1542,7 +1621,7 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   connect_bd_net -net xlconstant_3_dout [get_bd_pins xlconstant_3/dout] [get_bd_pins axi_datamover_1/s2mm_allow_addr_req]
   connect_bd_net -net xlconstant_4_dout [get_bd_pins xlconstant_4/dout] [get_bd_pins axi_datamover_1/mm2s_allow_addr_req]
   connect_bd_net -net xlconstant_5_dout [get_bd_pins xlconstant_5/dout] [get_bd_pins rdma_axilite_ctrl_0/enable]
-  connect_bd_net -net zynq_ultra_ps_e_0_pl_clk0 [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_fpd_aclk] [get_bd_pins rst_ps8_0_99M/slowest_sync_clk] [get_bd_pins axi_bram_ctrl_0/s_axi_aclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc0_fpd_aclk] [get_bd_pins smartconnect_0/aclk] [get_bd_pins axi_datamover_0/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_0/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_awclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc1_fpd_aclk] [get_bd_pins axi_datamover_1/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_1/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_awclk] [get_bd_pins smartconnect_1/aclk] [get_bd_pins data_mover_controller_0/s00_axi_aclk] [get_bd_pins data_mover_controller_0/s00_axis_aclk] [get_bd_pins data_mover_controller_0/m00_axis_aclk] [get_bd_pins blk_mem_gen_0/clkb] [get_bd_pins axi_ethernet_1/s_axi_lite_clk] [get_bd_pins axi_ethernet_1/axis_clk] [get_bd_pins axi_interconnect_0/ACLK] [get_bd_pins axi_interconnect_0/M00_ACLK] [get_bd_pins axi_interconnect_0/S00_ACLK] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_lpd_aclk] [get_bd_pins eth_pkt_gen_0/aclk] [get_bd_pins tx_header_inserter_0/aclk] [get_bd_pins rdma_axilite_ctrl_0/clk] [get_bd_pins axis_data_fifo_1/s_axis_aclk] [get_bd_pins tx_streamer_0/aclk]
+  connect_bd_net -net zynq_ultra_ps_e_0_pl_clk0 [get_bd_pins zynq_ultra_ps_e_0/pl_clk0] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_fpd_aclk] [get_bd_pins rst_ps8_0_99M/slowest_sync_clk] [get_bd_pins axi_bram_ctrl_0/s_axi_aclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc0_fpd_aclk] [get_bd_pins smartconnect_0/aclk] [get_bd_pins axi_datamover_0/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_0/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_0/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_0/m_axis_s2mm_cmdsts_awclk] [get_bd_pins zynq_ultra_ps_e_0/saxihpc1_fpd_aclk] [get_bd_pins axi_datamover_1/m_axi_mm2s_aclk] [get_bd_pins axi_datamover_1/m_axis_mm2s_cmdsts_aclk] [get_bd_pins axi_datamover_1/m_axi_s2mm_aclk] [get_bd_pins axi_datamover_1/m_axis_s2mm_cmdsts_awclk] [get_bd_pins smartconnect_1/aclk] [get_bd_pins data_mover_controller_0/s00_axi_aclk] [get_bd_pins data_mover_controller_0/s00_axis_aclk] [get_bd_pins data_mover_controller_0/m00_axis_aclk] [get_bd_pins blk_mem_gen_0/clkb] [get_bd_pins axi_ethernet_1/s_axi_lite_clk] [get_bd_pins axi_ethernet_1/axis_clk] [get_bd_pins axi_interconnect_0/ACLK] [get_bd_pins axi_interconnect_0/M00_ACLK] [get_bd_pins axi_interconnect_0/S00_ACLK] [get_bd_pins zynq_ultra_ps_e_0/maxihpm0_lpd_aclk] [get_bd_pins eth_pkt_gen_0/aclk] [get_bd_pins tx_header_inserter_0/aclk] [get_bd_pins rdma_axilite_ctrl_0/clk] [get_bd_pins axis_data_fifo_1/s_axis_aclk] [get_bd_pins tx_streamer_0/aclk] [get_bd_pins tx_local_dma_0/aclk] [get_bd_pins tx_link_stripe_0/aclk]
   connect_bd_net -net zynq_ultra_ps_e_0_pl_resetn0 [get_bd_pins zynq_ultra_ps_e_0/pl_resetn0] [get_bd_pins rst_ps8_0_99M/ext_reset_in]
 
   # Create address segments
@@ -1559,17 +1638,17 @@ Port;FD4A0000;FD4AFFFF;1|FPD;DPDMA;FD4C0000;FD4CFFFF;1|FPD;DDR_XMPU5_CFG;FD05000
   assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
   assign_bd_address -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_LOW] -force
   assign_bd_address -offset 0xC0000000 -range 0x20000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_QSPI] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
+  assign_bd_address -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH] -force
 
   # Exclude Address Segments
   exclude_bd_addr_seg -offset 0xA0000000 -range 0x00010000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs data_mover_controller_0/S00_AXI/S00_AXI_reg]
-  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH]
   exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_LPS_OCM]
   exclude_bd_addr_seg -offset 0xA0000000 -range 0x00010000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs data_mover_controller_0/S00_AXI/S00_AXI_reg]
-  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH]
   exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_0/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_LPS_OCM]
-  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH]
   exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_MM2S] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
-  exclude_bd_addr_seg -offset 0x000800000000 -range 0x000100000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_DDR_HIGH]
   exclude_bd_addr_seg -offset 0xFF000000 -range 0x01000000 -target_address_space [get_bd_addr_spaces axi_datamover_1/Data_S2MM] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP1/HPC1_LPS_OCM]
   exclude_bd_addr_seg -offset 0x000800000000 -range 0x000800000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_HIGH]
   exclude_bd_addr_seg -offset 0x00000000 -range 0x80000000 -target_address_space [get_bd_addr_spaces zynq_ultra_ps_e_0/Data] [get_bd_addr_segs zynq_ultra_ps_e_0/SAXIGP0/HPC0_DDR_LOW]
@@ -29,7 +29,7 @@
 
 		// Parameters of Axi Slave Bus Interface S00_AXI
 		parameter integer C_S00_AXI_DATA_WIDTH	= 32,
-		parameter integer C_S00_AXI_ADDR_WIDTH	= 7,
+		parameter integer C_S00_AXI_ADDR_WIDTH	= 8,
 
 		// Parameters of Axi Slave Bus Interface S00_AXIS
 		parameter integer C_S00_AXIS_TDATA_WIDTH	= 32,
@@ -86,10 +86,27 @@
 		output wire  m00_axis_tlast,
 		input wire  m00_axis_tready,
 
+		// Ports of Axi Slave Bus Interface S01_AXIS (WQEs pushed by PL kernels, 16 beats each)
+		// and Axi Master Bus Interface M01_AXIS (their CQEs, 8 beats each), on s00_axi_aclk
+		output wire  s01_axis_tready,
+		input wire [31:0] s01_axis_tdata,
+		input wire [3:0] s01_axis_tstrb,
+		input wire  s01_axis_tlast,
+		input wire  s01_axis_tvalid,
+		output wire  m01_axis_tvalid,
+		output wire [31:0] m01_axis_tdata,
+		output wire [3:0] m01_axis_tstrb,
+		output wire  m01_axis_tlast,
+		input wire  m01_axis_tready,
+
+		// Streaming ring producer index from a PL producer (same effect as a STRM_PROD write)
+		input wire  strm_prod_wr,
+		input wire [31:0] strm_prod,
+
 		// Ports of AXI MM2S and S2MM CMD Master interface for DATA MOVER
-		output wire [71:0]	m_axis_mm2s_cmd_tdata,
+		output wire [103:0]	m_axis_mm2s_cmd_tdata,
 		output wire m_axis_mm2s_cmd_tvalid,
-		output wire [71:0]	m_axis_s2mm_cmd_tdata,
+		output wire [103:0]	m_axis_s2mm_cmd_tdata,
 		output wire m_axis_s2mm_cmd_tvalid,
 		input wire s2mm_wr_xfer_cmplt,
 		input wire mm2s_rd_xfer_cmplt,
@@ -99,22 +116,58 @@
 		output wire                     tx_cmd_valid,
 		input  wire                     tx_cmd_ready,
 		output wire [7:0]               tx_cmd_sq_index,
-		output wire [31:0]              tx_cmd_ddr_addr,
+		output wire [63:0]              tx_cmd_ddr_addr,
 		output wire [31:0]              tx_cmd_length,
+		output wire [63:0]              tx_cmd_sg1_addr,
+		output wire [31:0]              tx_cmd_sg1_length,
+		output wire [63:0]              tx_cmd_sg2_addr,
+		output wire [31:0]              tx_cmd_sg2_length,
+		output wire [15:0]              tx_cmd_row_count,
+		output wire [31:0]              tx_cmd_src_stride,
+		output wire [31:0]              tx_cmd_dst_stride,
+		output wire [31:0]              tx_cmd_local_rkey,
+		output wire [31:0]              tx_cmd_imm,
+		output wire [63:0]              tx_cmd_atomic_swap_add,
+		output wire [63:0]              tx_cmd_atomic_compare,
+		output wire [31:0]              tx_cmd_dst_ip,
+		output wire [31:0]              tx_cmd_udp_ports,
+		output wire [1:0]               tx_cmd_mc_count,
+		output wire [95:0]              tx_cmd_mc_dst_ip,
+		output wire [95:0]              tx_cmd_mc_udp_ports,
+		output wire [71:0]              tx_cmd_mc_dest_qp,
+		output wire [23:0]              tx_cmd_mc_qp_handle,
 		output wire [7:0]               tx_cmd_opcode,
 		output wire [23:0]              tx_cmd_dest_qp,
+		output wire [7:0]               tx_cmd_qp_handle,
 		output wire [63:0]              tx_cmd_remote_addr,
 		output wire [31:0]              tx_cmd_rkey,
 		output wire [15:0]              tx_cmd_partition_key,
 		output wire [7:0]               tx_cmd_service_level,
-		output wire [23:0]              tx_cmd_psn,
 		input  wire                     tx_cpl_valid,
 		output wire                     tx_cpl_ready,
 		input  wire [7:0]               tx_cpl_sq_index,
 		input  wire [7:0]               tx_cpl_status,
 		input  wire [31:0]              tx_cpl_bytes_sent,
+		input  wire [63:0]              tx_cpl_atomic_orig,
 		output wire [3:0]                 STATE_REG,
 		
+		// Reliable delivery settings (to tx_streamer)
+		output wire [31:0]              retry_timeout,
+		output wire [2:0]               retry_limit,
+		
+		// Per-QP token-bucket shaper settings (to tx_streamer)
+		output wire [31:0]              rate_cfg,
+		output wire                     rate_cfg_wr,
+		output wire                     cc_enable,            // CONTROL[9]: DCQCN rate control
+		
+		// Traffic-class scheduling (to tx_streamer)
+		output wire [31:0]              tc_map,               // 0x38: class of each SL
+		output wire [31:0]              tc_weight,            // 0x3C: WRR weights
+		output wire                     tc_wrr,               // CONTROL[10]: WRR instead of strict priority
+		
+		// Link aggregation (to tx_link_stripe)
+		output wire [1:0]               link_mode,            // CONTROL[12:11]
+		
 		// CQ Entry Register Outputs (for ILA debugging)
 		output wire [31:0]              cq_entry_reg_0,
 		output wire [31:0]              cq_entry_reg_1,
@@ -157,13 +210,15 @@
 		.SQ_BASE_HI(SQ_BASE_HI),
 		.SQ_SIZE(SQ_SIZE),
 		.SQ_TAIL(SQ_TAIL),
-		.SQ_FLAGS(SQ_FLAGS),
-		.SQ_STRIDE(SQ_STRIDE),
+		.TC_MAP(tc_map),
+		.TC_WEIGHT(tc_weight),
 		.CQ_BASE_LO(CQ_BASE_LO),
 		.CQ_BASE_HI(CQ_BASE_HI),
 		.CQ_SIZE(CQ_SIZE),
 		.CQ_HEAD_SW(CQ_HEAD_SW),
-		.CQ_FLAGS(CQ_FLAGS),
+		.QP_CTX_ADDR(QP_CTX_ADDR),
+		.QP_CTX_DATA(QP_CTX_DATA),
+		.QP_CTX_WR_PULSE(QP_CTX_WR_PULSE),
 		.SQ_DOORBELL_PULSE(SQ_DOORBELL_PULSE),
 		.CQ_DOORBELL_PULSE(CQ_DOORBELL_PULSE),
 		.GLOBAL_ENABLE(GLOBAL_ENABLE),
@@ -172,6 +227,23 @@
 		.MODE(MODE),
 		.GLOBAL_IRQ_EN(GLOBAL_IRQ_EN),
 		.IRQ_OUT(IRQ_OUT),
+		.RETRY_TIMEOUT(retry_timeout),
+		.RETRY_LIMIT(retry_limit),
+		.RATE_CFG(rate_cfg),
+		.RATE_CFG_WR_PULSE(rate_cfg_wr),
+		.STRM_BASE_LO(STRM_BASE_LO),
+		.STRM_BASE_HI(STRM_BASE_HI),
+		.STRM_SIZE(STRM_SIZE),
+		.STRM_CHUNK(STRM_CHUNK),
+		.STRM_RADDR_LO(STRM_RADDR_LO),
+		.STRM_RADDR_HI(STRM_RADDR_HI),
+		.STRM_RKEY(STRM_RKEY),
+		.STRM_CFG(STRM_CFG),
+		.STRM_PROD(STRM_PROD),
+		.STRM_PROD_WR_PULSE(STRM_PROD_WR_PULSE),
+		.CC_ENABLE(cc_enable),
+		.TC_WRR(tc_wrr),
+		.LINK_MODE(link_mode),
 
 		.HW_SQ_HEAD(HW_SQ_HEAD),
 		.HW_CQ_TAIL(HW_CQ_TAIL),
@@ -182,6 +254,8 @@
 		.HW_CQE_WRITTEN(HW_CQE_WRITTEN),
 		.HW_CYCLES_BUSY_LO(HW_CYCLES_BUSY_LO),
 		.HW_CYCLES_BUSY_HI(HW_CYCLES_BUSY_HI),
+		.HW_STRM_PROD(HW_STRM_PROD),
+		.HW_STRM_CONS(HW_STRM_CONS),
 		.rdma_id(rdma_id),
 		.rdma_opcode(rdma_opcode),
 		.rdma_flags(rdma_flags),
@@ -198,13 +272,23 @@
 	wire [31:0] SQ_BASE_HI;
 	wire [31:0] SQ_SIZE;
 	wire [31:0] SQ_TAIL;
-	wire [31:0] SQ_FLAGS;
-	wire [31:0] SQ_STRIDE;
 	wire [31:0] CQ_BASE_LO;
 	wire [31:0] CQ_BASE_HI;
 	wire [31:0] CQ_SIZE;
 	wire [31:0] CQ_HEAD_SW;
-	wire [31:0] CQ_FLAGS;
+	wire [31:0] QP_CTX_ADDR;
+	wire [31:0] QP_CTX_DATA;
+	wire        QP_CTX_WR_PULSE;
+	wire [31:0] STRM_BASE_LO;
+	wire [31:0] STRM_BASE_HI;
+	wire [31:0] STRM_SIZE;
+	wire [31:0] STRM_CHUNK;
+	wire [31:0] STRM_RADDR_LO;
+	wire [31:0] STRM_RADDR_HI;
+	wire [31:0] STRM_RKEY;
+	wire [31:0] STRM_CFG;
+	wire [31:0] STRM_PROD;
+	wire        STRM_PROD_WR_PULSE;
 
 	wire SQ_DOORBELL_PULSE;
 	wire CQ_DOORBELL_PULSE;
@@ -225,6 +309,8 @@
 	wire [31:0] HW_CQE_WRITTEN;
 	wire [31:0] HW_CYCLES_BUSY_LO;
 	wire [31:0] HW_CYCLES_BUSY_HI;
+	wire [31:0] HW_STRM_PROD;
+	wire [31:0] HW_STRM_CONS;
 	wire [31:0]   rdma_id;
 	wire [15:0]   rdma_opcode;
 	wire [15:0]   rdma_flags;
@@ -241,11 +327,11 @@
 	) data_mover_controller_slave_stream_v1_0_S00_AXIS_inst (
 		.S_AXIS_ACLK(s00_axis_aclk),
 		.S_AXIS_ARESETN(s00_axis_aresetn),
-		.S_AXIS_TREADY(s00_axis_tready),
-		.S_AXIS_TDATA(s00_axis_tdata),
-		.S_AXIS_TSTRB(s00_axis_tstrb),
-		.S_AXIS_TLAST(s00_axis_tlast),
-		.S_AXIS_TVALID(s00_axis_tvalid),
+		.S_AXIS_TREADY(sqe_axis_tready),
+		.S_AXIS_TDATA(sqe_axis_tdata),
+		.S_AXIS_TSTRB(sqe_axis_tstrb),
+		.S_AXIS_TLAST(sqe_axis_tlast),
+		.S_AXIS_TVALID(sqe_axis_tvalid),
 		.rdma_id(rdma_id),
 		.rdma_opcode(rdma_opcode),
 		.rdma_flags(rdma_flags),
@@ -256,6 +342,17 @@
 		.rdma_entry_valid(rdma_entry_valid)
 	);
 
+	// SQE parser input: the MM2S data stream, or S01_AXIS while rdma_controller takes a PL WQE
+	wire        PL_WQE_SEL;
+	wire        sqe_axis_tready;
+	wire [31:0] sqe_axis_tdata  = PL_WQE_SEL ? s01_axis_tdata  : s00_axis_tdata;
+	wire [3:0]  sqe_axis_tstrb  = PL_WQE_SEL ? s01_axis_tstrb  : s00_axis_tstrb;
+	wire        sqe_axis_tlast  = PL_WQE_SEL ? s01_axis_tlast  : s00_axis_tlast;
+	wire        sqe_axis_tvalid = PL_WQE_SEL ? s01_axis_tvalid : s00_axis_tvalid;
+	assign s00_axis_tready = sqe_axis_tready && !PL_WQE_SEL;
+	assign s01_axis_tready = sqe_axis_tready && PL_WQE_SEL;
+	assign m01_axis_tstrb  = 4'hF;
+
 // Instantiation of Axi Bus Interface M00_AXIS
 	data_mover_controller_master_stream_v1_0_M00_AXIS # ( 
 		.C_M_AXIS_TDATA_WIDTH(C_M00_AXIS_TDATA_WIDTH),
@@ -323,7 +420,7 @@
 	// Add user logic here
 	data_mover_axi_cmd_master #
 	(
-
+		.ADDR_WIDTH(64)
 	) data_mover_axi_cmd_master_inst
     (
         .clk(s00_axi_aclk),
@@ -345,8 +442,8 @@
 	wire CMD_CTRL_READY;
 	wire CMD_CTRL_START;
 	wire CMD_IS_READ;
-	wire [31:0] CMD_CTRL_SRC_ADDR;
-	wire [31:0] CMD_CTRL_DST_ADDR;
+	wire [63:0] CMD_CTRL_SRC_ADDR;
+	wire [63:0] CMD_CTRL_DST_ADDR;
 	wire [31:0] CMD_CTRL_BTT;
 	wire READ_COMPLETE;
 	wire WRITE_COMPLETE;
@@ -363,15 +460,15 @@
 
     rdma_controller #(
         .SQ_IDX_WIDTH(16),
-        .ADDR_WIDTH  (32)
+        .ADDR_WIDTH  (64)
     ) rdma_controller_inst (
         .clk             (s00_axi_aclk),
         .rst             (~s00_axi_aresetn),
         .START_RDMA      (GLOBAL_ENABLE),
         .RESET_RDMA      (SOFT_RESET),
 
-        .SQ_BASE_ADDR    (SQ_BASE_LO),
-        .CQ_BASE_ADDR    (CQ_BASE_LO),
+        .SQ_BASE_ADDR    ({SQ_BASE_HI, SQ_BASE_LO}),
+        .CQ_BASE_ADDR    ({CQ_BASE_HI, CQ_BASE_LO}),
         .SQ_SIZE         (SQ_SIZE[15:0]),
         .CQ_SIZE         (CQ_SIZE[15:0]),
         .SQ_TAIL_SW      (SQ_TAIL[15:0]),
@@ -386,8 +483,28 @@
         .rdma_local_key  (rdma_local_key),
         .rdma_remote_key (rdma_remote_key),
         .rdma_btt        (rdma_btt),
+        .rdma_reserved   (rdma_reserved),
         .rdma_entry_valid(rdma_entry_valid),
 
+        // QP context table
+        .qp_ctx_wr       (QP_CTX_WR_PULSE),
+        .qp_ctx_addr     (QP_CTX_ADDR[9:0]),
+        .qp_ctx_data     (QP_CTX_DATA),
+
+        // Streaming ring (STRM_CFG: [0] enable, [11:4] QP handle); a PL producer
+        // index update wins over a register write in the same cycle
+        .STRM_EN         (STRM_CFG[0]),
+        .STRM_BASE_ADDR  ({STRM_BASE_HI, STRM_BASE_LO}),
+        .STRM_SIZE       (STRM_SIZE),
+        .STRM_CHUNK      (STRM_CHUNK),
+        .STRM_REMOTE_ADDR({STRM_RADDR_HI, STRM_RADDR_LO}),
+        .STRM_RKEY       (STRM_RKEY),
+        .STRM_QP         (STRM_CFG[11:4]),
+        .STRM_PROD_WR    (strm_prod_wr || STRM_PROD_WR_PULSE),
+        .STRM_PROD_IN    (strm_prod_wr ? strm_prod : STRM_PROD),
+        .STRM_PROD       (HW_STRM_PROD),
+        .STRM_CONS       (HW_STRM_CONS),
+
         // Unified command controller (for SQ/CQ operations)
         .CMD_CTRL_READY    (CMD_CTRL_READY),
         .CMD_CTRL_START    (CMD_CTRL_START),
@@ -404,18 +521,44 @@
         .tx_cmd_sq_index       (tx_cmd_sq_index),
         .tx_cmd_ddr_addr       (tx_cmd_ddr_addr),
         .tx_cmd_length         (tx_cmd_length),
+        .tx_cmd_sg1_addr       (tx_cmd_sg1_addr),
+        .tx_cmd_sg1_length     (tx_cmd_sg1_length),
+        .tx_cmd_sg2_addr       (tx_cmd_sg2_addr),
+        .tx_cmd_sg2_length     (tx_cmd_sg2_length),
+        .tx_cmd_row_count      (tx_cmd_row_count),
+        .tx_cmd_src_stride     (tx_cmd_src_stride),
+        .tx_cmd_dst_stride     (tx_cmd_dst_stride),
+        .tx_cmd_local_rkey     (tx_cmd_local_rkey),
+        .tx_cmd_imm            (tx_cmd_imm),
+        .tx_cmd_atomic_swap_add(tx_cmd_atomic_swap_add),
+        .tx_cmd_atomic_compare (tx_cmd_atomic_compare),
+        .tx_cmd_dst_ip         (tx_cmd_dst_ip),
+        .tx_cmd_udp_ports      (tx_cmd_udp_ports),
+        .tx_cmd_mc_count       (tx_cmd_mc_count),
+        .tx_cmd_mc_dst_ip      (tx_cmd_mc_dst_ip),
+        .tx_cmd_mc_udp_ports   (tx_cmd_mc_udp_ports),
+        .tx_cmd_mc_dest_qp     (tx_cmd_mc_dest_qp),
+        .tx_cmd_mc_qp_handle   (tx_cmd_mc_qp_handle),
         .tx_cmd_opcode         (tx_cmd_opcode),
         .tx_cmd_dest_qp        (tx_cmd_dest_qp),
+        .tx_cmd_qp_handle      (tx_cmd_qp_handle),
         .tx_cmd_remote_addr    (tx_cmd_remote_addr),
         .tx_cmd_rkey           (tx_cmd_rkey),
         .tx_cmd_partition_key  (tx_cmd_partition_key),
         .tx_cmd_service_level  (tx_cmd_service_level),
-        .tx_cmd_psn            (tx_cmd_psn),
         .tx_cpl_valid          (tx_cpl_valid),
         .tx_cpl_ready          (tx_cpl_ready),
         .tx_cpl_sq_index       (tx_cpl_sq_index),
         .tx_cpl_status         (tx_cpl_status),
         .tx_cpl_bytes_sent     (tx_cpl_bytes_sent),
+        .tx_cpl_atomic_orig    (tx_cpl_atomic_orig),
+
+        .pl_wqe_valid          (s01_axis_tvalid),
+        .pl_wqe_sel            (PL_WQE_SEL),
+        .pl_cpl_tdata          (m01_axis_tdata),
+        .pl_cpl_tvalid         (m01_axis_tvalid),
+        .pl_cpl_tready         (m01_axis_tready),
+        .pl_cpl_tlast          (m01_axis_tlast),
 
         .STATE_REG       (state_reg),
         .HAS_WORK        (has_work),
@@ -29,7 +29,7 @@
 		// Width of S_AXI data bus
 		parameter integer C_S_AXI_DATA_WIDTH	= 32,
 		// Width of S_AXI address bus
-		parameter integer C_S_AXI_ADDR_WIDTH	= 7
+		parameter integer C_S_AXI_ADDR_WIDTH	= 8
 	)
 	(
 		// Users to add ports here
@@ -103,13 +103,16 @@
 		output wire [31:0] SQ_BASE_HI,
 		output wire [31:0] SQ_SIZE,
 		output wire [31:0] SQ_TAIL,
-		output wire [31:0] SQ_FLAGS,
-		output wire [31:0] SQ_STRIDE,
+		output wire [31:0] TC_MAP,         // Traffic class of each SL, 2 bits per SL
+		output wire [31:0] TC_WEIGHT,      // WRR fragments per turn, 8 bits per class
 		output wire [31:0] CQ_BASE_LO,
 		output wire [31:0] CQ_BASE_HI,
 		output wire [31:0] CQ_SIZE,
 		output wire [31:0] CQ_HEAD_SW,
-		output wire [31:0] CQ_FLAGS,
+		// QP context table: write 0x16 QP_CTX_ADDR to store 0x07 QP_CTX_DATA
+		output wire [31:0] QP_CTX_ADDR,
+		output wire [31:0] QP_CTX_DATA,
+		output wire QP_CTX_WR_PULSE,
 		// Doorbell pulses (one-cycle) generated when SW writes doorbell/tail
 		output wire SQ_DOORBELL_PULSE,
 		output wire CQ_DOORBELL_PULSE,
@@ -119,8 +122,28 @@
 		output wire PAUSE,
 		output wire [3:0] MODE,
 		output wire GLOBAL_IRQ_EN,
+		output wire CC_ENABLE,
+		output wire TC_WRR,
+		output wire [1:0] LINK_MODE,
 		// IRQ output (gated)
 		output wire IRQ_OUT,
+		// Reliable delivery: ACK timeout in clock cycles (0 = off), retransmissions per WQE
+		output wire [31:0] RETRY_TIMEOUT,
+		output wire [2:0] RETRY_LIMIT,
+		// Per-QP shaper: write to 0x04 RATE_CFG loads one token bucket
+		output wire [31:0] RATE_CFG,
+		output wire RATE_CFG_WR_PULSE,
+		// Streaming ring: write to 0xA0 STRM_PROD moves the producer index
+		output wire [31:0] STRM_BASE_LO,
+		output wire [31:0] STRM_BASE_HI,
+		output wire [31:0] STRM_SIZE,
+		output wire [31:0] STRM_CHUNK,
+		output wire [31:0] STRM_RADDR_LO,
+		output wire [31:0] STRM_RADDR_HI,
+		output wire [31:0] STRM_RKEY,
+		output wire [31:0] STRM_CFG,
+		output wire [31:0] STRM_PROD,
+		output wire STRM_PROD_WR_PULSE,
 		// Inputs from RDMA core (hw-updated status and counters)
 		input  wire [31:0] HW_SQ_HEAD,
 		input  wire [31:0] HW_CQ_TAIL,
@@ -131,6 +154,8 @@
 		input  wire [31:0] HW_CQE_WRITTEN,
 		input  wire [31:0] HW_CYCLES_BUSY_LO,
 		input  wire [31:0] HW_CYCLES_BUSY_HI,
+		input  wire [31:0] HW_STRM_PROD,
+		input  wire [31:0] HW_STRM_CONS,
 		input wire [31:0]   rdma_id,
   		input wire [15:0]   rdma_opcode,
   		input wire [15:0]   rdma_flags,
@@ -160,11 +185,11 @@
 	// ADDR_LSB = 2 for 32 bits (n downto 2)
 	// ADDR_LSB = 3 for 64 bits (n downto 3)
 	localparam integer ADDR_LSB = (C_S_AXI_DATA_WIDTH/32) + 1;
-	localparam integer OPT_MEM_ADDR_BITS = 4;
+	localparam integer OPT_MEM_ADDR_BITS = 5;
 	//----------------------------------------------
 	//-- Signals for user logic register space example
 	//------------------------------------------------
-	//-- Number of Slave Registers 32
+	//-- Number of Slave Registers 41 (0x00-0x7C, streaming ring 0x80-0xA0)
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg0;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg1;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg2;
@@ -197,6 +222,15 @@
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg29;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg30;
 	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg31;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg32;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg33;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg34;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg35;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg36;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg37;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg38;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg39;
+	reg [C_S_AXI_DATA_WIDTH-1:0]	slv_reg40;
 	integer	 byte_index;
 
 	// internal read data register for S_AXI_RDATA
@@ -205,6 +239,9 @@
 	// doorbell pulse registers (one-cycle pulses)
 	reg sq_doorbell_reg;
 	reg cq_doorbell_reg;
+	reg rate_cfg_wr_reg;
+	reg qp_ctx_wr_reg;
+	reg strm_prod_wr_reg;
 
 	// I/O Connections assignments
 
@@ -333,12 +370,24 @@
 	      slv_reg29 <= 0;
 	      slv_reg30 <= 0;
 	      slv_reg31 <= 32'h4c4c4c4c;
+	      slv_reg32 <= 0;
+	      slv_reg33 <= 0;
+	      slv_reg34 <= 0;
+	      slv_reg35 <= 0;
+	      slv_reg36 <= 0;
+	      slv_reg37 <= 0;
+	      slv_reg38 <= 0;
+	      slv_reg39 <= 0;
+	      slv_reg40 <= 0;
 	    end 
 	  else begin
 	    // Clear one-cycle doorbell flags by default; they'll be set when a write occurs to the
 	    // corresponding doorbell/tail registers below.
 	    sq_doorbell_reg <= 1'b0;
 	    cq_doorbell_reg <= 1'b0;
+	    rate_cfg_wr_reg <= 1'b0;
+	    qp_ctx_wr_reg <= 1'b0;
+	    strm_prod_wr_reg <= 1'b0;
 	    if (S_AXI_WVALID)
 	      begin
 	        case ( (S_AXI_AWVALID) ? S_AXI_AWADDR[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] : axi_awaddr[ADDR_LSB+OPT_MEM_ADDR_BITS:ADDR_LSB] )
@@ -363,14 +412,31 @@
 	                slv_reg3[(byte_index*8) +: 8] <= slv_reg3[(byte_index*8) +: 8] & ~S_AXI_WDATA[(byte_index*8) +: 8];
 	              end
 
-	          // 0x04 GLOBAL_CFG (RW)
+	          // 0x04 RATE_CFG (RW, write = load the selected QP's token bucket)
 	          5'h04:
+	            begin
+	              for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	                if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                  slv_reg4[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	                end
+	              rate_cfg_wr_reg <= 1'b1;
+	            end
+
+	          // 0x05 RETRY_TIMEOUT (RW)
+	          5'h05:
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
+	                slv_reg5[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              end
+
+	          // 0x06 RETRY_CFG (RW)
+	          5'h06:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
-	                slv_reg4[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	                slv_reg6[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              end
 
-	          // 0x07 TEST_REG (RW)
+	          // 0x07 QP_CTX_DATA (RW)
 	          5'h07:
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) begin
@@ -400,10 +466,10 @@
 	                if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg13[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              sq_doorbell_reg <= 1'b1;
 	            end
-	          5'h0E: // SQ_FLAGS
+	          5'h0E: // TC_MAP
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg14[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
-	          5'h0F: // SQ_STRIDE
+	          5'h0F: // TC_WEIGHT
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
 	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg15[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 
@@ -427,9 +493,45 @@
 	                if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg21[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
 	              cq_doorbell_reg <= 1'b1; // optional doorbell
 	            end
-	          5'h16: // CQ_FLAGS
+	          5'h16: // QP_CTX_ADDR (write = store QP_CTX_DATA into the QP context table)
+	            begin
+	              for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	                if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg22[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              qp_ctx_wr_reg <= 1'b1;
+	            end
+
+	          // Streaming ring registers (32..40)
+	          6'h20: // STRM_BASE_LO
 	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
-	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg22[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg32[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h21: // STRM_BASE_HI
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg33[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h22: // STRM_SIZE
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg34[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h23: // STRM_CHUNK
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg35[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h24: // STRM_RADDR_LO
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg36[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h25: // STRM_RADDR_HI
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg37[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h26: // STRM_RKEY
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg38[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h27: // STRM_CFG
+	            for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	              if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg39[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	          6'h28: // STRM_PROD (write = new producer index)
+	            begin
+	              for ( byte_index = 0; byte_index <= (C_S_AXI_DATA_WIDTH/8)-1; byte_index = byte_index+1 )
+	                if ( S_AXI_WSTRB[byte_index] == 1 ) slv_reg40[(byte_index*8) +: 8] <= S_AXI_WDATA[(byte_index*8) +: 8];
+	              strm_prod_wr_reg <= 1'b1;
+	            end
+	          // 0x29 STRM_CONS is HW-owned (RO) -> no write
 
 	          default: begin end
 	        endcase
@@ -522,6 +624,16 @@
 	    5'h1D: slv_reg_rdata = rdma_btt[127:96];           // BTT [127:96]
 	    5'h1E: slv_reg_rdata = {31'h0, rdma_entry_valid};  // entry_valid flag
 	    5'h1F: slv_reg_rdata = slv_reg31;
+	    6'h20: slv_reg_rdata = slv_reg32;
+	    6'h21: slv_reg_rdata = slv_reg33;
+	    6'h22: slv_reg_rdata = slv_reg34;
+	    6'h23: slv_reg_rdata = slv_reg35;
+	    6'h24: slv_reg_rdata = slv_reg36;
+	    6'h25: slv_reg_rdata = slv_reg37;
+	    6'h26: slv_reg_rdata = slv_reg38;
+	    6'h27: slv_reg_rdata = slv_reg39;
+	    6'h28: slv_reg_rdata = HW_STRM_PROD;                // Last index from software or the PL
+	    6'h29: slv_reg_rdata = HW_STRM_CONS;                // HW-owned: direct
 	    default: slv_reg_rdata = 0;
 	  endcase
 	end
@@ -534,19 +646,40 @@
 	assign PAUSE          = slv_reg0[2];
 	assign MODE           = slv_reg0[7:4];
 	assign GLOBAL_IRQ_EN  = slv_reg0[8];
+	assign CC_ENABLE      = slv_reg0[9];
+	assign TC_WRR         = slv_reg0[10];
+	assign LINK_MODE      = slv_reg0[12:11];
+
+	assign RETRY_TIMEOUT  = slv_reg5;
+	assign RETRY_LIMIT    = slv_reg6[2:0];
+	assign RATE_CFG       = slv_reg4;
+	assign RATE_CFG_WR_PULSE = rate_cfg_wr_reg;
 
 	assign SQ_BASE_LO     = slv_reg8;
 	assign SQ_BASE_HI     = slv_reg9;
 	assign SQ_SIZE        = slv_reg10;
 	assign SQ_TAIL        = slv_reg12;
-	assign SQ_FLAGS       = slv_reg14;
-	assign SQ_STRIDE      = slv_reg15;
+	assign TC_MAP         = slv_reg14;
+	assign TC_WEIGHT      = slv_reg15;
 
 	assign CQ_BASE_LO     = slv_reg16;
 	assign CQ_BASE_HI     = slv_reg17;
 	assign CQ_SIZE        = slv_reg18;
 	assign CQ_HEAD_SW     = slv_reg19;
-	assign CQ_FLAGS       = slv_reg22;
+	assign QP_CTX_ADDR    = slv_reg22;
+	assign QP_CTX_DATA    = slv_reg7;
+	assign QP_CTX_WR_PULSE = qp_ctx_wr_reg;
+
+	assign STRM_BASE_LO   = slv_reg32;
+	assign STRM_BASE_HI   = slv_reg33;
+	assign STRM_SIZE      = slv_reg34;
+	assign STRM_CHUNK     = slv_reg35;
+	assign STRM_RADDR_LO  = slv_reg36;
+	assign STRM_RADDR_HI  = slv_reg37;
+	assign STRM_RKEY      = slv_reg38;
+	assign STRM_CFG       = slv_reg39;
+	assign STRM_PROD      = slv_reg40;
+	assign STRM_PROD_WR_PULSE = strm_prod_wr_reg;
 
 	assign SQ_DOORBELL_PULSE = sq_doorbell_reg;
 	assign CQ_DOORBELL_PULSE = cq_doorbell_reg;
@@ -19,19 +19,21 @@
 ----------------------------------------------------------------------------------
 `timescale 1ns / 1ps
 
-module data_mover_axi_cmd_master
+module data_mover_axi_cmd_master #(
+        parameter ADDR_WIDTH = 64               // DataMover address width (32 or 64)
+    )
     (
         input wire         clk,
         input wire         rst_n,
         input wire         is_read, // 1: read from memory, 0: write to memory
         output wire        ready,
-        input wire [31:0]  saddr,
-        input wire [31:0]  daddr,
+        input wire [ADDR_WIDTH-1:0] saddr,
+        input wire [ADDR_WIDTH-1:0] daddr,
         input wire [31:0]  btt,
         input wire         start,
-        output wire [71:0] m_axis_mm2s_cmd_tdata,
+        output wire [ADDR_WIDTH+39:0] m_axis_mm2s_cmd_tdata,
         output wire        m_axis_mm2s_cmd_tvalid,
-        output wire [71:0] m_axis_s2mm_cmd_tdata,
+        output wire [ADDR_WIDTH+39:0] m_axis_s2mm_cmd_tdata,
         output wire        m_axis_s2mm_cmd_tvalid,
         input wire         s2mm_wr_xfer_cmplt,
         input wire         mm2s_rd_xfer_cmplt,
@@ -99,7 +101,7 @@ module data_mover_axi_cmd_master
 
     assign ready = (state_reg == IDLE) ? 1'b1 : 1'b0;
 
-    // Build command TDATA fields (72-bit) as before
+    // Build command TDATA fields (ADDR_WIDTH + 40 bits: 104-bit for 64-bit addressing)
     assign m_axis_s2mm_cmd_tdata = {8'b00000000, daddr, 1'b0, 1'b1, 6'b000000, 1'b1, btt[22:0]}; // S2MM instruction
     assign m_axis_mm2s_cmd_tdata = {8'b00000000, saddr, 1'b0, 1'b1, 6'b000000, 1'b1, btt[22:0]}; // MM2S instruction
 
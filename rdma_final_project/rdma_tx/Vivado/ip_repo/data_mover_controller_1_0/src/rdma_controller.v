@@ -20,7 +20,7 @@
 `timescale 1ns / 1ps
 
 module rdma_controller #(
-    parameter ADDR_WIDTH = 32,
+    parameter ADDR_WIDTH = 64,
     parameter SQ_IDX_WIDTH = 16
 )(
     input  wire                    clk,
@@ -50,13 +50,32 @@ module rdma_controller #(
     input wire [63:0]   rdma_local_key,
     input wire [63:0]   rdma_remote_key,
     input wire [127:0]  rdma_btt,
+    input wire [191:0]  rdma_reserved,      // SQE words 10-15 (word 10 = rkey)
     input wire          rdma_entry_valid,
 
+    // QP context table write port (QP_CTX_ADDR / QP_CTX_DATA)
+    input wire          qp_ctx_wr,          // Pulse
+    input wire [9:0]    qp_ctx_addr,        // [9:2] QP handle, [1:0] word
+    input wire [31:0]   qp_ctx_data,
+
+    // Streaming ring: WRITEs generated from a DDR byte ring up to the producer index
+    input wire                     STRM_EN,
+    input wire [ADDR_WIDTH-1:0]    STRM_BASE_ADDR,    // Local ring base
+    input wire [31:0]              STRM_SIZE,         // Ring size in bytes
+    input wire [31:0]              STRM_CHUNK,        // Max bytes per WRITE
+    input wire [63:0]              STRM_REMOTE_ADDR,  // Remote ring base (same size)
+    input wire [31:0]              STRM_RKEY,
+    input wire [7:0]               STRM_QP,           // QP handle (QP context table)
+    input wire                     STRM_PROD_WR,      // Pulse: new producer index
+    input wire [31:0]              STRM_PROD_IN,
+    output wire [31:0]             STRM_PROD,
+    output wire [31:0]             STRM_CONS,         // [30:0] bytes sent and completed, [31] error
+
     // Command controller (unified for SQ/CQ operations)
     input  wire                    CMD_CTRL_READY,
     output wire                     CMD_CTRL_START,
-    output wire  [31:0]             CMD_CTRL_SRC_ADDR,
-    output wire  [31:0]             CMD_CTRL_DST_ADDR,
+    output wire  [ADDR_WIDTH-1:0]   CMD_CTRL_SRC_ADDR,
+    output wire  [ADDR_WIDTH-1:0]   CMD_CTRL_DST_ADDR,
     output wire  [31:0]             CMD_CTRL_BTT,
     output wire                     CMD_CTRL_IS_READ,
     input  wire                    READ_COMPLETE,      // from MM2S data path
@@ -66,21 +85,52 @@ module rdma_controller #(
     output wire                     tx_cmd_valid,
     input  wire                     tx_cmd_ready,
     output wire [7:0]               tx_cmd_sq_index,
-    output wire [31:0]              tx_cmd_ddr_addr,
+    output wire [ADDR_WIDTH-1:0]    tx_cmd_ddr_addr,
     output wire [31:0]              tx_cmd_length,
+    output wire [ADDR_WIDTH-1:0]    tx_cmd_sg1_addr,
+    output wire [31:0]              tx_cmd_sg1_length,
+    output wire [ADDR_WIDTH-1:0]    tx_cmd_sg2_addr,
+    output wire [31:0]              tx_cmd_sg2_length,
+    output wire [15:0]              tx_cmd_row_count,
+    output wire [31:0]              tx_cmd_src_stride,
+    output wire [31:0]              tx_cmd_dst_stride,
     output wire [7:0]               tx_cmd_opcode,
     output wire [23:0]              tx_cmd_dest_qp,
+    output wire [7:0]               tx_cmd_qp_handle,       // Keys the per-QP PSN in tx_streamer
     output wire [63:0]              tx_cmd_remote_addr,
     output wire [31:0]              tx_cmd_rkey,
     output wire [15:0]              tx_cmd_partition_key,
     output wire [7:0]               tx_cmd_service_level,
-    output wire [23:0]              tx_cmd_psn,
+    output wire [31:0]              tx_cmd_local_rkey,
+    output wire [31:0]              tx_cmd_imm,
+    output wire [63:0]              tx_cmd_atomic_swap_add,
+    output wire [63:0]              tx_cmd_atomic_compare,
+    output wire [31:0]              tx_cmd_dst_ip,
+    output wire [31:0]              tx_cmd_udp_ports,
+    // Multicast: further group members, member k at [32k+31:32k] / [24k+23:24k] / [8k+7:8k]
+    output wire [1:0]               tx_cmd_mc_count,
+    output wire [95:0]              tx_cmd_mc_dst_ip,
+    output wire [95:0]              tx_cmd_mc_udp_ports,
+    output wire [71:0]              tx_cmd_mc_dest_qp,
+    output wire [23:0]              tx_cmd_mc_qp_handle,
     
     input  wire                     tx_cpl_valid,
     output wire                     tx_cpl_ready,
     input  wire [7:0]               tx_cpl_sq_index,
     input  wire [7:0]               tx_cpl_status,
     input  wire [31:0]              tx_cpl_bytes_sent,
+    input  wire [63:0]              tx_cpl_atomic_orig,
+
+    // PL WQE submission port: while pl_wqe_sel is high the SQE parser reads
+    // s01_axis instead of the MM2S data stream
+    input  wire                     pl_wqe_valid,
+    output wire                     pl_wqe_sel,
+
+    // Completions of PL-submitted WQEs (8-beat CQE, instead of the DDR CQ)
+    output wire [31:0]              pl_cpl_tdata,
+    output wire                     pl_cpl_tvalid,
+    input  wire                     pl_cpl_tready,
+    output wire                     pl_cpl_tlast,
 
     output wire [3:0]               STATE_REG,
     output wire                     HAS_WORK,
@@ -115,21 +165,124 @@ module rdma_controller #(
     localparam S_WRITE_CMD        = 4'd8;
     localparam S_START_STREAM     = 4'd9;
     localparam S_WAIT_WRITE_DONE  = 4'd10;
+    localparam S_MCAST_WALK       = 4'd11;
+    localparam S_PL_WQE           = 4'd12;
+    localparam S_PL_CPL           = 4'd13;
+    localparam S_STRM_WQE         = 4'd14;
 
     reg [3:0] state_reg, state_next;
 
     // SQ/CQ pointers
-    reg [SQ_IDX_WIDTH-1:0] sq_head_reg;
+    reg [SQ_IDX_WIDTH-1:0] sq_head_reg;     // Oldest descriptor not yet retired
+    reg [SQ_IDX_WIDTH-1:0] sq_fetch_reg;    // Next descriptor to read from DDR
     reg [SQ_IDX_WIDTH-1:0] cq_tail_reg;
     assign SQ_HEAD_HW = sq_head_reg;
     assign CQ_TAIL_HW = cq_tail_reg;
     
+    // SQE flags
+    localparam FLAG_SGE_INLINE = 0;     // Words 7-9 and 11-13 hold two extra gather segments
+    localparam FLAG_STRIDED    = 1;     // 2D transfer: word 7 = rows, word 8/9 = src/dst stride
+    localparam FLAG_QP_CTX     = 2;     // Destination from the QP context table
+    localparam FLAG_MCAST      = 3;     // With FLAG_QP_CTX: the QP handle heads a multicast group
+    localparam FLAG_QP_LSB     = 4;     // Flags[11:4] = QP handle (with FLAG_QP_CTX)
+    localparam FLAG_SL_LSB     = 12;    // Flags[15:12] = service level (traffic class select)
+
     // Latched RDMA entry
     reg [31:0]   rdma_id_reg;
     reg [15:0]   rdma_opcode_reg;
     reg [63:0]   rdma_local_key_reg;
     reg [63:0]   rdma_remote_key_reg;
     reg [31:0]   rdma_length_reg;
+    reg [15:0]   rdma_flags_reg;
+    reg [95:0]   rdma_btt_hi_reg;       // SQE words 7-9 (gather segment 1)
+    reg [191:0]  rdma_reserved_reg;
+    
+    wire strided    = rdma_flags_reg[FLAG_STRIDED];
+    wire sge_inline = rdma_flags_reg[FLAG_SGE_INLINE] && !strided;   // Both use words 7-9
+
+    // QP context table, one entry per QP handle:
+    //   word 0: peer IPv4 address
+    //   word 1: [31:16] UDP source port, [15:0] UDP destination port
+    //   word 2: [31] valid, [27:24] SL, [23:0] remote QPN
+    //   word 3: [31] valid, [7:0] next member of the multicast group
+    // Read with the flags of the SQE being latched, so it is ready together with rdma_*_reg
+    reg [31:0]   qp_ctx_ip_mem    [0:255];
+    reg [31:0]   qp_ctx_ports_mem [0:255];
+    reg [31:0]   qp_ctx_qp_mem    [0:255];
+    reg [31:0]   qp_ctx_next_mem  [0:255];
+    reg [31:0]   qp_ctx_ip_reg;
+    reg [31:0]   qp_ctx_ports_reg;
+    reg [31:0]   qp_ctx_qp_reg;
+    reg [31:0]   qp_ctx_next_reg;
+    reg [7:0]    qp_ctx_handle_reg;     // Handle of the entry in qp_ctx_*_reg
+
+    // Multicast group walk: one member per cycle along the word 3 links, at most
+    // MCAST_MAX members including the head (a looped chain just ends there)
+    localparam integer MCAST_MAX = 4;
+    reg [1:0]    mc_walk_reg;           // Member whose entry is in qp_ctx_*_reg
+    reg [1:0]    mc_count_reg;          // Valid members after the head
+    reg [95:0]   mc_dst_ip_reg;
+    reg [95:0]   mc_udp_ports_reg;
+    reg [71:0]   mc_dest_qp_reg;
+    reg [23:0]   mc_qp_handle_reg;
+
+    wire         mc_walk_more  = (state_reg == S_MCAST_WALK) && qp_ctx_next_reg[31] &&
+                                 (mc_walk_reg != MCAST_MAX - 1);
+    wire [15:0]  qp_ctx_flags  = rdma_entry_valid ? rdma_flags : rdma_flags_reg;
+    wire [7:0]   qp_ctx_handle = mc_walk_more ? qp_ctx_next_reg[7:0] : qp_ctx_flags[FLAG_QP_LSB+7:FLAG_QP_LSB];
+    wire         qp_ctx_use    = rdma_flags_reg[FLAG_QP_CTX] && qp_ctx_qp_reg[31];
+    wire         mcast_entry   = rdma_flags[FLAG_QP_CTX] && rdma_flags[FLAG_MCAST];
+
+    // Entries start out invalid
+    integer qp_i;
+    initial begin
+        for (qp_i = 0; qp_i < 256; qp_i = qp_i + 1) begin
+            qp_ctx_qp_mem[qp_i]   = 32'd0;
+            qp_ctx_next_mem[qp_i] = 32'd0;
+        end
+    end
+
+    always @(posedge clk) begin
+        if (qp_ctx_wr && (qp_ctx_addr[1:0] == 2'd0))
+            qp_ctx_ip_mem[qp_ctx_addr[9:2]] <= qp_ctx_data;
+        if (qp_ctx_wr && (qp_ctx_addr[1:0] == 2'd1))
+            qp_ctx_ports_mem[qp_ctx_addr[9:2]] <= qp_ctx_data;
+        if (qp_ctx_wr && (qp_ctx_addr[1:0] == 2'd2))
+            qp_ctx_qp_mem[qp_ctx_addr[9:2]] <= qp_ctx_data;
+        if (qp_ctx_wr && (qp_ctx_addr[1:0] == 2'd3))
+            qp_ctx_next_mem[qp_ctx_addr[9:2]] <= qp_ctx_data;
+
+        qp_ctx_ip_reg    <= qp_ctx_ip_mem[qp_ctx_handle];
+        qp_ctx_ports_reg <= qp_ctx_ports_mem[qp_ctx_handle];
+        qp_ctx_qp_reg    <= qp_ctx_qp_mem[qp_ctx_handle];
+        qp_ctx_next_reg  <= qp_ctx_next_mem[qp_ctx_handle];
+        qp_ctx_handle_reg <= qp_ctx_handle;
+    end
+
+    // Members after the head are collected here; the head itself is read back into
+    // qp_ctx_*_reg once the walk ends (the handle returns to the SQE's)
+    always @(posedge clk) begin
+        if (rst) begin
+            mc_walk_reg      <= 2'd0;
+            mc_count_reg     <= 2'd0;
+            mc_dst_ip_reg    <= 96'd0;
+            mc_udp_ports_reg <= 96'd0;
+            mc_dest_qp_reg   <= 72'd0;
+            mc_qp_handle_reg <= 24'd0;
+        end else if (rdma_entry_valid || (state_reg == S_STRM_WQE)) begin
+            mc_walk_reg  <= 2'd0;
+            mc_count_reg <= 2'd0;
+        end else if (state_reg == S_MCAST_WALK) begin
+            mc_walk_reg <= mc_walk_reg + 2'd1;
+            if ((mc_walk_reg != 2'd0) && qp_ctx_qp_reg[31]) begin
+                mc_dst_ip_reg[mc_count_reg*32 +: 32]    <= qp_ctx_ip_reg;
+                mc_udp_ports_reg[mc_count_reg*32 +: 32] <= qp_ctx_ports_reg;
+                mc_dest_qp_reg[mc_count_reg*24 +: 24]   <= qp_ctx_qp_reg[23:0];
+                mc_qp_handle_reg[mc_count_reg*8 +: 8]   <= qp_ctx_handle_reg;
+                mc_count_reg <= mc_count_reg + 2'd1;
+            end
+        end
+    end
     
     // CQ Entry registers (8 x 32-bit = 32 bytes)
     reg [31:0]   cq_entry_reg_0;
@@ -144,10 +297,90 @@ module rdma_controller #(
     // Check if there's work to do
     wire has_work = (sq_head_reg != SQ_TAIL_SW);
     assign HAS_WORK = has_work;
+
+    // WQEs handed to tx_streamer and not yet completed. tx_streamer holds up to two (one
+    // on the wire, one preempted by a higher class), so the next SQE is fetched and offered
+    // while the first is still in flight. Completions may then come back out of SQ order.
+    reg [1:0]    inflight_valid;
+    reg [1:0]    inflight_pl;           // Submitted on the PL port
+    reg [1:0]    inflight_strm;         // Generated from the streaming ring
+    reg [7:0]    inflight_idx [0:1];
+    reg [31:0]   inflight_id  [0:1];
+    reg [31:0]   inflight_len [0:1];
+    reg [31:0]   cpl_id_reg;
+    reg [31:0]   cpl_len_reg;
+    // tx_cpl_* may already describe the next completion after the handshake (ACK window,
+    // READ tracking), so the CQE is built from copies taken at tx_cpl_fire
+    reg [7:0]    cpl_idx_reg;
+    reg [7:0]    cpl_status_reg;
+    reg [31:0]   cpl_bytes_reg;
+    reg [63:0]   cpl_orig_reg;
+    reg          offer_pending_reg;     // CQE write interrupted an unaccepted tx_cmd offer
+    reg          tx_cmd_valid_r;
+
+    wire tx_cmd_fire = tx_cmd_valid_r && tx_cmd_ready;
+    wire tx_cpl_fire = tx_cpl_valid && tx_cpl_ready;
+    wire new_slot    = inflight_valid[0];
+    wire cpl_slot    = inflight_valid[1] && (inflight_idx[1] == tx_cpl_sq_index);
+    wire fetch_work  = (sq_fetch_reg != SQ_TAIL_SW);
+
+    // SQ slots whose CQE is written, by index[7:0]. SQ_HEAD only moves past a contiguous run
+    // of them, so an out-of-order CQE never hands back a slot below an older WQE in flight.
+    // A fetch that would reuse the head's bit and index tag, or a bit still set, waits.
+    reg  [255:0] sq_retired_reg;
+    wire         fetch_wrap  = sq_retired_reg[sq_fetch_reg[7:0]] ||
+                               ((sq_fetch_reg != sq_head_reg) && (sq_fetch_reg[7:0] == sq_head_reg[7:0]));
+
+    // PL and streaming WQEs have no SQ slot. Their index tag is the other in-flight WQE's
+    // index (or the next SQ index) with bit 7 flipped, so it never matches a WQE in flight;
+    // an SQ fetch that would reuse the tag of such a WQE still in flight waits for it.
+    localparam [1:0] SRC_SQ   = 2'd0;
+    localparam [1:0] SRC_PL   = 2'd1;
+    localparam [1:0] SRC_STRM = 2'd2;
+    reg          src_pl_reg;            // The latched WQE came from the PL port
+    reg          src_strm_reg;          // The latched WQE was generated from the streaming ring
+    reg  [1:0]   last_src_reg;          // Source of the last WQE handed over
+    reg          cpl_pl_reg;            // The completion being written belongs to a PL WQE
+    reg          cpl_strm_reg;          // The completion belongs to a streaming WQE (no CQE)
+    reg  [2:0]   pl_cpl_beat_reg;
+    wire [1:0]   inflight_nosq = inflight_pl | inflight_strm;
+    wire         other_valid = inflight_valid[!new_slot];
+    wire [7:0]   pl_idx      = (other_valid ? inflight_idx[!new_slot] : sq_fetch_reg[7:0]) ^ 8'h80;
+    wire         fetch_clash = (inflight_valid[0] && inflight_nosq[0] && (inflight_idx[0] == sq_fetch_reg[7:0])) ||
+                               (inflight_valid[1] && inflight_nosq[1] && (inflight_idx[1] == sq_fetch_reg[7:0]));
+
+    // Streaming ring, byte offsets into the ring: software or a PL producer moves the
+    // producer index, each WRITE covers up to STRM_CHUNK bytes from the issue index (not
+    // across the ring end) to the same offset in the remote ring, and the consumer index
+    // follows the completions. All three are held at 0 while the ring is disabled.
+    reg  [31:0]  strm_prod_reg;
+    reg  [31:0]  strm_issue_reg;
+    reg  [31:0]  strm_cons_reg;
+    reg          strm_err_reg;
+    wire [31:0]  strm_avail  = (strm_prod_reg >= strm_issue_reg) ? (strm_prod_reg - strm_issue_reg) :
+                                                                   (STRM_SIZE - strm_issue_reg);
+    wire [31:0]  strm_len    = (strm_avail > STRM_CHUNK) ? STRM_CHUNK : strm_avail;
+    wire [31:0]  strm_issue_sum = strm_issue_reg + rdma_length_reg;
+    wire [31:0]  strm_cons_sum  = strm_cons_reg + cpl_len_reg;
+    assign STRM_PROD = strm_prod_reg;
+    assign STRM_CONS = {strm_err_reg, strm_cons_reg[30:0]};
+
+    wire         sq_ready    = START_RDMA && fetch_work && !fetch_clash && !fetch_wrap && !(&inflight_valid);
+    wire         pl_ready    = START_RDMA && pl_wqe_valid && !(&inflight_valid);
+    wire         strm_ready  = START_RDMA && STRM_EN && (strm_len != 32'd0) && !(&inflight_valid);
+    // Sources waiting at the same time take turns: SQ, PL port, streaming ring
+    wire [1:0]   pick_src    = (last_src_reg == SRC_SQ) ? (pl_ready   ? SRC_PL   : strm_ready ? SRC_STRM : SRC_SQ) :
+                               (last_src_reg == SRC_PL) ? (strm_ready ? SRC_STRM : sq_ready   ? SRC_SQ   : SRC_PL) :
+                                                          (sq_ready   ? SRC_SQ   : pl_ready   ? SRC_PL   : SRC_STRM);
+    wire [3:0]   fetch_state = (pick_src == SRC_PL)   ? S_PL_WQE :
+                               (pick_src == SRC_STRM) ? S_STRM_WQE : S_PREPARE_READ;
+    wire         can_fetch   = sq_ready || pl_ready || strm_ready;
     
     // Pointer increment with wraparound
     wire [SQ_IDX_WIDTH-1:0] sq_head_next =
         (sq_head_reg + 1 == SQ_SIZE) ? {SQ_IDX_WIDTH{1'b0}} : (sq_head_reg + 1);
+    wire [SQ_IDX_WIDTH-1:0] sq_fetch_next =
+        (sq_fetch_reg + 1 == SQ_SIZE) ? {SQ_IDX_WIDTH{1'b0}} : (sq_fetch_reg + 1);
     wire [SQ_IDX_WIDTH-1:0] cq_tail_next =
         (cq_tail_reg + 1 == CQ_SIZE) ? {SQ_IDX_WIDTH{1'b0}} : (cq_tail_reg + 1);
     // Sequential part
@@ -155,12 +388,43 @@ module rdma_controller #(
         if (rst) begin
             state_reg     <= S_IDLE;
             sq_head_reg   <= {SQ_IDX_WIDTH{1'b0}};
+            sq_fetch_reg  <= {SQ_IDX_WIDTH{1'b0}};
             cq_tail_reg   <= {SQ_IDX_WIDTH{1'b0}};
+            sq_retired_reg <= 256'd0;
+            inflight_valid <= 2'b00;
+            inflight_pl   <= 2'b00;
+            inflight_strm <= 2'b00;
+            src_pl_reg    <= 1'b0;
+            src_strm_reg  <= 1'b0;
+            last_src_reg  <= SRC_SQ;
+            cpl_pl_reg    <= 1'b0;
+            cpl_strm_reg  <= 1'b0;
+            strm_prod_reg  <= 32'd0;
+            strm_issue_reg <= 32'd0;
+            strm_cons_reg  <= 32'd0;
+            strm_err_reg   <= 1'b0;
+            pl_cpl_beat_reg <= 3'd0;
+            inflight_idx[0] <= 0;
+            inflight_idx[1] <= 0;
+            inflight_id[0]  <= 0;
+            inflight_id[1]  <= 0;
+            inflight_len[0] <= 0;
+            inflight_len[1] <= 0;
+            cpl_id_reg    <= 0;
+            cpl_len_reg   <= 0;
+            cpl_idx_reg   <= 0;
+            cpl_status_reg <= 0;
+            cpl_bytes_reg <= 0;
+            cpl_orig_reg  <= 0;
+            offer_pending_reg <= 1'b0;
             rdma_id_reg   <= 0;
             rdma_opcode_reg <= 0;
             rdma_local_key_reg <= 0;
             rdma_remote_key_reg <= 0;
             rdma_length_reg <= 0;
+            rdma_flags_reg <= 0;
+            rdma_btt_hi_reg <= 0;
+            rdma_reserved_reg <= 0;
             cq_entry_reg_0 <= 0;
             cq_entry_reg_1 <= 0;
             cq_entry_reg_2 <= 0;
@@ -179,15 +443,91 @@ module rdma_controller #(
                 rdma_local_key_reg <= rdma_local_key;
                 rdma_remote_key_reg <= rdma_remote_key;
                 rdma_length_reg <= rdma_btt[31:0];
+                rdma_flags_reg <= rdma_flags;
+                rdma_btt_hi_reg <= rdma_btt[127:32];
+                rdma_reserved_reg <= rdma_reserved;
+            end else if (state_reg == S_STRM_WQE) begin
+                // WRITE (0x0A) of the next chunk; destination from the QP context
+                rdma_id_reg <= 32'd0;
+                rdma_opcode_reg <= 16'h000A;
+                rdma_local_key_reg <= STRM_BASE_ADDR + strm_issue_reg;
+                rdma_remote_key_reg <= STRM_REMOTE_ADDR + strm_issue_reg;
+                rdma_length_reg <= strm_len;
+                rdma_flags_reg <= {4'd0, STRM_QP, 4'd0} | (16'd1 << FLAG_QP_CTX);
+                rdma_btt_hi_reg <= 96'd0;
+                rdma_reserved_reg <= {160'd0, STRM_RKEY};
             end
 
-            // Update pointers on CQ write completion
+            // PL completion stream: one beat per CQE word
+            if (state_reg != S_PL_CPL)
+                pl_cpl_beat_reg <= 3'd0;
+            else if (pl_cpl_tready)
+                pl_cpl_beat_reg <= pl_cpl_beat_reg + 3'd1;
+
+            // Update pointers: the CQ tail on CQ write completion, which also retires the
+            // WQE's SQ slot; the SQ head then steps over retired slots, one per cycle
+            if (sq_retired_reg[sq_head_reg[7:0]]) begin
+                sq_retired_reg[sq_head_reg[7:0]] <= 1'b0;
+                sq_head_reg <= sq_head_next;
+            end
             if ((state_reg == S_WAIT_WRITE_DONE) && WRITE_COMPLETE) begin
                 cq_tail_reg <= cq_tail_next;
-                sq_head_reg <= sq_head_next;
+                sq_retired_reg[cpl_idx_reg] <= 1'b1;
+            end
+
+            // Source of the next WQE, chosen where the FSM leaves for a fetch
+            if ((state_next == S_PREPARE_READ) || (state_next == S_PL_WQE) || (state_next == S_STRM_WQE)) begin
+                src_pl_reg   <= (state_next == S_PL_WQE);
+                src_strm_reg <= (state_next == S_STRM_WQE);
+            end
+
+            // Hand-off to tx_streamer: record the WQE and move on to the next descriptor
+            if (tx_cmd_fire) begin
+                if (!src_pl_reg && !src_strm_reg)
+                    sq_fetch_reg <= sq_fetch_next;
+                last_src_reg <= src_strm_reg ? SRC_STRM : src_pl_reg ? SRC_PL : SRC_SQ;
+                inflight_valid[new_slot] <= 1'b1;
+                inflight_pl[new_slot]    <= src_pl_reg;
+                inflight_strm[new_slot]  <= src_strm_reg;
+                inflight_idx[new_slot]   <= tx_cmd_sq_index;
+                inflight_id[new_slot]    <= rdma_id_reg;
+                inflight_len[new_slot]   <= rdma_length_reg;
+                offer_pending_reg <= 1'b0;
+            end else if ((state_reg == S_SEND_TX_CMD) && tx_cpl_fire) begin
+                offer_pending_reg <= 1'b1;
+            end
+
+            // Completion: retire the matching record (only one can be valid when a new WQE
+            // is recorded in the same cycle, so the two slots never collide)
+            if (tx_cpl_fire) begin
+                inflight_valid[cpl_slot] <= 1'b0;
+                cpl_pl_reg  <= inflight_pl[cpl_slot];
+                cpl_strm_reg <= inflight_strm[cpl_slot];
+                cpl_id_reg  <= inflight_id[cpl_slot];
+                cpl_len_reg <= inflight_len[cpl_slot];
+                cpl_idx_reg    <= tx_cpl_sq_index;
+                cpl_status_reg <= tx_cpl_status;
+                cpl_bytes_reg  <= tx_cpl_bytes_sent;
+                cpl_orig_reg   <= tx_cpl_atomic_orig;
+            end
+
+            // Streaming ring indices. A chunk is complete once tx_streamer reports it; the
+            // consumer index then frees it for the producer. Errors are kept in STRM_CONS[31].
+            if (!STRM_EN) begin
+                strm_prod_reg  <= 32'd0;
+                strm_issue_reg <= 32'd0;
+                strm_cons_reg  <= 32'd0;
+                strm_err_reg   <= 1'b0;
             end else begin
-                cq_tail_reg <= cq_tail_reg;
-                sq_head_reg <= sq_head_reg;
+                if (STRM_PROD_WR)
+                    strm_prod_reg <= STRM_PROD_IN;
+                if (tx_cmd_fire && src_strm_reg)
+                    strm_issue_reg <= (strm_issue_sum == STRM_SIZE) ? 32'd0 : strm_issue_sum;
+                if ((state_reg == S_PREPARE_WRITE) && cpl_strm_reg) begin
+                    strm_cons_reg <= (strm_cons_sum == STRM_SIZE) ? 32'd0 : strm_cons_sum;
+                    if (cpl_status_reg != 8'd0)
+                        strm_err_reg <= 1'b1;
+                end
             end
 
             // Build CQ entry in PREPARE_WRITE state (after TX completion)
@@ -198,27 +538,27 @@ module rdma_controller #(
                 // Word 1: Status (8-bit) | Opcode (8-bit) | Reserved (16-bit)
                 // Word 2: Bytes transferred (lower 32 bits)
                 // Word 3: Bytes transferred (upper 32 bits)
-                // Word 4-7: Reserved / Extended info
-                cq_entry_reg_0 <= {24'd0, tx_cpl_sq_index};
-                cq_entry_reg_1 <= {24'd0, tx_cpl_status};  // Status assumed success
-                cq_entry_reg_2 <= tx_cpl_bytes_sent;  // Use the original length as bytes sent
-                cq_entry_reg_3 <= {24'd0, tx_cpl_sq_index};  // Upper bytes (assuming 32-bit length)
-                cq_entry_reg_4 <= rdma_id_reg;  // Original WQE ID for reference
-                cq_entry_reg_5 <= rdma_length_reg;  // Original length requested
-                cq_entry_reg_6 <= 32'd0;  // Reserved
-                cq_entry_reg_7 <= 32'd0;  // Reserved
+                // Word 4-5: Original WQE ID / length
+                // Word 6-7: Atomic original value (lower / upper 32 bits)
+                cq_entry_reg_0 <= {24'd0, cpl_idx_reg};
+                cq_entry_reg_1 <= {24'd0, cpl_status_reg};
+                cq_entry_reg_2 <= cpl_bytes_reg;
+                cq_entry_reg_3 <= {24'd0, cpl_idx_reg};  // Upper bytes (assuming 32-bit length)
+                cq_entry_reg_4 <= cpl_id_reg;  // Original WQE ID for reference
+                cq_entry_reg_5 <= cpl_len_reg;  // Original length requested
+                cq_entry_reg_6 <= cpl_orig_reg[31:0];   // Atomics only, else stale
+                cq_entry_reg_7 <= cpl_orig_reg[63:32];
             end
         end
     end
 
     // Internal command registers (unified)
     reg                    cmd_ctrl_start_r;
-    reg [31:0]             cmd_ctrl_src_addr_r;
-    reg [31:0]             cmd_ctrl_dst_addr_r;
+    reg [ADDR_WIDTH-1:0]   cmd_ctrl_src_addr_r;
+    reg [ADDR_WIDTH-1:0]   cmd_ctrl_dst_addr_r;
     reg [31:0]             cmd_ctrl_btt_r;
     reg                    cmd_ctrl_is_read_r;
     reg                    start_stream_r;
-    reg                    tx_cmd_valid_r;
     
     // Output assignments
     assign CMD_CTRL_START    = cmd_ctrl_start_r;
@@ -228,20 +568,56 @@ module rdma_controller #(
     assign CMD_CTRL_IS_READ  = cmd_ctrl_is_read_r;
     
     assign tx_cmd_valid = tx_cmd_valid_r;
-    assign tx_cmd_sq_index = sq_head_reg[7:0];
-    assign tx_cmd_ddr_addr = rdma_local_key_reg[31:0];
+    assign tx_cmd_sq_index = (src_pl_reg || src_strm_reg) ? pl_idx : sq_fetch_reg[7:0];
+    assign tx_cmd_ddr_addr = rdma_local_key_reg[ADDR_WIDTH-1:0];
     assign tx_cmd_length = rdma_length_reg;
+    // Inline gather list (SQE flag SGE_INLINE): seg1 = {w8,w7} / w9, seg2 = {w12,w11} / w13
+    assign tx_cmd_sg1_addr   = sge_inline ? rdma_btt_hi_reg[ADDR_WIDTH-1:0] : {ADDR_WIDTH{1'b0}};
+    assign tx_cmd_sg1_length = sge_inline ? rdma_btt_hi_reg[95:64] : 32'd0;
+    assign tx_cmd_sg2_addr   = sge_inline ? rdma_reserved_reg[ADDR_WIDTH+31:32] : {ADDR_WIDTH{1'b0}};
+    assign tx_cmd_sg2_length = sge_inline ? rdma_reserved_reg[127:96] : 32'd0;
+    // 2D transfer (SQE flag STRIDED): word 6 = row length, word 7 = row count, words 8/9 = strides
+    assign tx_cmd_row_count  = strided ? rdma_btt_hi_reg[15:0]  : 16'd1;
+    assign tx_cmd_src_stride = strided ? rdma_btt_hi_reg[63:32] : 32'd0;
+    assign tx_cmd_dst_stride = strided ? rdma_btt_hi_reg[95:64] : 32'd0;
     assign tx_cmd_opcode = rdma_opcode_reg[7:0];
-    assign tx_cmd_dest_qp = rdma_id_reg[23:0];  // Assuming ID contains dest QP
+    // Without a (valid) QP context the ID carries the dest QP and the encapsulator defaults apply
+    assign tx_cmd_dest_qp = qp_ctx_use ? qp_ctx_qp_reg[23:0] : rdma_id_reg[23:0];
+    assign tx_cmd_qp_handle = qp_ctx_use ? qp_ctx_handle_reg : rdma_id_reg[7:0];
     assign tx_cmd_remote_addr = rdma_remote_key_reg;
-    assign tx_cmd_rkey = rdma_remote_key_reg[31:0];
+    assign tx_cmd_rkey = rdma_reserved_reg[31:0];  // SQE word 10
     assign tx_cmd_partition_key = 16'hFFFF;
-    assign tx_cmd_service_level = 8'h00;
-    assign tx_cmd_psn = 24'h000001;
-    
-    assign tx_cpl_ready = 1'b1; // Always ready for completion
+    assign tx_cmd_service_level = {4'd0, qp_ctx_use ? qp_ctx_qp_reg[27:24] : rdma_flags_reg[FLAG_SL_LSB+3:FLAG_SL_LSB]};
+    assign tx_cmd_local_rkey = rdma_reserved_reg[159:128];  // SQE word 14: READ sink buffer rkey
+    assign tx_cmd_imm = rdma_reserved_reg[191:160];         // SQE word 15: WRITE_WITH_IMM immediate
+    // Atomics: swap/add = {w8,w7}, compare = {w12,w11}
+    assign tx_cmd_atomic_swap_add = rdma_btt_hi_reg[63:0];
+    assign tx_cmd_atomic_compare  = rdma_reserved_reg[95:32];
+    assign tx_cmd_dst_ip          = qp_ctx_use ? qp_ctx_ip_reg : 32'd0;
+    assign tx_cmd_udp_ports       = qp_ctx_use ? qp_ctx_ports_reg : 32'd0;
+    assign tx_cmd_mc_count        = mc_count_reg;
+    assign tx_cmd_mc_dst_ip       = mc_dst_ip_reg;
+    assign tx_cmd_mc_udp_ports    = mc_udp_ports_reg;
+    assign tx_cmd_mc_dest_qp      = mc_dest_qp_reg;
+    assign tx_cmd_mc_qp_handle    = mc_qp_handle_reg;
+    // tx_streamer keeps its own copy of each accepted WQE for retransmission
+    // (PSNs are assigned per QP inside tx_streamer), so these may change after the handshake
+
+    // Completions are taken while waiting for one or while an offer is outstanding
+    assign tx_cpl_ready = (state_reg == S_WAIT_TX_CPL) || (state_reg == S_SEND_TX_CMD);
     assign STATE_REG = state_reg;
     assign START_STREAM = start_stream_r;
+
+    assign pl_wqe_sel    = (state_reg == S_PL_WQE);
+    assign pl_cpl_tvalid = (state_reg == S_PL_CPL);
+    assign pl_cpl_tlast  = (pl_cpl_beat_reg == 3'd7);
+    assign pl_cpl_tdata  = (pl_cpl_beat_reg == 3'd0) ? cq_entry_reg_0 :
+                           (pl_cpl_beat_reg == 3'd1) ? cq_entry_reg_1 :
+                           (pl_cpl_beat_reg == 3'd2) ? cq_entry_reg_2 :
+                           (pl_cpl_beat_reg == 3'd3) ? cq_entry_reg_3 :
+                           (pl_cpl_beat_reg == 3'd4) ? cq_entry_reg_4 :
+                           (pl_cpl_beat_reg == 3'd5) ? cq_entry_reg_5 :
+                           (pl_cpl_beat_reg == 3'd6) ? cq_entry_reg_6 : cq_entry_reg_7;
     
     // CQ Entry outputs
     assign cq_entry_0 = cq_entry_reg_0;
@@ -258,8 +634,12 @@ module rdma_controller #(
 
         case (state_reg)
             S_IDLE: begin
-                if (START_RDMA && has_work)
-                    state_next = S_PREPARE_READ;
+                if (offer_pending_reg)
+                    state_next = S_SEND_TX_CMD;
+                else if (can_fetch)
+                    state_next = fetch_state;
+                else if (inflight_valid != 2'b00)
+                    state_next = S_WAIT_TX_CPL;
             end
 
             S_PREPARE_READ: begin
@@ -278,21 +658,50 @@ module rdma_controller #(
 
             S_IS_STREAM_BUSY: begin
                 if (!IS_STREAM_BUSY && rdma_entry_valid)
+                    state_next = mcast_entry ? S_MCAST_WALK : S_SEND_TX_CMD;
+            end
+
+            S_PL_WQE: begin
+                // 16 beats from s01_axis through the SQE parser
+                if (rdma_entry_valid)
+                    state_next = mcast_entry ? S_MCAST_WALK : S_SEND_TX_CMD;
+            end
+
+            S_STRM_WQE: begin
+                // Next chunk latched into rdma_*_reg; the QP context is read on the way
+                state_next = S_SEND_TX_CMD;
+            end
+
+            S_MCAST_WALK: begin
+                // Group members are collected before the WQE is offered
+                if (!mc_walk_more)
                     state_next = S_SEND_TX_CMD;
             end
 
             S_SEND_TX_CMD: begin
-                if (tx_cmd_ready)
+                // tx_streamer may be busy with READ responses or a running WQE, so wait for a
+                // real handshake; a completion arriving meanwhile is written out first
+                if (tx_cpl_fire)
+                    state_next = S_PREPARE_WRITE;
+                else if (tx_cmd_fire)
                     state_next = S_WAIT_TX_CPL;
             end
 
             S_WAIT_TX_CPL: begin
-                if (tx_cpl_valid)
+                if (tx_cpl_fire)
                     state_next = S_PREPARE_WRITE;
+                else if (can_fetch)
+                    state_next = fetch_state;                            // Prefetch the next WQE
             end
 
             S_PREPARE_WRITE: begin
-                state_next = S_WRITE_CMD;
+                // Streaming chunks only advance the consumer index
+                state_next = cpl_strm_reg ? S_IDLE : cpl_pl_reg ? S_PL_CPL : S_WRITE_CMD;
+            end
+
+            S_PL_CPL: begin
+                if (pl_cpl_tready && pl_cpl_tlast)
+                    state_next = S_IDLE;
             end
 
             S_WRITE_CMD: begin
@@ -317,8 +726,8 @@ module rdma_controller #(
     always @(posedge clk) begin
         if (rst) begin
             cmd_ctrl_start_r    <= 1'b0;
-            cmd_ctrl_src_addr_r <= 32'd0;
-            cmd_ctrl_dst_addr_r <= 32'd0;
+            cmd_ctrl_src_addr_r <= {ADDR_WIDTH{1'b0}};
+            cmd_ctrl_dst_addr_r <= {ADDR_WIDTH{1'b0}};
             cmd_ctrl_btt_r      <= 32'd0;
             cmd_ctrl_is_read_r  <= 1'b1;
             tx_cmd_valid_r      <= 1'b0;
@@ -331,8 +740,8 @@ module rdma_controller #(
 
             case (state_reg)
                 S_PREPARE_READ: begin
-                    cmd_ctrl_src_addr_r <= SQ_BASE_ADDR[31:0] + (sq_head_reg << SQ_DESC_SHIFT);
-                    cmd_ctrl_dst_addr_r <= 32'd0;
+                    cmd_ctrl_src_addr_r <= SQ_BASE_ADDR + (sq_fetch_reg << SQ_DESC_SHIFT);
+                    cmd_ctrl_dst_addr_r <= {ADDR_WIDTH{1'b0}};
                     cmd_ctrl_btt_r      <= SQ_DESC_BYTES;
                     cmd_ctrl_is_read_r  <= 1'b1;
                 end
@@ -345,12 +754,12 @@ module rdma_controller #(
                 end
 
                 S_SEND_TX_CMD: begin
-                    tx_cmd_valid_r <= 1'b1;
+                    tx_cmd_valid_r <= !tx_cmd_fire && !tx_cpl_fire;
                 end
 
                 S_PREPARE_WRITE: begin
-                    cmd_ctrl_src_addr_r <= 32'd0;
-                    cmd_ctrl_dst_addr_r <= CQ_BASE_ADDR[31:0] + (cq_tail_reg << CQ_DESC_SHIFT);
+                    cmd_ctrl_src_addr_r <= {ADDR_WIDTH{1'b0}};
+                    cmd_ctrl_dst_addr_r <= CQ_BASE_ADDR + (cq_tail_reg << CQ_DESC_SHIFT);
                     cmd_ctrl_btt_r      <= CQ_DESC_BYTES;
                     cmd_ctrl_is_read_r  <= 1'b0;
                 end
@@ -0,0 +1,365 @@
+`timescale 1ns / 1ps
+
+//////////////////////////////////////////////////////////////////////////////////
+// ------------------------------------------------------------------------------
+// -- Company: KUL - Group T - RDMA Team
+// -- Engineer: Tubi Soyer <tugberksoyer@gmail.com>
+// --
+// -- Create Date: 22/11/2025 12:09:11 PM
+// -- Design Name:
+// -- Module Name: endpoint_lookup
+// -- Project Name: RDMA
+// -- Target Devices: Kria KR260
+// -- Tool Versions:
+// -- Description: IP -> MAC endpoint table.
+// --   Software writes the table through the AXI BRAM controller (port A).
+// --   16 bytes per entry, 512 entries:
+// --     +0x0: MAC[31:0]
+// --     +0x4: [31] valid, [15:0] MAC[47:32]
+// --     +0x8: IPv4 address
+// --     +0xC: reserved
+// --   Entry 0 is the local endpoint (source MAC, local IP). Peer entries are
+// --   2-way hashed: IP a.b.c.d goes to entry 2*(a^b^c^d) or 2*(a^b^c^d)+1.
+// --   Port B sweeps the table continuously into a wide internal copy, so a
+// --   lookup reads both ways of a bucket in one cycle. A software update is
+// --   seen within one sweep (3 reads per entry, 1536 cycles).
+// --   Lookups are pipelined (one per cycle, result after 2 cycles); a repeat
+// --   of the last hit is answered after 1 cycle from the last-hit cache.
+// --   Bindings learned by the RX ARP unit are written back through port B:
+// --   into the entry already holding the IP, else a free way, else way 1.
+// --
+// -- Dependencies:
+// --
+// -- Revision:
+// -- Revision 0.01 - File Created
+// -- Revision 0.02 - Hashed multi-entry table with last-hit cache
+// -- Revision 0.03 - Learned bindings written through port B
+// -- Additional Comments:
+// --
+// -------------------------------------------------------------------------------
+//////////////////////////////////////////////////////////////////////////////////
+
+module endpoint_lookup #(
+    parameter integer BRAM_LATENCY = 2     // address register to bram_dout sample
+)(
+    input  wire         clk,
+    input  wire         rstn,
+
+    // Lookup Interface
+    input  wire [31:0]  dst_ip,
+    input  wire         lookup_valid,
+    output wire         lookup_ready,
+    output reg          lookup_done,
+    output reg          lookup_hit,
+    output reg [47:0]   dst_mac,
+    output reg [47:0]   src_mac,
+    output reg          src_mac_valid,
+
+    // Learned bindings (from the RX ARP unit)
+    input  wire         learn_valid,   // Pulse
+    input  wire [31:0]  learn_ip,
+    input  wire [47:0]  learn_mac,
+
+    // BRAM Port B Interface (Connect to Block Memory Generator Port B)
+    output reg          bram_en,
+    output reg [3:0]    bram_we,       // Learned entry writes only
+    output reg [31:0]   bram_addr,
+    output reg [31:0]   bram_din,
+    input  wire [31:0]  bram_dout
+);
+
+    // Entry = {valid, ip[31:0], mac[47:0]}
+    localparam integer ENTRY_W = 81;
+
+    function [7:0] ip_hash;
+        input [31:0] ip;
+        begin
+            ip_hash = ip[31:24] ^ ip[23:16] ^ ip[15:8] ^ ip[7:0];
+        end
+    endfunction
+
+    // ------------------------------------------------------------------------
+    // Table sweep: BRAM port B -> internal copy
+    // ------------------------------------------------------------------------
+    // Learned entry write (driven by the learning FSM below)
+    wire        lrn_write;
+    wire [1:0]  lrn_word;
+    wire [31:0] lrn_din;
+    reg  [8:0]  lrn_entry;
+
+    reg [8:0] sweep_entry;
+    reg [1:0] sweep_word;                  // 0 = MAC low, 1 = valid/MAC high, 2 = IP
+    reg       table_loaded;                // one full sweep done since reset
+
+    // Read tags travelling alongside the BRAM latency
+    reg [BRAM_LATENCY-1:0] rd_valid_pipe;
+    reg [8:0]              rd_entry_pipe [0:BRAM_LATENCY-1];
+    reg [1:0]              rd_word_pipe  [0:BRAM_LATENCY-1];
+
+    wire       rd_valid = rd_valid_pipe[BRAM_LATENCY-1];
+    wire [8:0] rd_entry = rd_entry_pipe[BRAM_LATENCY-1];
+    wire [1:0] rd_word  = rd_word_pipe[BRAM_LATENCY-1];
+
+    reg [31:0] asm_mac_low;
+    reg [16:0] asm_mac_high;               // {valid, MAC[47:32]}
+
+    wire                 tbl_we    = rd_valid && (rd_word == 2'd2);
+    wire [ENTRY_W-1:0]   tbl_wdata = {asm_mac_high[16], bram_dout, asm_mac_high[15:0], asm_mac_low};
+
+    integer i;
+
+    always @(posedge clk) begin
+        if (!rstn) begin
+            sweep_entry   <= 9'd0;
+            sweep_word    <= 2'd0;
+            table_loaded  <= 1'b0;
+            rd_valid_pipe <= {BRAM_LATENCY{1'b0}};
+            bram_en       <= 1'b0;
+            bram_we       <= 4'b0000;
+            bram_addr     <= 32'd0;
+            bram_din      <= 32'd0;
+            asm_mac_low   <= 32'd0;
+            asm_mac_high  <= 17'd0;
+            src_mac       <= 48'h0;
+            src_mac_valid <= 1'b0;
+        end else begin
+            // Issue one read per cycle, forever, except while a learned entry is written
+            bram_en <= 1'b1;
+            if (lrn_write) begin
+                bram_we   <= 4'b1111;
+                bram_addr <= {19'd0, lrn_entry, lrn_word, 2'b00};
+                bram_din  <= lrn_din;
+            end else begin
+                bram_we   <= 4'b0000;
+                bram_addr <= {19'd0, sweep_entry, sweep_word, 2'b00};
+                if (sweep_word == 2'd2) begin
+                    sweep_word  <= 2'd0;
+                    sweep_entry <= sweep_entry + 9'd1;
+                end else begin
+                    sweep_word <= sweep_word + 2'd1;
+                end
+            end
+
+            rd_valid_pipe <= {rd_valid_pipe[BRAM_LATENCY-2:0], !lrn_write};
+
+            // Assemble the entry as its words come back
+            if (rd_valid) begin
+                case (rd_word)
+                    2'd0: asm_mac_low  <= bram_dout;
+                    2'd1: asm_mac_high <= {bram_dout[31], bram_dout[15:0]};
+                    default: ;
+                endcase
+            end
+
+            if (tbl_we) begin
+                if (rd_entry == 9'd0) begin
+                    src_mac       <= tbl_wdata[47:0];
+                    src_mac_valid <= tbl_wdata[80];
+                end
+                if (rd_entry == 9'd511)
+                    table_loaded <= 1'b1;
+            end
+        end
+    end
+
+    always @(posedge clk) begin
+        rd_entry_pipe[0] <= sweep_entry;
+        rd_word_pipe[0]  <= sweep_word;
+        for (i = 1; i < BRAM_LATENCY; i = i + 1) begin
+            rd_entry_pipe[i] <= rd_entry_pipe[i-1];
+            rd_word_pipe[i]  <= rd_word_pipe[i-1];
+        end
+    end
+
+    // Internal copy, one array per way so a bucket is read in a single cycle
+    reg [ENTRY_W-1:0] way0_mem [0:255];
+    reg [ENTRY_W-1:0] way1_mem [0:255];
+    reg [ENTRY_W-1:0] way0_rd;
+    reg [ENTRY_W-1:0] way1_rd;
+
+    initial begin
+        for (i = 0; i < 256; i = i + 1) begin
+            way0_mem[i] = {ENTRY_W{1'b0}};
+            way1_mem[i] = {ENTRY_W{1'b0}};
+        end
+    end
+
+    always @(posedge clk) begin
+        if (tbl_we && !rd_entry[0])
+            way0_mem[rd_entry[8:1]] <= tbl_wdata;
+        if (tbl_we && rd_entry[0])
+            way1_mem[rd_entry[8:1]] <= tbl_wdata;
+    end
+
+    // ------------------------------------------------------------------------
+    // Lookup pipeline
+    // ------------------------------------------------------------------------
+    // Held off until the first sweep has filled the internal copy
+    assign lookup_ready = table_loaded;
+
+    wire lookup_fire = lookup_valid && table_loaded;
+
+    // Last-hit cache, kept coherent with the sweep through its slot index
+    reg        cache_valid;
+    reg [31:0] cache_ip;
+    reg [47:0] cache_mac;
+    reg [8:0]  cache_slot;
+
+    reg        s1_valid;
+    reg [31:0] s1_ip;
+    reg [7:0]  s1_bucket;
+
+    // ------------------------------------------------------------------------
+    // Learning: read the bucket from the copy in a cycle without a lookup,
+    // pick the way, write the entry at an entry boundary of the sweep (so the
+    // sweep never assembles a half-old entry), then wait until the sweep has
+    // re-read it before taking the next binding.
+    // ------------------------------------------------------------------------
+    localparam [2:0] LRN_IDLE  = 3'd0;
+    localparam [2:0] LRN_READ  = 3'd1;    // Bucket on way0_rd / way1_rd
+    localparam [2:0] LRN_WRITE = 3'd2;    // Three words, sweep paused
+    localparam [2:0] LRN_SYNC  = 3'd3;    // Wait for the sweep to reload the entry
+
+    reg [2:0]  lrn_state;
+    reg        pend_valid;                // Newest binding not yet taken
+    reg [31:0] pend_ip;
+    reg [47:0] pend_mac;
+    reg [31:0] lrn_ip;                    // Binding being written
+    reg [47:0] lrn_mac;
+    reg [1:0]  lrn_cnt;
+    reg        lrn_reread;                // Sweep has issued the entry since the write
+
+    wire       lrn_issue = (lrn_state == LRN_IDLE) && pend_valid && table_loaded && !lookup_valid;
+    wire [7:0] rd_bucket = lrn_issue ? ip_hash(pend_ip) : ip_hash(dst_ip);
+
+    // Words in order MAC low, IP, valid + MAC high, so valid is set last
+    assign lrn_write = (lrn_state == LRN_WRITE) && ((lrn_cnt != 2'd0) || (sweep_word == 2'd0));
+    assign lrn_word  = (lrn_cnt == 2'd0) ? 2'd0 : (lrn_cnt == 2'd1) ? 2'd2 : 2'd1;
+    assign lrn_din   = (lrn_cnt == 2'd0) ? lrn_mac[31:0] :
+                       (lrn_cnt == 2'd1) ? lrn_ip : {1'b1, 15'd0, lrn_mac[47:32]};
+
+    wire [7:0] lrn_bucket = ip_hash(lrn_ip);
+    wire       lrn_way0_ok  = (lrn_bucket != 8'd0);          // Entry 0 is the local endpoint
+    wire       lrn_match0   = lrn_way0_ok && way0_rd[80] && (way0_rd[79:48] == lrn_ip);
+    wire       lrn_match1   = way1_rd[80] && (way1_rd[79:48] == lrn_ip);
+    wire       lrn_same     = (lrn_match0 && (way0_rd[47:0] == lrn_mac)) ||
+                              (lrn_match1 && (way1_rd[47:0] == lrn_mac));
+    wire       lrn_sel_way1 = !lrn_match0 && (lrn_match1 || !lrn_way0_ok || way0_rd[80]);
+
+    always @(posedge clk) begin
+        if (!rstn) begin
+            lrn_state  <= LRN_IDLE;
+            pend_valid <= 1'b0;
+            pend_ip    <= 32'd0;
+            pend_mac   <= 48'h0;
+            lrn_ip     <= 32'd0;
+            lrn_mac    <= 48'h0;
+            lrn_entry  <= 9'd0;
+            lrn_cnt    <= 2'd0;
+            lrn_reread <= 1'b0;
+        end else begin
+            // One binding waits while another is written; a newer one replaces it
+            if (learn_valid) begin
+                pend_valid <= 1'b1;
+                pend_ip    <= learn_ip;
+                pend_mac   <= learn_mac;
+            end else if (lrn_issue) begin
+                pend_valid <= 1'b0;
+            end
+
+            case (lrn_state)
+                LRN_IDLE: begin
+                    if (lrn_issue) begin
+                        lrn_ip    <= pend_ip;
+                        lrn_mac   <= pend_mac;
+                        lrn_state <= LRN_READ;
+                    end
+                end
+
+                LRN_READ: begin
+                    if (lrn_same || (lrn_ip == 32'd0)) begin
+                        lrn_state <= LRN_IDLE;
+                    end else begin
+                        lrn_entry <= {lrn_bucket, lrn_sel_way1};
+                        lrn_cnt   <= 2'd0;
+                        lrn_state <= LRN_WRITE;
+                    end
+                end
+
+                LRN_WRITE: begin
+                    if (lrn_write) begin
+                        lrn_cnt <= lrn_cnt + 2'd1;
+                        if (lrn_cnt == 2'd2) begin
+                            lrn_reread <= 1'b0;
+                            lrn_state  <= LRN_SYNC;
+                        end
+                    end
+                end
+
+                LRN_SYNC: begin
+                    if (sweep_entry == lrn_entry && sweep_word == 2'd0)
+                        lrn_reread <= 1'b1;
+                    if (lrn_reread && tbl_we && (rd_entry == lrn_entry))
+                        lrn_state <= LRN_IDLE;
+                end
+
+                default: lrn_state <= LRN_IDLE;
+            endcase
+        end
+    end
+
+    // The cache answers directly only when no older lookup is still in flight
+    wire cache_take = lookup_fire && cache_valid && (dst_ip == cache_ip) && !s1_valid;
+
+    wire s1_hit0 = way0_rd[80] && (way0_rd[79:48] == s1_ip);
+    wire s1_hit1 = way1_rd[80] && (way1_rd[79:48] == s1_ip);
+
+    always @(posedge clk) begin
+        way0_rd <= way0_mem[rd_bucket];
+        way1_rd <= way1_mem[rd_bucket];
+    end
+
+    always @(posedge clk) begin
+        if (!rstn) begin
+            lookup_done <= 1'b0;
+            lookup_hit  <= 1'b0;
+            dst_mac     <= 48'h0;
+            s1_valid    <= 1'b0;
+            s1_ip       <= 32'd0;
+            s1_bucket   <= 8'd0;
+            cache_valid <= 1'b0;
+            cache_ip    <= 32'd0;
+            cache_mac   <= 48'h0;
+            cache_slot  <= 9'd0;
+        end else begin
+            lookup_done <= 1'b0;
+
+            s1_valid  <= lookup_fire && !cache_take;
+            s1_ip     <= dst_ip;
+            s1_bucket <= ip_hash(dst_ip);
+
+            if (cache_take) begin
+                lookup_done <= 1'b1;
+                lookup_hit  <= 1'b1;
+                dst_mac     <= cache_mac;
+            end else if (s1_valid) begin
+                lookup_done <= 1'b1;
+                lookup_hit  <= s1_hit0 || s1_hit1;
+                dst_mac     <= s1_hit0 ? way0_rd[47:0] : way1_rd[47:0];
+                if (s1_hit0 || s1_hit1) begin
+                    cache_valid <= 1'b1;
+                    cache_ip    <= s1_ip;
+                    cache_mac   <= s1_hit0 ? way0_rd[47:0] : way1_rd[47:0];
+                    cache_slot  <= {s1_bucket, !s1_hit0};
+                end
+            end
+
+            // Sweep rewrote the cached slot: follow it, drop the entry if it changed owner
+            if (tbl_we && (rd_entry == cache_slot)) begin
+                cache_valid <= tbl_wdata[80] && (tbl_wdata[79:48] == cache_ip);
+                cache_mac   <= tbl_wdata[47:0];
+            end
+        end
+    end
+
+endmodule
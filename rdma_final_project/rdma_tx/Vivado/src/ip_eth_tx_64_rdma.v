@@ -35,10 +35,7 @@
 // -------------------------------------------------------------------------------
 //////////////////////////////////////////////////////////////////////////////////
 
-module ip_eth_tx_64_rdma #(
-    parameter [47:0] SRC_MAC = 48'h123456789ABC,
-    parameter [47:0] DST_MAC = 48'h000A35010203
-)(
+module ip_eth_tx_64_rdma (
     input  wire        iClk,
     input  wire        iRst,
 
@@ -50,6 +47,8 @@ module ip_eth_tx_64_rdma #(
     input  wire [31:0] s_dst_ip,
     input  wire [15:0] s_src_port,
     input  wire [15:0] s_dst_port,
+    input  wire [47:0] s_dst_mac,
+    input  wire [47:0] s_src_mac,
 
     // Payload input (AXI-Stream 32-bit)
     input  wire [31:0] s_payload_tdata,
@@ -97,6 +96,7 @@ reg [3:0] state_reg;
 reg [15:0] payload_len_reg;
 reg [31:0] src_ip_reg, dst_ip_reg;
 reg [15:0] src_port_reg, dst_port_reg;
+reg [47:0] dst_mac_reg, src_mac_reg;
 reg [15:0] total_len_reg;   // IP total length
 reg [15:0] udp_len_reg;     // UDP length
 reg [15:0] ip_id_reg;       // IP identification (increments per packet)
@@ -161,20 +161,20 @@ assign checksum_final = ~(checksum_step2[15:0] + checksum_step2[16]);
 
 // Word 0: Bytes 0-3 (Dst MAC [0:3])
 wire [31:0] hdr_word0 = {
-    DST_MAC[23:16], DST_MAC[31:24],             // Bytes 3,2: Dst MAC [3:2]
-    DST_MAC[39:32], DST_MAC[47:40]           // Bytes 1,0: Dst MAC [1:0]
+    dst_mac_reg[23:16], dst_mac_reg[31:24],  // Bytes 3,2: Dst MAC [3:2]
+    dst_mac_reg[39:32], dst_mac_reg[47:40]   // Bytes 1,0: Dst MAC [1:0]
 };
 
 // Word 1: Bytes 4-7 (Dst MAC [4:5] + Src MAC [0:1])
 wire [31:0] hdr_word1 = {
-    SRC_MAC[39:32], SRC_MAC[47:40],          // Bytes 7,6: Src MAC [1:0]
-    DST_MAC[7:0], DST_MAC[15:8]           // Bytes 5,4: Dst MAC [5:4]
+    src_mac_reg[39:32], src_mac_reg[47:40],  // Bytes 7,6: Src MAC [1:0]
+    dst_mac_reg[7:0], dst_mac_reg[15:8]      // Bytes 5,4: Dst MAC [5:4]
 };
 
 // Word 2: Bytes 8-11 (Src MAC [2:5])
 wire [31:0] hdr_word2 = {
-    SRC_MAC[7:0], SRC_MAC[15:8],             // Bytes 11,10: Src MAC [5:4]
-    SRC_MAC[23:16], SRC_MAC[31:24]           // Bytes 9,8: Src MAC [3:2]
+    src_mac_reg[7:0], src_mac_reg[15:8],     // Bytes 11,10: Src MAC [5:4]
+    src_mac_reg[23:16], src_mac_reg[31:24]   // Bytes 9,8: Src MAC [3:2]
 };
 
 // Word 3: Bytes 12-15 (EtherType + IP Version/IHL + DSCP)
@@ -249,6 +249,8 @@ always @(posedge iClk) begin
         dst_ip_reg      <= 32'd0;
         src_port_reg    <= 16'd0;
         dst_port_reg    <= 16'd0;
+        dst_mac_reg     <= 48'd0;
+        src_mac_reg     <= 48'd0;
         total_len_reg   <= 16'd0;
         udp_len_reg     <= 16'd0;
         ip_id_reg       <= 16'd1;
@@ -283,6 +285,8 @@ always @(posedge iClk) begin
                     dst_ip_reg      <= s_dst_ip;
                     src_port_reg    <= s_src_port;
                     dst_port_reg    <= s_dst_port;
+                    dst_mac_reg     <= s_dst_mac;
+                    src_mac_reg     <= s_src_mac;
 
                     total_len_reg <= 16'd28 + s_payload_len;  // 20 IP + 8 UDP + payload
                     udp_len_reg   <= 16'd8 + s_payload_len;   // 8 UDP + payload
@@ -13,6 +13,9 @@
 //   0x14: SRC_PORT  [15:0]=source UDP port
 //   0x18: DST_PORT  [15:0]=destination UDP port
 //   0x1C: PKT_CNT   [31:0]=transmitted packet count (read-only)
+//
+// Destination IP and UDP ports follow the current WQE's QP context
+// (dst_ip / udp_ports from tx_streamer); zero selects the parameter default.
 // ============================================================================
 module rdma_axilite_ctrl #(
     parameter [47:0] SRC_MAC = 48'h0123456789AB,
@@ -28,6 +31,8 @@ module rdma_axilite_ctrl #(
     input wire enable,
     input wire start,
     input wire [15:0] rdma_length,
+    input wire [31:0] dst_ip,     // 0 = DST_IP
+    input wire [31:0] udp_ports,  // {src, dst}, 0 = SRC_PORT/DST_PORT
     
     // AXI-Stream Slave: Payload Input (from DMA MM2S channel)
     input  wire [31:0] s_axis_payload_tdata,
@@ -42,7 +47,19 @@ module rdma_axilite_ctrl #(
     output wire        m_axis_packet_tvalid,
     input  wire        m_axis_packet_tready,
     output wire        m_axis_packet_tlast,
-    output wire [31:0] reg_ctrl_deb
+    output wire [31:0] reg_ctrl_deb,
+
+    // Learned IP -> MAC bindings (rdma_axilite_rx_ctrl learn_*)
+    input  wire        learn_valid,
+    input  wire [31:0] learn_ip,
+    input  wire [47:0] learn_mac,
+
+    // Endpoint table (blk_mem_gen_0 port B, see endpoint_lookup.v)
+    output wire        bram_en,
+    output wire [3:0]  bram_we,
+    output wire [31:0] bram_addr,
+    output wire [31:0] bram_din,
+    input  wire [31:0] bram_dout
 );
 //internal reset
 wire rst = ~rst_n;
@@ -104,9 +121,9 @@ always @(posedge clk) begin
         
     end else begin
         reg_src_ip   <= SRC_IP;           // 192.168.10.1
-        reg_dst_ip   <= DST_IP;           // 192.168.10.2
-        reg_src_port <= SRC_PORT;               // RoCEv2 default port
-        reg_dst_port <= DST_PORT;
+        reg_dst_ip   <= (dst_ip != 32'd0)          ? dst_ip           : DST_IP;
+        reg_src_port <= (udp_ports[31:16] != 16'd0) ? udp_ports[31:16] : SRC_PORT;
+        reg_dst_port <= (udp_ports[15:0] != 16'd0)  ? udp_ports[15:0]  : DST_PORT;
         reg_meta_len <= rdma_length;
         reg_ctrl <= {30'h0, start, enable};
        
@@ -207,7 +224,17 @@ rdma_ip_encap_integrated #(
     .o_error(dut_error),
     .o_error_code(dut_error_code),
     .o_busy(dut_busy),
-    .o_debug_state(dut_debug_state)
+    .o_debug_state(dut_debug_state),
+
+    // Endpoint table
+    .i_learn_valid(learn_valid),
+    .i_learn_ip(learn_ip),
+    .i_learn_mac(learn_mac),
+    .o_bram_en(bram_en),
+    .o_bram_we(bram_we),
+    .o_bram_addr(bram_addr),
+    .o_bram_din(bram_din),
+    .i_bram_dout(bram_dout)
 );
 
 endmodule
\ No newline at end of file
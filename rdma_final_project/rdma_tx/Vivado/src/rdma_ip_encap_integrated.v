@@ -62,7 +62,19 @@ module rdma_ip_encap_integrated #(
     output wire        o_busy,
 
     // Debug
-    output wire [2:0]  o_debug_state
+    output wire [2:0]  o_debug_state,
+
+    // Learned bindings (from the RX ARP unit)
+    input  wire        i_learn_valid,
+    input  wire [31:0] i_learn_ip,
+    input  wire [47:0] i_learn_mac,
+
+    // Endpoint table (BRAM port B)
+    output wire        o_bram_en,
+    output wire [3:0]  o_bram_we,
+    output wire [31:0] o_bram_addr,
+    output wire [31:0] o_bram_din,
+    input  wire [31:0] i_bram_dout
 );
 
 // Internal Signals: Validator → Streaming TX
@@ -108,22 +120,87 @@ rdma_meta_validator u_validator (
     .o_error_code(o_error_code)
 );
 
+//Endpoint Lookup: dst IP -> dst MAC, one lookup per validated header
+wire        w_lkp_ready;
+wire        w_lkp_done;
+wire        w_lkp_hit;
+wire [47:0] w_lkp_dst_mac;
+wire [47:0] w_lkp_src_mac;
+wire        w_lkp_src_valid;
+
+reg         lkp_busy;       // lookup issued for the header the validator holds
+reg         hdr_valid_reg;  // MACs resolved, header offered to the transmitter
+reg  [47:0] hdr_dst_mac_reg;
+reg  [47:0] hdr_src_mac_reg;
+wire        w_tx_hdr_ready;
+
+wire        w_lkp_valid = w_val_valid && !lkp_busy && !hdr_valid_reg;
+
+// Validator is released only when the transmitter takes the header
+assign w_val_ready = hdr_valid_reg && w_tx_hdr_ready;
+
+always @(posedge iClk) begin
+    if (!iRst) begin
+        lkp_busy        <= 1'b0;
+        hdr_valid_reg   <= 1'b0;
+        hdr_dst_mac_reg <= 48'h0;
+        hdr_src_mac_reg <= 48'h0;
+    end else begin
+        if (w_lkp_valid && w_lkp_ready)
+            lkp_busy <= 1'b1;
+
+        // A miss (or an empty table) falls back to the build-time MACs
+        if (w_lkp_done) begin
+            lkp_busy        <= 1'b0;
+            hdr_valid_reg   <= 1'b1;
+            hdr_dst_mac_reg <= w_lkp_hit ? w_lkp_dst_mac : DST_MAC;
+            hdr_src_mac_reg <= w_lkp_src_valid ? w_lkp_src_mac : SRC_MAC;
+        end
+
+        if (hdr_valid_reg && w_tx_hdr_ready)
+            hdr_valid_reg <= 1'b0;
+    end
+end
+
+endpoint_lookup u_endpoint_lookup (
+    .clk(iClk),
+    .rstn(iRst),
+
+    .dst_ip(w_val_dst_ip),
+    .lookup_valid(w_lkp_valid),
+    .lookup_ready(w_lkp_ready),
+    .lookup_done(w_lkp_done),
+    .lookup_hit(w_lkp_hit),
+    .dst_mac(w_lkp_dst_mac),
+    .src_mac(w_lkp_src_mac),
+    .src_mac_valid(w_lkp_src_valid),
+
+    .learn_valid(i_learn_valid),
+    .learn_ip(i_learn_ip),
+    .learn_mac(i_learn_mac),
+
+    .bram_en(o_bram_en),
+    .bram_we(o_bram_we),
+    .bram_addr(o_bram_addr),
+    .bram_din(o_bram_din),
+    .bram_dout(i_bram_dout)
+);
+
 //Streaming IP/UDP/Ethernet Transmitter
-ip_eth_tx_64_rdma #(
-    .SRC_MAC(SRC_MAC),
-    .DST_MAC(DST_MAC)
-) u_streaming_tx (
+ip_eth_tx_64_rdma u_streaming_tx (
     .iClk(iClk),
     .iRst(iRst),
     
     // Validated header input
-    .s_hdr_valid(w_val_valid),
-    .s_hdr_ready(w_val_ready),
+    .s_hdr_valid(hdr_valid_reg),
+    .s_hdr_ready(w_tx_hdr_ready),
     .s_payload_len(w_val_payload_len),
     .s_src_ip(w_val_src_ip),
     .s_dst_ip(w_val_dst_ip),
     .s_src_port(w_val_src_port),
     .s_dst_port(w_val_dst_port),
+    .s_dst_mac(hdr_dst_mac_reg),
+    .s_src_mac(hdr_src_mac_reg),
     
     // Payload input (direct from top-level)
     .s_payload_tdata(i_payload_axis_tdata),
@@ -30,7 +30,14 @@ module tx_header_inserter #(
     parameter RDMA_QPN_WIDTH     = 24,         // Queue Pair Number
     parameter RDMA_ADDR_WIDTH    = 64,         // Remote virtual address
     parameter RDMA_RKEY_WIDTH    = 32,         // Remote key
-    parameter RDMA_LENGTH_WIDTH  = 32          // DMA length
+    parameter RDMA_LENGTH_WIDTH  = 32,         // DMA length
+
+    parameter RDMA_OPCODE_READ_REQUEST = 8'h0C, // Appends the 3-beat read extension
+    parameter RDMA_OPCODE_WRITE_IMM    = 8'h0B, // Appends the 1-beat immediate
+    parameter RDMA_OPCODE_CMP_SWAP     = 8'h13, // Atomics append swap/add (2) + compare (2)
+    parameter RDMA_OPCODE_FETCH_ADD    = 8'h14,
+    parameter RDMA_OPCODE_ATOMIC_ACK   = 8'h12, // Appends the 2-beat original value
+    parameter RDMA_OPCODE_ACK          = 8'h11  // ACK/NAK: appends the 1-beat AETH (rdma_imm)
 ) (
     input  wire                             aclk,
     input  wire                             aresetn,
@@ -67,6 +74,14 @@ module tx_header_inserter #(
     input  wire [15:0]                      fragment_id,          // Fragment identifier
     input  wire                             more_fragments,       // More fragments flag
     input  wire [15:0]                      fragment_offset,       // Fragment offset
+
+    // READ request: no payload, header carries where the response must land
+    input  wire                             header_only,          // Packet ends with the header
+    input  wire [RDMA_ADDR_WIDTH-1:0]      read_sink_addr,
+    input  wire [RDMA_RKEY_WIDTH-1:0]      read_sink_rkey,
+    input  wire [31:0]                      rdma_imm,             // WRITE_WITH_IMM immediate
+    input  wire [63:0]                      atomic_data,          // Swap/add operand, or ACK original value
+    input  wire [63:0]                      atomic_compare,       // CMP_SWAP compare operand
     output wire start,
     output wire [15:0] rdma_sodir_length
 );
@@ -96,6 +111,16 @@ module tx_header_inserter #(
     reg                             more_fragments_reg;
     reg [15:0]                      fragment_offset_reg;
     
+    reg                             header_only_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]      read_sink_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]      read_sink_rkey_reg;
+    reg [31:0]                      rdma_imm_reg;
+    reg                             is_imm_reg;
+    reg [63:0]                      atomic_data_reg;
+    reg [63:0]                      atomic_compare_reg;
+    reg                             is_atomic_reg;         // Atomic request or ACK
+    reg [3:0]                       header_last_beat_reg;  // 8, 9 imm, 10 atomic ACK, 11 read, 12 atomic
+    
     // Master output registers
     reg [C_AXIS_TDATA_WIDTH-1:0]   m_axis_tdata_reg;
     reg [C_AXIS_TKEEP_WIDTH-1:0]   m_axis_tkeep_reg;
@@ -109,8 +134,23 @@ module tx_header_inserter #(
     reg                             tx_busy_reg;
     reg                             tx_done_reg;
     
-    localparam HEADER_SIZE_BITS = 208;
-    localparam HEADER_BEATS = 7;  // Fixed for 32-bit bus
+    localparam HEADER_SIZE_BITS = 288;
+    localparam HEADER_BEATS = 9;  // Fixed for 32-bit bus
+    localparam READ_HEADER_BEATS = 12;  // + sink address (2) + sink rkey (1)
+    localparam IMM_HEADER_BEATS = 10;   // + immediate (1)
+    localparam ATOMIC_HEADER_BEATS = 13;      // + swap/add (2) + compare (2)
+    localparam ATOMIC_ACK_HEADER_BEATS = 11;  // + original value (2)
+    
+    wire is_read_request = (rdma_opcode == RDMA_OPCODE_READ_REQUEST);
+    wire is_write_imm    = (rdma_opcode == RDMA_OPCODE_WRITE_IMM);
+    wire is_ack          = (rdma_opcode == RDMA_OPCODE_ACK);
+    wire is_atomic_req   = (rdma_opcode == RDMA_OPCODE_CMP_SWAP) || (rdma_opcode == RDMA_OPCODE_FETCH_ADD);
+    wire is_atomic_ack   = (rdma_opcode == RDMA_OPCODE_ATOMIC_ACK);
+    wire [3:0] header_beats = is_read_request ? READ_HEADER_BEATS       :
+                              (is_write_imm ||
+                               is_ack)        ? IMM_HEADER_BEATS        :
+                              is_atomic_req   ? ATOMIC_HEADER_BEATS     :
+                              is_atomic_ack   ? ATOMIC_ACK_HEADER_BEATS : HEADER_BEATS;
     
     assign m_axis_tdata  = m_axis_tdata_reg;
     assign m_axis_tkeep  = m_axis_tkeep_reg;
@@ -149,6 +189,15 @@ module tx_header_inserter #(
             fragment_id_reg        <= 0;
             more_fragments_reg     <= 0;
             fragment_offset_reg    <= 0;
+            header_only_reg        <= 0;
+            read_sink_addr_reg     <= 0;
+            read_sink_rkey_reg     <= 0;
+            rdma_imm_reg           <= 0;
+            is_imm_reg             <= 0;
+            atomic_data_reg        <= 0;
+            atomic_compare_reg     <= 0;
+            is_atomic_reg          <= 0;
+            header_last_beat_reg   <= HEADER_BEATS - 1;
             len_sent <= 0;
             sodir_len_reg <= 0;
             sodir_start_reg <= 0;
@@ -166,7 +215,17 @@ module tx_header_inserter #(
             fragment_id_reg        <= fragment_id;
             more_fragments_reg     <= more_fragments;
             fragment_offset_reg    <= fragment_offset;
-            sodir_len_reg <= rdma_length + HEADER_BEATS;
+            header_only_reg        <= header_only;
+            read_sink_addr_reg     <= read_sink_addr;
+            read_sink_rkey_reg     <= read_sink_rkey;
+            rdma_imm_reg           <= rdma_imm;
+            is_imm_reg             <= is_write_imm || is_ack;
+            atomic_data_reg        <= atomic_data;
+            atomic_compare_reg     <= atomic_compare;
+            is_atomic_reg          <= is_atomic_req || is_atomic_ack;
+            header_last_beat_reg   <= header_beats - 1'b1;
+            // UDP payload = RDMA header + data (a READ request's length is not on the wire)
+            sodir_len_reg <= (header_only ? 16'd0 : rdma_length[15:0]) + {header_beats, 2'b00};
             len_sent <= 1;
         end else if (len_sent == 1) begin
             len_sent <= 0;
@@ -209,7 +268,8 @@ module tx_header_inserter #(
                 m_axis_tvalid_reg = 1;
                 s_axis_tready_reg = 0;  // Don't accept data yet
                 m_axis_tkeep_reg = {C_AXIS_TKEEP_WIDTH{1'b1}};  // All bytes valid
-                m_axis_tlast_reg = 0;  // Not last beat (data follows)
+                // Not last beat unless the packet has no payload
+                m_axis_tlast_reg = header_only_reg && (header_beat_count_reg == header_last_beat_reg);
                 
                 // Multi-beat header transmission for 32-bit bus
                 case (header_beat_count_reg)
@@ -229,7 +289,7 @@ module tx_header_inserter #(
                     end
                     
                     4'd3: begin
-                        m_axis_tdata_reg = {16'h0000, fragment_offset_reg};
+                        m_axis_tdata_reg = {15'h0000, more_fragments_reg, fragment_offset_reg};
                     end
                     
                     4'd4: begin
@@ -244,6 +304,32 @@ module tx_header_inserter #(
                         m_axis_tdata_reg = {24'hababab, rdma_service_level_reg};
                     end
                     
+                    4'd7: begin
+                        m_axis_tdata_reg = rdma_rkey_reg;
+                    end
+                    
+                    4'd8: begin
+                        m_axis_tdata_reg = rdma_remote_addr_reg[63:32];
+                    end
+                    
+                    // Immediate, atomic operands, or READ request extension
+                    4'd9: begin
+                        m_axis_tdata_reg = is_imm_reg    ? rdma_imm_reg          :
+                                           is_atomic_reg ? atomic_data_reg[31:0] : read_sink_addr_reg[31:0];
+                    end
+                    
+                    4'd10: begin
+                        m_axis_tdata_reg = is_atomic_reg ? atomic_data_reg[63:32] : read_sink_addr_reg[63:32];
+                    end
+                    
+                    4'd11: begin
+                        m_axis_tdata_reg = is_atomic_reg ? atomic_compare_reg[31:0] : read_sink_rkey_reg;
+                    end
+                    
+                    4'd12: begin
+                        m_axis_tdata_reg = atomic_compare_reg[63:32];
+                    end
+                    
                     default: begin
                         m_axis_tdata_reg = 32'h0;
                     end
@@ -251,10 +337,16 @@ module tx_header_inserter #(
                 
                 // Advance to next beat when master is ready
                 if (m_axis_tready) begin
-                    if (header_beat_count_reg == HEADER_BEATS - 1) begin
-                        // All header beats sent, move to data phase
-                        state_next = STATE_SEND_DATA;
+                    if (header_beat_count_reg == header_last_beat_reg) begin
                         header_beat_count_next = 0;
+                        if (header_only_reg) begin
+                            // No payload: packet is complete
+                            state_next = STATE_IDLE;
+                            tx_done_reg = 1;
+                        end else begin
+                            // All header beats sent, move to data phase
+                            state_next = STATE_SEND_DATA;
+                        end
                     end else begin
                         // Send next header beat
                         header_beat_count_next = header_beat_count_reg + 1;
@@ -0,0 +1,192 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 11:58:14 PM
+-- Design Name:
+-- Module Name: tx_link_stripe
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Link aggregation, transmit side.
+--              Spreads the Ethernet frames of the encapsulator over two
+--              links (one eth_pkt_gen + AXI Ethernet MAC each). Frames are
+--              never split; the link is chosen per frame by link_mode:
+--                0: link 0 only
+--                1: round robin, one WRITE packet (fragment) per link in
+--                   turn; all other packets follow mode 2
+--                2: per flow, parity of the UDP source port (one port per
+--                   QP through the QP context table keeps a QP on one link)
+--                3: link 1 only
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   The UDP source port is in beat 8 of the frame and the RDMA opcode in
+--   beat 10, so frames are held in a 16-beat FIFO until the opcode is seen
+--   (or the frame ends); this adds 11 cycles of latency but no gaps between
+--   frames.
+--   A link that is not ready stalls both: frames leave in order.
+--   Round robin reorders packets between the links, so the receiver must
+--   run without the PSN check (CTRL[5] of rdma_axilite_rx_ctrl clear).
+--   Only plain WRITEs are striped: each packet carries its own remote
+--   address, so the data lands in place. SEND places by arrival order and
+--   WRITE_IMM / READ responses complete on their last packet, so those
+--   stay on the QP's flow link.
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module tx_link_stripe #(
+    parameter C_AXIS_TDATA_WIDTH = 32,
+    parameter C_AXIS_TKEEP_WIDTH = 4,
+    parameter RDMA_OPCODE_WRITE  = 8'h0A    // The only opcode striped in round-robin mode
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    input  wire [1:0]                       link_mode,        // CONTROL[12:11]
+
+    // Frames (from axis_data_fifo_1)
+    input  wire [C_AXIS_TDATA_WIDTH-1:0]    s_axis_tdata,
+    input  wire [C_AXIS_TKEEP_WIDTH-1:0]    s_axis_tkeep,
+    input  wire                             s_axis_tvalid,
+    output wire                             s_axis_tready,
+    input  wire                             s_axis_tlast,
+
+    // Link 0 (to eth_pkt_gen_0)
+    output wire [C_AXIS_TDATA_WIDTH-1:0]    m0_axis_tdata,
+    output wire [C_AXIS_TKEEP_WIDTH-1:0]    m0_axis_tkeep,
+    output wire                             m0_axis_tvalid,
+    input  wire                             m0_axis_tready,
+    output wire                             m0_axis_tlast,
+
+    // Link 1 (to eth_pkt_gen_1)
+    output wire [C_AXIS_TDATA_WIDTH-1:0]    m1_axis_tdata,
+    output wire [C_AXIS_TKEEP_WIDTH-1:0]    m1_axis_tkeep,
+    output wire                             m1_axis_tvalid,
+    input  wire                             m1_axis_tready,
+    output wire                             m1_axis_tlast
+);
+
+    localparam [1:0] MODE_LINK0 = 2'd0;
+    localparam [1:0] MODE_RR    = 2'd1;
+    localparam [1:0] MODE_FLOW  = 2'd2;
+    localparam [1:0] MODE_LINK1 = 2'd3;
+
+    localparam [3:0] PORT_BEAT   = 4'd8;   // Bytes 32-35: destination IP low half, UDP source port
+    localparam [3:0] OPCODE_BEAT = 4'd10;  // Bytes 40-43: UDP checksum, RDMA opcode, PSN low byte
+
+    localparam W = C_AXIS_TDATA_WIDTH + C_AXIS_TKEEP_WIDTH + 1;
+
+    // Frame beats
+    reg [W-1:0] data_mem [0:15];
+    reg [4:0]   data_wr_ptr;
+    reg [4:0]   data_rd_ptr;
+
+    // Link of each frame, pushed once the frame's link is known
+    reg [15:0]  lane_mem;
+    reg [4:0]   lane_wr_ptr;
+    reg [4:0]   lane_rd_ptr;
+
+    wire data_empty = (data_wr_ptr == data_rd_ptr);
+    wire data_full  = (data_wr_ptr - data_rd_ptr == 5'd16);
+    wire lane_empty = (lane_wr_ptr == lane_rd_ptr);
+    wire lane_full  = (lane_wr_ptr - lane_rd_ptr == 5'd16);
+
+    // ------------------------------------------------------------------------
+    // Write side: choose the link
+    // ------------------------------------------------------------------------
+    reg [3:0] wr_beat;                    // Beat of the incoming frame, stops at OPCODE_BEAT + 1
+    reg       rr_lane;
+    reg       flow_lane;                  // UDP source port parity of the incoming frame
+
+    assign s_axis_tready = !data_full && !lane_full;
+
+    wire wr_take = s_axis_tvalid && s_axis_tready;
+    wire decide  = wr_take && ((wr_beat == OPCODE_BEAT) || (s_axis_tlast && (wr_beat < OPCODE_BEAT)));
+
+    wire flow_new = (wr_beat == PORT_BEAT) ? ^s_axis_tdata[31:16] : flow_lane;
+    wire rr_write = (wr_beat == OPCODE_BEAT) && (s_axis_tdata[23:16] == RDMA_OPCODE_WRITE);
+
+    reg lane_new;
+    always @(*) begin
+        case (link_mode)
+            MODE_RR:    lane_new = rr_write ? rr_lane : flow_new;
+            MODE_FLOW:  lane_new = flow_new;
+            MODE_LINK1: lane_new = 1'b1;
+            default:    lane_new = 1'b0;
+        endcase
+    end
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            data_wr_ptr <= 5'd0;
+            lane_wr_ptr <= 5'd0;
+            wr_beat     <= 4'd0;
+            rr_lane     <= 1'b0;
+            flow_lane   <= 1'b0;
+        end else begin
+            if (wr_take) begin
+                data_mem[data_wr_ptr[3:0]] <= {s_axis_tlast, s_axis_tkeep, s_axis_tdata};
+                data_wr_ptr <= data_wr_ptr + 5'd1;
+                if (s_axis_tlast)
+                    wr_beat <= 4'd0;
+                else if (wr_beat <= OPCODE_BEAT)
+                    wr_beat <= wr_beat + 4'd1;
+                if (s_axis_tlast)
+                    flow_lane <= 1'b0;
+                else if (wr_beat == PORT_BEAT)
+                    flow_lane <= flow_new;
+            end
+            if (decide) begin
+                lane_mem[lane_wr_ptr[3:0]] <= lane_new;
+                lane_wr_ptr <= lane_wr_ptr + 5'd1;
+                if (rr_write)
+                    rr_lane <= !rr_lane;
+            end
+        end
+    end
+
+    // ------------------------------------------------------------------------
+    // Read side: forward whole frames to their link
+    // ------------------------------------------------------------------------
+    reg rd_active;                        // Inside a frame
+    reg rd_lane;
+
+    wire [W-1:0] head    = data_mem[data_rd_ptr[3:0]];
+    wire         rd_go   = rd_active || !lane_empty;
+    wire         lane    = rd_active ? rd_lane : lane_mem[lane_rd_ptr[3:0]];
+    wire         rd_ok   = rd_go && !data_empty;
+    wire         rd_take = rd_ok && (lane ? m1_axis_tready : m0_axis_tready);
+    wire         rd_last = head[W-1];
+
+    assign m0_axis_tdata  = head[C_AXIS_TDATA_WIDTH-1:0];
+    assign m0_axis_tkeep  = head[W-2:C_AXIS_TDATA_WIDTH];
+    assign m0_axis_tlast  = rd_last;
+    assign m0_axis_tvalid = rd_ok && !lane;
+
+    assign m1_axis_tdata  = head[C_AXIS_TDATA_WIDTH-1:0];
+    assign m1_axis_tkeep  = head[W-2:C_AXIS_TDATA_WIDTH];
+    assign m1_axis_tlast  = rd_last;
+    assign m1_axis_tvalid = rd_ok && lane;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            data_rd_ptr <= 5'd0;
+            lane_rd_ptr <= 5'd0;
+            rd_active   <= 1'b0;
+            rd_lane     <= 1'b0;
+        end else if (rd_take) begin
+            data_rd_ptr <= data_rd_ptr + 5'd1;
+            if (!rd_active) begin
+                lane_rd_ptr <= lane_rd_ptr + 5'd1;
+                rd_lane     <= lane;
+            end
+            rd_active <= !rd_last;
+        end
+    end
+
+endmodule
@@ -0,0 +1,164 @@
+----------------------------------------------------------------------------------
+-- Company: KUL - Group T - RDMA Team
+-- Engineer: Tolga Kuntman <kuntmantolga@gmail.com>
+--
+-- Create Date: 10/18/2026 11:04:52 PM
+-- Design Name:
+-- Module Name: tx_local_dma
+-- Project Name: RDMA
+-- Target Devices: Kria KR260
+-- Tool Versions:
+-- Description: Payload stream router for local (non-network) WQEs.
+--              Normally the MM2S payload stream goes to the header inserter.
+--              For LOCAL_COPY it is looped into the S2MM stream of the same
+--              DataMover, so data moves DDR-to-DDR without Ethernet framing.
+--              For LOCAL_FILL the S2MM stream is sourced here with a repeated
+--              32-bit pattern (zero fill = pattern 0).
+--              Every payload fragment sent to the header inserter is also
+--              kept in a fragment buffer; replay_start sends it again, so a
+--              multicast WQE reads each fragment from DDR only once.
+--
+-- Dependencies:
+--
+-- Revision:
+-- Revision 0.01 - File Created
+-- Additional Comments:
+--   copy_en must be held by tx_streamer for the whole copy chunk.
+--   A fill chunk ends with TLAST and a partial TKEEP when fill_len is not a
+--   multiple of 4, matching the EOF S2MM command issued for it.
+--   The fragment buffer holds 1 << BUF_DEPTH_WIDTH beats, which must cover
+--   tx_streamer's BLOCK_SIZE; a replay is only started once the fragment
+--   has been fully sent (header inserter done).
+--
+----------------------------------------------------------------------------------
+`timescale 1ns / 1ps
+
+module tx_local_dma #(
+    parameter C_AXIS_TDATA_WIDTH = 32,
+    parameter C_AXIS_TKEEP_WIDTH = 4,
+    parameter C_BTT_WIDTH        = 23,
+    parameter BUF_DEPTH_WIDTH    = 8            // Fragment buffer: 256 beats = 1 KB
+) (
+    input  wire                             aclk,
+    input  wire                             aresetn,
+
+    // Control (from tx_streamer)
+    input  wire                             copy_en,          // Route MM2S into S2MM
+    input  wire                             fill_start,       // Pulse: generate fill_len bytes
+    input  wire [C_BTT_WIDTH-1:0]           fill_len,
+    input  wire [31:0]                      fill_pattern,
+    output wire                             fill_busy,
+    input  wire                             replay_start,     // Pulse: resend the last fragment
+    output wire                             replay_busy,
+
+    // MM2S payload stream (from axi_datamover_1)
+    input  wire [C_AXIS_TDATA_WIDTH-1:0]    s_axis_tdata,
+    input  wire [C_AXIS_TKEEP_WIDTH-1:0]    s_axis_tkeep,
+    input  wire                             s_axis_tvalid,
+    output wire                             s_axis_tready,
+    input  wire                             s_axis_tlast,
+
+    // To tx_header_inserter
+    output wire [C_AXIS_TDATA_WIDTH-1:0]    m_axis_hdr_tdata,
+    output wire [C_AXIS_TKEEP_WIDTH-1:0]    m_axis_hdr_tkeep,
+    output wire                             m_axis_hdr_tvalid,
+    input  wire                             m_axis_hdr_tready,
+    output wire                             m_axis_hdr_tlast,
+
+    // To axi_datamover_1 S2MM
+    output wire [C_AXIS_TDATA_WIDTH-1:0]    m_axis_s2mm_tdata,
+    output wire [C_AXIS_TKEEP_WIDTH-1:0]    m_axis_s2mm_tkeep,
+    output wire                             m_axis_s2mm_tvalid,
+    input  wire                             m_axis_s2mm_tready,
+    output wire                             m_axis_s2mm_tlast
+);
+
+    localparam BEAT_BYTES = C_AXIS_TKEEP_WIDTH;
+
+    reg                             fill_active_reg;
+    reg [C_BTT_WIDTH-1:0]           fill_left_reg;      // Bytes still to generate
+    reg [31:0]                      fill_pattern_reg;
+
+    wire fill_last = (fill_left_reg <= BEAT_BYTES);
+    wire [C_AXIS_TKEEP_WIDTH-1:0] fill_keep = (fill_last && (fill_left_reg != BEAT_BYTES)) ?
+                                              ({C_AXIS_TKEEP_WIDTH{1'b1}} >> (BEAT_BYTES - fill_left_reg)) :
+                                              {C_AXIS_TKEEP_WIDTH{1'b1}};
+
+    assign fill_busy = fill_active_reg;
+
+    // Fragment buffer {tlast, tkeep, tdata} (distributed RAM, read combinationally)
+    localparam BUF_W = C_AXIS_TDATA_WIDTH + C_AXIS_TKEEP_WIDTH + 1;
+
+    (* ram_style = "distributed" *)
+    reg [BUF_W-1:0]             buf_mem [0:(1<<BUF_DEPTH_WIDTH)-1];
+    reg [BUF_DEPTH_WIDTH-1:0]   cap_ptr_reg;        // Next beat of the fragment being captured
+    reg                         replay_active_reg;
+    reg [BUF_DEPTH_WIDTH-1:0]   replay_ptr_reg;
+
+    wire [BUF_W-1:0] replay_beat = buf_mem[replay_ptr_reg];
+
+    assign replay_busy = replay_active_reg;
+
+    // Header inserter path: untouched unless a copy or a replay is running
+    assign m_axis_hdr_tdata  = replay_active_reg ? replay_beat[C_AXIS_TDATA_WIDTH-1:0] : s_axis_tdata;
+    assign m_axis_hdr_tkeep  = replay_active_reg ? replay_beat[BUF_W-2:C_AXIS_TDATA_WIDTH] : s_axis_tkeep;
+    assign m_axis_hdr_tvalid = replay_active_reg || (s_axis_tvalid && !copy_en);
+    assign m_axis_hdr_tlast  = replay_active_reg ? replay_beat[BUF_W-1] : s_axis_tlast;
+
+    assign s_axis_tready = copy_en ? m_axis_s2mm_tready : (m_axis_hdr_tready && !replay_active_reg);
+
+    wire capture = s_axis_tvalid && s_axis_tready && !copy_en;
+
+    always @(posedge aclk) begin
+        if (capture)
+            buf_mem[cap_ptr_reg] <= {s_axis_tlast, s_axis_tkeep, s_axis_tdata};
+    end
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            cap_ptr_reg       <= 0;
+            replay_active_reg <= 1'b0;
+            replay_ptr_reg    <= 0;
+        end else begin
+            if (capture)
+                cap_ptr_reg <= s_axis_tlast ? {BUF_DEPTH_WIDTH{1'b0}} : cap_ptr_reg + 1'b1;
+
+            if (replay_start && !replay_active_reg) begin
+                replay_active_reg <= 1'b1;
+                replay_ptr_reg    <= 0;
+            end else if (replay_active_reg && m_axis_hdr_tready) begin
+                replay_ptr_reg <= replay_ptr_reg + 1'b1;
+                if (replay_beat[BUF_W-1])
+                    replay_active_reg <= 1'b0;
+            end
+        end
+    end
+
+    // S2MM path: fill generator, else the looped-back MM2S stream
+    assign m_axis_s2mm_tdata  = fill_active_reg ? {(C_AXIS_TDATA_WIDTH/32){fill_pattern_reg}} : s_axis_tdata;
+    assign m_axis_s2mm_tkeep  = fill_active_reg ? fill_keep : s_axis_tkeep;
+    assign m_axis_s2mm_tvalid = fill_active_reg || (copy_en && s_axis_tvalid);
+    assign m_axis_s2mm_tlast  = fill_active_reg ? fill_last : s_axis_tlast;
+
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            fill_active_reg  <= 1'b0;
+            fill_left_reg    <= 0;
+            fill_pattern_reg <= 0;
+        end else begin
+            if (fill_start && !fill_active_reg && (fill_len != 0)) begin
+                fill_active_reg  <= 1'b1;
+                fill_left_reg    <= fill_len;
+                fill_pattern_reg <= fill_pattern;
+            end else if (fill_active_reg && m_axis_s2mm_tready) begin
+                if (fill_last) begin
+                    fill_active_reg <= 1'b0;
+                    fill_left_reg   <= 0;
+                end else begin
+                    fill_left_reg   <= fill_left_reg - BEAT_BYTES;
+                end
+            end
+        end
+    end
+
+endmodule
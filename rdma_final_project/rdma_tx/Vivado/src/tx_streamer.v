@@ -21,7 +21,7 @@
 
 module tx_streamer #(
     // Data Mover Parameters
-    parameter C_ADDR_WIDTH       = 32,          // DDR address width
+    parameter C_ADDR_WIDTH       = 64,          // DDR address width (DataMover c_addr_width)
     parameter C_DATA_WIDTH       = 32,          // AXI-Stream data width
     parameter C_BTT_WIDTH        = 23,          // Bytes to transfer width (up to 8MB)
     
@@ -36,7 +36,33 @@ module tx_streamer #(
     parameter RDMA_QPN_WIDTH     = 24,
     parameter RDMA_ADDR_WIDTH    = 64,
     parameter RDMA_RKEY_WIDTH    = 32,
-    parameter RDMA_LENGTH_WIDTH  = 32
+    parameter RDMA_LENGTH_WIDTH  = 32,
+    parameter QP_IDX_WIDTH       = 2,           // Shaper / DCQCN buckets: 4 (low QPN bits)
+    parameter QP_KEY_WIDTH       = 8,           // PSN table: one entry per QP context handle
+    parameter REL_WIN_BITS       = 1,           // Reliable WQEs awaiting ACKs: 2 (rdma_controller keeps 2 in flight)
+    
+    // DCQCN-style congestion control (rates in RATE_CFG units, 100 MHz timings)
+    parameter CC_ALPHA_CYCLES    = 5500,        // Alpha decay period (55 us)
+    parameter CC_RATE_CYCLES     = 5500,        // Rate increase period (55 us)
+    parameter CC_G_SHIFT         = 4,           // Alpha gain g = 1/16
+    parameter CC_FAST_STAGES     = 5,           // Fast-recovery steps before additive increase
+    parameter CC_RAI_SHIFT       = 5,           // Additive increase: configured rate / 32
+    parameter CC_LINE_RATE       = 16'd320,     // Ceiling of QPs without a RATE (1 Gb/s at 100 MHz)
+    
+    // READ completes with an error after this many cycles without a response when
+    // retry_timeout is 0 (100 ms), so a READ to a silent peer cannot stall the SQ
+    parameter RD_TIMEOUT_DEFAULT = 32'd10_000_000,
+    
+    parameter RDMA_OPCODE_READ_REQUEST  = 8'h0C,
+    parameter RDMA_OPCODE_READ_RESPONSE = 8'h10,
+    parameter RDMA_OPCODE_CMP_SWAP      = 8'h13,
+    parameter RDMA_OPCODE_FETCH_ADD     = 8'h14,
+    parameter RDMA_OPCODE_ATOMIC_ACK    = 8'h12,
+    parameter RDMA_OPCODE_ACK           = 8'h11,    // ACK / NAK, AETH in the immediate beat
+    parameter RDMA_OPCODE_CNP           = 8'h81,    // Congestion notification, header only
+    // Local-only WQEs: DDR-to-DDR copy and fill, no packet is sent
+    parameter RDMA_OPCODE_LOCAL_COPY    = 8'h20,
+    parameter RDMA_OPCODE_LOCAL_FILL    = 8'h21
 ) (
     // Clock and Reset
     input  wire                             aclk,
@@ -46,20 +72,94 @@ module tx_streamer #(
     output wire                             tx_cmd_ready,
     input  wire [SQ_INDEX_WIDTH-1:0]       tx_cmd_sq_index,      // Send Queue index
     input  wire [C_ADDR_WIDTH-1:0]         tx_cmd_ddr_addr,      // DDR payload address
-    input  wire [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_length,        // Total payload length
+    input  wire [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_length,        // Segment 0 payload length
+    input  wire [C_ADDR_WIDTH-1:0]         tx_cmd_sg1_addr,      // Gather segment 1 DDR address
+    input  wire [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_sg1_length,    // Gather segment 1 length (0 = unused)
+    input  wire [C_ADDR_WIDTH-1:0]         tx_cmd_sg2_addr,      // Gather segment 2 DDR address
+    input  wire [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_sg2_length,    // Gather segment 2 length (0 = unused)
+    input  wire [15:0]                      tx_cmd_row_count,     // 2D transfer: rows of tx_cmd_length bytes (0/1 = linear)
+    input  wire [31:0]                      tx_cmd_src_stride,    // 2D transfer: source row pitch in bytes
+    input  wire [31:0]                      tx_cmd_dst_stride,    // 2D transfer: destination row pitch in bytes
     input  wire [RDMA_OPCODE_WIDTH-1:0]    tx_cmd_opcode,        // RDMA opcode
     input  wire [RDMA_QPN_WIDTH-1:0]       tx_cmd_dest_qp,       // Destination QP
     input  wire [RDMA_ADDR_WIDTH-1:0]      tx_cmd_remote_addr,   // Remote virtual address
     input  wire [RDMA_RKEY_WIDTH-1:0]      tx_cmd_rkey,          // Remote key
     input  wire [15:0]                      tx_cmd_partition_key, // Partition key
     input  wire [7:0]                       tx_cmd_service_level, // Service level
-    input  wire [RDMA_PSN_WIDTH-1:0]       tx_cmd_psn,           // Starting PSN
+    input  wire [RDMA_RKEY_WIDTH-1:0]      tx_cmd_local_rkey,    // READ: rkey of the local sink buffer
+    input  wire [31:0]                      tx_cmd_imm,           // WRITE_WITH_IMM: immediate data
+    input  wire [63:0]                      tx_cmd_atomic_swap_add, // CMP_SWAP swap value / FETCH_ADD addend
+    input  wire [63:0]                      tx_cmd_atomic_compare,  // CMP_SWAP compare value
+    input  wire [31:0]                      tx_cmd_dst_ip,        // QP context: peer IPv4 (0 = encapsulator default)
+    input  wire [31:0]                      tx_cmd_udp_ports,     // QP context: {src, dst} UDP port (0 = default)
+    input  wire [1:0]                       tx_cmd_mc_count,      // Multicast: further group members (0 = unicast)
+    input  wire [95:0]                      tx_cmd_mc_dst_ip,     // Member k at [32k+31:32k]
+    input  wire [95:0]                      tx_cmd_mc_udp_ports,
+    input  wire [71:0]                      tx_cmd_mc_dest_qp,    // Member k at [24k+23:24k]
+    input  wire [7:0]                       tx_cmd_qp_handle,     // QP context handle (QPN[7:0] without one): PSN key
+    input  wire [23:0]                      tx_cmd_mc_qp_handle,  // Member k at [8k+7:8k]
+    
+    // READ responses requested by the remote side (from rx_streamer), served before new WQEs
+    input  wire                             rd_rsp_valid,
+    output wire                             rd_rsp_ready,
+    input  wire [C_ADDR_WIDTH-1:0]         rd_rsp_src_addr,
+    input  wire [RDMA_LENGTH_WIDTH-1:0]    rd_rsp_length,
+    input  wire [RDMA_ADDR_WIDTH-1:0]      rd_rsp_remote_addr,
+    input  wire [RDMA_RKEY_WIDTH-1:0]      rd_rsp_rkey,
+    input  wire [RDMA_QPN_WIDTH-1:0]       rd_rsp_dest_qp,
+    input  wire [RDMA_PSN_WIDTH-1:0]       rd_rsp_psn,
+    input  wire                             rd_rsp_atomic,        // Send an ATOMIC_ACK instead of READ data
+    input  wire [63:0]                      rd_rsp_orig,          // ATOMIC_ACK: original memory value
+    input  wire [7:0]                       rd_rsp_sl,            // Service level of the request
+    
+    // Last READ response landed locally (from rx_streamer), completes the pending READ WQE
+    input  wire                             read_done,
+    // ATOMIC_ACK received (from rx_streamer), completes the pending atomic WQE
+    input  wire                             atomic_done,
+    input  wire [63:0]                      atomic_orig,
+    
+    // Reliable delivery of WRITE / WRITE_IMM / SEND: Go-Back-N on NAK or ACK timeout
+    input  wire [31:0]                      retry_timeout,        // ACK timeout in cycles, 0 = no ACKs expected
+    input  wire [2:0]                       retry_limit,          // Retransmissions before the WQE fails
+    input  wire                             ack_rcvd,             // ACK / NAK received (from rx_streamer)
+    input  wire [RDMA_QPN_WIDTH-1:0]       ack_rcvd_dest_qp,
+    input  wire [RDMA_PSN_WIDTH-1:0]       ack_rcvd_psn,
+    input  wire [7:0]                       ack_rcvd_syndrome,
+    
+    // ACK / NAK owed to the remote requester (from rx_streamer), header-only packet
+    input  wire                             ack_tx_valid,
+    output wire                             ack_tx_ready,
+    input  wire [RDMA_QPN_WIDTH-1:0]       ack_tx_dest_qp,
+    input  wire [RDMA_PSN_WIDTH-1:0]       ack_tx_psn,
+    input  wire [7:0]                       ack_tx_syndrome,
+    
+    // Per-QP token-bucket shaper, loaded from RATE_CFG: [31:30] QP, [29:16] burst in 64-byte
+    // units, [15:0] rate in bytes per 256 cycles (0 = not shaped)
+    input  wire [31:0]                      rate_cfg,
+    input  wire                             rate_cfg_wr,         // Pulse
+    
+    // Congestion control: CNPs received cut the shaped rate of their QP (cc_enable = CONTROL[9])
+    input  wire                             cc_enable,
+    input  wire                             cnp_rcvd,             // CNP received (from rx_streamer)
+    input  wire [RDMA_QPN_WIDTH-1:0]       cnp_rcvd_dest_qp,
+    
+    // CNP owed to a congested sender (from rx_streamer), header-only packet
+    input  wire                             cnp_tx_valid,
+    output wire                             cnp_tx_ready,
+    input  wire [RDMA_QPN_WIDTH-1:0]       cnp_tx_dest_qp,
+    
+    // Traffic classes: SL n belongs to class tc_map[2n+1:2n] (3 = most urgent). Strict priority,
+    // or WRR with tc_weight[8c+7:8c] fragments per turn for class c (tc_wrr = CONTROL[10])
+    input  wire [31:0]                      tc_map,
+    input  wire [31:0]                      tc_weight,
+    input  wire                             tc_wrr,
     
     output wire                             tx_cpl_valid,
     input  wire                             tx_cpl_ready,
     output wire [SQ_INDEX_WIDTH-1:0]       tx_cpl_sq_index,      // Original SQ index
     output wire [7:0]                       tx_cpl_status,        // 0=success, non-zero=error
     output wire [RDMA_LENGTH_WIDTH-1:0]    tx_cpl_bytes_sent,    // Total bytes transmitted
+    output wire [63:0]                      tx_cpl_atomic_orig,   // Atomic WQE: value before the operation
     
     output wire                             hdr_start_tx,
     input  wire                             hdr_tx_busy,
@@ -75,14 +175,36 @@ module tx_streamer #(
     output wire [15:0]                      hdr_fragment_id,
     output wire                             hdr_more_fragments,
     output wire [15:0]                      hdr_fragment_offset,
+    output wire                             hdr_header_only,
+    output wire [RDMA_ADDR_WIDTH-1:0]      hdr_read_sink_addr,
+    output wire [RDMA_RKEY_WIDTH-1:0]      hdr_read_sink_rkey,
+    output wire [31:0]                      hdr_imm,
+    output wire [63:0]                      hdr_atomic_data,
+    output wire [63:0]                      hdr_atomic_compare,
+    output wire [31:0]                      hdr_dst_ip,           // To the IP encapsulator
+    output wire [31:0]                      hdr_udp_ports,
     
     // Data Mover MM2S Command Interface (AXI-Stream)
-    output wire [71:0]                      m_axis_mm2s_cmd_tdata,
+    output wire [C_ADDR_WIDTH+39:0]         m_axis_mm2s_cmd_tdata,
     output wire                             m_axis_mm2s_cmd_tvalid,
     input  wire                             m_axis_mm2s_cmd_tready,
     
     // Data Mover MM2S Status Interface
     input  wire                             mm2s_rd_xfer_cmplt,
+    
+    // Data Mover S2MM Command Interface (local copy / fill destination)
+    output wire [C_ADDR_WIDTH+39:0]         m_axis_s2mm_cmd_tdata,
+    output wire                             m_axis_s2mm_cmd_tvalid,
+    input  wire                             m_axis_s2mm_cmd_tready,
+    input  wire                             s2mm_wr_xfer_cmplt,
+    
+    // Payload routing (to tx_local_dma)
+    output wire                             local_copy_en,
+    output wire                             local_fill_start,     // Pulse
+    output wire [C_BTT_WIDTH-1:0]          local_fill_len,
+    output wire [31:0]                      local_fill_pattern,
+    output wire                             mc_replay_start,      // Pulse: resend the buffered fragment
+    
     output wire [3:0]                       streamer_state
 );
 
@@ -95,6 +217,18 @@ module tx_streamer #(
     localparam [3:0] STATE_WAIT_HDR_DONE  = 4'd6;
     localparam [3:0] STATE_UPDATE_STATE   = 4'd7;
     localparam [3:0] STATE_SEND_CPL       = 4'd8;
+    localparam [3:0] STATE_LOCAL_CMD      = 4'd9;
+    localparam [3:0] STATE_LOCAL_WAIT     = 4'd10;
+    localparam [3:0] STATE_ACK_HEADER     = 4'd11;
+    
+    // Completion status of a reliable WQE
+    localparam [7:0] CPL_ST_RETRY_EXC     = 8'h01;   // No ACK after retry_limit retransmissions
+    localparam [7:0] CPL_ST_REM_ACC_ERR   = 8'h02;   // Responder NAKed a packet (remote access error)
+    localparam [7:0] CPL_ST_INV_REQ       = 8'h03;   // Responder NAKed an atomic as invalid (misaligned)
+    localparam [7:0] CPL_ST_REM_OP_ERR    = 8'h04;   // Responder's atomic read-modify-write failed
+    
+    // Local jobs are cut into DataMover commands of at most 4 MB
+    localparam [31:0] LOCAL_CHUNK_MAX = 32'd1 << (C_BTT_WIDTH - 1);
     
     reg [3:0] state_reg, state_next;
     
@@ -103,13 +237,205 @@ module tx_streamer #(
     reg [RDMA_LENGTH_WIDTH-1:0]    cmd_length_reg;
     reg [RDMA_OPCODE_WIDTH-1:0]    cmd_opcode_reg;
     reg [RDMA_QPN_WIDTH-1:0]       cmd_dest_qp_reg;
+    reg [QP_KEY_WIDTH-1:0]         cmd_qp_key_reg;      // psn_table entry of the destination
     reg [RDMA_ADDR_WIDTH-1:0]      cmd_remote_addr_reg;
     reg [RDMA_RKEY_WIDTH-1:0]      cmd_rkey_reg;
     reg [15:0]                      cmd_partition_key_reg;
     reg [7:0]                       cmd_service_level_reg;
     reg [RDMA_PSN_WIDTH-1:0]       cmd_psn_reg;
+    reg [C_ADDR_WIDTH-1:0]         cmd_sg1_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]    cmd_sg1_length_reg;
+    reg [C_ADDR_WIDTH-1:0]         cmd_sg2_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]    cmd_sg2_length_reg;
+    reg [15:0]                      cmd_row_count_reg;
+    reg [31:0]                      cmd_src_stride_reg;
+    reg [31:0]                      cmd_dst_stride_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]      cmd_local_rkey_reg;
+    reg [31:0]                      cmd_imm_reg;
+    reg [63:0]                      cmd_atomic_data_reg;    // Swap/add operand, or ACK original value
+    reg [63:0]                      cmd_atomic_compare_reg;
+    reg [31:0]                      cmd_dst_ip_reg;
+    reg [31:0]                      cmd_udp_ports_reg;
+    reg                             is_rsp_reg;          // Current job is a READ response or ATOMIC_ACK
+    
+    // Multicast WQE: each fragment is read from DDR for the head member (the cmd_* destination)
+    // and replayed by tx_local_dma for every further member with that member's header
+    reg [1:0]                       cmd_mc_count_reg;
+    reg [95:0]                      cmd_mc_dst_ip_reg;
+    reg [95:0]                      cmd_mc_udp_ports_reg;
+    reg [71:0]                      cmd_mc_dest_qp_reg;
+    reg [23:0]                      cmd_mc_qp_key_reg;
+    reg [71:0]                      cmd_mc_psn_reg;      // First PSN of each member
+    reg [1:0]                       mc_member_reg;       // Member of the current fragment, 0 = head
+    
+    // Outstanding READ / atomic WQE: completed when its last response has landed, on a
+    // remote access NAK for its PSN, or once the response timeout has expired retry_limit times
+    reg                             rd_pending_reg;
+    reg                             rd_done_seen_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]    rd_length_reg;
+    reg [63:0]                      atomic_orig_reg;
+    reg                             rd_fail_reg;
+    reg [7:0]                       rd_status_reg;
+    reg [RDMA_QPN_WIDTH-1:0]       rd_qp_reg;
+    reg [RDMA_PSN_WIDTH-1:0]       rd_psn_reg;
+    reg [2:0]                       rd_retry_cnt_reg;
+    reg [31:0]                      rd_timer_reg;
+    
+    // Next PSN per QP, keyed by the QP context handle, so peers whose QPNs share low bits
+    // keep separate sequences. WRITE / WRITE_IMM / SEND packets consume one PSN each;
+    // READ / atomic requests carry the next PSN without consuming it.
+    reg [RDMA_PSN_WIDTH-1:0]       psn_table [0:(1<<QP_KEY_WIDTH)-1];
+    integer                         i;
+    
+    // Reliable WQEs in flight. A WQE whose last packet has gone out enters the ACK window and
+    // completes once una_psn_reg passes its last PSN. Further WQEs to the same QP are sent while
+    // the window has room; a retransmission replays the window from its oldest entry, resending
+    // from una_psn_reg.
+    reg                             rel_active_reg;      // Current WQE expects ACKs (first pass)
+    reg                             replay_reg;          // Current pass is a retransmission
+    reg                             rel_fail_reg;
+    reg                             nak_seq_reg;         // Responder asked for a resend
+    reg [RDMA_PSN_WIDTH-1:0]        wqe_psn_reg;         // First PSN of the WQE
+    reg [RDMA_PSN_WIDTH-1:0]       last_psn_reg;        // Last PSN of the newest window entry
+    reg [RDMA_PSN_WIDTH-1:0]       una_psn_reg;         // Oldest unacknowledged PSN
+    reg [RDMA_QPN_WIDTH-1:0]       rel_qp_reg;
+    reg [QP_KEY_WIDTH-1:0]         rel_qp_key_reg;
+    reg [7:0]                       rel_status_reg;
+    reg [2:0]                       retry_cnt_reg;
+    reg [31:0]                      ack_timer_reg;
+    reg                             ack_job_reg;         // Current packet is an ACK / NAK / CNP
+    reg                             ack_resume_reg;      // ... sent between two fragments of a job
+    
+    // Copy of the reliable WQE for retransmission, so rdma_controller is free to fetch the next one
+    reg [C_ADDR_WIDTH-1:0]          wqe_ddr_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     wqe_length_reg;
+    reg [RDMA_OPCODE_WIDTH-1:0]     wqe_opcode_reg;
+    reg [RDMA_QPN_WIDTH-1:0]        wqe_dest_qp_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]       wqe_remote_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]       wqe_rkey_reg;
+    reg [15:0]                      wqe_partition_key_reg;
+    reg [7:0]                       wqe_service_level_reg;
+    reg [C_ADDR_WIDTH-1:0]          wqe_sg1_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     wqe_sg1_length_reg;
+    reg [C_ADDR_WIDTH-1:0]          wqe_sg2_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     wqe_sg2_length_reg;
+    reg [15:0]                      wqe_row_count_reg;
+    reg [31:0]                      wqe_src_stride_reg;
+    reg [31:0]                      wqe_dst_stride_reg;
+    reg [31:0]                      wqe_imm_reg;
+    reg [63:0]                      wqe_atomic_data_reg;
+    reg [63:0]                      wqe_atomic_compare_reg;
+    reg [31:0]                      wqe_dst_ip_reg;
+    reg [31:0]                      wqe_udp_ports_reg;
+    
+    // ACK window: copies of the sent reliable WQEs, oldest at win_head_reg
+    localparam WIN_DEPTH = 1 << REL_WIN_BITS;
+    reg [C_ADDR_WIDTH-1:0]          win_ddr_addr        [0:WIN_DEPTH-1];
+    reg [RDMA_LENGTH_WIDTH-1:0]     win_length          [0:WIN_DEPTH-1];
+    reg [RDMA_OPCODE_WIDTH-1:0]     win_opcode          [0:WIN_DEPTH-1];
+    reg [RDMA_QPN_WIDTH-1:0]        win_dest_qp         [0:WIN_DEPTH-1];
+    reg [RDMA_ADDR_WIDTH-1:0]       win_remote_addr     [0:WIN_DEPTH-1];
+    reg [RDMA_RKEY_WIDTH-1:0]       win_rkey            [0:WIN_DEPTH-1];
+    reg [15:0]                      win_partition_key   [0:WIN_DEPTH-1];
+    reg [7:0]                       win_service_level   [0:WIN_DEPTH-1];
+    reg [C_ADDR_WIDTH-1:0]          win_sg1_addr        [0:WIN_DEPTH-1];
+    reg [RDMA_LENGTH_WIDTH-1:0]     win_sg1_length      [0:WIN_DEPTH-1];
+    reg [C_ADDR_WIDTH-1:0]          win_sg2_addr        [0:WIN_DEPTH-1];
+    reg [RDMA_LENGTH_WIDTH-1:0]     win_sg2_length      [0:WIN_DEPTH-1];
+    reg [15:0]                      win_row_count       [0:WIN_DEPTH-1];
+    reg [31:0]                      win_src_stride      [0:WIN_DEPTH-1];
+    reg [31:0]                      win_dst_stride      [0:WIN_DEPTH-1];
+    reg [31:0]                      win_imm             [0:WIN_DEPTH-1];
+    reg [31:0]                      win_dst_ip          [0:WIN_DEPTH-1];
+    reg [31:0]                      win_udp_ports       [0:WIN_DEPTH-1];
+    reg [RDMA_PSN_WIDTH-1:0]        win_psn             [0:WIN_DEPTH-1];   // First PSN
+    reg [RDMA_PSN_WIDTH-1:0]        win_last_psn        [0:WIN_DEPTH-1];
+    reg [RDMA_LENGTH_WIDTH-1:0]     win_bytes           [0:WIN_DEPTH-1];
+    reg [SQ_INDEX_WIDTH-1:0]        win_sq_index        [0:WIN_DEPTH-1];
+    reg [REL_WIN_BITS-1:0]          win_head_reg;
+    reg [REL_WIN_BITS-1:0]          win_tail_reg;
+    reg [REL_WIN_BITS:0]            win_cnt_reg;
+    reg [REL_WIN_BITS-1:0]          rp_idx_reg;          // Window entry being retransmitted
+    reg                             rp_more_reg;         // ... and the replay continues with it
+    
+    // Job preempted at a fragment boundary by a more urgent class (one level deep). A WQE is
+    // only preempted on its first pass, before any ACK wait, and takes its ACK state along.
+    reg                             bank_valid_reg;
+    reg                             bank_is_rsp_reg;
+    reg [C_ADDR_WIDTH-1:0]          bank_ddr_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_length_reg;
+    reg [RDMA_OPCODE_WIDTH-1:0]     bank_opcode_reg;
+    reg [RDMA_QPN_WIDTH-1:0]        bank_dest_qp_reg;
+    reg [QP_KEY_WIDTH-1:0]          bank_qp_key_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]       bank_remote_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]       bank_rkey_reg;
+    reg [15:0]                      bank_partition_key_reg;
+    reg [7:0]                       bank_service_level_reg;
+    reg [C_ADDR_WIDTH-1:0]          bank_sg1_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_sg1_length_reg;
+    reg [C_ADDR_WIDTH-1:0]          bank_sg2_addr_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_sg2_length_reg;
+    reg [15:0]                      bank_row_count_reg;
+    reg [31:0]                      bank_src_stride_reg;
+    reg [31:0]                      bank_dst_stride_reg;
+    reg [31:0]                      bank_imm_reg;
+    reg [31:0]                      bank_dst_ip_reg;
+    reg [31:0]                      bank_udp_ports_reg;
+    reg [RDMA_PSN_WIDTH-1:0]        bank_psn_reg;
+    reg [SQ_INDEX_WIDTH-1:0]        bank_sq_index_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_remaining_len_reg;
+    reg [1:0]                       bank_seg_idx_reg;
+    reg [15:0]                      bank_rows_left_reg;
+    reg [C_ADDR_WIDTH-1:0]          bank_row_src_addr_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]       bank_row_dst_addr_reg;
+    reg [C_ADDR_WIDTH-1:0]          bank_current_addr_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]       bank_current_remote_addr_reg;
+    reg [15:0]                      bank_frag_idx_reg;
+    reg [15:0]                      bank_frag_offset_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_chunk_len_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]     bank_total_sent_reg;
+    reg [RDMA_PSN_WIDTH-1:0]        bank_una_psn_reg;
+    reg [7:0]                       bank_rel_status_reg;
+    reg                             bank_rel_active_reg;
+    reg                             bank_rel_fail_reg;
+    reg                             bank_nak_seq_reg;
+    reg [7:0]                       tc_frag_cnt_reg;     // Fragments sent in the current turn
+    
+    // Token buckets in 1/256 byte units. A payload fragment may start while its QP's bucket is
+    // not negative and then takes its full length, so fragments larger than the burst still go.
+    // Buckets (and the DCQCN state below) are per QPN[QP_IDX_WIDTH-1:0]: such QPs share one.
+    reg [15:0]                      rate_table   [0:(1<<QP_IDX_WIDTH)-1];
+    reg [27:0]                      burst_table  [0:(1<<QP_IDX_WIDTH)-1];
+    reg signed [31:0]               tokens_table [0:(1<<QP_IDX_WIDTH)-1];
+    reg signed [32:0]               tokens_next;
+    integer                         q;
+    
+    // QPs whose payload fragments are shaped: a configured RATE, or any QP while DCQCN is on
+    reg [(1<<QP_IDX_WIDTH)-1:0]    qp_shaped;
+    reg [(1<<QP_IDX_WIDTH)-1:0]    qp_open;             // Bucket lets a fragment start
+    integer                         k;
+    
+    // DCQCN state per QP: current and target rate, alpha (1.0 = 1024), recovery stage
+    reg [15:0]                      cc_rate   [0:(1<<QP_IDX_WIDTH)-1];
+    reg [15:0]                      cc_target [0:(1<<QP_IDX_WIDTH)-1];
+    reg [10:0]                      cc_alpha  [0:(1<<QP_IDX_WIDTH)-1];
+    reg [2:0]                       cc_stage  [0:(1<<QP_IDX_WIDTH)-1];
+    reg [(1<<QP_IDX_WIDTH)-1:0]    cc_cnp_seen;         // CNP since the last alpha update
+    reg [(1<<QP_IDX_WIDTH)-1:0]    cc_cut;              // Rate cut since the last increase
+    reg [31:0]                      cc_alpha_timer;
+    reg [31:0]                      cc_rate_timer;
+    reg [16:0]                      cc_sum;
+    reg [16:0]                      cc_target_next;
+    reg [15:0]                      cc_ceil;             // Configured RATE, or CC_LINE_RATE
+    wire [QP_IDX_WIDTH-1:0]         cc_qp       = cnp_rcvd_dest_qp[QP_IDX_WIDTH-1:0];
+    wire [26:0]                     cc_cut_prod = cc_rate[cc_qp] * cc_alpha[cc_qp];
+    wire [15:0]                     cc_cut_amt  = cc_cut_prod[26:11];     // rate * alpha / 2
     
-    reg [RDMA_LENGTH_WIDTH-1:0]    remaining_len_reg;
+    reg [RDMA_LENGTH_WIDTH-1:0]    remaining_len_reg;   // Bytes left in the current segment
+    reg [1:0]                       seg_idx_reg;         // Current gather segment (0..2)
+    reg [15:0]                      rows_left_reg;       // Rows still to send, including the current one
+    reg [C_ADDR_WIDTH-1:0]         row_src_addr_reg;    // Source address of the current row
+    reg [RDMA_ADDR_WIDTH-1:0]      row_dst_addr_reg;    // Remote address of the current row
     reg [C_ADDR_WIDTH-1:0]         current_addr_reg;
     reg [RDMA_ADDR_WIDTH-1:0]      current_remote_addr_reg;
     reg [15:0]                      frag_idx_reg;
@@ -129,52 +455,244 @@ module tx_streamer #(
     reg [15:0]                      hdr_frag_id_reg;
     reg                             hdr_more_frags_reg;
     reg [15:0]                      hdr_frag_offset_reg;
+    reg                             hdr_header_only_reg;
+    reg [RDMA_ADDR_WIDTH-1:0]      hdr_read_sink_addr_reg;
+    reg [RDMA_RKEY_WIDTH-1:0]      hdr_read_sink_rkey_reg;
+    reg [31:0]                      hdr_imm_reg;
+    reg [63:0]                      hdr_atomic_data_reg;
+    reg [63:0]                      hdr_atomic_compare_reg;
+    reg [31:0]                      hdr_dst_ip_reg;
+    reg [31:0]                      hdr_udp_ports_reg;
     reg                             hdr_start_tx_reg;
     
     reg [C_ADDR_WIDTH-1:0]         mm2s_addr_reg;
     reg [C_BTT_WIDTH-1:0]          mm2s_btt_reg;
     reg                             mm2s_valid_reg;
     
+    reg [C_ADDR_WIDTH-1:0]         s2mm_addr_reg;
+    reg [C_BTT_WIDTH-1:0]          s2mm_btt_reg;
+    reg                             s2mm_valid_reg;
+    reg                             local_cmd_issued_reg;  // Commands for the current chunk sent
+    
     reg                             tx_cpl_valid_reg;
     reg [SQ_INDEX_WIDTH-1:0]       tx_cpl_sq_index_reg;
     reg [7:0]                       tx_cpl_status_reg;
     reg [RDMA_LENGTH_WIDTH-1:0]    tx_cpl_bytes_sent_reg;
     
+    wire [RDMA_LENGTH_WIDTH-1:0]   remaining_after;
+    wire [C_ADDR_WIDTH-1:0]        addr_after;
     wire [RDMA_LENGTH_WIDTH-1:0]   chunk_to_boundary;
     wire [RDMA_LENGTH_WIDTH-1:0]   chunk_by_block;
     wire [RDMA_LENGTH_WIDTH-1:0]   chunk_len_next;
+    wire                            seg_more;
     wire                            more_fragments;
     
+    // Next gather segment / next row
+    wire [C_ADDR_WIDTH-1:0]        next_seg_addr;
+    wire [RDMA_LENGTH_WIDTH-1:0]   next_seg_length;
+    wire                            has_next_seg;
+    wire                            has_next_row;
+    wire [C_ADDR_WIDTH-1:0]        next_row_src_addr;
+    wire [RDMA_ADDR_WIDTH-1:0]     next_row_dst_addr;
+    wire [C_ADDR_WIDTH-1:0]        next_blk_addr;
+    wire [RDMA_LENGTH_WIDTH-1:0]   next_blk_length;
+    wire                            has_next_blk;
+    wire [RDMA_LENGTH_WIDTH-1:0]   seg_chunk_to_boundary;
+    wire [RDMA_LENGTH_WIDTH-1:0]   seg_chunk_by_block;
+    wire [RDMA_LENGTH_WIDTH-1:0]   seg_first_chunk_len;
+    
     // For first fragment calculation (using command inputs)
     wire [RDMA_LENGTH_WIDTH-1:0]   first_chunk_to_boundary;
     wire [RDMA_LENGTH_WIDTH-1:0]   first_chunk_by_block;
     wire [RDMA_LENGTH_WIDTH-1:0]   first_chunk_len;
     
-    // Calculate bytes remaining to next 4KB boundary (for current fragment)
-    assign chunk_to_boundary = BOUNDARY_4KB - (current_addr_reg & (BOUNDARY_4KB - 1));
+    // Position after the current fragment has been sent
+    assign remaining_after = remaining_len_reg - chunk_len_reg;
+    assign addr_after      = current_addr_reg + chunk_len_reg;
     
-    // Clamp to block size (for current fragment)
-    assign chunk_by_block = (remaining_len_reg > BLOCK_SIZE) ? BLOCK_SIZE : remaining_len_reg;
+    // Calculate bytes remaining to next 4KB boundary (for next fragment)
+    assign chunk_to_boundary = BOUNDARY_4KB - (addr_after & (BOUNDARY_4KB - 1));
     
-    // Final chunk size: minimum of (remaining, block_size, to_boundary) (for current fragment)
+    // Clamp to block size (for next fragment)
+    assign chunk_by_block = (remaining_after > BLOCK_SIZE) ? BLOCK_SIZE : remaining_after;
+    
+    // Final chunk size: minimum of (remaining, block_size, to_boundary) (for next fragment)
     assign chunk_len_next = (chunk_by_block < chunk_to_boundary) ? chunk_by_block : chunk_to_boundary;
     
+    // Gather list: segments are packed, the first zero-length segment ends the list.
+    // A fragment never spans two segments (one MM2S command per fragment).
+    assign next_seg_addr   = (seg_idx_reg == 2'd0) ? cmd_sg1_addr_reg   : cmd_sg2_addr_reg;
+    assign next_seg_length = (seg_idx_reg == 2'd0) ? cmd_sg1_length_reg : cmd_sg2_length_reg;
+    assign has_next_seg    = (seg_idx_reg != 2'd2) && (next_seg_length != 0);
+    
+    // 2D transfer: every row is tx_cmd_length bytes, rows are stride apart on both sides.
+    // Rows are never merged into one packet, so each packet carries its row's remote address.
+    assign has_next_row      = (rows_left_reg > 16'd1);
+    assign next_row_src_addr = row_src_addr_reg + cmd_src_stride_reg;
+    assign next_row_dst_addr = row_dst_addr_reg + cmd_dst_stride_reg;
+    
+    // Next block of payload: next row first, otherwise next gather segment
+    assign next_blk_addr   = has_next_row ? next_row_src_addr : next_seg_addr;
+    assign next_blk_length = has_next_row ? cmd_length_reg    : next_seg_length;
+    assign has_next_blk    = has_next_row || has_next_seg;
+    
+    // First fragment of the next segment / row
+    assign seg_chunk_to_boundary = BOUNDARY_4KB - (next_blk_addr & (BOUNDARY_4KB - 1));
+    assign seg_chunk_by_block    = (next_blk_length > BLOCK_SIZE) ? BLOCK_SIZE : next_blk_length;
+    assign seg_first_chunk_len   = (seg_chunk_by_block < seg_chunk_to_boundary) ? seg_chunk_by_block : seg_chunk_to_boundary;
+    
     // Calculate first fragment size using command inputs
     assign first_chunk_to_boundary = BOUNDARY_4KB - (cmd_ddr_addr_reg & (BOUNDARY_4KB - 1));
     assign first_chunk_by_block = (cmd_length_reg > BLOCK_SIZE) ? BLOCK_SIZE : cmd_length_reg;
     assign first_chunk_len = (first_chunk_by_block < first_chunk_to_boundary) ? first_chunk_by_block : first_chunk_to_boundary;
     
+    // A READ request is a single header-only packet covering the whole length
+    wire is_read_req_job = (cmd_opcode_reg == RDMA_OPCODE_READ_REQUEST) && !is_rsp_reg;
+    // Atomic requests and ACKs carry their operands in the header as well
+    wire is_atomic_req_job = ((cmd_opcode_reg == RDMA_OPCODE_CMP_SWAP) ||
+                              (cmd_opcode_reg == RDMA_OPCODE_FETCH_ADD)) && !is_rsp_reg;
+    wire is_atomic_ack_job = (cmd_opcode_reg == RDMA_OPCODE_ATOMIC_ACK) && is_rsp_reg;
+    wire is_remote_req_job = is_read_req_job || is_atomic_req_job;   // Completes on the response
+    wire is_hdr_only_job   = is_remote_req_job || is_atomic_ack_job;
+    
+    // Local copy / fill: MM2S (copy only) and S2MM on the payload DataMover, no header
+    wire is_local_copy_job = (cmd_opcode_reg == RDMA_OPCODE_LOCAL_COPY) && !is_rsp_reg;
+    wire is_local_fill_job = (cmd_opcode_reg == RDMA_OPCODE_LOCAL_FILL) && !is_rsp_reg;
+    wire is_local_job      = is_local_copy_job || is_local_fill_job;
+    wire [RDMA_LENGTH_WIDTH-1:0] local_chunk = (remaining_len_reg > LOCAL_CHUNK_MAX) ? LOCAL_CHUNK_MAX : remaining_len_reg;
+    wire local_issue = (state_reg == STATE_LOCAL_CMD) && !local_cmd_issued_reg;
+    
+    wire tx_cmd_is_atomic = (tx_cmd_opcode == RDMA_OPCODE_CMP_SWAP) || (tx_cmd_opcode == RDMA_OPCODE_FETCH_ADD);
+    
+    // Multicast member of the current packet (mc_sel indexes the cmd_mc_* vectors)
+    wire [1:0]                mc_sel     = mc_member_reg - 1'b1;
+    wire                      mc_replay  = (mc_member_reg != 2'd0);
+    wire                      mc_more    = (mc_member_reg != cmd_mc_count_reg);
+    wire [RDMA_PSN_WIDTH-1:0] mc_cur_psn = cmd_mc_psn_reg[mc_sel*24 +: 24] + frag_idx_reg;
+    
+    // PSN of the current fragment; on a retransmission fragments before una_psn_reg are skipped
+    wire [RDMA_PSN_WIDTH-1:0] cur_psn   = cmd_psn_reg + frag_idx_reg;
+    wire [RDMA_PSN_WIDTH-1:0] una_diff  = cur_psn - una_psn_reg;
+    wire                      skip_frag = replay_reg && una_diff[RDMA_PSN_WIDTH-1];
+    wire is_seq_job = !is_rsp_reg && !is_remote_req_job && !is_local_job;   // Consumes PSNs
+    
+    // ACK / NAK for the reliable WQE: AETH syndrome [7:5] 000 = ACK, 001 = RNR NAK, 011 = NAK
+    wire                      win_valid   = (win_cnt_reg != 0);
+    wire                      win_full    = win_cnt_reg[REL_WIN_BITS];
+    wire                      rel_track   = rel_active_reg || win_valid;    // una_psn_reg in use
+    wire                      ack_for_wqe = ack_rcvd && rel_track && (ack_rcvd_dest_qp == rel_qp_reg);
+    wire [RDMA_PSN_WIDTH-1:0] ack_adv     = ack_rcvd_psn - una_psn_reg;
+    wire                      ack_new     = !ack_adv[RDMA_PSN_WIDTH-1];     // Not older than una
+    wire [RDMA_PSN_WIDTH-1:0] una_past    = una_psn_reg - last_psn_reg - 1'b1;
+    wire [RDMA_PSN_WIDTH-1:0] head_past   = una_psn_reg - win_last_psn[win_head_reg] - 1'b1;
+    wire rel_all_acked = win_valid && !una_past[RDMA_PSN_WIDTH-1];        // una beyond the newest entry
+    wire head_acked    = win_valid && !head_past[RDMA_PSN_WIDTH-1];       // ... beyond the oldest one
+    wire ack_timeout   = win_valid && (ack_timer_reg >= retry_timeout);
+    wire retry_due     = win_valid && !rel_fail_reg && !rel_all_acked && (nak_seq_reg || ack_timeout);
+    wire replay_ok     = retry_due && (retry_cnt_reg < retry_limit);
+    wire replay_next   = rp_more_reg && win_valid && !rel_fail_reg;       // Next entry of a replay
+    wire [REL_WIN_BITS-1:0] rp_sel = replay_ok ? win_head_reg : rp_idx_reg;
+    wire win_push      = (state_reg == STATE_UPDATE_STATE) && !more_fragments && is_seq_job &&
+                         rel_active_reg && !replay_reg;
+    
+    // READ / atomic request without a response: resent from its wqe_* copy while retries are
+    // enabled; the WQE fails once they run out (at once with retry_timeout = 0)
+    wire [31:0] rd_timeout_limit = (retry_timeout != 0) ? retry_timeout : RD_TIMEOUT_DEFAULT;
+    wire rd_retry_due  = rd_pending_reg && !rd_done_seen_reg && !rd_fail_reg && (rd_timer_reg >= rd_timeout_limit);
+    wire rd_replay_ok  = rd_retry_due && (retry_timeout != 0) && (rd_retry_cnt_reg < retry_limit);
+    wire ack_for_rd    = ack_rcvd && rd_pending_reg && (ack_rcvd_dest_qp == rd_qp_reg) &&
+                         (ack_rcvd_psn == rd_psn_reg) && (ack_rcvd_syndrome[7:5] == 3'b011) &&
+                         (ack_rcvd_syndrome[4:0] != 5'd0);
+    
+    // Shaping applies to payload fragments (WQEs and READ responses) of the destination QP
+    wire [QP_IDX_WIDTH-1:0] shaper_qp    = cmd_dest_qp_reg[QP_IDX_WIDTH-1:0];
+    wire                    shaper_ok    = is_hdr_only_job || qp_open[shaper_qp];
+    wire                    shaper_debit = (state_reg == STATE_START_HEADER) && !is_hdr_only_job && !ack_job_reg;
+    
     // Check if more fragments will be needed after this one
-    assign more_fragments = (remaining_len_reg > chunk_len_reg);
+    assign seg_more       = (remaining_len_reg > chunk_len_reg);
+    assign more_fragments = !is_hdr_only_job && (seg_more || has_next_blk);
+    
+    wire rd_cpl_due    = rd_pending_reg && (rd_done_seen_reg || rd_fail_reg);
+    wire rel_cpl_due   = head_acked || (win_valid && rel_fail_reg);
+    wire win_pop       = (state_reg == STATE_SEND_CPL) && tx_cpl_ready && rel_cpl_due;
+    wire cpl_due       = rd_cpl_due || rel_cpl_due;
+    wire ctrl_pkt_due  = ack_tx_valid || cnp_tx_valid;
+    
+    // Fragment-boundary scheduling. Between two fragments (PROGRAM_HEADER) the running job may
+    // hand the link to another class: the preempted job, a READ response, or a new WRITE / SEND
+    // WQE for another QP (PSNs of one QP stay in order). Strict priority switches to a more
+    // urgent class at once; WRR switches to a different class after tc_weight fragments.
+    wire       tx_cmd_is_seq  = !tx_cmd_is_atomic && (tx_cmd_opcode != RDMA_OPCODE_READ_REQUEST) &&
+                                (tx_cmd_opcode != RDMA_OPCODE_LOCAL_COPY) && (tx_cmd_opcode != RDMA_OPCODE_LOCAL_FILL);
+    wire [QP_KEY_WIDTH-1:0] tx_cmd_qp_key = tx_cmd_qp_handle[QP_KEY_WIDTH-1:0];
+    
+    wire [1:0] cur_class      = tc_map[{cmd_service_level_reg[3:0], 1'b0} +: 2];
+    wire [1:0] bank_class     = tc_map[{bank_service_level_reg[3:0], 1'b0} +: 2];
+    wire [1:0] rsp_class      = tc_map[{rd_rsp_sl[3:0], 1'b0} +: 2];
+    wire [1:0] cmd_class      = tc_map[{tx_cmd_service_level[3:0], 1'b0} +: 2];
+    wire [7:0] tc_quantum     = tc_weight[{cur_class, 3'b000} +: 8];
+    wire       tc_turn_over   = (tc_frag_cnt_reg != 0) && (tc_frag_cnt_reg >= tc_quantum);
+    // Only a job that can be resumed later is switched out: a WQE on its first pass, or a
+    // READ response while no other WQE holds the ACK tracker
+    wire cur_preemptible = (state_reg == STATE_PROGRAM_HEADER) && !ctrl_pkt_due && (cmd_mc_count_reg == 2'd0) &&
+                           ((is_seq_job && !replay_reg && !win_valid) ||
+                            (is_rsp_reg && !is_atomic_ack_job && !rel_track));
+    wire tc_rsp_ok       = !bank_valid_reg && rd_rsp_valid && !is_rsp_reg;
+    wire tc_cmd_ok       = !bank_valid_reg && tx_cmd_valid && tx_cmd_is_seq && !rd_pending_reg && (tx_cmd_mc_count == 2'd0) &&
+                           (is_rsp_reg ? !rel_track :
+                            (tx_cmd_qp_key != cmd_qp_key_reg));
+    wire [1:0] other_class = bank_valid_reg ? bank_class : tc_rsp_ok ? rsp_class : cmd_class;
+    // A job whose QP is out of tokens is not switched in, and a running job that is out of
+    // tokens hands the link to any other job that may send, whatever its class
+    wire [QP_IDX_WIDTH-1:0] bank_qp = bank_dest_qp_reg[QP_IDX_WIDTH-1:0];
+    wire [QP_IDX_WIDTH-1:0] rsp_qp  = rd_rsp_dest_qp[QP_IDX_WIDTH-1:0];
+    wire [QP_IDX_WIDTH-1:0] cmd_qp  = tx_cmd_dest_qp[QP_IDX_WIDTH-1:0];
+    wire other_shaper_ok = bank_valid_reg ? qp_open[bank_qp] :
+                           tc_rsp_ok      ? (rd_rsp_atomic || qp_open[rsp_qp]) : qp_open[cmd_qp];
+    wire tc_switch       = cur_preemptible && (bank_valid_reg || tc_rsp_ok || tc_cmd_ok) && other_shaper_ok &&
+                           (!shaper_ok ||
+                            ((other_class != cur_class) &&
+                             (tc_wrr ? tc_turn_over : (other_class > cur_class))));
+    wire tc_swap         = tc_switch && bank_valid_reg;
+    wire tc_take_rsp     = tc_switch && tc_rsp_ok;
+    wire tc_take_cmd     = tc_switch && !bank_valid_reg && !tc_rsp_ok;
+    
+    // Job selection in IDLE: pending completion, then ACK / NAK, the preempted job, responses,
+    // retransmission, and finally new WQEs. No new WQE is taken while a READ or reliable WQE is
+    // outstanding. ACK / NAK / CNP also go out between two fragments of a job.
+    wire ctrl_slot     = ((state_reg == STATE_IDLE) && !cpl_due) || (state_reg == STATE_PROGRAM_HEADER);
+    wire accept_ack    = ctrl_slot && ack_tx_valid;
+    wire accept_cnp    = ctrl_slot && !ack_tx_valid && cnp_tx_valid;
+    wire accept_resume = (state_reg == STATE_IDLE) && !cpl_due && !ctrl_pkt_due && bank_valid_reg &&
+                         (bank_is_rsp_reg || (!rel_track && !rd_pending_reg));
+    wire accept_rsp    = ((state_reg == STATE_IDLE) && !cpl_due && !ctrl_pkt_due && !accept_resume && rd_rsp_valid) ||
+                         tc_take_rsp;
+    wire accept_replay = (state_reg == STATE_IDLE) && !cpl_due && !ctrl_pkt_due && !accept_resume && !rd_rsp_valid &&
+                         (replay_ok || replay_next || rd_replay_ok);
+    // With WQEs in the ACK window, only another reliable WRITE / SEND to the same QP may follow
+    wire win_accept    = !rel_track ||
+                         (!win_full && !rel_fail_reg && !replay_reg && !replay_next && (retry_timeout != 0) &&
+                          tx_cmd_is_seq && (tx_cmd_mc_count == 2'd0) && (tx_cmd_dest_qp == rel_qp_reg) &&
+                          (tx_cmd_qp_key == rel_qp_key_reg));
+    wire cmd_slot_free = (state_reg == STATE_IDLE) && !rd_pending_reg && win_accept && !bank_valid_reg &&
+                         !ctrl_pkt_due && !rd_rsp_valid;
+    wire accept_cmd    = (cmd_slot_free && tx_cmd_valid) || tc_take_cmd;
+    wire ctx_save      = tc_switch;
+    wire ctx_restore   = tc_swap || accept_resume;
     
     // Command interface
-    assign tx_cmd_ready = (state_reg == STATE_IDLE);
+    assign tx_cmd_ready = cmd_slot_free || tc_take_cmd;
+    assign rd_rsp_ready = accept_rsp;
+    assign ack_tx_ready = accept_ack;
+    assign cnp_tx_ready = accept_cnp;
     assign streamer_state =state_reg;
     // Completion interface
     assign tx_cpl_valid        = tx_cpl_valid_reg;
     assign tx_cpl_sq_index     = tx_cpl_sq_index_reg;
     assign tx_cpl_status       = tx_cpl_status_reg;
     assign tx_cpl_bytes_sent   = tx_cpl_bytes_sent_reg;
+    assign tx_cpl_atomic_orig  = atomic_orig_reg;
     
     // Header inserter interface
     assign hdr_start_tx            = hdr_start_tx_reg;
@@ -189,12 +707,30 @@ module tx_streamer #(
     assign hdr_fragment_id         = hdr_frag_id_reg;
     assign hdr_more_fragments      = hdr_more_frags_reg;
     assign hdr_fragment_offset     = 0;
+    assign hdr_header_only         = hdr_header_only_reg;
+    assign hdr_read_sink_addr      = hdr_read_sink_addr_reg;
+    assign hdr_read_sink_rkey      = hdr_read_sink_rkey_reg;
+    assign hdr_imm                 = hdr_imm_reg;
+    assign hdr_atomic_data         = hdr_atomic_data_reg;
+    assign hdr_atomic_compare      = hdr_atomic_compare_reg;
+    assign hdr_dst_ip              = hdr_dst_ip_reg;
+    assign hdr_udp_ports           = hdr_udp_ports_reg;
     
-    // Data Mover MM2S command interface (72-bit AXI-Stream format)
-    // Format: [Reserved(8) | Address(32) | Type(1) | DSA(1) | Reserved(6) | EOF(1) | BTT(23)]
+    // Data Mover MM2S command interface (C_ADDR_WIDTH + 40 bits, 104-bit with 64-bit addressing)
+    // Format: [Reserved(4) | Tag(4) | Address(C_ADDR_WIDTH) | DRR(1) | EOF(1) | DSA(6) | Type(1) | BTT(23)]
     assign m_axis_mm2s_cmd_tdata = {8'b00000000, mm2s_addr_reg, 1'b0, 1'b1, 6'b000000, 1'b1, mm2s_btt_reg[22:0]};
     assign m_axis_mm2s_cmd_tvalid = mm2s_valid_reg;
     
+    // Data Mover S2MM command interface (same layout, EOF set so TLAST closes the chunk)
+    assign m_axis_s2mm_cmd_tdata  = {8'b00000000, s2mm_addr_reg, 1'b0, 1'b1, 6'b000000, 1'b1, s2mm_btt_reg[22:0]};
+    assign m_axis_s2mm_cmd_tvalid = s2mm_valid_reg;
+    
+    assign local_copy_en      = is_local_copy_job && ((state_reg == STATE_LOCAL_CMD) || (state_reg == STATE_LOCAL_WAIT));
+    assign local_fill_start   = local_issue && is_local_fill_job;
+    assign local_fill_len     = local_chunk[C_BTT_WIDTH-1:0];
+    assign local_fill_pattern = cmd_imm_reg;        // SQE word 15
+    assign mc_replay_start    = (state_reg == STATE_START_HEADER) && mc_replay && !ack_job_reg;
+    
     always @(posedge aclk) begin
         if (!aresetn) begin
             state_reg <= STATE_IDLE;
@@ -210,28 +746,718 @@ module tx_streamer #(
             cmd_length_reg         <= 0;
             cmd_opcode_reg         <= 0;
             cmd_dest_qp_reg        <= 0;
+            cmd_qp_key_reg         <= 0;
             cmd_remote_addr_reg    <= 0;
             cmd_rkey_reg           <= 0;
             cmd_partition_key_reg  <= 0;
             cmd_service_level_reg  <= 0;
             cmd_psn_reg            <= 0;
-        end else if (tx_cmd_valid && tx_cmd_ready) begin
+            cmd_sg1_addr_reg       <= 0;
+            cmd_sg1_length_reg     <= 0;
+            cmd_sg2_addr_reg       <= 0;
+            cmd_sg2_length_reg     <= 0;
+            cmd_row_count_reg      <= 0;
+            cmd_src_stride_reg     <= 0;
+            cmd_dst_stride_reg     <= 0;
+            cmd_local_rkey_reg     <= 0;
+            cmd_imm_reg            <= 0;
+            cmd_atomic_data_reg    <= 0;
+            cmd_atomic_compare_reg <= 0;
+            cmd_dst_ip_reg         <= 0;
+            cmd_udp_ports_reg      <= 0;
+            cmd_mc_count_reg       <= 0;
+            cmd_mc_dst_ip_reg      <= 0;
+            cmd_mc_udp_ports_reg   <= 0;
+            cmd_mc_dest_qp_reg     <= 0;
+            cmd_mc_qp_key_reg      <= 0;
+            cmd_mc_psn_reg         <= 0;
+            is_rsp_reg             <= 0;
+        end else if (ctx_restore) begin
+            // Resume the preempted job; a response leaves the WQE completion index alone
+            cmd_ddr_addr_reg       <= bank_ddr_addr_reg;
+            cmd_length_reg         <= bank_length_reg;
+            cmd_opcode_reg         <= bank_opcode_reg;
+            cmd_dest_qp_reg        <= bank_dest_qp_reg;
+            cmd_qp_key_reg         <= bank_qp_key_reg;
+            cmd_remote_addr_reg    <= bank_remote_addr_reg;
+            cmd_rkey_reg           <= bank_rkey_reg;
+            cmd_partition_key_reg  <= bank_partition_key_reg;
+            cmd_service_level_reg  <= bank_service_level_reg;
+            cmd_sg1_addr_reg       <= bank_sg1_addr_reg;
+            cmd_sg1_length_reg     <= bank_sg1_length_reg;
+            cmd_sg2_addr_reg       <= bank_sg2_addr_reg;
+            cmd_sg2_length_reg     <= bank_sg2_length_reg;
+            cmd_row_count_reg      <= bank_row_count_reg;
+            cmd_src_stride_reg     <= bank_src_stride_reg;
+            cmd_dst_stride_reg     <= bank_dst_stride_reg;
+            cmd_imm_reg            <= bank_imm_reg;
+            cmd_dst_ip_reg         <= bank_dst_ip_reg;
+            cmd_udp_ports_reg      <= bank_udp_ports_reg;
+            cmd_psn_reg            <= bank_psn_reg;
+            cmd_mc_count_reg       <= 0;                // Multicast jobs are never parked
+            is_rsp_reg             <= bank_is_rsp_reg;
+            if (!bank_is_rsp_reg) begin
+                cmd_sq_index_reg   <= bank_sq_index_reg;
+            end
+        end else if (accept_rsp) begin
+            // READ response: local source, remote sink, one contiguous segment.
+            // ATOMIC_ACK: header only, original value in the atomic fields.
+            // cmd_sq_index_reg is kept for the pending READ completion.
+            cmd_ddr_addr_reg       <= rd_rsp_src_addr;
+            cmd_length_reg         <= rd_rsp_length;
+            cmd_opcode_reg         <= rd_rsp_atomic ? RDMA_OPCODE_ATOMIC_ACK : RDMA_OPCODE_READ_RESPONSE;
+            cmd_atomic_data_reg    <= rd_rsp_orig;
+            cmd_atomic_compare_reg <= 0;
+            cmd_dest_qp_reg        <= rd_rsp_dest_qp;
+            cmd_remote_addr_reg    <= rd_rsp_remote_addr;
+            cmd_rkey_reg           <= rd_rsp_rkey;
+            cmd_partition_key_reg  <= 16'hFFFF;
+            cmd_service_level_reg  <= rd_rsp_sl;        // Same class as the request
+            cmd_psn_reg            <= rd_rsp_psn;
+            cmd_dst_ip_reg         <= 0;                // Requester: encapsulator default
+            cmd_udp_ports_reg      <= 0;
+            cmd_sg1_length_reg     <= 0;
+            cmd_sg2_length_reg     <= 0;
+            cmd_row_count_reg      <= 16'd1;
+            cmd_mc_count_reg       <= 0;
+            is_rsp_reg             <= 1'b1;
+        end else if (accept_replay && rd_pending_reg) begin
+            // READ / atomic resend: the same request again. cmd_local_rkey_reg and
+            // cmd_sq_index_reg are kept, no other WQE is taken while it is pending.
+            cmd_ddr_addr_reg       <= wqe_ddr_addr_reg;
+            cmd_atomic_data_reg    <= wqe_atomic_data_reg;
+            cmd_atomic_compare_reg <= wqe_atomic_compare_reg;
+            cmd_length_reg         <= wqe_length_reg;
+            cmd_opcode_reg         <= wqe_opcode_reg;
+            cmd_dest_qp_reg        <= wqe_dest_qp_reg;
+            cmd_remote_addr_reg    <= wqe_remote_addr_reg;
+            cmd_rkey_reg           <= wqe_rkey_reg;
+            cmd_partition_key_reg  <= wqe_partition_key_reg;
+            cmd_service_level_reg  <= wqe_service_level_reg;
+            cmd_sg1_addr_reg       <= wqe_sg1_addr_reg;
+            cmd_sg1_length_reg     <= wqe_sg1_length_reg;
+            cmd_sg2_addr_reg       <= wqe_sg2_addr_reg;
+            cmd_sg2_length_reg     <= wqe_sg2_length_reg;
+            cmd_row_count_reg      <= wqe_row_count_reg;
+            cmd_src_stride_reg     <= wqe_src_stride_reg;
+            cmd_dst_stride_reg     <= wqe_dst_stride_reg;
+            cmd_imm_reg            <= wqe_imm_reg;
+            cmd_dst_ip_reg         <= wqe_dst_ip_reg;
+            cmd_udp_ports_reg      <= wqe_udp_ports_reg;
+            cmd_psn_reg            <= wqe_psn_reg;
+            cmd_mc_count_reg       <= 0;
+            is_rsp_reg             <= 1'b0;
+        end else if (accept_replay) begin
+            // A retransmission takes a window entry again, starting at its first PSN
+            cmd_sq_index_reg       <= win_sq_index[rp_sel];
+            cmd_ddr_addr_reg       <= win_ddr_addr[rp_sel];
+            cmd_length_reg         <= win_length[rp_sel];
+            cmd_opcode_reg         <= win_opcode[rp_sel];
+            cmd_dest_qp_reg        <= win_dest_qp[rp_sel];
+            cmd_qp_key_reg         <= rel_qp_key_reg;   // The window holds a single QP
+            cmd_remote_addr_reg    <= win_remote_addr[rp_sel];
+            cmd_rkey_reg           <= win_rkey[rp_sel];
+            cmd_partition_key_reg  <= win_partition_key[rp_sel];
+            cmd_service_level_reg  <= win_service_level[rp_sel];
+            cmd_sg1_addr_reg       <= win_sg1_addr[rp_sel];
+            cmd_sg1_length_reg     <= win_sg1_length[rp_sel];
+            cmd_sg2_addr_reg       <= win_sg2_addr[rp_sel];
+            cmd_sg2_length_reg     <= win_sg2_length[rp_sel];
+            cmd_row_count_reg      <= win_row_count[rp_sel];
+            cmd_src_stride_reg     <= win_src_stride[rp_sel];
+            cmd_dst_stride_reg     <= win_dst_stride[rp_sel];
+            cmd_imm_reg            <= win_imm[rp_sel];
+            cmd_dst_ip_reg         <= win_dst_ip[rp_sel];
+            cmd_udp_ports_reg      <= win_udp_ports[rp_sel];
+            cmd_psn_reg            <= win_psn[rp_sel];
+            cmd_mc_count_reg       <= 0;                // Multicast WQEs are not retransmitted
+            is_rsp_reg             <= 1'b0;
+        end else if (accept_cmd) begin
             cmd_sq_index_reg       <= tx_cmd_sq_index;
             cmd_ddr_addr_reg       <= tx_cmd_ddr_addr;
-            cmd_length_reg         <= tx_cmd_length;
+            cmd_length_reg         <= tx_cmd_is_atomic ? 32'd8 : tx_cmd_length;   // Atomics: one 64-bit word
             cmd_opcode_reg         <= tx_cmd_opcode;
             cmd_dest_qp_reg        <= tx_cmd_dest_qp;
+            cmd_qp_key_reg         <= tx_cmd_qp_key;
             cmd_remote_addr_reg    <= tx_cmd_remote_addr;
             cmd_rkey_reg           <= tx_cmd_rkey;
             cmd_partition_key_reg  <= tx_cmd_partition_key;
             cmd_service_level_reg  <= tx_cmd_service_level;
-            cmd_psn_reg            <= tx_cmd_psn;
+            cmd_psn_reg            <= psn_table[tx_cmd_qp_key];
+            cmd_sg1_addr_reg       <= tx_cmd_sg1_addr;
+            cmd_sg1_length_reg     <= tx_cmd_sg1_length;
+            cmd_sg2_addr_reg       <= tx_cmd_sg2_addr;
+            cmd_sg2_length_reg     <= tx_cmd_sg2_length;
+            cmd_row_count_reg      <= tx_cmd_row_count;
+            cmd_src_stride_reg     <= tx_cmd_src_stride;
+            cmd_dst_stride_reg     <= tx_cmd_dst_stride;
+            cmd_local_rkey_reg     <= tx_cmd_local_rkey;
+            cmd_imm_reg            <= tx_cmd_imm;
+            cmd_atomic_data_reg    <= tx_cmd_atomic_swap_add;
+            cmd_atomic_compare_reg <= tx_cmd_atomic_compare;
+            cmd_dst_ip_reg         <= tx_cmd_dst_ip;
+            cmd_udp_ports_reg      <= tx_cmd_udp_ports;
+            cmd_mc_count_reg       <= tx_cmd_is_seq ? tx_cmd_mc_count : 2'd0;   // WRITE / WRITE_IMM / SEND only
+            cmd_mc_dst_ip_reg      <= tx_cmd_mc_dst_ip;
+            cmd_mc_udp_ports_reg   <= tx_cmd_mc_udp_ports;
+            cmd_mc_dest_qp_reg     <= tx_cmd_mc_dest_qp;
+            cmd_mc_qp_key_reg      <= tx_cmd_mc_qp_handle;
+            cmd_mc_psn_reg         <= {psn_table[tx_cmd_mc_qp_handle[16 +: QP_KEY_WIDTH]],
+                                       psn_table[tx_cmd_mc_qp_handle[8  +: QP_KEY_WIDTH]],
+                                       psn_table[tx_cmd_mc_qp_handle[0  +: QP_KEY_WIDTH]]};
+            is_rsp_reg             <= 1'b0;
+        end
+    end
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            mc_member_reg <= 0;
+        end else if (state_reg == STATE_INIT_FRAGMENT) begin
+            mc_member_reg <= 0;
+        end else if (state_reg == STATE_WAIT_HDR_DONE && hdr_tx_done && !ack_job_reg) begin
+            // Next member of the same fragment, or back to the head for the next fragment
+            mc_member_reg <= mc_more ? mc_member_reg + 1'b1 : 2'd0;
+        end
+    end
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            wqe_ddr_addr_reg       <= 0;
+            wqe_length_reg         <= 0;
+            wqe_opcode_reg         <= 0;
+            wqe_dest_qp_reg        <= 0;
+            wqe_remote_addr_reg    <= 0;
+            wqe_rkey_reg           <= 0;
+            wqe_partition_key_reg  <= 0;
+            wqe_service_level_reg  <= 0;
+            wqe_sg1_addr_reg       <= 0;
+            wqe_sg1_length_reg     <= 0;
+            wqe_sg2_addr_reg       <= 0;
+            wqe_sg2_length_reg     <= 0;
+            wqe_row_count_reg      <= 0;
+            wqe_src_stride_reg     <= 0;
+            wqe_dst_stride_reg     <= 0;
+            wqe_imm_reg            <= 0;
+            wqe_atomic_data_reg    <= 0;
+            wqe_atomic_compare_reg <= 0;
+            wqe_dst_ip_reg         <= 0;
+            wqe_udp_ports_reg      <= 0;
+        end else if (accept_cmd) begin
+            wqe_ddr_addr_reg       <= tx_cmd_ddr_addr;
+            wqe_length_reg         <= tx_cmd_is_atomic ? 32'd8 : tx_cmd_length;
+            wqe_opcode_reg         <= tx_cmd_opcode;
+            wqe_dest_qp_reg        <= tx_cmd_dest_qp;
+            wqe_remote_addr_reg    <= tx_cmd_remote_addr;
+            wqe_rkey_reg           <= tx_cmd_rkey;
+            wqe_partition_key_reg  <= tx_cmd_partition_key;
+            wqe_service_level_reg  <= tx_cmd_service_level;
+            wqe_sg1_addr_reg       <= tx_cmd_sg1_addr;
+            wqe_sg1_length_reg     <= tx_cmd_sg1_length;
+            wqe_sg2_addr_reg       <= tx_cmd_sg2_addr;
+            wqe_sg2_length_reg     <= tx_cmd_sg2_length;
+            wqe_row_count_reg      <= tx_cmd_row_count;
+            wqe_src_stride_reg     <= tx_cmd_src_stride;
+            wqe_dst_stride_reg     <= tx_cmd_dst_stride;
+            wqe_imm_reg            <= tx_cmd_imm;
+            wqe_atomic_data_reg    <= tx_cmd_atomic_swap_add;
+            wqe_atomic_compare_reg <= tx_cmd_atomic_compare;
+            wqe_dst_ip_reg         <= tx_cmd_dst_ip;
+            wqe_udp_ports_reg      <= tx_cmd_udp_ports;
+        end else if (ctx_restore && !bank_is_rsp_reg) begin
+            wqe_ddr_addr_reg       <= bank_ddr_addr_reg;
+            wqe_length_reg         <= bank_length_reg;
+            wqe_opcode_reg         <= bank_opcode_reg;
+            wqe_dest_qp_reg        <= bank_dest_qp_reg;
+            wqe_remote_addr_reg    <= bank_remote_addr_reg;
+            wqe_rkey_reg           <= bank_rkey_reg;
+            wqe_partition_key_reg  <= bank_partition_key_reg;
+            wqe_service_level_reg  <= bank_service_level_reg;
+            wqe_sg1_addr_reg       <= bank_sg1_addr_reg;
+            wqe_sg1_length_reg     <= bank_sg1_length_reg;
+            wqe_sg2_addr_reg       <= bank_sg2_addr_reg;
+            wqe_sg2_length_reg     <= bank_sg2_length_reg;
+            wqe_row_count_reg      <= bank_row_count_reg;
+            wqe_src_stride_reg     <= bank_src_stride_reg;
+            wqe_dst_stride_reg     <= bank_dst_stride_reg;
+            wqe_imm_reg            <= bank_imm_reg;
+            wqe_dst_ip_reg         <= bank_dst_ip_reg;
+            wqe_udp_ports_reg      <= bank_udp_ports_reg;
+        end
+    end
+    
+    // ACK window storage, written when a reliable WQE has sent its last packet
+    always @(posedge aclk) begin
+        if (win_push) begin
+            win_ddr_addr[win_tail_reg]      <= wqe_ddr_addr_reg;
+            win_length[win_tail_reg]        <= wqe_length_reg;
+            win_opcode[win_tail_reg]        <= wqe_opcode_reg;
+            win_dest_qp[win_tail_reg]       <= wqe_dest_qp_reg;
+            win_remote_addr[win_tail_reg]   <= wqe_remote_addr_reg;
+            win_rkey[win_tail_reg]          <= wqe_rkey_reg;
+            win_partition_key[win_tail_reg] <= wqe_partition_key_reg;
+            win_service_level[win_tail_reg] <= wqe_service_level_reg;
+            win_sg1_addr[win_tail_reg]      <= wqe_sg1_addr_reg;
+            win_sg1_length[win_tail_reg]    <= wqe_sg1_length_reg;
+            win_sg2_addr[win_tail_reg]      <= wqe_sg2_addr_reg;
+            win_sg2_length[win_tail_reg]    <= wqe_sg2_length_reg;
+            win_row_count[win_tail_reg]     <= wqe_row_count_reg;
+            win_src_stride[win_tail_reg]    <= wqe_src_stride_reg;
+            win_dst_stride[win_tail_reg]    <= wqe_dst_stride_reg;
+            win_imm[win_tail_reg]           <= wqe_imm_reg;
+            win_dst_ip[win_tail_reg]        <= wqe_dst_ip_reg;
+            win_udp_ports[win_tail_reg]     <= wqe_udp_ports_reg;
+            win_psn[win_tail_reg]           <= wqe_psn_reg;
+            win_last_psn[win_tail_reg]      <= cur_psn;
+            win_bytes[win_tail_reg]         <= total_sent_reg + chunk_len_reg;
+            win_sq_index[win_tail_reg]      <= cmd_sq_index_reg;
+        end
+    end
+    
+    // Context bank: the current job is parked on a switch, the parked one comes back on a swap
+    // or, from IDLE, once the link is free for it
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            bank_valid_reg               <= 0;
+            bank_is_rsp_reg              <= 0;
+            bank_ddr_addr_reg            <= 0;
+            bank_length_reg              <= 0;
+            bank_opcode_reg              <= 0;
+            bank_dest_qp_reg             <= 0;
+            bank_qp_key_reg              <= 0;
+            bank_remote_addr_reg         <= 0;
+            bank_rkey_reg                <= 0;
+            bank_partition_key_reg       <= 0;
+            bank_service_level_reg       <= 0;
+            bank_sg1_addr_reg            <= 0;
+            bank_sg1_length_reg          <= 0;
+            bank_sg2_addr_reg            <= 0;
+            bank_sg2_length_reg          <= 0;
+            bank_row_count_reg           <= 0;
+            bank_src_stride_reg          <= 0;
+            bank_dst_stride_reg          <= 0;
+            bank_imm_reg                 <= 0;
+            bank_dst_ip_reg              <= 0;
+            bank_udp_ports_reg           <= 0;
+            bank_psn_reg                 <= 0;
+            bank_sq_index_reg            <= 0;
+            bank_remaining_len_reg       <= 0;
+            bank_seg_idx_reg             <= 0;
+            bank_rows_left_reg           <= 0;
+            bank_row_src_addr_reg        <= 0;
+            bank_row_dst_addr_reg        <= 0;
+            bank_current_addr_reg        <= 0;
+            bank_current_remote_addr_reg <= 0;
+            bank_frag_idx_reg            <= 0;
+            bank_frag_offset_reg         <= 0;
+            bank_chunk_len_reg           <= 0;
+            bank_total_sent_reg          <= 0;
+            bank_una_psn_reg             <= 0;
+            bank_rel_status_reg          <= 0;
+            bank_rel_active_reg          <= 0;
+            bank_rel_fail_reg            <= 0;
+            bank_nak_seq_reg             <= 0;
+            tc_frag_cnt_reg              <= 0;
+        end else begin
+            if (ctx_save) begin
+                bank_valid_reg               <= 1'b1;
+                bank_is_rsp_reg              <= is_rsp_reg;
+                bank_ddr_addr_reg            <= cmd_ddr_addr_reg;
+                bank_length_reg              <= cmd_length_reg;
+                bank_opcode_reg              <= cmd_opcode_reg;
+                bank_dest_qp_reg             <= cmd_dest_qp_reg;
+                bank_qp_key_reg              <= cmd_qp_key_reg;
+                bank_remote_addr_reg         <= cmd_remote_addr_reg;
+                bank_rkey_reg                <= cmd_rkey_reg;
+                bank_partition_key_reg       <= cmd_partition_key_reg;
+                bank_service_level_reg       <= cmd_service_level_reg;
+                bank_sg1_addr_reg            <= cmd_sg1_addr_reg;
+                bank_sg1_length_reg          <= cmd_sg1_length_reg;
+                bank_sg2_addr_reg            <= cmd_sg2_addr_reg;
+                bank_sg2_length_reg          <= cmd_sg2_length_reg;
+                bank_row_count_reg           <= cmd_row_count_reg;
+                bank_src_stride_reg          <= cmd_src_stride_reg;
+                bank_dst_stride_reg          <= cmd_dst_stride_reg;
+                bank_imm_reg                 <= cmd_imm_reg;
+                bank_dst_ip_reg              <= cmd_dst_ip_reg;
+                bank_udp_ports_reg           <= cmd_udp_ports_reg;
+                bank_psn_reg                 <= cmd_psn_reg;
+                bank_sq_index_reg            <= cmd_sq_index_reg;
+                bank_remaining_len_reg       <= remaining_len_reg;
+                bank_seg_idx_reg             <= seg_idx_reg;
+                bank_rows_left_reg           <= rows_left_reg;
+                bank_row_src_addr_reg        <= row_src_addr_reg;
+                bank_row_dst_addr_reg        <= row_dst_addr_reg;
+                bank_current_addr_reg        <= current_addr_reg;
+                bank_current_remote_addr_reg <= current_remote_addr_reg;
+                bank_frag_idx_reg            <= frag_idx_reg;
+                bank_frag_offset_reg         <= frag_offset_reg;
+                bank_chunk_len_reg           <= chunk_len_reg;
+                bank_total_sent_reg          <= total_sent_reg;
+                bank_una_psn_reg             <= una_psn_reg;
+                bank_rel_status_reg          <= rel_status_reg;
+                bank_rel_active_reg          <= rel_active_reg;
+                bank_rel_fail_reg            <= rel_fail_reg;
+                bank_nak_seq_reg             <= nak_seq_reg;
+            end else if (ctx_restore) begin
+                bank_valid_reg               <= 1'b0;
+            end
+            
+            if (state_reg == STATE_INIT_FRAGMENT || ctx_restore) begin
+                tc_frag_cnt_reg <= 0;
+            end else if (state_reg == STATE_START_HEADER && !ack_job_reg && tc_frag_cnt_reg != 8'hFF) begin
+                tc_frag_cnt_reg <= tc_frag_cnt_reg + 1'b1;
+            end
+        end
+    end
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            rd_pending_reg   <= 0;
+            rd_done_seen_reg <= 0;
+            rd_length_reg    <= 0;
+            atomic_orig_reg  <= 0;
+            rd_fail_reg      <= 0;
+            rd_status_reg    <= 0;
+            rd_qp_reg        <= 0;
+            rd_psn_reg       <= 0;
+            rd_retry_cnt_reg <= 0;
+            rd_timer_reg     <= 0;
+        end else begin
+            // Response timer, restarted each time the request goes out
+            if (rd_pending_reg && !rd_done_seen_reg && !rd_fail_reg && !rd_retry_due) begin
+                rd_timer_reg <= rd_timer_reg + 1'b1;
+            end
+            
+            if (state_reg == STATE_UPDATE_STATE && is_remote_req_job) begin
+                // Request sent (first pass or resend), wait for the responder's data
+                if (!rd_pending_reg) begin
+                    rd_retry_cnt_reg <= 0;
+                    rd_status_reg    <= 8'h00;
+                end
+                rd_pending_reg <= 1'b1;
+                rd_length_reg  <= cmd_length_reg;
+                rd_qp_reg      <= cmd_dest_qp_reg;
+                rd_psn_reg     <= cmd_psn_reg;
+                rd_timer_reg   <= 0;
+            end else if (state_reg == STATE_SEND_CPL && tx_cpl_ready) begin
+                rd_pending_reg <= 1'b0;
+            end
+            
+            if (state_reg == STATE_SEND_CPL && tx_cpl_ready) begin
+                rd_done_seen_reg <= 1'b0;
+            end else if ((read_done || atomic_done) && rd_pending_reg) begin
+                rd_done_seen_reg <= 1'b1;
+            end
+            
+            if (state_reg == STATE_SEND_CPL && tx_cpl_ready) begin
+                rd_fail_reg <= 1'b0;
+            end else if (accept_replay && rd_pending_reg) begin
+                rd_retry_cnt_reg <= rd_retry_cnt_reg + 1'b1;
+                rd_timer_reg     <= 0;
+            end else if (rd_retry_due && !rd_replay_ok) begin
+                rd_fail_reg   <= 1'b1;
+                rd_status_reg <= CPL_ST_RETRY_EXC;
+            end else if (ack_for_rd && !rd_done_seen_reg) begin
+                // Responder rejected the request: rkey / bounds, misaligned or failed atomic
+                rd_fail_reg   <= 1'b1;
+                rd_status_reg <= (ack_rcvd_syndrome[4:0] == 5'd1) ? CPL_ST_INV_REQ :
+                                 (ack_rcvd_syndrome[4:0] == 5'd3) ? CPL_ST_REM_OP_ERR : CPL_ST_REM_ACC_ERR;
+            end
+            
+            if (atomic_done) begin
+                atomic_orig_reg <= atomic_orig;
+            end
+        end
+    end
+    
+    // PSN assignment, ACK tracking and retransmission control
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (i = 0; i < (1<<QP_KEY_WIDTH); i = i + 1) begin
+                psn_table[i] <= 0;
+            end
+            rel_active_reg <= 0;
+            replay_reg     <= 0;
+            rel_fail_reg   <= 0;
+            nak_seq_reg    <= 0;
+            wqe_psn_reg    <= 0;
+            last_psn_reg   <= 0;
+            una_psn_reg    <= 0;
+            rel_qp_reg     <= 0;
+            rel_qp_key_reg <= 0;
+            rel_status_reg <= 0;
+            retry_cnt_reg  <= 0;
+            ack_timer_reg  <= 0;
+            ack_job_reg    <= 0;
+            ack_resume_reg <= 0;
+            win_head_reg   <= 0;
+            win_tail_reg   <= 0;
+            win_cnt_reg    <= 0;
+            rp_idx_reg     <= 0;
+            rp_more_reg    <= 0;
+        end else begin
+            if (accept_cmd) begin
+                wqe_psn_reg <= psn_table[tx_cmd_qp_key];
+            end
+            
+            // Timer runs while waiting for ACKs, not during a retransmission pass
+            if (win_valid && !replay_reg && !ack_timeout) begin
+                ack_timer_reg <= ack_timer_reg + 1'b1;
+            end
+            
+            // First pass of a WRITE / WRITE_IMM / SEND with ACKs enabled
+            // (multicast WQEs are sent unreliably, the tracker follows a single QP).
+            // A WQE joining a non-empty window keeps the window's ACK state.
+            if (state_reg == STATE_INIT_FRAGMENT && is_seq_job && !replay_reg && (retry_timeout != 0) &&
+                (cmd_mc_count_reg == 2'd0)) begin
+                rel_active_reg <= 1'b1;
+                if (!win_valid) begin
+                    rel_qp_reg     <= cmd_dest_qp_reg;
+                    rel_qp_key_reg <= cmd_qp_key_reg;
+                    una_psn_reg    <= cmd_psn_reg;
+                    rel_status_reg <= 8'h00;
+                    rel_fail_reg   <= 1'b0;
+                    nak_seq_reg    <= 1'b0;
+                    retry_cnt_reg  <= 0;
+                end
+            end
+            
+            // Last fragment of a WQE: advance the QP's PSN (first pass), start waiting for ACKs
+            if (state_reg == STATE_UPDATE_STATE && !more_fragments && is_seq_job) begin
+                if (!replay_reg) begin
+                    psn_table[cmd_qp_key_reg] <= cur_psn + 1'b1;
+                    for (i = 0; i < 3; i = i + 1) begin
+                        if (i < cmd_mc_count_reg) begin
+                            psn_table[cmd_mc_qp_key_reg[i*8 +: QP_KEY_WIDTH]] <= cmd_mc_psn_reg[i*24 +: 24] + frag_idx_reg + 1'b1;
+                        end
+                    end
+                end else begin
+                    // Entry resent: go on with the next one, up to the newest
+                    rp_more_reg <= ((rp_idx_reg + 1'b1) != win_tail_reg);
+                    rp_idx_reg  <= rp_idx_reg + 1'b1;
+                end
+                replay_reg <= 1'b0;
+            end
+            
+            // Every packet of the WQE sent: it waits for its ACKs in the window
+            if (win_push) begin
+                rel_active_reg <= 1'b0;
+                last_psn_reg   <= cur_psn;
+                win_tail_reg   <= win_tail_reg + 1'b1;
+                if (!win_valid) begin
+                    ack_timer_reg <= 0;
+                end
+            end
+            
+            // Go back to the oldest unacknowledged PSN, entry by entry (a READ resend is tracked by rd_*)
+            if (accept_replay && !rd_pending_reg) begin
+                replay_reg  <= 1'b1;
+                rp_idx_reg  <= rp_sel;
+                rp_more_reg <= 1'b0;
+                if (replay_ok) begin
+                    nak_seq_reg   <= 1'b0;
+                    retry_cnt_reg <= retry_cnt_reg + 1'b1;
+                    ack_timer_reg <= 0;
+                end
+            end else if (retry_due && !replay_ok) begin
+                rel_fail_reg   <= 1'b1;
+                rel_status_reg <= CPL_ST_RETRY_EXC;
+            end
+            
+            if (ack_for_wqe) begin
+                case (ack_rcvd_syndrome[7:5])
+                    3'b000: begin
+                        // ACK: everything up to and including ack_rcvd_psn arrived
+                        if (ack_new) begin
+                            una_psn_reg   <= ack_rcvd_psn + 1'b1;
+                            ack_timer_reg <= 0;
+                            retry_cnt_reg <= 0;
+                        end
+                    end
+                    3'b001: begin
+                        // RNR NAK: no receive buffer, resend from ack_rcvd_psn after the timeout
+                        if (ack_new) begin
+                            una_psn_reg   <= ack_rcvd_psn;
+                            ack_timer_reg <= 0;
+                        end
+                    end
+                    3'b011: begin
+                        if (ack_rcvd_syndrome[4:0] == 5'd0) begin
+                            // PSN sequence error: resend from the PSN the responder expects
+                            if (ack_new) begin
+                                una_psn_reg <= ack_rcvd_psn;
+                            end
+                            nak_seq_reg <= 1'b1;
+                        end else begin
+                            rel_fail_reg   <= 1'b1;
+                            rel_status_reg <= CPL_ST_REM_ACC_ERR;
+                        end
+                    end
+                    default: begin
+                    end
+                endcase
+            end
+            
+            // Oldest entry completed. After a failure every entry completes with the error;
+            // once the window has drained the responder still expects una_psn_reg, reuse it.
+            if (win_pop) begin
+                win_head_reg <= win_head_reg + 1'b1;
+                if ((win_cnt_reg == 1) && !rel_active_reg) begin
+                    if (rel_fail_reg && (rel_status_reg == CPL_ST_RETRY_EXC)) begin
+                        psn_table[rel_qp_key_reg] <= una_psn_reg;
+                    end
+                    rel_fail_reg <= 1'b0;
+                    nak_seq_reg  <= 1'b0;
+                    rp_more_reg  <= 1'b0;
+                end
+            end
+            if (win_push && !win_pop) begin
+                win_cnt_reg <= win_cnt_reg + 1'b1;
+            end else if (win_pop && !win_push) begin
+                win_cnt_reg <= win_cnt_reg - 1'b1;
+            end
+            
+            if (accept_ack || accept_cnp) begin
+                ack_job_reg    <= 1'b1;
+                ack_resume_reg <= (state_reg == STATE_PROGRAM_HEADER);
+            end else if (state_reg == STATE_WAIT_HDR_DONE && hdr_tx_done) begin
+                ack_job_reg <= 1'b0;
+            end
+            
+            // Context switch: a parked WQE takes its ACK state along. ACKs for it are ignored
+            // until it resumes; the cumulative ACKs of its later packets cover them.
+            if (ctx_save && !is_rsp_reg) begin
+                rel_active_reg <= 1'b0;
+                rel_fail_reg   <= 1'b0;
+                nak_seq_reg    <= 1'b0;
+                rel_status_reg <= 8'h00;
+            end
+            if (ctx_restore && !bank_is_rsp_reg) begin
+                rel_active_reg <= bank_rel_active_reg;
+                rel_qp_reg     <= bank_dest_qp_reg;
+                rel_qp_key_reg <= bank_qp_key_reg;
+                una_psn_reg    <= bank_una_psn_reg;
+                wqe_psn_reg    <= bank_psn_reg;
+                rel_fail_reg   <= bank_rel_fail_reg;
+                rel_status_reg <= bank_rel_status_reg;
+                nak_seq_reg    <= bank_nak_seq_reg;
+                retry_cnt_reg  <= 0;
+            end
+        end
+    end
+    
+    always @(*) begin
+        for (k = 0; k < (1 << QP_IDX_WIDTH); k = k + 1) begin
+            qp_shaped[k] = cc_enable || (rate_table[k] != 0);
+            qp_open[k]   = !qp_shaped[k] || !tokens_table[k][31];
+        end
+    end
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (q = 0; q < (1 << QP_IDX_WIDTH); q = q + 1) begin
+                rate_table[q]   <= 0;
+                burst_table[q]  <= 0;
+                tokens_table[q] <= 0;
+            end
+        end else begin
+            // Refill every cycle up to the burst, charge a fragment when its header starts
+            for (q = 0; q < (1 << QP_IDX_WIDTH); q = q + 1) begin
+                tokens_next = tokens_table[q] + $signed({1'b0, (cc_enable ? cc_rate[q] : rate_table[q])});
+                if (tokens_next > $signed({5'b0, burst_table[q]})) begin
+                    tokens_next = $signed({5'b0, burst_table[q]});
+                end
+                if (shaper_debit && (shaper_qp == q) && qp_shaped[q]) begin
+                    tokens_next = tokens_next - $signed({1'b0, chunk_len_reg, 8'h00});
+                end
+                tokens_table[q] <= tokens_next[31:0];
+            end
+            
+            if (rate_cfg_wr) begin
+                rate_table[rate_cfg[31 -: QP_IDX_WIDTH]]   <= rate_cfg[15:0];
+                burst_table[rate_cfg[31 -: QP_IDX_WIDTH]]  <= {rate_cfg[29:16], 14'h0000};
+                tokens_table[rate_cfg[31 -: QP_IDX_WIDTH]] <= {4'h0, rate_cfg[29:16], 14'h0000};
+            end
+        end
+    end
+    
+    // DCQCN reaction point. A CNP cuts the QP's rate by alpha / 2 and raises alpha; without
+    // CNPs alpha decays. Every CC_RATE_CYCLES the rate recovers halfway to the target
+    // (fast recovery), then the target grows by RATE / 2^CC_RAI_SHIFT up to the configured RATE.
+    // A QP without a RATE starts at CC_LINE_RATE and recovers up to it, so every QP takes part;
+    // the shaper uses cc_rate while cc_enable is set.
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            for (q = 0; q < (1 << QP_IDX_WIDTH); q = q + 1) begin
+                cc_rate[q]   <= CC_LINE_RATE;
+                cc_target[q] <= CC_LINE_RATE;
+                cc_alpha[q]  <= 11'd1024;
+                cc_stage[q]  <= 0;
+            end
+            cc_cnp_seen    <= 0;
+            cc_cut         <= 0;
+            cc_alpha_timer <= 0;
+            cc_rate_timer  <= 0;
+        end else begin
+            cc_alpha_timer <= (cc_alpha_timer == CC_ALPHA_CYCLES - 1) ? 32'd0 : cc_alpha_timer + 1'b1;
+            cc_rate_timer  <= (cc_rate_timer  == CC_RATE_CYCLES  - 1) ? 32'd0 : cc_rate_timer  + 1'b1;
+            
+            if (cc_alpha_timer == CC_ALPHA_CYCLES - 1) begin
+                for (q = 0; q < (1 << QP_IDX_WIDTH); q = q + 1) begin
+                    if (!cc_cnp_seen[q]) begin
+                        cc_alpha[q] <= cc_alpha[q] - (cc_alpha[q] >> CC_G_SHIFT);
+                    end
+                end
+                cc_cnp_seen <= 0;
+            end
+            
+            if (cc_rate_timer == CC_RATE_CYCLES - 1) begin
+                for (q = 0; q < (1 << QP_IDX_WIDTH); q = q + 1) begin
+                    cc_ceil = (rate_table[q] != 0) ? rate_table[q] : CC_LINE_RATE;
+                    if (cc_cut[q]) begin
+                        // Cut during this period: wait a full period before recovering
+                        cc_cut[q] <= 1'b0;
+                    end else if (cc_stage[q] < CC_FAST_STAGES) begin
+                        cc_sum       = cc_rate[q] + cc_target[q];
+                        cc_rate[q]  <= cc_sum[16:1];
+                        cc_stage[q] <= cc_stage[q] + 1'b1;
+                    end else begin
+                        cc_target_next = cc_target[q] + ((cc_ceil >> CC_RAI_SHIFT) | 16'd1);
+                        if (cc_target_next > cc_ceil) begin
+                            cc_target_next = cc_ceil;
+                        end
+                        cc_sum       = cc_rate[q] + cc_target_next;
+                        cc_target[q] <= cc_target_next[15:0];
+                        cc_rate[q]   <= cc_sum[16:1];
+                    end
+                end
+            end
+            
+            if (cnp_rcvd && cc_enable) begin
+                cc_target[cc_qp]   <= cc_rate[cc_qp];
+                cc_rate[cc_qp]     <= (cc_rate[cc_qp] > cc_cut_amt) ? (cc_rate[cc_qp] - cc_cut_amt) : 16'd1;
+                cc_alpha[cc_qp]    <= cc_alpha[cc_qp] + ((11'd1024 - cc_alpha[cc_qp]) >> CC_G_SHIFT);
+                cc_stage[cc_qp]    <= 0;
+                cc_cnp_seen[cc_qp] <= 1'b1;
+                cc_cut[cc_qp]      <= 1'b1;
+            end
+            
+            if (rate_cfg_wr) begin
+                cc_rate[rate_cfg[31 -: QP_IDX_WIDTH]]   <= (rate_cfg[15:0] != 0) ? rate_cfg[15:0] : CC_LINE_RATE;
+                cc_target[rate_cfg[31 -: QP_IDX_WIDTH]] <= (rate_cfg[15:0] != 0) ? rate_cfg[15:0] : CC_LINE_RATE;
+                cc_alpha[rate_cfg[31 -: QP_IDX_WIDTH]]  <= 11'd1024;
+                cc_stage[rate_cfg[31 -: QP_IDX_WIDTH]]  <= 0;
+            end
         end
     end
     
     always @(posedge aclk) begin
         if (!aresetn) begin
             remaining_len_reg       <= 0;
+            seg_idx_reg             <= 0;
+            rows_left_reg           <= 0;
+            row_src_addr_reg        <= 0;
+            row_dst_addr_reg        <= 0;
             current_addr_reg        <= 0;
             current_remote_addr_reg <= 0;
             frag_idx_reg            <= 0;
@@ -239,32 +1465,83 @@ module tx_streamer #(
             chunk_len_reg           <= 0;
             total_sent_reg          <= 0;
             error_status_reg        <= 0;
+        end else if (ctx_restore) begin
+            remaining_len_reg       <= bank_remaining_len_reg;
+            seg_idx_reg             <= bank_seg_idx_reg;
+            rows_left_reg           <= bank_rows_left_reg;
+            row_src_addr_reg        <= bank_row_src_addr_reg;
+            row_dst_addr_reg        <= bank_row_dst_addr_reg;
+            current_addr_reg        <= bank_current_addr_reg;
+            current_remote_addr_reg <= bank_current_remote_addr_reg;
+            frag_idx_reg            <= bank_frag_idx_reg;
+            frag_offset_reg         <= bank_frag_offset_reg;
+            chunk_len_reg           <= bank_chunk_len_reg;
+            total_sent_reg          <= bank_total_sent_reg;
         end else begin
             case (state_reg)
                 STATE_INIT_FRAGMENT: begin
                     // Initialize for new send operation
                     remaining_len_reg       <= cmd_length_reg;
+                    seg_idx_reg             <= 0;
+                    rows_left_reg           <= cmd_row_count_reg;
+                    row_src_addr_reg        <= cmd_ddr_addr_reg;
+                    row_dst_addr_reg        <= cmd_remote_addr_reg;
                     current_addr_reg        <= cmd_ddr_addr_reg;
                     current_remote_addr_reg <= cmd_remote_addr_reg;
                     frag_idx_reg            <= 0;
                     frag_offset_reg         <= 0;
-                    chunk_len_reg           <= first_chunk_len;  // Use first_chunk_len for initial fragment
+                    // Use first_chunk_len for initial fragment (header-only jobs: whole length, no payload)
+                    chunk_len_reg           <= is_hdr_only_job ? cmd_length_reg : first_chunk_len;
                     total_sent_reg          <= 0;
                     error_status_reg        <= 0;
                 end
                 
+                STATE_LOCAL_CMD: begin
+                    if (local_issue) begin
+                        chunk_len_reg <= local_chunk;
+                    end
+                end
+                
+                STATE_LOCAL_WAIT: begin
+                    // Chunk written: advance source, destination and byte count
+                    if (s2mm_wr_xfer_cmplt) begin
+                        remaining_len_reg       <= remaining_len_reg - chunk_len_reg;
+                        current_addr_reg        <= current_addr_reg + chunk_len_reg;
+                        current_remote_addr_reg <= current_remote_addr_reg + chunk_len_reg;
+                        total_sent_reg          <= total_sent_reg + chunk_len_reg;
+                    end
+                end
+                
                 STATE_UPDATE_STATE: begin
-                    // Advance counters for next fragment
-                    remaining_len_reg       <= remaining_len_reg - chunk_len_reg;
-                    current_addr_reg        <= current_addr_reg + chunk_len_reg;
+                    // Advance counters for next fragment (remote side contiguous within a row)
                     current_remote_addr_reg <= current_remote_addr_reg + chunk_len_reg;
                     frag_idx_reg            <= frag_idx_reg + 1;
                     frag_offset_reg         <= frag_offset_reg + chunk_len_reg[15:0];
                     total_sent_reg          <= total_sent_reg + chunk_len_reg;
                     
-                    // Calculate next chunk length
-                    if (remaining_len_reg > chunk_len_reg) begin
-                        chunk_len_reg <= chunk_len_next;
+                    if (seg_more) begin
+                        // Next fragment of the same segment
+                        remaining_len_reg <= remaining_after;
+                        current_addr_reg  <= addr_after;
+                        chunk_len_reg     <= chunk_len_next;
+                    end else if (has_next_row) begin
+                        // Start the next row at its strided source and destination
+                        rows_left_reg           <= rows_left_reg - 1'b1;
+                        row_src_addr_reg        <= next_row_src_addr;
+                        row_dst_addr_reg        <= next_row_dst_addr;
+                        remaining_len_reg       <= cmd_length_reg;
+                        current_addr_reg        <= next_row_src_addr;
+                        current_remote_addr_reg <= next_row_dst_addr;
+                        chunk_len_reg           <= seg_first_chunk_len;
+                    end else if (has_next_seg) begin
+                        // Move on to the next gather segment
+                        seg_idx_reg       <= seg_idx_reg + 1'b1;
+                        remaining_len_reg <= next_seg_length;
+                        current_addr_reg  <= next_seg_addr;
+                        chunk_len_reg     <= seg_first_chunk_len;
+                    end else begin
+                        remaining_len_reg <= remaining_after;
+                        current_addr_reg  <= addr_after;
                     end
                 end
             endcase
@@ -284,10 +1561,36 @@ module tx_streamer #(
             hdr_frag_id_reg        <= 0;
             hdr_more_frags_reg     <= 0;
             hdr_frag_offset_reg    <= 0;
+            hdr_header_only_reg    <= 0;
+            hdr_read_sink_addr_reg <= 0;
+            hdr_read_sink_rkey_reg <= 0;
+            hdr_imm_reg            <= 0;
+            hdr_atomic_data_reg    <= 0;
+            hdr_atomic_compare_reg <= 0;
+            hdr_dst_ip_reg         <= 0;
+            hdr_udp_ports_reg      <= 0;
+        end else if (accept_ack || accept_cnp) begin
+            // ACK / NAK: header only, AETH {syndrome, MSN = 0} in the immediate beat.
+            // CNP: base header only.
+            hdr_opcode_reg         <= accept_ack ? RDMA_OPCODE_ACK : RDMA_OPCODE_CNP;
+            hdr_psn_reg            <= accept_ack ? ack_tx_psn : {RDMA_PSN_WIDTH{1'b0}};
+            hdr_dest_qp_reg        <= accept_ack ? ack_tx_dest_qp : cnp_tx_dest_qp;
+            hdr_remote_addr_reg    <= 0;
+            hdr_rkey_reg           <= 0;
+            hdr_length_reg         <= 0;
+            hdr_partition_key_reg  <= 16'hFFFF;
+            hdr_service_level_reg  <= 8'h00;
+            hdr_frag_id_reg        <= 0;
+            hdr_more_frags_reg     <= 1'b0;
+            hdr_frag_offset_reg    <= 0;
+            hdr_header_only_reg    <= 1'b1;
+            hdr_imm_reg            <= accept_ack ? {ack_tx_syndrome, 24'h000000} : 32'h00000000;
+            hdr_dst_ip_reg         <= 0;
+            hdr_udp_ports_reg      <= 0;
         end else if (state_reg == STATE_PROGRAM_HEADER) begin
             hdr_opcode_reg         <= cmd_opcode_reg;
-            hdr_psn_reg            <= cmd_psn_reg;
-            hdr_dest_qp_reg        <= cmd_dest_qp_reg;
+            hdr_psn_reg            <= mc_replay ? mc_cur_psn : cur_psn;
+            hdr_dest_qp_reg        <= mc_replay ? cmd_mc_dest_qp_reg[mc_sel*24 +: 24] : cmd_dest_qp_reg;
             hdr_remote_addr_reg    <= current_remote_addr_reg;
             hdr_rkey_reg           <= cmd_rkey_reg;
             hdr_length_reg         <= chunk_len_reg;
@@ -296,6 +1599,14 @@ module tx_streamer #(
             hdr_frag_id_reg        <= frag_idx_reg;
             hdr_more_frags_reg     <= more_fragments;
             hdr_frag_offset_reg    <= frag_offset_reg;
+            hdr_header_only_reg    <= is_hdr_only_job;
+            hdr_read_sink_addr_reg <= cmd_ddr_addr_reg;      // READ: local buffer the response lands in
+            hdr_read_sink_rkey_reg <= cmd_local_rkey_reg;
+            hdr_imm_reg            <= cmd_imm_reg;          // Repeated in every fragment
+            hdr_atomic_data_reg    <= cmd_atomic_data_reg;
+            hdr_atomic_compare_reg <= cmd_atomic_compare_reg;
+            hdr_dst_ip_reg         <= mc_replay ? cmd_mc_dst_ip_reg[mc_sel*32 +: 32]    : cmd_dst_ip_reg;
+            hdr_udp_ports_reg      <= mc_replay ? cmd_mc_udp_ports_reg[mc_sel*32 +: 32] : cmd_udp_ports_reg;
         end
     end
     
@@ -311,6 +1622,36 @@ module tx_streamer #(
                 mm2s_addr_reg <= current_addr_reg;
                 mm2s_btt_reg <= chunk_len_reg[C_BTT_WIDTH-1:0];
                 mm2s_valid_reg <= 1;
+            end else if (local_issue) begin
+                // Local copy: read side of the chunk
+                mm2s_addr_reg <= current_addr_reg;
+                mm2s_btt_reg <= local_chunk[C_BTT_WIDTH-1:0];
+                mm2s_valid_reg <= is_local_copy_job;
+            end else if (state_reg == STATE_LOCAL_CMD && mm2s_valid_reg && !m_axis_mm2s_cmd_tready) begin
+                mm2s_valid_reg <= 1; // Hold until accepted
+            end
+        end
+    end
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            s2mm_addr_reg <= 0;
+            s2mm_btt_reg <= 0;
+            s2mm_valid_reg <= 0;
+            local_cmd_issued_reg <= 0;
+        end else begin
+            if (local_issue) begin
+                // Write side of the chunk (copy and fill)
+                s2mm_addr_reg <= current_remote_addr_reg[C_ADDR_WIDTH-1:0];
+                s2mm_btt_reg <= local_chunk[C_BTT_WIDTH-1:0];
+                s2mm_valid_reg <= 1;
+                local_cmd_issued_reg <= 1;
+            end else if (s2mm_valid_reg && m_axis_s2mm_cmd_tready) begin
+                s2mm_valid_reg <= 0;
+            end
+            
+            if (state_reg == STATE_LOCAL_WAIT && s2mm_wr_xfer_cmplt) begin
+                local_cmd_issued_reg <= 0;
             end
         end
     end
@@ -322,23 +1663,65 @@ module tx_streamer #(
         hdr_start_tx_reg = 0;
         
         tx_cpl_valid_reg      = 0;
-        tx_cpl_sq_index_reg   = cmd_sq_index_reg;
-        tx_cpl_status_reg     = error_status_reg;
-        tx_cpl_bytes_sent_reg = total_sent_reg;
+        tx_cpl_sq_index_reg   = rel_cpl_due ? win_sq_index[win_head_reg] : cmd_sq_index_reg;
+        tx_cpl_status_reg     = rd_pending_reg ? rd_status_reg :
+                                rel_cpl_due    ? (head_acked ? 8'h00 : rel_status_reg) : error_status_reg;
+        tx_cpl_bytes_sent_reg = rd_pending_reg ? rd_length_reg :
+                                rel_cpl_due    ? win_bytes[win_head_reg] : total_sent_reg;
         
         case (state_reg)
             STATE_IDLE: begin
-                if (tx_cmd_valid) begin
+                if (cpl_due) begin
+                    state_next = STATE_SEND_CPL;
+                end else if (accept_ack || accept_cnp) begin
+                    state_next = STATE_ACK_HEADER;
+                end else if (accept_resume) begin
+                    state_next = STATE_PROGRAM_HEADER;
+                end else if (accept_rsp || accept_replay || accept_cmd) begin
                     state_next = STATE_INIT_FRAGMENT;
                 end
             end
             
             STATE_INIT_FRAGMENT: begin
-                state_next = STATE_PROGRAM_HEADER;
+                if (is_local_job) begin
+                    state_next = (cmd_length_reg == 0) ? STATE_SEND_CPL : STATE_LOCAL_CMD;
+                end else begin
+                    state_next = STATE_PROGRAM_HEADER;
+                end
+            end
+            
+            STATE_LOCAL_CMD: begin
+                // Wait until both DataMover commands of the chunk are accepted
+                if (local_cmd_issued_reg &&
+                    (!mm2s_valid_reg || m_axis_mm2s_cmd_tready) &&
+                    (!s2mm_valid_reg || m_axis_s2mm_cmd_tready)) begin
+                    state_next = STATE_LOCAL_WAIT;
+                end
+            end
+            
+            STATE_LOCAL_WAIT: begin
+                if (s2mm_wr_xfer_cmplt) begin
+                    state_next = (remaining_len_reg > chunk_len_reg) ? STATE_LOCAL_CMD : STATE_SEND_CPL;
+                end
             end
             
             STATE_PROGRAM_HEADER: begin
-                // Wait for header inserter to be idle
+                if (accept_ack || accept_cnp) begin
+                    // Control packet between two fragments, then carry on with this job
+                    state_next = STATE_ACK_HEADER;
+                end else if (tc_switch) begin
+                    // Swapped-in job continues at its next fragment, a new one starts fresh
+                    state_next = tc_swap ? STATE_PROGRAM_HEADER : STATE_INIT_FRAGMENT;
+                end else if (skip_frag) begin
+                    // Retransmission: already ACKed, only advance the counters
+                    state_next = STATE_UPDATE_STATE;
+                end else if (!hdr_tx_busy && shaper_ok) begin
+                    // Wait for header inserter to be idle and the QP's token bucket
+                    state_next = STATE_START_HEADER;
+                end
+            end
+            
+            STATE_ACK_HEADER: begin
                 if (!hdr_tx_busy) begin
                     state_next = STATE_START_HEADER;
                 end
@@ -346,7 +1729,9 @@ module tx_streamer #(
             
             STATE_START_HEADER: begin
                 hdr_start_tx_reg = 1;
-                state_next = STATE_ISSUE_DM_CMD;
+                // READ requests, atomics, ACKs and CNPs carry no payload; multicast members after the
+                // head take the fragment from tx_local_dma's buffer
+                state_next = (is_hdr_only_job || ack_job_reg || mc_replay) ? STATE_WAIT_HDR_DONE : STATE_ISSUE_DM_CMD;
             end
             
             STATE_ISSUE_DM_CMD: begin
@@ -363,14 +1748,19 @@ module tx_streamer #(
             
             STATE_WAIT_HDR_DONE: begin
                 if (hdr_tx_done) begin
-                    state_next = STATE_UPDATE_STATE;
+                    state_next = !ack_job_reg   ? (mc_more ? STATE_PROGRAM_HEADER : STATE_UPDATE_STATE) :
+                                 ack_resume_reg ? STATE_PROGRAM_HEADER : STATE_IDLE;
                 end
             end
             
             STATE_UPDATE_STATE: begin
-                if (remaining_len_reg > chunk_len_reg) begin
-                    // More fragments to send
+                if (more_fragments) begin
+                    // More fragments to send (same or next segment)
                     state_next = STATE_PROGRAM_HEADER;
+                end else if (is_rsp_reg || is_remote_req_job || rel_active_reg || replay_reg) begin
+                    // Responses complete silently; a READ / atomic completes once its response is back,
+                    // a reliable WQE from the ACK window once all of its PSNs are ACKed
+                    state_next = STATE_IDLE;
                 end else begin
                     // All fragments sent, send completion
                     state_next = STATE_SEND_CPL;
@@ -41,13 +41,15 @@ module tb_rdma_registers();
   wire [31:0] SQ_BASE_HI;
   wire [31:0] SQ_SIZE;
   wire [31:0] SQ_TAIL;
-  wire [31:0] SQ_FLAGS;
-  wire [31:0] SQ_STRIDE;
+  wire [31:0] TC_MAP;
+  wire [31:0] TC_WEIGHT;
   wire [31:0] CQ_BASE_LO;
   wire [31:0] CQ_BASE_HI;
   wire [31:0] CQ_SIZE;
   wire [31:0] CQ_HEAD_SW;
-  wire [31:0] CQ_FLAGS;
+  wire [31:0] QP_CTX_ADDR;
+  wire [31:0] QP_CTX_DATA;
+  wire QP_CTX_WR_PULSE;
   wire SQ_DOORBELL_PULSE;
   wire CQ_DOORBELL_PULSE;
   wire GLOBAL_ENABLE;
@@ -100,13 +102,15 @@ module tb_rdma_registers();
     .SQ_BASE_HI(SQ_BASE_HI),
     .SQ_SIZE(SQ_SIZE),
     .SQ_TAIL(SQ_TAIL),
-    .SQ_FLAGS(SQ_FLAGS),
-    .SQ_STRIDE(SQ_STRIDE),
+    .TC_MAP(TC_MAP),
+    .TC_WEIGHT(TC_WEIGHT),
     .CQ_BASE_LO(CQ_BASE_LO),
     .CQ_BASE_HI(CQ_BASE_HI),
     .CQ_SIZE(CQ_SIZE),
     .CQ_HEAD_SW(CQ_HEAD_SW),
-    .CQ_FLAGS(CQ_FLAGS),
+    .QP_CTX_ADDR(QP_CTX_ADDR),
+    .QP_CTX_DATA(QP_CTX_DATA),
+    .QP_CTX_WR_PULSE(QP_CTX_WR_PULSE),
     .SQ_DOORBELL_PULSE(SQ_DOORBELL_PULSE),
     .CQ_DOORBELL_PULSE(CQ_DOORBELL_PULSE),
     .GLOBAL_ENABLE(GLOBAL_ENABLE),
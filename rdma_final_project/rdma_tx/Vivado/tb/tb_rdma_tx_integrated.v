@@ -9,6 +9,12 @@
 //   - Stream Parser (provides RDMA entries)
 //   - TX Header Inserter (simulates header transmission)
 //   - Memory (simulates DDR for SQ/CQ)
+//
+// Test 5 sends a multicast WQE to a three-member group from the QP context
+// table: one MM2S command per fragment, one header per member and fragment.
+// Test 6 checks the CQE words of reliable WQEs completed by one cumulative ACK
+// and of a WQE that runs out of retries. Test 7 checks the CQE status of
+// READs that time out or are NAKed.
 ////////////////////////////////////////////////////////////////////////////////
 
 module tb_rdma_tx_integrated();
@@ -43,6 +49,20 @@ module tb_rdma_tx_integrated();
     reg [63:0]  rdma_remote_key;
     reg [127:0] rdma_btt;
     reg         rdma_entry_valid;
+    reg [15:0]  sqe_flags;              // Flags of the next submitted SQE
+    
+    // QP context table write port
+    reg         qp_ctx_wr;
+    reg [9:0]   qp_ctx_addr;
+    reg [31:0]  qp_ctx_data;
+    
+    // Reliability (ACK timeout, retries and the ACK / NAK input)
+    reg [31:0]  retry_timeout;
+    reg [2:0]   retry_limit;
+    reg         ack_rcvd;
+    reg [23:0]  ack_rcvd_dest_qp;
+    reg [23:0]  ack_rcvd_psn;
+    reg [7:0]   ack_rcvd_syndrome;
     
     // Command Controller (mock Data Mover commands)
     reg         CMD_CTRL_READY;
@@ -60,13 +80,32 @@ module tb_rdma_tx_integrated();
     wire [7:0]  tx_cmd_sq_index;
     wire [31:0] tx_cmd_ddr_addr;
     wire [31:0] tx_cmd_length;
+    wire [31:0] tx_cmd_sg1_addr;
+    wire [31:0] tx_cmd_sg1_length;
+    wire [31:0] tx_cmd_sg2_addr;
+    wire [31:0] tx_cmd_sg2_length;
+    wire [15:0] tx_cmd_row_count;
+    wire [31:0] tx_cmd_src_stride;
+    wire [31:0] tx_cmd_dst_stride;
+    wire [31:0] tx_cmd_local_rkey;
+    wire [31:0] tx_cmd_imm;
+    wire [63:0] tx_cmd_atomic_swap_add;
+    wire [63:0] tx_cmd_atomic_compare;
+    wire [31:0] tx_cmd_dst_ip;
+    wire [31:0] tx_cmd_udp_ports;
+    wire [1:0]  tx_cmd_mc_count;
+    wire [95:0] tx_cmd_mc_dst_ip;
+    wire [95:0] tx_cmd_mc_udp_ports;
+    wire [71:0] tx_cmd_mc_dest_qp;
+    wire [23:0] tx_cmd_mc_qp_handle;
+    wire [63:0] tx_cpl_atomic_orig;
     wire [7:0]  tx_cmd_opcode;
     wire [23:0] tx_cmd_dest_qp;
+    wire [7:0]  tx_cmd_qp_handle;
     wire [63:0] tx_cmd_remote_addr;
     wire [31:0] tx_cmd_rkey;
     wire [15:0] tx_cmd_partition_key;
     wire [7:0]  tx_cmd_service_level;
-    wire [23:0] tx_cmd_psn;
     
     wire        tx_cpl_valid;
     wire        tx_cpl_ready;
@@ -105,6 +144,7 @@ module tb_rdma_tx_integrated();
     wire [15:0] hdr_fragment_id;
     wire        hdr_more_fragments;
     wire [15:0] hdr_fragment_offset;
+    wire [31:0] hdr_dst_ip;
     
     // TX Streamer <-> Data Mover MM2S interface
     wire [71:0] m_axis_mm2s_cmd_tdata;
@@ -136,6 +176,9 @@ module tb_rdma_tx_integrated();
         .rdma_remote_key(rdma_remote_key),
         .rdma_btt(rdma_btt),
         .rdma_entry_valid(rdma_entry_valid),
+        .qp_ctx_wr(qp_ctx_wr),
+        .qp_ctx_addr(qp_ctx_addr),
+        .qp_ctx_data(qp_ctx_data),
         .CMD_CTRL_READY(CMD_CTRL_READY),
         .CMD_CTRL_START(CMD_CTRL_START),
         .CMD_CTRL_SRC_ADDR(CMD_CTRL_SRC_ADDR),
@@ -149,18 +192,54 @@ module tb_rdma_tx_integrated();
         .tx_cmd_sq_index(tx_cmd_sq_index),
         .tx_cmd_ddr_addr(tx_cmd_ddr_addr),
         .tx_cmd_length(tx_cmd_length),
+        .tx_cmd_sg1_addr(tx_cmd_sg1_addr),
+        .tx_cmd_sg1_length(tx_cmd_sg1_length),
+        .tx_cmd_sg2_addr(tx_cmd_sg2_addr),
+        .tx_cmd_sg2_length(tx_cmd_sg2_length),
+        .tx_cmd_row_count(tx_cmd_row_count),
+        .tx_cmd_src_stride(tx_cmd_src_stride),
+        .tx_cmd_dst_stride(tx_cmd_dst_stride),
+        .tx_cmd_local_rkey(tx_cmd_local_rkey),
+        .tx_cmd_imm(tx_cmd_imm),
+        .tx_cmd_atomic_swap_add(tx_cmd_atomic_swap_add),
+        .tx_cmd_atomic_compare(tx_cmd_atomic_compare),
+        .tx_cmd_dst_ip(tx_cmd_dst_ip),
+        .tx_cmd_udp_ports(tx_cmd_udp_ports),
+        .tx_cmd_mc_count(tx_cmd_mc_count),
+        .tx_cmd_mc_dst_ip(tx_cmd_mc_dst_ip),
+        .tx_cmd_mc_udp_ports(tx_cmd_mc_udp_ports),
+        .tx_cmd_mc_dest_qp(tx_cmd_mc_dest_qp),
+        .tx_cmd_mc_qp_handle(tx_cmd_mc_qp_handle),
         .tx_cmd_opcode(tx_cmd_opcode),
         .tx_cmd_dest_qp(tx_cmd_dest_qp),
+        .tx_cmd_qp_handle(tx_cmd_qp_handle),
         .tx_cmd_remote_addr(tx_cmd_remote_addr),
         .tx_cmd_rkey(tx_cmd_rkey),
         .tx_cmd_partition_key(tx_cmd_partition_key),
         .tx_cmd_service_level(tx_cmd_service_level),
-        .tx_cmd_psn(tx_cmd_psn),
         .tx_cpl_valid(tx_cpl_valid),
         .tx_cpl_ready(tx_cpl_ready),
         .tx_cpl_sq_index(tx_cpl_sq_index),
         .tx_cpl_status(tx_cpl_status),
         .tx_cpl_bytes_sent(tx_cpl_bytes_sent),
+        .tx_cpl_atomic_orig(tx_cpl_atomic_orig),
+        .pl_wqe_valid(1'b0),
+        .pl_wqe_sel(),
+        .pl_cpl_tdata(),
+        .pl_cpl_tvalid(),
+        .pl_cpl_tready(1'b1),
+        .pl_cpl_tlast(),
+        .STRM_EN(1'b0),
+        .STRM_BASE_ADDR(64'd0),
+        .STRM_SIZE(32'd0),
+        .STRM_CHUNK(32'd0),
+        .STRM_REMOTE_ADDR(64'd0),
+        .STRM_RKEY(32'd0),
+        .STRM_QP(8'd0),
+        .STRM_PROD_WR(1'b0),
+        .STRM_PROD_IN(32'd0),
+        .STRM_PROD(),
+        .STRM_CONS(),
         .STATE_REG(STATE_REG),
         .HAS_WORK(HAS_WORK),
         .START_STREAM(START_STREAM),
@@ -197,18 +276,73 @@ module tb_rdma_tx_integrated();
         .tx_cmd_sq_index(tx_cmd_sq_index),
         .tx_cmd_ddr_addr(tx_cmd_ddr_addr),
         .tx_cmd_length(tx_cmd_length),
+        .tx_cmd_sg1_addr(tx_cmd_sg1_addr),
+        .tx_cmd_sg1_length(tx_cmd_sg1_length),
+        .tx_cmd_sg2_addr(tx_cmd_sg2_addr),
+        .tx_cmd_sg2_length(tx_cmd_sg2_length),
+        .tx_cmd_row_count(tx_cmd_row_count),
+        .tx_cmd_src_stride(tx_cmd_src_stride),
+        .tx_cmd_dst_stride(tx_cmd_dst_stride),
+        .tx_cmd_local_rkey(tx_cmd_local_rkey),
+        .tx_cmd_imm(tx_cmd_imm),
+        .tx_cmd_atomic_swap_add(tx_cmd_atomic_swap_add),
+        .tx_cmd_atomic_compare(tx_cmd_atomic_compare),
+        .tx_cmd_dst_ip(tx_cmd_dst_ip),
+        .tx_cmd_udp_ports(tx_cmd_udp_ports),
+        .tx_cmd_mc_count(tx_cmd_mc_count),
+        .tx_cmd_mc_dst_ip(tx_cmd_mc_dst_ip),
+        .tx_cmd_mc_udp_ports(tx_cmd_mc_udp_ports),
+        .tx_cmd_mc_dest_qp(tx_cmd_mc_dest_qp),
+        .tx_cmd_mc_qp_handle(tx_cmd_mc_qp_handle),
+        .rd_rsp_valid(1'b0),
+        .rd_rsp_ready(),
+        .rd_rsp_src_addr(32'd0),
+        .rd_rsp_length(32'd0),
+        .rd_rsp_remote_addr(64'd0),
+        .rd_rsp_rkey(32'd0),
+        .rd_rsp_dest_qp(24'd0),
+        .rd_rsp_psn(24'd0),
+        .rd_rsp_atomic(1'b0),
+        .rd_rsp_orig(64'd0),
+        .rd_rsp_sl(8'd0),
+        .read_done(1'b0),
+        .atomic_done(1'b0),
+        .atomic_orig(64'd0),
+        .retry_timeout(retry_timeout),
+        .retry_limit(retry_limit),
+        .ack_rcvd(ack_rcvd),
+        .ack_rcvd_dest_qp(ack_rcvd_dest_qp),
+        .ack_rcvd_psn(ack_rcvd_psn),
+        .ack_rcvd_syndrome(ack_rcvd_syndrome),
+        .ack_tx_valid(1'b0),
+        .ack_tx_ready(),
+        .ack_tx_dest_qp(24'd0),
+        .ack_tx_psn(24'd0),
+        .ack_tx_syndrome(8'd0),
+        .rate_cfg(32'd0),
+        .rate_cfg_wr(1'b0),
+        .cc_enable(1'b0),
+        .cnp_rcvd(1'b0),
+        .cnp_rcvd_dest_qp(24'd0),
+        .cnp_tx_valid(1'b0),
+        .cnp_tx_ready(),
+        .cnp_tx_dest_qp(24'd0),
+        .tc_map(32'd0),
+        .tc_weight(32'd0),
+        .tc_wrr(1'b0),
         .tx_cmd_opcode(tx_cmd_opcode),
         .tx_cmd_dest_qp(tx_cmd_dest_qp),
+        .tx_cmd_qp_handle(tx_cmd_qp_handle),
         .tx_cmd_remote_addr(tx_cmd_remote_addr),
         .tx_cmd_rkey(tx_cmd_rkey),
         .tx_cmd_partition_key(tx_cmd_partition_key),
         .tx_cmd_service_level(tx_cmd_service_level),
-        .tx_cmd_psn(tx_cmd_psn),
         .tx_cpl_valid(tx_cpl_valid),
         .tx_cpl_ready(tx_cpl_ready),
         .tx_cpl_sq_index(tx_cpl_sq_index),
         .tx_cpl_status(tx_cpl_status),
         .tx_cpl_bytes_sent(tx_cpl_bytes_sent),
+        .tx_cpl_atomic_orig(tx_cpl_atomic_orig),
         .hdr_start_tx(hdr_start_tx),
         .hdr_tx_busy(hdr_tx_busy),
         .hdr_tx_done(hdr_tx_done),
@@ -223,10 +357,27 @@ module tb_rdma_tx_integrated();
         .hdr_fragment_id(hdr_fragment_id),
         .hdr_more_fragments(hdr_more_fragments),
         .hdr_fragment_offset(hdr_fragment_offset),
+        .hdr_header_only(),
+        .hdr_read_sink_addr(),
+        .hdr_read_sink_rkey(),
+        .hdr_imm(),
+        .hdr_atomic_data(),
+        .hdr_atomic_compare(),
+        .hdr_dst_ip(hdr_dst_ip),
+        .hdr_udp_ports(),
         .m_axis_mm2s_cmd_tdata(m_axis_mm2s_cmd_tdata),
         .m_axis_mm2s_cmd_tvalid(m_axis_mm2s_cmd_tvalid),
         .m_axis_mm2s_cmd_tready(m_axis_mm2s_cmd_tready),
-        .mm2s_rd_xfer_cmplt(mm2s_rd_xfer_cmplt)
+        .mm2s_rd_xfer_cmplt(mm2s_rd_xfer_cmplt),
+        .m_axis_s2mm_cmd_tdata(),
+        .m_axis_s2mm_cmd_tvalid(),
+        .m_axis_s2mm_cmd_tready(1'b1),
+        .s2mm_wr_xfer_cmplt(1'b0),
+        .local_copy_en(),
+        .local_fill_start(),
+        .local_fill_len(),
+        .local_fill_pattern(),
+        .mc_replay_start()
     );
     
     // State name display for debugging
@@ -244,6 +395,10 @@ module tb_rdma_tx_integrated();
             4'd8:  state_name = "WRITE_CMD";
             4'd9:  state_name = "START_STREAM";
             4'd10: state_name = "WAIT_WRITE_DONE";
+            4'd11: state_name = "MCAST_WALK";
+            4'd12: state_name = "PL_WQE";
+            4'd13: state_name = "PL_CPL";
+            4'd14: state_name = "STRM_WQE";
             default: state_name = "UNKNOWN";
         endcase
     end
@@ -330,6 +485,13 @@ module tb_rdma_tx_integrated();
     //========================================================================
     reg [4:0] hdr_tx_cnt;
     
+    // Header log (QPN, PSN, destination IP, remote address per packet)
+    reg [23:0] hdr_log_qp    [0:15];
+    reg [23:0] hdr_log_psn   [0:15];
+    reg [31:0] hdr_log_ip    [0:15];
+    reg [63:0] hdr_log_raddr [0:15];
+    integer    hdr_log_cnt;
+    
     always @(posedge clk) begin
         if (rst) begin
             hdr_tx_busy <= 0;
@@ -338,6 +500,13 @@ module tb_rdma_tx_integrated();
         end else begin
             hdr_tx_done <= 1;
             if (hdr_start_tx && !hdr_tx_busy) begin
+                if (hdr_log_cnt < 16) begin
+                    hdr_log_qp[hdr_log_cnt]    = hdr_rdma_dest_qp;
+                    hdr_log_psn[hdr_log_cnt]   = hdr_rdma_psn;
+                    hdr_log_ip[hdr_log_cnt]    = hdr_dst_ip;
+                    hdr_log_raddr[hdr_log_cnt] = hdr_rdma_remote_addr;
+                end
+                hdr_log_cnt = hdr_log_cnt + 1;
                 hdr_tx_busy <= 1;
                 hdr_tx_cnt <= 32; // 7 beats for header
                 $display("[%0t] Mock HDR: Start TX - Opcode=0x%h, Length=%0d, FragID=%0d, More=%b",
@@ -359,6 +528,12 @@ module tb_rdma_tx_integrated();
     reg [7:0] mm2s_transfer_cnt;
     reg [22:0] btt;
     reg [31:0] addr;
+    
+    // MM2S command log
+    reg [31:0] mm2s_log_addr [0:15];
+    reg [22:0] mm2s_log_btt  [0:15];
+    integer    mm2s_log_cnt;
+    
     always @(posedge clk) begin
         if (rst) begin
             m_axis_mm2s_cmd_tready <= 1;
@@ -372,6 +547,11 @@ module tb_rdma_tx_integrated();
                 
                 btt = m_axis_mm2s_cmd_tdata[22:0];
                 addr = m_axis_mm2s_cmd_tdata[63:32];
+                if (mm2s_log_cnt < 16) begin
+                    mm2s_log_addr[mm2s_log_cnt] = addr;
+                    mm2s_log_btt[mm2s_log_cnt]  = btt;
+                end
+                mm2s_log_cnt = mm2s_log_cnt + 1;
                 
                 // Simulate transfer delay (1 cycle per 256 bytes)
                 mm2s_transfer_cnt <= 5 + (btt[22:8]); // Base 5 + btt/256
@@ -440,6 +620,10 @@ module tb_rdma_tx_integrated();
                 4'd8:  get_state_name = "WRITE_CMD";
                 4'd9:  get_state_name = "START_STREAM";
                 4'd10: get_state_name = "WAIT_WRITE_DONE";
+                4'd11: get_state_name = "MCAST_WALK";
+                4'd12: get_state_name = "PL_WQE";
+                4'd13: get_state_name = "PL_CPL";
+                4'd14: get_state_name = "STRM_WQE";
                 default: get_state_name = "UNKNOWN";
             endcase
         end
@@ -448,6 +632,9 @@ module tb_rdma_tx_integrated();
     //========================================================================
     // TX Streamer monitoring
     //========================================================================
+    reg [7:0]  last_cpl_status;
+    reg [31:0] last_cpl_bytes;
+    
     always @(posedge clk) begin
         if (tx_cmd_valid && tx_cmd_ready) begin
             $display("[%0t] TX CMD: SQ_IDX=%0d, Addr=0x%h, Len=%0d, Opcode=0x%h",
@@ -457,12 +644,17 @@ module tb_rdma_tx_integrated();
         if (tx_cpl_valid && tx_cpl_ready) begin
             $display("[%0t] TX CPL: SQ_IDX=%0d, Status=%0d, Bytes=%0d",
                      $time, tx_cpl_sq_index, tx_cpl_status, tx_cpl_bytes_sent);
+            last_cpl_status <= tx_cpl_status;
+            last_cpl_bytes  <= tx_cpl_bytes_sent;
         end
     end
     
     //========================================================================
     // Test Tasks
     //========================================================================
+    integer    errors;
+    reg [23:0] psn0, psn1, psn2;        // PSN table before the multicast WQE
+    
     task submit_sq_entry;
         input [31:0] id;
         input [15:0] opcode;
@@ -472,7 +664,7 @@ module tb_rdma_tx_integrated();
         begin
             rdma_id = id;
             rdma_opcode = opcode;
-            rdma_flags = 16'h0000;
+            rdma_flags = sqe_flags;
             rdma_local_key = {32'h0, local_addr};
             rdma_remote_key = remote_addr;
             rdma_btt = {96'h0, length};
@@ -502,6 +694,84 @@ module tb_rdma_tx_integrated();
         end
     endtask
     
+    task write_qp_ctx;
+        input [7:0]  handle;
+        input [1:0]  word;
+        input [31:0] data;
+        begin
+            @(posedge clk);
+            qp_ctx_wr <= 1;
+            qp_ctx_addr <= {handle, word};
+            qp_ctx_data <= data;
+            @(posedge clk);
+            qp_ctx_wr <= 0;
+        end
+    endtask
+    
+    task check_mm2s;
+        input integer idx;
+        input [31:0] exp_addr;
+        input [22:0] exp_btt;
+        begin
+            if (mm2s_log_addr[idx] !== exp_addr || mm2s_log_btt[idx] !== exp_btt) begin
+                $display("ERROR: MM2S[%0d] Addr=0x%h BTT=%0d, expected 0x%h / %0d",
+                         idx, mm2s_log_addr[idx], mm2s_log_btt[idx], exp_addr, exp_btt);
+                errors = errors + 1;
+            end
+        end
+    endtask
+    
+    task check_header;
+        input integer idx;
+        input [23:0] exp_qp;
+        input [23:0] exp_psn;
+        input [31:0] exp_ip;
+        input [63:0] exp_raddr;
+        begin
+            if (hdr_log_qp[idx] !== exp_qp || hdr_log_psn[idx] !== exp_psn ||
+                hdr_log_ip[idx] !== exp_ip || hdr_log_raddr[idx] !== exp_raddr) begin
+                $display("ERROR: HDR[%0d] QP=0x%h PSN=%0d IP=0x%h RAddr=0x%h, expected 0x%h / %0d / 0x%h / 0x%h",
+                         idx, hdr_log_qp[idx], hdr_log_psn[idx], hdr_log_ip[idx], hdr_log_raddr[idx],
+                         exp_qp, exp_psn, exp_ip, exp_raddr);
+                errors = errors + 1;
+            end
+        end
+    endtask
+    
+    task send_ack;
+        input [23:0] qp;
+        input [23:0] psn;
+        input [7:0]  syndrome;
+        begin
+            @(posedge clk);
+            ack_rcvd <= 1;
+            ack_rcvd_dest_qp <= qp;
+            ack_rcvd_psn <= psn;
+            ack_rcvd_syndrome <= syndrome;
+            @(posedge clk);
+            ack_rcvd <= 0;
+            $display("[%0t] ACK received: QP=0x%h, PSN=%0d, Syndrome=0x%h", $time, qp, psn, syndrome);
+        end
+    endtask
+    
+    // CQE words of the entry just written: SQ index, status, bytes, WQE ID, requested length
+    task check_cqe;
+        input [7:0]  exp_idx;
+        input [7:0]  exp_status;
+        input [31:0] exp_bytes;
+        input [31:0] exp_id;
+        input [31:0] exp_len;
+        begin
+            if (cq_entry_0 !== {24'd0, exp_idx} || cq_entry_1 !== {24'd0, exp_status} ||
+                cq_entry_2 !== exp_bytes || cq_entry_4 !== exp_id || cq_entry_5 !== exp_len) begin
+                $display("ERROR: CQE [0]=0x%h [1]=0x%h [2]=%0d [4]=0x%h [5]=%0d, expected 0x%h / 0x%h / %0d / 0x%h / %0d",
+                         cq_entry_0, cq_entry_1, cq_entry_2, cq_entry_4, cq_entry_5,
+                         exp_idx, exp_status, exp_bytes, exp_id, exp_len);
+                errors = errors + 1;
+            end
+        end
+    endtask
+    
     //========================================================================
     // Test Stimulus
     //========================================================================
@@ -524,6 +794,19 @@ module tb_rdma_tx_integrated();
         rdma_remote_key = 0;
         rdma_btt = 0;
         rdma_entry_valid = 0;
+        sqe_flags = 0;
+        qp_ctx_wr = 0;
+        qp_ctx_addr = 0;
+        qp_ctx_data = 0;
+        retry_timeout = 0;              // Unreliable until test 6
+        retry_limit = 0;
+        ack_rcvd = 0;
+        ack_rcvd_dest_qp = 0;
+        ack_rcvd_psn = 0;
+        ack_rcvd_syndrome = 0;
+        hdr_log_cnt = 0;
+        mm2s_log_cnt = 0;
+        errors = 0;
         
         prev_state = 4'd0;
         
@@ -566,8 +849,106 @@ module tb_rdma_tx_integrated();
         wait_for_cq_entry(1000);
         repeat(20) @(posedge clk);
         
+        // Test 5: Multicast (8KB, 2 fragments, head + 2 members)
+        // Group 1 -> 2 -> 3 on the QPNs of tests 1-3; with a QP context the PSN is kept per handle
+        $display("\n--- Test 5: 8KB multicast to 3 members ---");
+        write_qp_ctx(8'd1, 2'd0, 32'h0A00_0001);
+        write_qp_ctx(8'd1, 2'd1, 32'h12B7_12B7);
+        write_qp_ctx(8'd1, 2'd2, 32'h8000_1234);
+        write_qp_ctx(8'd1, 2'd3, 32'h8000_0002);
+        write_qp_ctx(8'd2, 2'd0, 32'h0A00_0002);
+        write_qp_ctx(8'd2, 2'd1, 32'h12B7_12B7);
+        write_qp_ctx(8'd2, 2'd2, 32'h8000_1235);
+        write_qp_ctx(8'd2, 2'd3, 32'h8000_0003);
+        write_qp_ctx(8'd3, 2'd0, 32'h0A00_0003);
+        write_qp_ctx(8'd3, 2'd1, 32'h12B7_12B7);
+        write_qp_ctx(8'd3, 2'd2, 32'h8000_1236);
+        write_qp_ctx(8'd3, 2'd3, 32'h0000_0000);
+        
+        psn0 = u_tx_streamer.psn_table[1];
+        psn1 = u_tx_streamer.psn_table[2];
+        psn2 = u_tx_streamer.psn_table[3];
+        hdr_log_cnt = 0;
+        mm2s_log_cnt = 0;
+        sqe_flags = 16'h001C;           // QP handle 1, FLAG_QP_CTX | FLAG_MCAST
+        submit_sq_entry(32'h1238, 16'h0A, 32'h3000_4000, 64'h5000_0000_0000_4000, 32'd8192);
+        wait_for_cq_entry(2000);
+        sqe_flags = 0;
+        
+        // The payload is read once per fragment; members replay it with their own header
+        if (mm2s_log_cnt != 2 || hdr_log_cnt != 6) begin
+            $display("ERROR: %0d MM2S commands / %0d headers, expected 2 / 6", mm2s_log_cnt, hdr_log_cnt);
+            errors = errors + 1;
+        end
+        check_mm2s(0, 32'h3000_4000, 23'd4096);
+        check_mm2s(1, 32'h3000_5000, 23'd4096);
+        check_header(0, 24'h001234, psn0,     32'h0A00_0001, 64'h5000_0000_0000_4000);
+        check_header(1, 24'h001235, psn1,     32'h0A00_0002, 64'h5000_0000_0000_4000);
+        check_header(2, 24'h001236, psn2,     32'h0A00_0003, 64'h5000_0000_0000_4000);
+        check_header(3, 24'h001234, psn0 + 1, 32'h0A00_0001, 64'h5000_0000_0000_5000);
+        check_header(4, 24'h001235, psn1 + 1, 32'h0A00_0002, 64'h5000_0000_0000_5000);
+        check_header(5, 24'h001236, psn2 + 1, 32'h0A00_0003, 64'h5000_0000_0000_5000);
+        if (last_cpl_status != 0 || last_cpl_bytes != 32'd8192) begin
+            $display("ERROR: multicast completion Status=%0d Bytes=%0d, expected 0 / 8192",
+                     last_cpl_status, last_cpl_bytes);
+            errors = errors + 1;
+        end
+        // Every member's PSN moved past the two fragments
+        if (u_tx_streamer.psn_table[1] != psn0 + 2 || u_tx_streamer.psn_table[2] != psn1 + 2 ||
+            u_tx_streamer.psn_table[3] != psn2 + 2) begin
+            $display("ERROR: member PSNs not advanced by 2");
+            errors = errors + 1;
+        end
+        repeat(20) @(posedge clk);
+        
+        // Test 6: Reliable WQEs. One ACK retires both window entries back to back, so each
+        // CQE must carry its own WQE's index, status and bytes, not the next entry's.
+        $display("\n--- Test 6: Reliable WQEs, cumulative ACK and retry exhaustion ---");
+        retry_timeout = 32'd2000;
+        retry_limit = 3'd1;
+        psn0 = u_tx_streamer.psn_table[8'h34];     // No QP context: keyed by QPN[7:0]
+        submit_sq_entry(32'h1234, 16'h0A, 32'h3000_6000, 64'h5000_0000_0000_6000, 32'd8192);   // SQ 5, PSN p, p+1
+        wait (u_tx_streamer.win_cnt_reg == 1);
+        submit_sq_entry(32'h1234, 16'h0A, 32'h3000_8000, 64'h5000_0000_0000_8000, 32'd4096);   // SQ 6, PSN p+2
+        wait (u_tx_streamer.win_cnt_reg == 2);
+        send_ack(24'h001234, psn0 + 2, 8'h00);
+        wait_for_cq_entry(500);
+        check_cqe(8'd5, 8'h00, 32'd8192, 32'h1234, 32'd8192);
+        wait_for_cq_entry(500);
+        check_cqe(8'd6, 8'h00, 32'd4096, 32'h1234, 32'd4096);
+        
+        // No ACK at all: first pass, one retransmission, then CPL_ST_RETRY_EXC
+        submit_sq_entry(32'h1234, 16'h0A, 32'h3000_9000, 64'h5000_0000_0000_9000, 32'd256);    // SQ 7
+        wait_for_cq_entry(10000);
+        check_cqe(8'd7, 8'h01, 32'd256, 32'h1234, 32'd256);
+        repeat(20) @(posedge clk);
+        
+        // Test 7: Failed READs. The READ tracking is cleared on the handshake, so the CQE
+        // must keep the READ's status and length rather than the streamer's defaults.
+        $display("\n--- Test 7: READ timeout and NAK ---");
+        retry_limit = 3'd0;
+        submit_sq_entry(32'h1235, 16'h0C, 32'h3000_A000, 64'h5000_0000_0000_A000, 32'd256);    // SQ 8
+        wait_for_cq_entry(5000);
+        check_cqe(8'd8, 8'h01, 32'd256, 32'h1235, 32'd256);
+        repeat(20) @(posedge clk);
+        
+        // Remote access error NAK of the request PSN
+        hdr_log_cnt = 0;
+        submit_sq_entry(32'h1235, 16'h0C, 32'h3000_B000, 64'h5000_0000_0000_B000, 32'd512);    // SQ 9
+        wait (hdr_log_cnt == 1);
+        wait (u_tx_streamer.rd_pending_reg);
+        send_ack(24'h001235, hdr_log_psn[0], 8'h62);
+        wait_for_cq_entry(500);
+        check_cqe(8'd9, 8'h02, 32'd512, 32'h1235, 32'd512);
+        retry_timeout = 0;
+        retry_limit = 0;
+        repeat(20) @(posedge clk);
+        
         $display("\n========================================");
-        $display("Test Complete");
+        if (errors == 0)
+            $display("Test Complete");
+        else
+            $display("Test Complete: %0d ERRORS", errors);
         $display("========================================\n");
         
         repeat(50) @(posedge clk);
@@ -576,7 +957,7 @@ module tb_rdma_tx_integrated();
     
     // Timeout watchdog
     initial begin
-        #100000;
+        #400000;
         $display("ERROR: Simulation timeout!");
         $finish;
     end
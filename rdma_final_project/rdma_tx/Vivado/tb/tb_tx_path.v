@@ -15,6 +15,14 @@
 //   2. Multi-fragment transfer (> 4KB) 
 //   3. 4KB boundary alignment
 //   4. Back-to-back commands
+//   5. Three-segment gather list, one segment crossing 4KB
+//   6. Strided 2D transfer, source and destination pitches differ
+//   7. Reliable WQEs: PSN assignment, one cumulative ACK completes two
+//   8. NAK (PSN sequence error): Go-Back-N from the NAKed PSN
+//   9. ACK timeout: retransmission, then ACK
+//  10. Retry exhaustion: error completion, PSN reused by the next WQE
+//  11. Strict priority: urgent-class WQE preempts a bulk WQE, bulk resumes
+//  12. WRR: bulk and urgent classes alternate by their fragment weights
 //
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -60,7 +68,13 @@ module tb_tx_path();
     reg [RDMA_RKEY_WIDTH-1:0]      tx_cmd_rkey;
     reg [15:0]                      tx_cmd_partition_key;
     reg [7:0]                       tx_cmd_service_level;
-    reg [RDMA_PSN_WIDTH-1:0]       tx_cmd_psn;
+    reg [C_ADDR_WIDTH-1:0]         tx_cmd_sg1_addr;
+    reg [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_sg1_length;
+    reg [C_ADDR_WIDTH-1:0]         tx_cmd_sg2_addr;
+    reg [RDMA_LENGTH_WIDTH-1:0]    tx_cmd_sg2_length;
+    reg [15:0]                      tx_cmd_row_count;
+    reg [31:0]                      tx_cmd_src_stride;
+    reg [31:0]                      tx_cmd_dst_stride;
     
     // Completion Interface from tx_streamer
     wire                            tx_cpl_valid;
@@ -84,6 +98,12 @@ module tb_tx_path();
     wire [15:0]                     hdr_fragment_id;
     wire                            hdr_more_fragments;
     wire [15:0]                     hdr_fragment_offset;
+    wire                            hdr_header_only;
+    wire [RDMA_ADDR_WIDTH-1:0]      hdr_read_sink_addr;
+    wire [RDMA_RKEY_WIDTH-1:0]      hdr_read_sink_rkey;
+    wire [31:0]                     hdr_imm;
+    wire [63:0]                     hdr_atomic_data;
+    wire [63:0]                     hdr_atomic_compare;
     
     // MM2S Command Interface (tx_streamer output)
     wire [71:0]                     m_axis_mm2s_cmd_tdata;
@@ -93,6 +113,23 @@ module tb_tx_path();
     // MM2S Status (mock Data Mover)
     reg                             mm2s_rd_xfer_cmplt;
     
+    // READ response seen (mock responder)
+    reg                             read_done;
+    
+    // Reliable delivery: ACK timeout / retries and received ACK / NAK
+    reg [31:0]                      retry_timeout;
+    reg [2:0]                       retry_limit;
+    reg                             ack_rcvd;
+    reg [RDMA_QPN_WIDTH-1:0]        ack_rcvd_dest_qp;
+    reg [RDMA_PSN_WIDTH-1:0]        ack_rcvd_psn;
+    reg [7:0]                       ack_rcvd_syndrome;
+    
+    // Traffic classes: SL -> class map, WRR weights, service level of the next command
+    reg [31:0]                      tc_map;
+    reg [31:0]                      tc_weight;
+    reg                             tc_wrr;
+    reg [7:0]                       cmd_sl;
+    
     // Data Mover to Header Inserter (AXI-Stream)
     reg [C_AXIS_TDATA_WIDTH-1:0]   s_axis_tdata;
     reg [C_AXIS_TKEEP_WIDTH-1:0]   s_axis_tkeep;
@@ -115,6 +152,18 @@ module tb_tx_path();
     reg [RDMA_LENGTH_WIDTH-1:0] dm_bytes_remaining;
     reg [C_ADDR_WIDTH-1:0] dm_current_addr;
     
+    // MM2S commands and packet headers seen since the last clear
+    reg [C_ADDR_WIDTH-1:0]         mm2s_log_addr [0:31];
+    reg [C_BTT_WIDTH-1:0]          mm2s_log_btt  [0:31];
+    integer mm2s_log_cnt;
+    reg [RDMA_OPCODE_WIDTH-1:0]    hdr_log_opcode [0:31];
+    reg [RDMA_PSN_WIDTH-1:0]       hdr_log_psn    [0:31];
+    reg [RDMA_QPN_WIDTH-1:0]       hdr_log_qp     [0:31];
+    reg [RDMA_ADDR_WIDTH-1:0]      hdr_log_raddr  [0:31];
+    reg [RDMA_LENGTH_WIDTH-1:0]    hdr_log_length [0:31];
+    integer hdr_log_cnt;
+    integer cpl_log_cnt;
+    
     //========================================================================
     // Test Variables
     //========================================================================
@@ -122,6 +171,12 @@ module tb_tx_path();
     integer header_beats_received;
     integer data_beats_received;
     integer total_beats_received;
+    integer errors;
+    
+    // Last completion taken by wait_completion
+    reg [SQ_INDEX_WIDTH-1:0]       cpl_sq_index;
+    reg [7:0]                       cpl_status;
+    reg [RDMA_LENGTH_WIDTH-1:0]    cpl_bytes;
     
     //========================================================================
     // Clock Generation
@@ -157,13 +212,69 @@ module tb_tx_path();
         .tx_cmd_sq_index(tx_cmd_sq_index),
         .tx_cmd_ddr_addr(tx_cmd_ddr_addr),
         .tx_cmd_length(tx_cmd_length),
+        .tx_cmd_sg1_addr(tx_cmd_sg1_addr),          // Gather list (length 0 = unused)
+        .tx_cmd_sg1_length(tx_cmd_sg1_length),
+        .tx_cmd_sg2_addr(tx_cmd_sg2_addr),
+        .tx_cmd_sg2_length(tx_cmd_sg2_length),
+        .tx_cmd_row_count(tx_cmd_row_count),        // 2D transfer (0/1 = linear)
+        .tx_cmd_src_stride(tx_cmd_src_stride),
+        .tx_cmd_dst_stride(tx_cmd_dst_stride),
+        .tx_cmd_local_rkey({RDMA_RKEY_WIDTH{1'b0}}),
+        .tx_cmd_imm(32'd0),
+        .tx_cmd_atomic_swap_add(64'd0),
+        .tx_cmd_atomic_compare(64'd0),
+        .tx_cmd_dst_ip(32'd0),
+        .tx_cmd_udp_ports(32'd0),
+        .tx_cmd_mc_count(2'd0),
+        .tx_cmd_mc_dst_ip(96'd0),
+        .tx_cmd_mc_udp_ports(96'd0),
+        .tx_cmd_mc_dest_qp(72'd0),
+        .tx_cmd_mc_qp_handle(24'd0),
+        
+        // No remote READ requests / READ responses served in this test
+        .rd_rsp_valid(1'b0),
+        .rd_rsp_ready(),
+        .rd_rsp_src_addr({C_ADDR_WIDTH{1'b0}}),
+        .rd_rsp_length({RDMA_LENGTH_WIDTH{1'b0}}),
+        .rd_rsp_remote_addr({RDMA_ADDR_WIDTH{1'b0}}),
+        .rd_rsp_rkey({RDMA_RKEY_WIDTH{1'b0}}),
+        .rd_rsp_dest_qp({RDMA_QPN_WIDTH{1'b0}}),
+        .rd_rsp_psn({RDMA_PSN_WIDTH{1'b0}}),
+        .rd_rsp_atomic(1'b0),
+        .rd_rsp_orig(64'd0),
+        .rd_rsp_sl(8'd0),
+        .read_done(read_done),
+        .atomic_done(1'b0),
+        .atomic_orig(64'd0),
+        .retry_timeout(retry_timeout),
+        .retry_limit(retry_limit),
+        .ack_rcvd(ack_rcvd),
+        .ack_rcvd_dest_qp(ack_rcvd_dest_qp),
+        .ack_rcvd_psn(ack_rcvd_psn),
+        .ack_rcvd_syndrome(ack_rcvd_syndrome),
+        .ack_tx_valid(1'b0),
+        .ack_tx_ready(),
+        .ack_tx_dest_qp(24'd0),
+        .ack_tx_psn(24'd0),
+        .ack_tx_syndrome(8'd0),
+        .rate_cfg(32'd0),
+        .rate_cfg_wr(1'b0),
+        .cc_enable(1'b0),
+        .cnp_rcvd(1'b0),
+        .cnp_rcvd_dest_qp(24'd0),
+        .cnp_tx_valid(1'b0),
+        .cnp_tx_ready(),
+        .cnp_tx_dest_qp(24'd0),
+        .tc_map(tc_map),
+        .tc_weight(tc_weight),
+        .tc_wrr(tc_wrr),
         .tx_cmd_opcode(tx_cmd_opcode),
         .tx_cmd_dest_qp(tx_cmd_dest_qp),
+        .tx_cmd_qp_handle(tx_cmd_dest_qp[7:0]),
         .tx_cmd_remote_addr(tx_cmd_remote_addr),
         .tx_cmd_rkey(tx_cmd_rkey),
         .tx_cmd_partition_key(tx_cmd_partition_key),
         .tx_cmd_service_level(tx_cmd_service_level),
-        .tx_cmd_psn(tx_cmd_psn),
         
         // Completion Interface
         .tx_cpl_valid(tx_cpl_valid),
@@ -171,6 +282,7 @@ module tb_tx_path();
         .tx_cpl_sq_index(tx_cpl_sq_index),
         .tx_cpl_status(tx_cpl_status),
         .tx_cpl_bytes_sent(tx_cpl_bytes_sent),
+        .tx_cpl_atomic_orig(),
         
         // Header Inserter Interface
         .hdr_start_tx(hdr_start_tx),
@@ -187,6 +299,14 @@ module tb_tx_path();
         .hdr_fragment_id(hdr_fragment_id),
         .hdr_more_fragments(hdr_more_fragments),
         .hdr_fragment_offset(hdr_fragment_offset),
+        .hdr_header_only(hdr_header_only),
+        .hdr_read_sink_addr(hdr_read_sink_addr),
+        .hdr_read_sink_rkey(hdr_read_sink_rkey),
+        .hdr_imm(hdr_imm),
+        .hdr_atomic_data(hdr_atomic_data),
+        .hdr_atomic_compare(hdr_atomic_compare),
+        .hdr_dst_ip(),
+        .hdr_udp_ports(),
         
         // MM2S Command Interface
         .m_axis_mm2s_cmd_tdata(m_axis_mm2s_cmd_tdata),
@@ -194,7 +314,18 @@ module tb_tx_path();
         .m_axis_mm2s_cmd_tready(m_axis_mm2s_cmd_tready),
         
         // MM2S Status
-        .mm2s_rd_xfer_cmplt(mm2s_rd_xfer_cmplt)
+        .mm2s_rd_xfer_cmplt(mm2s_rd_xfer_cmplt),
+        
+        // No local copy / fill or multicast jobs in this test
+        .m_axis_s2mm_cmd_tdata(),
+        .m_axis_s2mm_cmd_tvalid(),
+        .m_axis_s2mm_cmd_tready(1'b1),
+        .s2mm_wr_xfer_cmplt(1'b0),
+        .local_copy_en(),
+        .local_fill_start(),
+        .local_fill_len(),
+        .local_fill_pattern(),
+        .mc_replay_start()
     );
     
     //========================================================================
@@ -243,7 +374,13 @@ module tb_tx_path();
         .rdma_service_level(hdr_rdma_service_level),
         .fragment_id(hdr_fragment_id),
         .more_fragments(hdr_more_fragments),
-        .fragment_offset(hdr_fragment_offset)
+        .fragment_offset(hdr_fragment_offset),
+        .header_only(hdr_header_only),
+        .read_sink_addr(hdr_read_sink_addr),
+        .read_sink_rkey(hdr_read_sink_rkey),
+        .rdma_imm(hdr_imm),
+        .atomic_data(hdr_atomic_data),
+        .atomic_compare(hdr_atomic_compare)
     );
     
     //========================================================================
@@ -266,10 +403,15 @@ module tb_tx_path();
                 dm_delay_counter <= 0;
                 // Extract BTT from command
                 dm_bytes_remaining <= m_axis_mm2s_cmd_tdata[22:0];
-                // Extract address
-                dm_current_addr <= m_axis_mm2s_cmd_tdata[62:31];
+                // Extract address (above DRR / EOF / DSA / Type / BTT)
+                dm_current_addr <= m_axis_mm2s_cmd_tdata[63:32];
+                if (mm2s_log_cnt < 32) begin
+                    mm2s_log_addr[mm2s_log_cnt] = m_axis_mm2s_cmd_tdata[63:32];
+                    mm2s_log_btt[mm2s_log_cnt]  = m_axis_mm2s_cmd_tdata[22:0];
+                end
+                mm2s_log_cnt = mm2s_log_cnt + 1;
                 $display("[%0t] Data Mover: Accepted MM2S command - Addr=0x%08h, BTT=%0d", 
-                         $time, m_axis_mm2s_cmd_tdata[62:31], m_axis_mm2s_cmd_tdata[22:0]);
+                         $time, m_axis_mm2s_cmd_tdata[63:32], m_axis_mm2s_cmd_tdata[22:0]);
             end
             
             // Simulate transfer delay (5 cycles)
@@ -292,8 +434,8 @@ module tb_tx_path();
     //========================================================================
     // Mock Data Stream Generator
     //========================================================================
-    // Generate AXI-Stream data after MM2S command accepted
-    reg [7:0] data_beat_count;
+    // Stream the BTT of each accepted MM2S command as 32-bit beats, TLAST on the last
+    reg [C_BTT_WIDTH-1:0] data_beats_left;
     reg [31:0] data_pattern;
     
     always @(posedge aclk) begin
@@ -302,29 +444,28 @@ module tb_tx_path();
             s_axis_tdata <= 0;
             s_axis_tkeep <= 0;
             s_axis_tlast <= 0;
-            data_beat_count <= 0;
+            data_beats_left <= 0;
             data_pattern <= 32'hDEAD0000;
         end else begin
-            // Start streaming when transfer active and header inserter ready
-            if (dm_transfer_active && s_axis_tready && dm_delay_counter >= 2) begin
+            if (m_axis_mm2s_cmd_tvalid && m_axis_mm2s_cmd_tready && !dm_transfer_active) begin
+                // First beat of the new transfer
                 s_axis_tvalid <= 1;
                 s_axis_tdata <= data_pattern;
                 s_axis_tkeep <= 4'hF;
+                s_axis_tlast <= (m_axis_mm2s_cmd_tdata[22:0] <= 4);
+                data_beats_left <= (m_axis_mm2s_cmd_tdata[22:0] + 3) >> 2;
                 data_pattern <= data_pattern + 1;
-                data_beat_count <= data_beat_count + 1;
-                
-                // Calculate if this is the last beat (simplified: 16 beats = 64 bytes)
-                if (data_beat_count >= (dm_bytes_remaining[31:2] - 1)) begin
-                    s_axis_tlast <= 1;
-                    data_beat_count <= 0;
-                end else begin
+            end else if (s_axis_tvalid && s_axis_tready) begin
+                if (s_axis_tlast) begin
+                    // Reset after last beat transferred
+                    s_axis_tvalid <= 0;
                     s_axis_tlast <= 0;
+                end else begin
+                    s_axis_tdata <= data_pattern;
+                    data_pattern <= data_pattern + 1;
+                    s_axis_tlast <= (data_beats_left == 2);
+                    data_beats_left <= data_beats_left - 1;
                 end
-            end else if (s_axis_tlast && s_axis_tvalid && s_axis_tready) begin
-                // Reset after last beat transferred
-                s_axis_tvalid <= 0;
-                s_axis_tlast <= 0;
-                data_beat_count <= 0;
             end
         end
     end
@@ -347,6 +488,54 @@ module tb_tx_path();
         end
     end
     
+    //========================================================================
+    // Header / Completion Monitor
+    //========================================================================
+    // Record the fields of every packet the streamer starts, count completions
+    always @(posedge aclk) begin
+        if (aresetn && hdr_start_tx) begin
+            if (hdr_log_cnt < 32) begin
+                hdr_log_opcode[hdr_log_cnt] = hdr_rdma_opcode;
+                hdr_log_psn[hdr_log_cnt]    = hdr_rdma_psn;
+                hdr_log_qp[hdr_log_cnt]     = hdr_rdma_dest_qp;
+                hdr_log_raddr[hdr_log_cnt]  = hdr_rdma_remote_addr;
+                hdr_log_length[hdr_log_cnt] = hdr_rdma_length;
+            end
+            hdr_log_cnt = hdr_log_cnt + 1;
+            $display("[%0t] Header: Opcode=0x%02h, PSN=%0d, QP=0x%06h, RADDR=0x%016h, LEN=%0d",
+                     $time, hdr_rdma_opcode, hdr_rdma_psn, hdr_rdma_dest_qp, hdr_rdma_remote_addr, hdr_rdma_length);
+        end
+        if (aresetn && tx_cpl_valid && tx_cpl_ready) begin
+            cpl_log_cnt = cpl_log_cnt + 1;
+        end
+    end
+    
+    //========================================================================
+    // Mock READ Responder
+    //========================================================================
+    // Reports the READ response as received a while after each READ request
+    // header, standing in for the RX path's read_done
+    reg [7:0] rd_rsp_delay;
+    
+    always @(posedge aclk) begin
+        if (!aresetn) begin
+            read_done <= 0;
+            rd_rsp_delay <= 0;
+        end else begin
+            read_done <= 0;  // Pulse signal
+            
+            if (hdr_start_tx && hdr_rdma_opcode == 8'h0C) begin
+                rd_rsp_delay <= 8'd200;
+            end else if (rd_rsp_delay > 0) begin
+                rd_rsp_delay <= rd_rsp_delay - 1;
+                if (rd_rsp_delay == 1) begin
+                    read_done <= 1;
+                    $display("[%0t] READ Responder: Response received", $time);
+                end
+            end
+        end
+    end
+    
     //========================================================================
     // Task: Send Command
     //========================================================================
@@ -370,11 +559,11 @@ module tb_tx_path();
         tx_cmd_remote_addr <= remote_addr;
         tx_cmd_rkey <= rkey;
         tx_cmd_partition_key <= 16'hFFFF;
-        tx_cmd_service_level <= 8'h00;
-        tx_cmd_psn <= 24'h000001;
+        tx_cmd_service_level <= cmd_sl;
         
-        wait(tx_cmd_ready);
+        // Held until the streamer takes it (ready sampled at the clock edge)
         @(posedge aclk);
+        while (!tx_cmd_ready) @(posedge aclk);
         tx_cmd_valid <= 0;
         $display("[%0t] Command sent: SQ_IDX=%0d, ADDR=0x%08h, LEN=%0d", 
                  $time, sq_idx, ddr_addr, length);
@@ -386,10 +575,103 @@ module tb_tx_path();
     //========================================================================
     task wait_completion();
     begin
-        wait(tx_cpl_valid);
+        // tx_cpl_ready is held high: the completion is taken at the first edge with valid
         @(posedge aclk);
+        while (!tx_cpl_valid) @(posedge aclk);
+        cpl_sq_index = tx_cpl_sq_index;
+        cpl_status   = tx_cpl_status;
+        cpl_bytes    = tx_cpl_bytes_sent;
         $display("[%0t] Completion: SQ_IDX=%0d, Status=0x%02h, Bytes=%0d", 
-                 $time, tx_cpl_sq_index, tx_cpl_status, tx_cpl_bytes_sent);
+                 $time, cpl_sq_index, cpl_status, cpl_bytes);
+    end
+    endtask
+    
+    //========================================================================
+    // Task: Check Completion
+    //========================================================================
+    task check_completion(
+        input [SQ_INDEX_WIDTH-1:0] sq_idx,
+        input [7:0] status,
+        input [RDMA_LENGTH_WIDTH-1:0] bytes
+    );
+    begin
+        if (cpl_sq_index !== sq_idx || cpl_status !== status || cpl_bytes !== bytes) begin
+            $display("ERROR: Completion SQ_IDX=%0d Status=0x%02h Bytes=%0d, expected SQ_IDX=%0d Status=0x%02h Bytes=%0d",
+                     cpl_sq_index, cpl_status, cpl_bytes, sq_idx, status, bytes);
+            errors = errors + 1;
+        end
+    end
+    endtask
+    
+    //========================================================================
+    // Task: Check MM2S Command / Packet Header
+    //========================================================================
+    task check_mm2s(
+        input integer idx,
+        input [C_ADDR_WIDTH-1:0] addr,
+        input [C_BTT_WIDTH-1:0] btt
+    );
+    begin
+        if (idx >= mm2s_log_cnt) begin
+            $display("ERROR: MM2S command %0d missing (%0d seen)", idx, mm2s_log_cnt);
+            errors = errors + 1;
+        end else if (mm2s_log_addr[idx] !== addr || mm2s_log_btt[idx] !== btt) begin
+            $display("ERROR: MM2S command %0d Addr=0x%08h BTT=%0d, expected Addr=0x%08h BTT=%0d",
+                     idx, mm2s_log_addr[idx], mm2s_log_btt[idx], addr, btt);
+            errors = errors + 1;
+        end
+    end
+    endtask
+    
+    task check_header(
+        input integer idx,
+        input [RDMA_PSN_WIDTH-1:0] psn,
+        input [RDMA_QPN_WIDTH-1:0] qp,
+        input [RDMA_ADDR_WIDTH-1:0] raddr,
+        input [RDMA_LENGTH_WIDTH-1:0] length
+    );
+    begin
+        if (idx >= hdr_log_cnt) begin
+            $display("ERROR: Header %0d missing (%0d seen)", idx, hdr_log_cnt);
+            errors = errors + 1;
+        end else if (hdr_log_psn[idx] !== psn || hdr_log_qp[idx] !== qp ||
+                     hdr_log_raddr[idx] !== raddr || hdr_log_length[idx] !== length) begin
+            $display("ERROR: Header %0d PSN=%0d QP=0x%06h RADDR=0x%016h LEN=%0d, expected PSN=%0d QP=0x%06h RADDR=0x%016h LEN=%0d",
+                     idx, hdr_log_psn[idx], hdr_log_qp[idx], hdr_log_raddr[idx], hdr_log_length[idx],
+                     psn, qp, raddr, length);
+            errors = errors + 1;
+        end
+    end
+    endtask
+    
+    //========================================================================
+    // Task: Receive ACK / NAK
+    //========================================================================
+    // One-cycle ack_rcvd pulse, as from rx_streamer. Syndrome [7:5]: 000 ACK, 011 NAK.
+    task send_ack(
+        input [RDMA_QPN_WIDTH-1:0] qp,
+        input [RDMA_PSN_WIDTH-1:0] psn,
+        input [7:0] syndrome
+    );
+    begin
+        @(posedge aclk);
+        ack_rcvd <= 1;
+        ack_rcvd_dest_qp <= qp;
+        ack_rcvd_psn <= psn;
+        ack_rcvd_syndrome <= syndrome;
+        @(posedge aclk);
+        ack_rcvd <= 0;
+        $display("[%0t] ACK received: QP=0x%06h, PSN=%0d, Syndrome=0x%02h", $time, qp, psn, syndrome);
+    end
+    endtask
+    
+    task clear_logs();
+    begin
+        mm2s_log_cnt = 0;
+        hdr_log_cnt = 0;
+        cpl_log_cnt = 0;
+        header_beats_received = 0;
+        data_beats_received = 0;
     end
     endtask
     
@@ -400,6 +682,23 @@ module tb_tx_path();
         // Initialize
         aresetn = 0;
         tx_cmd_valid = 0;
+        tx_cmd_sg1_addr = 0;
+        tx_cmd_sg1_length = 0;
+        tx_cmd_sg2_addr = 0;
+        tx_cmd_sg2_length = 0;
+        tx_cmd_row_count = 16'd1;
+        tx_cmd_src_stride = 0;
+        tx_cmd_dst_stride = 0;
+        retry_timeout = 0;          // Unreliable until test 7
+        retry_limit = 0;
+        ack_rcvd = 0;
+        ack_rcvd_dest_qp = 0;
+        ack_rcvd_psn = 0;
+        ack_rcvd_syndrome = 0;
+        tc_map = 0;                 // Single class until test 11
+        tc_weight = 0;
+        tc_wrr = 0;
+        cmd_sl = 0;
         tx_cpl_ready = 1;
         m_axis_tready = 1;  // Always ready to receive output
         
@@ -407,6 +706,10 @@ module tb_tx_path();
         header_beats_received = 0;
         data_beats_received = 0;
         total_beats_received = 0;
+        errors = 0;
+        mm2s_log_cnt = 0;
+        hdr_log_cnt = 0;
+        cpl_log_cnt = 0;
         
         // Reset
         repeat(10) @(posedge aclk);
@@ -459,11 +762,11 @@ module tb_tx_path();
         repeat(20) @(posedge aclk);
         
         //====================================================================
-        // Test 4: Small Transfer (256 bytes)
+        // Test 4: Small READ (256 bytes, answered by the mock responder)
         //====================================================================
         test_num = 4;
         $display("\n========================================");
-        $display("Test %0d: Small Transfer (256B)", test_num);
+        $display("Test %0d: Small READ (256B)", test_num);
         $display("========================================");
         header_beats_received = 0;
         data_beats_received = 0;
@@ -473,11 +776,290 @@ module tb_tx_path();
         wait_completion();
         repeat(20) @(posedge aclk);
         
+        //====================================================================
+        // Test 5: Gather list, 1KB + 768B (crossing 4KB) + 512B
+        //====================================================================
+        test_num = 5;
+        $display("\n========================================");
+        $display("Test %0d: Three-Segment Gather List", test_num);
+        $display("========================================");
+        clear_logs();
+        
+        // Segment 1 starts 256B below a 4KB boundary: two MM2S commands
+        tx_cmd_sg1_addr = 32'h4100_0F00;
+        tx_cmd_sg1_length = 32'd768;
+        tx_cmd_sg2_addr = 32'h4200_0000;
+        tx_cmd_sg2_length = 32'd512;
+        send_command(8'd5, 32'h4000_0000, 32'd1024, 8'h0A, 24'h123456, 64'h0000_0001_0000_0000, 32'h0505_0505);
+        
+        wait_completion();
+        tx_cmd_sg1_length = 0;
+        tx_cmd_sg2_length = 0;
+        check_completion(8'd5, 8'h00, 32'd2304);
+        if (mm2s_log_cnt != 4 || hdr_log_cnt != 4) begin
+            $display("ERROR: %0d MM2S commands / %0d headers, expected 4 / 4", mm2s_log_cnt, hdr_log_cnt);
+            errors = errors + 1;
+        end
+        check_mm2s(0, 32'h4000_0000, 23'd1024);
+        check_mm2s(1, 32'h4100_0F00, 23'd256);
+        check_mm2s(2, 32'h4100_1000, 23'd512);
+        check_mm2s(3, 32'h4200_0000, 23'd512);
+        // One message: consecutive PSNs, contiguous remote addresses
+        check_header(0, hdr_log_psn[0],     24'h123456, 64'h0000_0001_0000_0000, 32'd1024);
+        check_header(1, hdr_log_psn[0] + 1, 24'h123456, 64'h0000_0001_0000_0400, 32'd256);
+        check_header(2, hdr_log_psn[0] + 2, 24'h123456, 64'h0000_0001_0000_0500, 32'd512);
+        check_header(3, hdr_log_psn[0] + 3, 24'h123456, 64'h0000_0001_0000_0700, 32'd512);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 6: Strided 2D transfer, 3 rows of 1KB
+        //====================================================================
+        test_num = 6;
+        $display("\n========================================");
+        $display("Test %0d: Strided Transfer (3 x 1KB)", test_num);
+        $display("========================================");
+        clear_logs();
+        
+        // Source pitch 0x900, destination pitch 0x1000. Row 0 starts 512B below a
+        // 4KB boundary (two MM2S commands), rows 1 and 2 fit in one page each.
+        tx_cmd_row_count = 16'd3;
+        tx_cmd_src_stride = 32'h0000_0900;
+        tx_cmd_dst_stride = 32'h0000_1000;
+        send_command(8'd6, 32'h5000_0E00, 32'd1024, 8'h0A, 24'h123456, 64'h0000_0002_0000_0000, 32'h0606_0606);
+        
+        wait_completion();
+        tx_cmd_row_count = 16'd1;
+        tx_cmd_src_stride = 0;
+        tx_cmd_dst_stride = 0;
+        check_completion(8'd6, 8'h00, 32'd3072);
+        if (mm2s_log_cnt != 4 || hdr_log_cnt != 4) begin
+            $display("ERROR: %0d MM2S commands / %0d headers, expected 4 / 4", mm2s_log_cnt, hdr_log_cnt);
+            errors = errors + 1;
+        end
+        check_mm2s(0, 32'h5000_0E00, 23'd512);
+        check_mm2s(1, 32'h5000_1000, 23'd512);
+        check_mm2s(2, 32'h5000_1700, 23'd1024);
+        check_mm2s(3, 32'h5000_2000, 23'd1024);
+        // Each row starts at its own strided remote address
+        check_header(0, hdr_log_psn[0],     24'h123456, 64'h0000_0002_0000_0000, 32'd512);
+        check_header(1, hdr_log_psn[0] + 1, 24'h123456, 64'h0000_0002_0000_0200, 32'd512);
+        check_header(2, hdr_log_psn[0] + 2, 24'h123456, 64'h0000_0002_0000_1000, 32'd1024);
+        check_header(3, hdr_log_psn[0] + 3, 24'h123456, 64'h0000_0002_0000_2000, 32'd1024);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 7: Reliable WQEs, PSN assignment and a cumulative ACK
+        //====================================================================
+        test_num = 7;
+        $display("\n========================================");
+        $display("Test %0d: Reliable WRITEs, One Cumulative ACK", test_num);
+        $display("========================================");
+        clear_logs();
+        retry_timeout = 32'd50000;
+        retry_limit = 3'd2;
+        
+        // 8KB (PSN p, p+1) and 4KB (PSN p+2) to the same QP share the ACK window
+        send_command(8'd7, 32'h6000_0000, 32'd8192, 8'h0A, 24'hABCDEF, 64'h0000_0003_0000_0000, 32'h0707_0707);
+        send_command(8'd8, 32'h6100_0000, 32'd4096, 8'h0A, 24'hABCDEF, 64'h0000_0003_0001_0000, 32'h0707_0707);
+        wait (dut_streamer.win_cnt_reg == 2);
+        repeat(100) @(posedge aclk);
+        if (cpl_log_cnt != 0) begin
+            $display("ERROR: %0d completions before any ACK", cpl_log_cnt);
+            errors = errors + 1;
+        end
+        check_header(0, hdr_log_psn[0],     24'hABCDEF, 64'h0000_0003_0000_0000, 32'd4096);
+        check_header(1, hdr_log_psn[0] + 1, 24'hABCDEF, 64'h0000_0003_0000_1000, 32'd4096);
+        check_header(2, hdr_log_psn[0] + 2, 24'hABCDEF, 64'h0000_0003_0001_0000, 32'd4096);
+        
+        // The ACK of the last PSN covers both WQEs, completed in order
+        send_ack(24'hABCDEF, hdr_log_psn[0] + 2, 8'h00);
+        wait_completion();
+        check_completion(8'd7, 8'h00, 32'd8192);
+        wait_completion();
+        check_completion(8'd8, 8'h00, 32'd4096);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 8: NAK, Go-Back-N from the NAKed PSN
+        //====================================================================
+        test_num = 8;
+        $display("\n========================================");
+        $display("Test %0d: NAK and Go-Back-N", test_num);
+        $display("========================================");
+        clear_logs();
+        
+        send_command(8'd9, 32'h6200_0000, 32'd12288, 8'h0A, 24'hABCDEF, 64'h0000_0003_0002_0000, 32'h0808_0808);
+        wait (dut_streamer.win_cnt_reg == 1);
+        
+        // PSN sequence error at the second packet: resend PSN q+1 and q+2 only
+        send_ack(24'hABCDEF, hdr_log_psn[0] + 1, 8'h60);
+        wait (hdr_log_cnt == 5);
+        wait (!dut_streamer.replay_reg);
+        if (hdr_log_cnt != 5 || mm2s_log_cnt != 5) begin
+            $display("ERROR: %0d headers / %0d MM2S commands, expected 5 / 5", hdr_log_cnt, mm2s_log_cnt);
+            errors = errors + 1;
+        end
+        check_header(0, hdr_log_psn[0],     24'hABCDEF, 64'h0000_0003_0002_0000, 32'd4096);
+        check_header(1, hdr_log_psn[0] + 1, 24'hABCDEF, 64'h0000_0003_0002_1000, 32'd4096);
+        check_header(2, hdr_log_psn[0] + 2, 24'hABCDEF, 64'h0000_0003_0002_2000, 32'd4096);
+        check_header(3, hdr_log_psn[0] + 1, 24'hABCDEF, 64'h0000_0003_0002_1000, 32'd4096);
+        check_header(4, hdr_log_psn[0] + 2, 24'hABCDEF, 64'h0000_0003_0002_2000, 32'd4096);
+        check_mm2s(3, 32'h6200_1000, 23'd4096);
+        check_mm2s(4, 32'h6200_2000, 23'd4096);
+        if (cpl_log_cnt != 0) begin
+            $display("ERROR: Completion before the retransmission was ACKed");
+            errors = errors + 1;
+        end
+        
+        send_ack(24'hABCDEF, hdr_log_psn[0] + 2, 8'h00);
+        wait_completion();
+        check_completion(8'd9, 8'h00, 32'd12288);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 9: ACK timeout, retransmission
+        //====================================================================
+        test_num = 9;
+        $display("\n========================================");
+        $display("Test %0d: ACK Timeout and Retransmission", test_num);
+        $display("========================================");
+        clear_logs();
+        retry_timeout = 32'd3000;
+        
+        send_command(8'd10, 32'h6300_0000, 32'd256, 8'h0A, 24'hABCDEF, 64'h0000_0003_0003_0000, 32'h0909_0909);
+        wait (hdr_log_cnt == 2);
+        wait (!dut_streamer.replay_reg);
+        check_header(1, hdr_log_psn[0], 24'hABCDEF, 64'h0000_0003_0003_0000, 32'd256);
+        
+        send_ack(24'hABCDEF, hdr_log_psn[0], 8'h00);
+        wait_completion();
+        check_completion(8'd10, 8'h00, 32'd256);
+        if (hdr_log_cnt != 2) begin
+            $display("ERROR: %0d transmissions, expected 2", hdr_log_cnt);
+            errors = errors + 1;
+        end
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 10: Retry exhaustion
+        //====================================================================
+        test_num = 10;
+        $display("\n========================================");
+        $display("Test %0d: Retry Exhaustion", test_num);
+        $display("========================================");
+        clear_logs();
+        retry_limit = 3'd1;
+        
+        // No ACK: first pass, one retransmission, then CPL_ST_RETRY_EXC
+        send_command(8'd11, 32'h6400_0000, 32'd256, 8'h0A, 24'hABCDEF, 64'h0000_0003_0004_0000, 32'h0A0A_0A0A);
+        wait_completion();
+        check_completion(8'd11, 8'h01, 32'd256);
+        if (hdr_log_cnt != 2) begin
+            $display("ERROR: %0d transmissions, expected 2", hdr_log_cnt);
+            errors = errors + 1;
+        end
+        check_header(1, hdr_log_psn[0], 24'hABCDEF, 64'h0000_0003_0004_0000, 32'd256);
+        
+        // The responder never saw the PSN: the next WQE on the QP sends it again
+        retry_timeout = 0;
+        retry_limit = 0;
+        send_command(8'd12, 32'h6500_0000, 32'd256, 8'h0A, 24'hABCDEF, 64'h0000_0003_0005_0000, 32'h0A0A_0A0A);
+        wait_completion();
+        check_completion(8'd12, 8'h00, 32'd256);
+        check_header(2, hdr_log_psn[0], 24'hABCDEF, 64'h0000_0003_0005_0000, 32'd256);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 11: Strict priority preemption and resume
+        //====================================================================
+        test_num = 11;
+        $display("\n========================================");
+        $display("Test %0d: Strict Priority Preemption", test_num);
+        $display("========================================");
+        clear_logs();
+        tc_map = 32'h0000_000C;     // SL0 -> class 0 (bulk), SL1 -> class 3 (urgent)
+        
+        // Bulk 16KB on QP 0x123456; the urgent 4KB WQE on QP 0x654321 arrives during its first fragment
+        cmd_sl = 8'd0;
+        send_command(8'd13, 32'h7000_0000, 32'd16384, 8'h0A, 24'h123456, 64'h0000_0004_0000_0000, 32'h0B0B_0B0B);
+        wait (hdr_log_cnt == 1);
+        cmd_sl = 8'd1;
+        send_command(8'd14, 32'h7100_0000, 32'd4096, 8'h0A, 24'h654321, 64'h0000_0004_1000_0000, 32'h0B0B_0B0B);
+        cmd_sl = 8'd0;
+        
+        wait_completion();
+        check_completion(8'd14, 8'h00, 32'd4096);
+        wait_completion();
+        check_completion(8'd13, 8'h00, 32'd16384);
+        if (hdr_log_cnt != 5 || mm2s_log_cnt != 5) begin
+            $display("ERROR: %0d headers / %0d MM2S commands, expected 5 / 5", hdr_log_cnt, mm2s_log_cnt);
+            errors = errors + 1;
+        end
+        // Bulk resumes from the context bank: next fragment, PSN and remote address
+        check_header(0, hdr_log_psn[0],     24'h123456, 64'h0000_0004_0000_0000, 32'd4096);
+        check_header(1, hdr_log_psn[1],     24'h654321, 64'h0000_0004_1000_0000, 32'd4096);
+        check_header(2, hdr_log_psn[0] + 1, 24'h123456, 64'h0000_0004_0000_1000, 32'd4096);
+        check_header(3, hdr_log_psn[0] + 2, 24'h123456, 64'h0000_0004_0000_2000, 32'd4096);
+        check_header(4, hdr_log_psn[0] + 3, 24'h123456, 64'h0000_0004_0000_3000, 32'd4096);
+        check_mm2s(0, 32'h7000_0000, 23'd4096);
+        check_mm2s(1, 32'h7100_0000, 23'd4096);
+        check_mm2s(2, 32'h7000_1000, 23'd4096);
+        check_mm2s(3, 32'h7000_2000, 23'd4096);
+        check_mm2s(4, 32'h7000_3000, 23'd4096);
+        repeat(20) @(posedge aclk);
+        
+        //====================================================================
+        // Test 12: Weighted round robin between two classes
+        //====================================================================
+        test_num = 12;
+        $display("\n========================================");
+        $display("Test %0d: WRR Preemption", test_num);
+        $display("========================================");
+        clear_logs();
+        tc_wrr = 1;
+        tc_weight = 32'h0100_0002;  // Class 0: 2 fragments per turn, class 3: 1
+        
+        // Bulk 16KB, then urgent 8KB: B0 B1 U0 B2 B3 U1
+        cmd_sl = 8'd0;
+        send_command(8'd15, 32'h7200_0000, 32'd16384, 8'h0A, 24'h123456, 64'h0000_0004_2000_0000, 32'h0C0C_0C0C);
+        wait (hdr_log_cnt == 1);
+        cmd_sl = 8'd1;
+        send_command(8'd16, 32'h7300_0000, 32'd8192, 8'h0A, 24'h654321, 64'h0000_0004_3000_0000, 32'h0C0C_0C0C);
+        cmd_sl = 8'd0;
+        
+        wait_completion();
+        check_completion(8'd15, 8'h00, 32'd16384);
+        wait_completion();
+        check_completion(8'd16, 8'h00, 32'd8192);
+        if (hdr_log_cnt != 6 || mm2s_log_cnt != 6) begin
+            $display("ERROR: %0d headers / %0d MM2S commands, expected 6 / 6", hdr_log_cnt, mm2s_log_cnt);
+            errors = errors + 1;
+        end
+        check_header(0, hdr_log_psn[0],     24'h123456, 64'h0000_0004_2000_0000, 32'd4096);
+        check_header(1, hdr_log_psn[0] + 1, 24'h123456, 64'h0000_0004_2000_1000, 32'd4096);
+        check_header(2, hdr_log_psn[2],     24'h654321, 64'h0000_0004_3000_0000, 32'd4096);
+        check_header(3, hdr_log_psn[0] + 2, 24'h123456, 64'h0000_0004_2000_2000, 32'd4096);
+        check_header(4, hdr_log_psn[0] + 3, 24'h123456, 64'h0000_0004_2000_3000, 32'd4096);
+        check_header(5, hdr_log_psn[2] + 1, 24'h654321, 64'h0000_0004_3000_1000, 32'd4096);
+        check_mm2s(0, 32'h7200_0000, 23'd4096);
+        check_mm2s(1, 32'h7200_1000, 23'd4096);
+        check_mm2s(2, 32'h7300_0000, 23'd4096);
+        check_mm2s(3, 32'h7200_2000, 23'd4096);
+        check_mm2s(4, 32'h7200_3000, 23'd4096);
+        check_mm2s(5, 32'h7300_1000, 23'd4096);
+        tc_map = 0;
+        tc_weight = 0;
+        tc_wrr = 0;
+        repeat(20) @(posedge aclk);
+        
         //====================================================================
         // Test Complete
         //====================================================================
         $display("\n========================================");
-        $display("All Tests Complete!");
+        if (errors == 0)
+            $display("All Tests Complete!");
+        else
+            $display("Tests Complete: %0d ERRORS", errors);
         $display("========================================");
         repeat(50) @(posedge aclk);
         $finish;
@@ -487,7 +1069,7 @@ module tb_tx_path();
     // Timeout Watchdog
     //========================================================================
     initial begin
-        #1000000;  // 1ms timeout
+        #5000000;  // 5ms timeout
         $display("ERROR: Simulation timeout!");
         $finish;
     end